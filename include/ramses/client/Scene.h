@@ -211,6 +211,18 @@ namespace ramses
         */
         bool destroy(SceneObject& object);
 
+        /**
+        * @brief Destroys a node together with all its descendants.
+        * The result is the same as destroying all nodes of the subtree one by one using #destroy,
+        * but cost grows linearly with the size of the subtree, which makes it suitable for tearing down
+        * large hierarchies. If any camera in the subtree is still assigned to a render pass
+        * nothing is destroyed and the call fails.
+        *
+        * @param rootNode The root node of the subtree to destroy, must be owned by this scene
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool destroySubtree(Node& rootNode);
+
         /**
          * @brief   Expiration timestamp is a point in time till which the scene is considered to be up-to-date.
          * @details Logic on renderer side will check the time every frame and in case it detects the scene
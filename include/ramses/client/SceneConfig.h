@@ -74,6 +74,32 @@ namespace ramses
          */
         void setMemoryVerificationEnabled(bool enabled);
 
+        /**
+         * Scenes with publication mode #ramses::EScenePublicationMode::LocalAndRemote by default keep a complete copy of the scene
+         * as it was at the last flush and apply every flush to it, so that a renderer subscribing to the scene later can be sent
+         * the scene immediately. For large scenes this doubles the memory used by the scene and the time spent in #ramses::Scene::flush.
+         *
+         * When disabled, no copy of the scene is kept between flushes. A newly subscribed renderer is sent the scene as it is
+         * right after the next #ramses::Scene::flush instead, i.e. the renderer receives the scene only once the application
+         * flushes again. The scene is described only for such a flush and sent to all renderers subscribed since the previous one.
+         * Scenes with publication mode #ramses::EScenePublicationMode::LocalOnly never keep a copy.
+         *
+         * @param enabled flag to enable (default) or disable the copy of the scene kept for new subscribers
+         */
+        void setShadowCopyEnabled(bool enabled);
+
+        /**
+         * By default #ramses::Scene::validate (and saving the scene with validation enabled) runs the checks of all scene objects.
+         * When enabled, results of the checks are kept and reused by following validations for objects which were not modified
+         * since, only modified objects and objects depending on them are checked again. Creating or destroying any scene object
+         * discards all kept results. The resulting report is the same as without incremental validation.
+         *
+         * This is useful for large scenes which are validated repeatedly while only a small part of the scene changes in between.
+         *
+         * @param enabled flag to enable or disable (default) incremental validation
+         */
+        void setIncrementalValidationEnabled(bool enabled);
+
         /**
          * @brief Copy constructor
          * @param other source to copy from
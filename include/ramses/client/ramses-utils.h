@@ -17,6 +17,8 @@
 #include <vector>
 #include <string>
 #include <string_view>
+#include <future>
+#include <cstddef>
 
 /**
  * @defgroup UtilsAPI The Ramses Utils API
@@ -35,6 +37,21 @@ namespace ramses
     struct MipLevelData;
     struct CubeMipLevelData;
 
+    /**
+     * @ingroup UtilsAPI
+     * @brief RGBA8 image decoded by RamsesUtils::DecodePngAsync or RamsesUtils::DecodePngBufferAsync.
+     *        Use RamsesUtils::CreateTextureResourceFromDecodedImage to create a texture from it.
+     */
+    struct DecodedImage
+    {
+        /// Width of the first mip level, 0 if decoding failed
+        uint32_t width = 0u;
+        /// Height of the first mip level, 0 if decoding failed
+        uint32_t height = 0u;
+        /// Data of all mip levels starting with the full resolution one, empty if decoding failed
+        std::vector<std::vector<std::byte>> mipLevels;
+    };
+
     /**
      * @ingroup UtilsAPI
      * @brief Temporary functions for convenience. All of these can be implemented on top
@@ -64,6 +81,61 @@ namespace ramses
         */
         RAMSES_API Texture2D*  CreateTextureResourceFromPngBuffer(const std::vector<uint8_t>& pngData, Scene& scene, const TextureSwizzle& swizzle = {}, std::string_view name = {});
 
+        /**
+        * @brief Decodes the given png file on a worker thread of the client's framework.
+        *        The result can be turned into a texture on the scene thread using #CreateTextureResourceFromDecodedImage.
+        *        Mip levels generated on CPU have to be requested explicitly and are generated only for power of two sizes.
+        *
+        * @param[in] client Client whose framework worker threads are used for decoding
+        * @param[in] pngFilePath Path to the png file to load
+        * @param[in] generateMipMaps Generate all mip levels of the image on the worker thread
+        * @return Future of the decoded image, the image is empty on error
+        */
+        RAMSES_API std::future<DecodedImage> DecodePngAsync(RamsesClient& client, std::string pngFilePath, bool generateMipMaps = false);
+
+        /**
+        * @brief Decodes the given png memory buffer on a worker thread of the client's framework.
+        *        See #DecodePngAsync for details.
+        *
+        * @param[in] client Client whose framework worker threads are used for decoding
+        * @param[in] pngData Buffer with PNG data to load
+        * @param[in] generateMipMaps Generate all mip levels of the image on the worker thread
+        * @return Future of the decoded image, the image is empty on error
+        */
+        RAMSES_API std::future<DecodedImage> DecodePngBufferAsync(RamsesClient& client, std::vector<uint8_t> pngData, bool generateMipMaps = false);
+
+        /**
+        * @brief Creates a Texture from an image decoded by #DecodePngAsync or #DecodePngBufferAsync.
+        *
+        * @param[in] image Decoded image
+        * @param[in] scene Scene the texture object is to be created in
+        * @param[in] swizzle Swizzling of texture color channels
+        * @param[in] name Name for the created texture
+        * @return Created texture object or nullptr on error
+        */
+        RAMSES_API Texture2D*  CreateTextureResourceFromDecodedImage(const DecodedImage& image, Scene& scene, const TextureSwizzle& swizzle = {}, std::string_view name = {});
+
+        /**
+        * @brief Creates Textures from a list of png files. The files are decoded in parallel using the worker threads
+        *        of the client's framework and the calling thread, textures are then created on the calling thread.
+        *
+        * @param[in] pngFilePaths Paths to the png files to load
+        * @param[in] scene Scene the texture objects are to be created in
+        * @param[in] generateMipMaps Generate all mip levels of the images on CPU (only for power of two sizes)
+        * @return Created texture objects in order of the given files, nullptr for each file that failed to load
+        */
+        RAMSES_API std::vector<Texture2D*> CreateTextureResourcesFromPngs(const std::vector<std::string>& pngFilePaths, Scene& scene, bool generateMipMaps = false);
+
+        /**
+        * @brief Creates Textures from a list of png memory buffers. See #CreateTextureResourcesFromPngs for details.
+        *
+        * @param[in] pngBuffers Buffers with PNG data to load
+        * @param[in] scene Scene the texture objects are to be created in
+        * @param[in] generateMipMaps Generate all mip levels of the images on CPU (only for power of two sizes)
+        * @return Created texture objects in order of the given buffers, nullptr for each buffer that failed to load
+        */
+        RAMSES_API std::vector<Texture2D*> CreateTextureResourcesFromPngBuffers(const std::vector<std::vector<uint8_t>>& pngBuffers, Scene& scene, bool generateMipMaps = false);
+
         /**
         * @brief Generate mip maps from original texture 2D data. You obtain ownership of all the
         *        data returned in the mip map data object.
@@ -244,6 +244,62 @@ namespace ramses
         */
         bool setConnectionKeepaliveSettings(std::chrono::milliseconds interval, std::chrono::milliseconds timeout);
 
+        /**
+        * @brief Enables LZ4 compression of scene updates sent over TCP
+        *
+        * Scene action data of a single scene update that is at least the given size gets LZ4 compressed
+        * before being sent to a remote renderer. Compression is only used when the remote participant
+        * announced support for it during connection setup, otherwise data is sent uncompressed.
+        * Resources are always sent compressed and are not affected by this setting.
+        *
+        * Default value is 0 which disables scene action compression.
+        *
+        * @param[in] thresholdBytes minimum size in bytes of scene action data to get compressed, 0 disables compression
+        */
+        void setSceneActionCompressionThresholdForTCPCommunication(uint32_t thresholdBytes);
+
+        /**
+        * @brief Sets the directory used by the shared memory connection system
+        *
+        * Every participant using #ramses::EConnectionSystem::SharedMemory creates a Unix domain socket in this
+        * directory and connects to all other participants found there, so all participants that should see each other
+        * have to use the same directory. It gets created if it does not exist.
+        * Keepalive settings are shared with TCP, see #setConnectionKeepaliveSettings.
+        *
+        * Default value is "/tmp/ramses-shm".
+        *
+        * @param[in] directory path of the socket directory
+        */
+        void setSocketDirectoryForSharedMemoryCommunication(std::string_view directory);
+
+        /**
+        * @brief Sets the size of the shared memory ring buffer used for scene updates
+        *
+        * One ring buffer of this size is allocated per connected participant and direction. Scene updates that do not fit
+        * into the remaining space are sent through the socket instead.
+        *
+        * Default value is 16 MiB.
+        *
+        * @param[in] sizeBytes ring buffer size in bytes, at least 64 KiB
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setRingBufferSizeForSharedMemoryCommunication(uint32_t sizeBytes);
+
+        /**
+        * @brief Enables a local endpoint serving internal statistics in Prometheus text format
+        *
+        * The endpoint answers HTTP GET requests for "/metrics" with framework, client scene and renderer statistics
+        * (message and resource counters, flush counters per scene, frame counts and frame time histograms per display etc.).
+        * It is served on its own thread, collecting the statistics does not block the render or framework threads.
+        * Only available on Linux, see ramses-sdk_ENABLE_METRICS_ENDPOINT.
+        *
+        * By default no endpoint is created.
+        *
+        * @param[in] address either "unix:<absolute path>" for a Unix domain socket or "tcp:<port>" for a TCP port on 127.0.0.1
+        * @return true on success, false if address is invalid or endpoint not supported by this build (error is logged)
+        */
+        bool setMetricsEndpoint(std::string_view address);
+
         /**
          * @brief Copy constructor
          * @param other source to copy from
@@ -259,6 +259,7 @@ namespace ramses
     enum class EConnectionSystem : uint32_t
     {
         TCP,
-        Off
+        Off,
+        SharedMemory, ///< Unix domain sockets and shared memory for participants on the same host, Linux only
     };
 }
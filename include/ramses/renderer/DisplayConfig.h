@@ -351,6 +351,34 @@ namespace ramses
         */
         bool setAsyncEffectUploadEnabled(bool enabled);
 
+        /**
+        * @brief Sets the number of threads used for async effect compile and upload
+        *
+        * @details Each thread creates its own shared context, effects submitted for upload together
+        *          are distributed among all threads and compiled in parallel.
+        *          Only applies if async effect upload is enabled (see #setAsyncEffectUploadEnabled).
+        *          The thread count may not be 0.
+        *
+        * @param[in] threadCount the number of effect upload threads (default: 1)
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setAsyncEffectUploadThreadCount(uint32_t threadCount);
+
+        /**
+        * @brief Enables compilation of effects of scenes which are not mapped yet
+        *
+        * @details If enabled, effects of a scene are compiled by the async effect upload threads
+        *          already while the scene is subscribed but not mapped to this display yet.
+        *          Mapping the scene then only needs to wait for effects which were not compiled yet.
+        *          Effects available in the binary shader cache (#ramses::IBinaryShaderCache) are not prewarmed.
+        *          Prewarmed effects of a scene which never gets mapped are kept until the display is destroyed.
+        *          Only applies if async effect upload is enabled (see #setAsyncEffectUploadEnabled).
+        *
+        * @param[in] enabled Set to true to enable effect prewarming, false to disable it (default: false).
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setEffectPrewarmingEnabled(bool enabled);
+
         /**
          * @brief      Set the name to be used for the embedded compositing
          *             display socket name.
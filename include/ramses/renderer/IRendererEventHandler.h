@@ -138,6 +138,25 @@ namespace ramses
             (void)averageLooptime;
         }
 
+        /**
+        * @brief This method will be called right after #renderThreadLoopTimings for the same measure period and provides
+        *        distribution of loop (frame) times within that period, so that occasional spikes are not hidden by the average.
+        *
+        * Percentiles are computed from a histogram with bucket precision of about 3% of the measured value.
+        *
+        * @param[in] displayId The display the timing information is for
+        * @param[in] percentile50LoopTime Loop time which was not exceeded by 50% of loops within the last measure period (median)
+        * @param[in] percentile90LoopTime Loop time which was not exceeded by 90% of loops within the last measure period
+        * @param[in] percentile99LoopTime Loop time which was not exceeded by 99% of loops within the last measure period
+        */
+        virtual void renderThreadLoopTimingPercentiles(displayId_t displayId, std::chrono::microseconds percentile50LoopTime, std::chrono::microseconds percentile90LoopTime, std::chrono::microseconds percentile99LoopTime)
+        {
+            (void)displayId;
+            (void)percentile50LoopTime;
+            (void)percentile90LoopTime;
+            (void)percentile99LoopTime;
+        }
+
         /**
         * @brief This method will be called after an external buffer is created (or failed to be created) as a result of RamsesRenderer API \c createExternalBuffer call.
         *
@@ -280,6 +299,17 @@ namespace ramses
             (void)averageLooptime;
         }
 
+        /**
+        * @copydoc ramses::IRendererEventHandler::renderThreadLoopTimingPercentiles
+        */
+        void renderThreadLoopTimingPercentiles(displayId_t displayId, std::chrono::microseconds percentile50LoopTime, std::chrono::microseconds percentile90LoopTime, std::chrono::microseconds percentile99LoopTime) override
+        {
+            (void)displayId;
+            (void)percentile50LoopTime;
+            (void)percentile90LoopTime;
+            (void)percentile99LoopTime;
+        }
+
         /**
         * @copydoc ramses::IRendererEventHandler::externalBufferCreated
         */
@@ -13,6 +13,7 @@
 #include "ramses/renderer/RendererConfig.h"
 
 #include <string_view>
+#include <limits>
 
 /**
  * @defgroup RendererAPI The Ramses Renderer API
@@ -146,6 +147,10 @@ namespace ramses
         *
         *          By default sections have infinite time limit, so renderer would not try to interrupt their execution.
         *
+        *          Applying scene actions of flushes is done before uploading scene resources, it is interrupted only for scenes
+        *          which are not shown and not linked to other scenes. A scene with interrupted flush application is shown only after
+        *          all its pending flushes are fully applied, so partially applied flushes are never visible.
+        *
         * !! IMPORTANT !! Scene resource actions can not be interrupted like other resources. Therefore, if this timer is exceeded, a scene will be
         * force-unsubscribed. Use this timer with caution and merely as a sanity check, NOT as a performance measure! Scenes should not be over-using
         * scene resources, precisely because they can not be interrupted.
@@ -153,9 +158,11 @@ namespace ramses
         * @param[in] limitForSceneResourcesUpload  Time limit in microseconds (since beginning of frame) for uploading scene resources to GPU
         * @param[in] limitForClientResourcesUpload Time limit in microseconds (since beginning of frame) for uploading client resources to GPU
         * @param[in] limitForOffscreenBufferRender Time limit in microseconds (since beginning of frame) for rendering scenes that are mapped to interruptible offscreen buffers
+        * @param[in] limitForSceneActionsApply Time limit in microseconds (since beginning of frame) for applying flushes to scenes which are not shown
         * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
         */
-        bool setFrameTimerLimits(uint64_t limitForSceneResourcesUpload, uint64_t limitForClientResourcesUpload, uint64_t limitForOffscreenBufferRender);
+        bool setFrameTimerLimits(uint64_t limitForSceneResourcesUpload, uint64_t limitForClientResourcesUpload, uint64_t limitForOffscreenBufferRender,
+            uint64_t limitForSceneActionsApply = std::numeric_limits<uint64_t>::max());
 
         /**
         * @brief Sets the number of pending flushes accepted before force-applying them to their scene, or forcefully insubscribing the scene.
@@ -104,6 +104,24 @@ namespace ramses
         */
         [[nodiscard]] std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
 
+        /**
+        * @brief   Set how display threads wait between frames to keep their framerate limit.
+        * @details Default is #ramses::EFramePacingMode::Sleep. Deadline based modes reduce frame time jitter, measured wake-up
+        *          jitter is reported in periodic renderer statistics log.
+        *          Has only effect if display threads are used (#ramses::RamsesRenderer::startThread).
+        *
+        * @param[in] mode Frame pacing mode to use for all displays
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setFramePacingMode(EFramePacingMode mode);
+
+        /**
+        * @brief Get the frame pacing mode
+        *
+        * @return Frame pacing mode used by display threads
+        */
+        [[nodiscard]] EFramePacingMode getFramePacingMode() const;
+
         /**
          * @brief Copy constructor
          * @param other source to copy from
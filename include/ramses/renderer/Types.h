@@ -274,6 +274,19 @@ namespace ramses
         UpdateOnly            //!< Render loop will update content without rendering
     };
 
+    /**
+    * @brief Specifies how display threads wait between frames to keep framerate limit (#ramses::RamsesRenderer::setFramerateLimit)
+    *
+    */
+    enum class EFramePacingMode
+    {
+        Sleep = 0,       //!< Sleep remaining time after frame finished with millisecond precision (default)
+        Deadline,        //!< Sleep until absolute frame start time with sub-millisecond precision, frame is started as late as possible
+                         //!< before its deadline based on measured update/render duration
+        DeadlineWithSpin //!< Same as Deadline but the last fraction of a millisecond is spent busy waiting, this reduces wake-up jitter
+                         //!< at the cost of CPU time
+    };
+
     /**
     * @brief Specifies type of depth buffer created within an offscreen buffer
     *
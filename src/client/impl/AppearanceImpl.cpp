@@ -300,6 +300,11 @@ namespace ramses::internal
         validateUniforms(report);
     }
 
+    bool AppearanceImpl::isValidationResultCacheable() const
+    {
+        return true;
+    }
+
     void AppearanceImpl::validateEffect(ValidationReportImpl& report) const
     {
         ObjectIteratorImpl iter(getSceneImpl().getObjectRegistry(), ERamsesObjectType::Effect);
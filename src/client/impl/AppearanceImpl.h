@@ -44,6 +44,7 @@ namespace ramses::internal
         bool deserialize(ramses::internal::IInputStream& inStream, DeserializationContext& serializationContext) override;
         bool resolveDeserializationDependencies(DeserializationContext& serializationContext) override;
         void onValidate(ValidationReportImpl& report) const override;
+        [[nodiscard]] bool isValidationResultCacheable() const override;
 
         [[nodiscard]] const EffectImpl* getEffectImpl() const;
         [[nodiscard]] const Effect& getEffect() const;
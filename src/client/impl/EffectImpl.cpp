@@ -125,39 +125,32 @@ namespace ramses::internal
         return true;
     }
 
+    void EffectImpl::prepareValidation() const
+    {
+        ResourceImpl::prepareValidation();
+        if (!m_shaderWarnings.has_value())
+        {
+            // issues are reported by onValidate, which tries to load the resource again
+            ValidationReportImpl ignoredReport;
+            m_effectResourceToValidate = loadDecompressedEffectResource(ignoredReport);
+        }
+    }
+
     void EffectImpl::onValidate(ValidationReportImpl& report) const
     {
         ResourceImpl::onValidate(report);
         if (!m_shaderWarnings.has_value())
         {
-            const auto resourceHash{getLowlevelResourceHash()};
-            assert(resourceHash.isValid());
-
-            auto managedResource{getClientImpl().getResource(resourceHash)};
-            if (!managedResource && !(managedResource = getClientImpl().getClientApplication().loadResource(resourceHash)))
-            {
-                report.add(EIssueType::Error, fmt::format("Unable to retrieve a resource by resource hash: {}", resourceHash), &getRamsesObject());
+            // moving releases the resource, it is not kept loaded by the effect
+            ManagedResource managedResource = std::move(m_effectResourceToValidate);
+            if (!managedResource && !(managedResource = loadDecompressedEffectResource(report)))
                 return;
-            }
 
             const EffectResource& effectResource{*managedResource->convertTo<EffectResource>()};
-            if (!effectResource.isDeCompressedAvailable())
-            {
-                if (effectResource.isCompressedAvailable())
-                {
-                    effectResource.decompress();
-                }
-                else
-                {
-                    report.add(EIssueType::Error, fmt::format("EffectResource without compressed/decompressed data: {}", resourceHash), &getRamsesObject());
-                    return;
-                }
-            }
-
             const GlslParser parser{effectResource.getVertexShader(), effectResource.getFragmentShader(), effectResource.getGeometryShader()};
             if (!parser.valid())
             {
-                report.add(EIssueType::Error, fmt::format("Can't parse shaders provided by EffectResource: {}", resourceHash), &getRamsesObject());
+                report.add(EIssueType::Error, fmt::format("Can't parse shaders provided by EffectResource: {}", getLowlevelResourceHash()), &getRamsesObject());
                 return;
             }
 
@@ -170,6 +163,35 @@ namespace ramses::internal
         }
     }
 
+    ManagedResource EffectImpl::loadDecompressedEffectResource(ValidationReportImpl& report) const
+    {
+        const auto resourceHash{getLowlevelResourceHash()};
+        assert(resourceHash.isValid());
+
+        auto managedResource{getClientImpl().getResource(resourceHash)};
+        if (!managedResource && !(managedResource = getClientImpl().getClientApplication().loadResource(resourceHash)))
+        {
+            report.add(EIssueType::Error, fmt::format("Unable to retrieve a resource by resource hash: {}", resourceHash), &getRamsesObject());
+            return {};
+        }
+
+        const EffectResource& effectResource{*managedResource->convertTo<EffectResource>()};
+        if (!effectResource.isDeCompressedAvailable())
+        {
+            if (effectResource.isCompressedAvailable())
+            {
+                effectResource.decompress();
+            }
+            else
+            {
+                report.add(EIssueType::Error, fmt::format("EffectResource without compressed/decompressed data: {}", resourceHash), &getRamsesObject());
+                return {};
+            }
+        }
+
+        return managedResource;
+    }
+
     size_t EffectImpl::getUniformInputCount() const
     {
         return m_effectUniformInputs.size();
@@ -41,6 +41,7 @@ namespace ramses::internal
 
         bool serialize(IOutputStream& outStream, SerializationContext& serializationContext) const override;
         bool deserialize(IInputStream& inStream, DeserializationContext& serializationContext) override;
+        void prepareValidation() const override;
         void onValidate(ValidationReportImpl& report) const override;
 
         size_t getUniformInputCount() const;
@@ -65,11 +66,14 @@ namespace ramses::internal
         static size_t GetEffectInputIndex(const EffectInputInformationVector& effectInputVector, std::string_view inputName);
         static size_t FindEffectInputIndex(const EffectInputInformationVector& effectInputVector, EFixedSemantics inputSemantics);
         void initializeEffectInputData(EffectInputImpl& effectInputImpl, const EffectInputInformation& effectInputInfo, size_t index) const;
+        [[nodiscard]] ManagedResource loadDecompressedEffectResource(ValidationReportImpl& report) const;
 
         EffectInputInformationVector m_effectUniformInputs;
         EffectInputInformationVector m_effectAttributeInputs;
         std::optional<EDrawMode> m_geometryShaderInputType;
 
         mutable std::optional<GlslParser::Warnings> m_shaderWarnings;
+        // loaded by prepareValidation, so that onValidate only parses the shaders
+        mutable ManagedResource m_effectResourceToValidate;
     };
 }
@@ -106,6 +106,11 @@ namespace ramses::internal
         validateAttribute(report);
     }
 
+    bool GeometryImpl::isValidationResultCacheable() const
+    {
+        return true;
+    }
+
     void GeometryImpl::validateEffect(ValidationReportImpl& report) const
     {
         ObjectIteratorImpl iter(getSceneImpl().getObjectRegistry(), ERamsesObjectType::Effect);
@@ -42,6 +42,7 @@ namespace ramses::internal
         bool deserialize(ramses::internal::IInputStream& inStream, DeserializationContext& serializationContext) override;
         bool resolveDeserializationDependencies(DeserializationContext& serializationContext) override;
         void onValidate(ValidationReportImpl& report) const override;
+        [[nodiscard]] bool isValidationResultCacheable() const override;
 
         bool setInputBuffer(const EffectInputImpl& input, const ArrayResourceImpl& bufferResource, uint32_t instancingDivisor, uint16_t offset, uint16_t stride);
         bool setInputBuffer(const EffectInputImpl& input, const ArrayBufferImpl& dataBuffer, uint32_t instancingDivisor, uint16_t offset, uint16_t stride);
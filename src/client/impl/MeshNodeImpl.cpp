@@ -117,6 +117,11 @@ namespace ramses::internal
         }
     }
 
+    bool MeshNodeImpl::isValidationResultCacheable() const
+    {
+        return true;
+    }
+
     void MeshNodeImpl::initializeFrameworkData()
     {
         NodeImpl::initializeFrameworkData();
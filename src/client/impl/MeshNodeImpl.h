@@ -41,6 +41,7 @@ namespace ramses::internal
         bool deserialize(ramses::internal::IInputStream& inStream, DeserializationContext& serializationContext) override;
         bool resolveDeserializationDependencies(DeserializationContext& serializationContext) override;
         void onValidate(ValidationReportImpl& report) const override;
+        [[nodiscard]] bool isValidationResultCacheable() const override;
 
         bool setAppearance(AppearanceImpl& appearanceImpl);
         bool setGeometry(GeometryImpl& geometryImpl);
@@ -47,6 +47,7 @@
 #include "internal/PlatformAbstraction/Collections/HashMap.h"
 #include "internal/PlatformAbstraction/PlatformTime.h"
 #include "internal/Core/Utils/LogMacros.h"
+#include "internal/Core/TaskFramework/ParallelTaskGroup.h"
 #include "internal/Core/Utils/RamsesLogger.h"
 #include "ClientFactory.h"
 #include "impl/FrameworkFactoryRegistry.h"
@@ -270,10 +271,13 @@ namespace ramses::internal
 
         // now the scene is registered, so it's possible to load the low level content into the scene
         LOG_TRACE(ramses::internal::CONTEXT_CLIENT, "    Reading low level scene from stream");
+        const uint64_t lowLevelSceneStart = ramses::internal::PlatformTime::GetMillisecondsMonotonic();
         ramses::internal::ScenePersistation::ReadSceneFromStream(inputStream, *internalScene);
 
         LOG_TRACE(ramses::internal::CONTEXT_CLIENT, "    Deserializing high level scene objects from stream");
-        DeserializationContext deserializationContext(config);
+        const uint64_t sceneObjectsStart = ramses::internal::PlatformTime::GetMillisecondsMonotonic();
+        // dependencies which can be resolved concurrently (logic engines) are resolved using framework thread pool
+        DeserializationContext deserializationContext(config, &m_framework.getTaskQueue());
         SerializationHelper::DeserializeObjectID(inputStream);
         if (!impl->deserialize(inputStream, deserializationContext))
         {
@@ -282,6 +286,18 @@ namespace ramses::internal
             return nullptr;
         }
 
+        LOG_TRACE(ramses::internal::CONTEXT_CLIENT, "    Resolving dependencies of high level scene objects and loading logic");
+        const uint64_t dependenciesStart = ramses::internal::PlatformTime::GetMillisecondsMonotonic();
+        if (!deserializationContext.resolveDependencies())
+        {
+            LOG_ERROR(ramses::internal::CONTEXT_CLIENT, "    Failed to resolve dependencies of high level scene:");
+            LOG_ERROR(ramses::internal::CONTEXT_CLIENT, m_framework.getErrorReporting().getError().value_or(Issue{}).message);
+            return nullptr;
+        }
+        const uint64_t dependenciesEnd = ramses::internal::PlatformTime::GetMillisecondsMonotonic();
+
+        LOG_INFO_P(ramses::internal::CONTEXT_CLIENT, "RamsesClient::{}: Scene {} from {} deserialized (low level scene: {} ms, scene objects: {} ms, dependencies and logic: {} ms)",
+            caller, createInfo.m_id, filename, sceneObjectsStart - lowLevelSceneStart, dependenciesStart - sceneObjectsStart, dependenciesEnd - dependenciesStart);
         LOG_TRACE(ramses::internal::CONTEXT_CLIENT, "    Done with preparing scene from input stream.");
 
         return SceneOwningPtr{ new ramses::Scene{ std::move(impl) }, [](ramses::Scene* s) { delete s; } };
@@ -317,8 +333,17 @@ namespace ramses::internal
         inputStream >> llResourceStart;
 
         SceneOwningPtr scene;
+        ramses::internal::ResourceTableOfContents loadedTOC;
+        uint64_t resourceTOCTime = 0u;
+        const auto readResourceTOC = [&]() {
+            const uint64_t start = ramses::internal::PlatformTime::GetMillisecondsMonotonic();
+            loadedTOC.readTOCPosAndTOCFromStream(inputStream);
+            resourceTOCTime = ramses::internal::PlatformTime::GetMillisecondsMonotonic() - start;
+        };
+
         if (cconfig.prefetchData)
         {
+            const uint64_t prefetchStart = ramses::internal::PlatformTime::GetMillisecondsMonotonic();
             std::vector<std::byte> sceneData(static_cast<size_t>(llResourceStart - sceneObjectStart));
             inputStream.read(sceneData.data(), sceneData.size());
 
@@ -327,25 +352,32 @@ namespace ramses::internal
                 LOG_ERROR_P(ramses::internal::CONTEXT_CLIENT, "RamsesClient::{}: Failed reading scene from file: {} ", cconfig.caller, inputStream.getState());
                 return nullptr;
             }
+            LOG_INFO_P(CONTEXT_CLIENT, "RamsesClient::{}: Prefetched {} bytes of scene data in {} ms", cconfig.caller, sceneData.size(),
+                ramses::internal::PlatformTime::GetMillisecondsMonotonic() - prefetchStart);
 
+            // scene is deserialized from prefetched data, source stream is only used for resource table of contents which follows the scene data
             ramses::internal::BinaryInputStream sceneDataStream(sceneData.data());
-            scene = loadSceneObjectFromStream(cconfig.caller, cconfig.dataSource, sceneDataStream, cconfig.config);
+            ramses::internal::ParallelTaskGroup loadTasks(&m_framework.getTaskQueue());
+            loadTasks.add([&]() { scene = loadSceneObjectFromStream(cconfig.caller, cconfig.dataSource, sceneDataStream, cconfig.config); });
+            loadTasks.add(readResourceTOC);
+            loadTasks.execute();
         }
         else
         {
             // this path will be used in the future when creating scene from user provided stream
             scene = loadSceneObjectFromStream(cconfig.caller, cconfig.dataSource, inputStream, cconfig.config);
+            if (scene)
+                readResourceTOC();
         }
         if (!scene)
         {
             LOG_ERROR_P(ramses::internal::CONTEXT_CLIENT, "RamsesClient::{}: scene creation for '{}' failed", cconfig.caller, cconfig.dataSource);
             return nullptr;
         }
+        LOG_INFO_P(CONTEXT_CLIENT, "RamsesClient::{}: Read resource table of contents with {} entries in {} ms", cconfig.caller, loadedTOC.getFileContents().size(), resourceTOCTime);
 
         // calls on m_appLogic are thread safe
         // register stream for on-demand resource loading (LL-Resources)
-        ramses::internal::ResourceTableOfContents loadedTOC;
-        loadedTOC.readTOCPosAndTOCFromStream(inputStream);
         const ramses::internal::SceneFileHandle fileHandle = m_appLogic.addResourceFile(cconfig.streamContainer, loadedTOC);
         scene->m_impl.setSceneFileHandle(fileHandle);
 
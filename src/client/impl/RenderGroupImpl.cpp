@@ -116,6 +116,11 @@ namespace ramses::internal
             report.addDependentObject(*this, *element);
     }
 
+    bool RenderGroupImpl::isValidationResultCacheable() const
+    {
+        return true;
+    }
+
     void RenderGroupImpl::initializeFrameworkData()
     {
         m_renderGroupHandle = getIScene().allocateRenderGroup(0, 0, {});
@@ -34,6 +34,7 @@ namespace ramses::internal
         bool deserialize(ramses::internal::IInputStream& inStream, DeserializationContext& serializationContext) override;
         bool resolveDeserializationDependencies(DeserializationContext& serializationContext) override;
         void onValidate(ValidationReportImpl& report) const override;
+        [[nodiscard]] bool isValidationResultCacheable() const override;
 
         bool               addMeshNode(const MeshNodeImpl& mesh, int32_t orderWithinGroup);
         bool               remove(const MeshNodeImpl& mesh);
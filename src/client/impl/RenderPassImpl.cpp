@@ -140,6 +140,11 @@ namespace ramses::internal
         }
     }
 
+    bool RenderPassImpl::isValidationResultCacheable() const
+    {
+        return true;
+    }
+
     void RenderPassImpl::initializeFrameworkData()
     {
         m_renderPassHandle = getIScene().allocateRenderPass(0, {});
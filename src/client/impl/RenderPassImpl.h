@@ -44,6 +44,7 @@ namespace ramses::internal
         bool deserialize(ramses::internal::IInputStream& inStream, DeserializationContext& serializationContext) override;
         bool resolveDeserializationDependencies(DeserializationContext& serializationContext) override;
         void onValidate(ValidationReportImpl& report) const override;
+        [[nodiscard]] bool isValidationResultCacheable() const override;
 
         bool setCamera(const CameraNodeImpl& cameraImpl);
         [[nodiscard]] const ramses::Camera* getCamera()const;
@@ -79,6 +79,12 @@ namespace ramses::internal
     {
     }
 
+    bool ResourceImpl::isValidationResultCacheable() const
+    {
+        // content of resources cannot change
+        return true;
+    }
+
     bool ResourceImpl::serialize(ramses::internal::IOutputStream& outStream, SerializationContext& serializationContext) const
     {
         if (!SceneObjectImpl::serialize(outStream, serializationContext))
@@ -36,6 +36,7 @@ namespace ramses::internal
         ~ResourceImpl() override;
 
         void deinitializeFrameworkData() override;
+        [[nodiscard]] bool isValidationResultCacheable() const override;
         bool serialize(ramses::internal::IOutputStream& outStream, SerializationContext& serializationContext) const override;
         bool deserialize(ramses::internal::IInputStream& inStream, DeserializationContext& serializationContext) override;
 
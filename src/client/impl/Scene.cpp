@@ -139,6 +139,13 @@ namespace ramses
         return status;
     }
 
+    bool Scene::destroySubtree(Node& rootNode)
+    {
+        const bool status = m_impl.destroySubtree(rootNode);
+        LOG_HL_CLIENT_API1(status, LOG_API_RAMSESOBJECT_STRING(rootNode));
+        return status;
+    }
+
     bool Scene::setExpirationTimestamp(uint64_t ptpExpirationTimestampInMilliseconds)
     {
         const bool status = m_impl.setExpirationTimestamp(ptpExpirationTimestampInMilliseconds);
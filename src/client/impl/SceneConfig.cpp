@@ -71,4 +71,16 @@ namespace ramses
         m_impl->setMemoryVerificationEnabled(enabled);
         LOG_HL_CLIENT_API1(true, enabled);
     }
+
+    void SceneConfig::setShadowCopyEnabled(bool enabled)
+    {
+        m_impl->setShadowCopyEnabled(enabled);
+        LOG_HL_CLIENT_API1(true, enabled);
+    }
+
+    void SceneConfig::setIncrementalValidationEnabled(bool enabled)
+    {
+        m_impl->setIncrementalValidationEnabled(enabled);
+        LOG_HL_CLIENT_API1(true, enabled);
+    }
 }
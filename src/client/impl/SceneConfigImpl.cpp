@@ -39,4 +39,24 @@ namespace ramses::internal
     {
         return m_memoryVerificationEnabled;
     }
+
+    void SceneConfigImpl::setShadowCopyEnabled(bool enabled)
+    {
+        m_shadowCopyEnabled = enabled;
+    }
+
+    bool SceneConfigImpl::isShadowCopyEnabled() const
+    {
+        return m_shadowCopyEnabled;
+    }
+
+    void SceneConfigImpl::setIncrementalValidationEnabled(bool enabled)
+    {
+        m_incrementalValidationEnabled = enabled;
+    }
+
+    bool SceneConfigImpl::isIncrementalValidationEnabled() const
+    {
+        return m_incrementalValidationEnabled;
+    }
 }
@@ -19,14 +19,20 @@ namespace ramses::internal
         void setPublicationMode(EScenePublicationMode publicationMode);
         void setMemoryVerificationEnabled(bool enabled);
         void setSceneId(sceneId_t sceneId);
+        void setShadowCopyEnabled(bool enabled);
+        void setIncrementalValidationEnabled(bool enabled);
 
         [[nodiscard]] EScenePublicationMode getPublicationMode() const;
         [[nodiscard]] bool getMemoryVerificationEnabled() const;
         [[nodiscard]] sceneId_t getSceneId() const;
+        [[nodiscard]] bool isShadowCopyEnabled() const;
+        [[nodiscard]] bool isIncrementalValidationEnabled() const;
 
     private:
         EScenePublicationMode m_publicationMode = EScenePublicationMode::LocalOnly;
         sceneId_t m_sceneId;
         bool m_memoryVerificationEnabled = true;
+        bool m_shadowCopyEnabled = true;
+        bool m_incrementalValidationEnabled = false;
     };
 }
@@ -112,14 +112,19 @@ namespace ramses::internal
         : ClientObjectImpl(ramsesClient.impl(), ERamsesObjectType::Scene, scene.getName().c_str())
         , m_scene(scene)
         , m_nextSceneVersion(InvalidSceneVersionTag)
+        , m_validator(m_objectRegistry, &ramsesClient.impl().getFramework().getTaskQueue(), sceneConfig.isIncrementalValidationEnabled())
         , m_futurePublicationMode(sceneConfig.getPublicationMode())
         , m_hlClient(ramsesClient)
     {
         LOG_INFO(ramses::internal::CONTEXT_CLIENT, "Scene::Scene: sceneId " << scene.getSceneId()  <<
-                 ", publicationMode " << (sceneConfig.getPublicationMode() == EScenePublicationMode::LocalAndRemote ? "LocalAndRemote" : "LocalOnly"));
+                 ", publicationMode " << (sceneConfig.getPublicationMode() == EScenePublicationMode::LocalAndRemote ? "LocalAndRemote" : "LocalOnly") <<
+                 ", shadowCopy " << sceneConfig.isShadowCopyEnabled() <<
+                 ", incrementalValidation " << sceneConfig.isIncrementalValidationEnabled());
         getClientImpl().getFramework().getPeriodicLogger().registerStatisticCollectionScene(m_scene.getSceneId(), m_scene.getStatisticCollection());
-        const bool enableLocalOnlyOptimization = sceneConfig.getPublicationMode() == EScenePublicationMode::LocalOnly;
-        getClientImpl().getClientApplication().createScene(scene, enableLocalOnlyOptimization);
+        getClientImpl().getFramework().getMetricsRegistry().registerStatisticCollectionScene(m_scene.getSceneId(), m_scene.getStatisticCollection());
+        // local only scenes are never subscribed remotely, the scene can be sent to new (local) subscribers on next flush without keeping a copy
+        const bool useDirectSceneLogic = sceneConfig.getPublicationMode() == EScenePublicationMode::LocalOnly || !sceneConfig.isShadowCopyEnabled();
+        getClientImpl().getClientApplication().createScene(scene, useDirectSceneLogic);
     }
 
     SceneImpl::~SceneImpl()
@@ -127,6 +132,7 @@ namespace ramses::internal
         LOG_INFO(CONTEXT_CLIENT, "SceneImpl::~SceneImpl");
         closeSceneFile();
         getClientImpl().getFramework().getPeriodicLogger().removeStatisticCollectionScene(m_scene.getSceneId());
+        getClientImpl().getFramework().getMetricsRegistry().removeStatisticCollectionScene(m_scene.getSceneId());
     }
 
     void SceneImpl::initializeFrameworkData()
@@ -147,7 +153,7 @@ namespace ramses::internal
         if (!SerializationHelper::SerializeObjectsInRegistry<SceneObject>(outStream, serializationContext, m_objectRegistry))
             return false;
 
-        outStream << m_lastSceneObjectId.getValue();
+        outStream << m_lastSceneObjectId.load();
 
         return true;
     }
@@ -314,7 +320,9 @@ namespace ramses::internal
                 return false;
         }
 
-        inStream >> m_lastSceneObjectId.getReference();
+        sceneObjectId_t::BaseType lastSceneObjectId = 0u;
+        inStream >> lastSceneObjectId;
+        m_lastSceneObjectId = lastSceneObjectId;
 
         LOG_DEBUG_F(ramses::internal::CONTEXT_PROFILING, ([&](ramses::internal::StringOutputStream& sos) {
                     sos << "SceneImpl::deserialize: HL scene object counts for SceneID " << m_scene.getSceneId() << "\n";
@@ -327,24 +335,12 @@ namespace ramses::internal
                     }
                 }));
 
-        return serializationContext.resolveDependencies();
+        return true;
     }
 
     void SceneImpl::onValidate(ValidationReportImpl& report) const
     {
-        for (size_t i = 0u; i < RamsesObjectTypeCount; ++i)
-        {
-            const auto type = static_cast<ERamsesObjectType>(i);
-            if (RamsesObjectTypeUtils::IsTypeMatchingBaseType(type, ERamsesObjectType::SceneObject)
-                && RamsesObjectTypeUtils::IsConcreteType(type))
-            {
-                SceneObjectRegistryIterator iter(getObjectRegistry(), ERamsesObjectType(i));
-                while (const auto* obj = iter.getNext())
-                {
-                    obj->impl().validate(report);
-                }
-            }
-        }
+        m_validator.validate(report);
 
         // special validation (see SceneImpl::createTextureConsumer(const TextureSamplerExternal&, dataConsumerId_t)),
         // duplicate IDs are temporarily allowed but validation still reports them as errors
@@ -487,6 +483,64 @@ namespace ramses::internal
         return false;
     }
 
+    bool SceneImpl::destroySubtree(Node& rootNode)
+    {
+        if (!containsSceneObject(rootNode.impl()))
+        {
+            getErrorReporting().set("Scene::destroySubtree failed, node is not in this scene.", *this);
+            return false;
+        }
+
+        std::vector<Node*> nodes{ &rootNode };
+        for (size_t i = 0u; i < nodes.size(); ++i)
+        {
+            NodeImpl& nodeImpl = nodes[i]->impl();
+            for (size_t childIdx = 0u; childIdx < nodeImpl.getChildCount(); ++childIdx)
+                nodes.push_back(&RamsesObjectTypeUtils::ConvertTo<Node>(nodeImpl.getChildImpl(childIdx).getRamsesObject()));
+        }
+
+        // check all preconditions before anything is modified
+        for (const auto* node : nodes)
+        {
+            if (node->isOfType(ERamsesObjectType::Camera) && cameraIsAssignedToRenderPasses(RamsesObjectTypeUtils::ConvertTo<ramses::Camera>(*node)))
+            {
+                getErrorReporting().set("Scene::destroySubtree can not destroy camera while it is still assigned to a render pass!", *this);
+                return false;
+            }
+        }
+
+        // unlink hierarchy from the end of children lists and release data slots of all nodes in one pass
+        // instead of per node as done in destroyNode
+        if (rootNode.hasParent())
+            rootNode.impl().removeParent();
+        std::vector<bool> isSubtreeNode(m_scene.getNodeCount(), false);
+        for (auto* node : nodes)
+        {
+            node->impl().removeAllChildren();
+            isSubtreeNode[node->impl().getNodeHandle().asMemoryHandle()] = true;
+        }
+
+        const uint32_t slotHandleCount = m_scene.getDataSlotCount();
+        for (ramses::internal::DataSlotHandle slotHandle(0u); slotHandle < slotHandleCount; slotHandle++)
+        {
+            if (m_scene.isDataSlotAllocated(slotHandle))
+            {
+                const ramses::internal::NodeHandle attachedNode = m_scene.getDataSlot(slotHandle).attachedNode;
+                if (attachedNode.isValid() && attachedNode.asMemoryHandle() < isSubtreeNode.size() && isSubtreeNode[attachedNode.asMemoryHandle()])
+                    m_scene.releaseDataSlot(slotHandle);
+            }
+        }
+
+        for (auto* node : nodes)
+        {
+            if (node->isOfType(ERamsesObjectType::MeshNode))
+                removeObjectFromAllContainers<MeshNode, ramses::RenderGroup>(RamsesObjectTypeUtils::ConvertTo<MeshNode>(*node));
+            destroyObject(*node);
+        }
+
+        return true;
+    }
+
     bool SceneImpl::destroyRenderTarget(ramses::RenderTarget& renderTarget)
     {
         SceneObjectRegistryIterator iterator(m_objectRegistry, ERamsesObjectType::RenderPass);
@@ -1317,6 +1371,11 @@ namespace ramses::internal
         return m_objectRegistry;
     }
 
+    const SceneValidator& SceneImpl::getSceneValidator() const
+    {
+        return m_validator;
+    }
+
     template <typename OBJECT, typename CONTAINER>
     void SceneImpl::removeObjectFromAllContainers(const OBJECT& object)
     {
@@ -1612,8 +1671,7 @@ namespace ramses::internal
 
     sceneObjectId_t SceneImpl::getNextSceneObjectId()
     {
-        ++m_lastSceneObjectId.getReference();
-        return sceneObjectId_t{ m_lastSceneObjectId};
+        return sceneObjectId_t{ ++m_lastSceneObjectId };
     }
 
     template <typename T>
@@ -20,6 +20,7 @@
 // internal
 #include "impl/ClientObjectImpl.h"
 #include "impl/SceneObjectRegistry.h"
+#include "impl/SceneValidator.h"
 #include "impl/AppearanceImpl.h"
 #include "internal/ClientCommands/SceneCommandBuffer.h"
 #include "internal/Components/FlushTimeInformation.h"
@@ -38,6 +39,7 @@
 #include "internal/Core/Utils/StatisticCollection.h"
 #include "impl/RamsesFrameworkTypesImpl.h"
 
+#include <atomic>
 #include <chrono>
 #include <unordered_map>
 #include <string_view>
@@ -198,6 +200,7 @@ namespace ramses::internal
         bool unlinkData(SceneReference* consumerReference, dataConsumerId_t consumerId);
 
         bool destroy(SceneObject& object);
+        bool destroySubtree(Node& rootNode);
 
         bool setExpirationTimestamp(uint64_t ptpExpirationTimestampInMilliseconds);
 
@@ -234,6 +237,7 @@ namespace ramses::internal
 
         SceneObjectRegistry&       getObjectRegistry();
         const SceneObjectRegistry& getObjectRegistry() const;
+        const SceneValidator&      getSceneValidator() const;
 
         void setSceneVersionForNextFlush(sceneVersionTag_t sceneVersion);
 
@@ -315,10 +319,13 @@ namespace ramses::internal
         ramses::internal::ClientScene&          m_scene;
         ramses::internal::SceneCommandBuffer    m_commandBuffer;
         sceneVersionTag_t                       m_nextSceneVersion;
-        sceneObjectId_t                         m_lastSceneObjectId;
+        // atomic because logic engines of a loaded scene create their objects concurrently
+        std::atomic<sceneObjectId_t::BaseType>  m_lastSceneObjectId{ 0u };
 
         SceneObjectRegistry m_objectRegistry;
         std::unordered_multimap <resourceId_t, Resource*> m_resources;
+        // validation keeps results of objects in incremental mode
+        mutable SceneValidator m_validator;
 
         // This is essentially a local variable only used in the "applyVisibilityToSubtree" method.
         // This is for performance reasons, so we can re-use the same vector each time the method is called.
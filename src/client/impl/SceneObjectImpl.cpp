@@ -45,14 +45,49 @@ namespace ramses::internal
 
     ramses::internal::ClientScene& SceneObjectImpl::getIScene()
     {
+        m_modifiedSinceValidation = true;
         return m_scene.getIScene();
     }
 
+    bool SceneObjectImpl::isModifiedSinceValidation() const
+    {
+        return m_modifiedSinceValidation;
+    }
+
+    void SceneObjectImpl::resetModifiedSinceValidation() const
+    {
+        m_modifiedSinceValidation = false;
+    }
+
+    bool SceneObjectImpl::isValidationResultCacheable() const
+    {
+        return false;
+    }
+
+    void SceneObjectImpl::prepareValidation() const
+    {
+    }
+
     bool SceneObjectImpl::isFromTheSameSceneAs(const SceneObjectImpl& otherObject) const
     {
         return &getIScene() == &(otherObject.getIScene());
     }
 
+    bool SceneObjectImpl::setName(std::string_view name)
+    {
+        // logic objects are not tracked in scene object registry
+        if (m_objectRegistry == nullptr)
+            return ClientObjectImpl::setName(name);
+
+        // keep name index of registry in sync, it refers to the current name
+        auto& object = RamsesObjectTypeUtils::ConvertTo<SceneObject>(getRamsesObject());
+        m_objectRegistry->unregisterObjectName(object);
+        const bool status = ClientObjectImpl::setName(name);
+        m_objectRegistry->registerObjectName(object);
+
+        return status;
+    }
+
     bool SceneObjectImpl::serialize(ramses::internal::IOutputStream& outStream, SerializationContext& serializationContext) const
     {
         if (!RamsesObjectImpl::serialize(outStream, serializationContext))
@@ -101,8 +136,9 @@ namespace ramses::internal
         return idString;
     }
 
-    void SceneObjectImpl::setObjectRegistryHandle(SceneObjectRegistryHandle handle)
+    void SceneObjectImpl::setObjectRegistryHandle(SceneObjectRegistry& registry, SceneObjectRegistryHandle handle)
     {
+        m_objectRegistry = &registry;
         m_objectRegistryHandle = handle;
     }
 
@@ -21,6 +21,7 @@ namespace ramses::internal
 {
     class ClientScene;
     class SceneImpl;
+    class SceneObjectRegistry;
 
     class SceneObjectImpl : public ClientObjectImpl
     {
@@ -33,7 +34,7 @@ namespace ramses::internal
         [[nodiscard]] Scene& getScene();
 
         // impl methods
-        void setObjectRegistryHandle(SceneObjectRegistryHandle handle);
+        void setObjectRegistryHandle(SceneObjectRegistry& registry, SceneObjectRegistryHandle handle);
         [[nodiscard]] SceneObjectRegistryHandle getObjectRegistryHandle() const;
 
         [[nodiscard]] const SceneImpl& getSceneImpl() const;
@@ -46,6 +47,18 @@ namespace ramses::internal
 
         [[nodiscard]] bool isFromTheSameSceneAs(const SceneObjectImpl& otherObject) const;
 
+        // objects are considered modified whenever they access the scene for writing
+        [[nodiscard]] bool isModifiedSinceValidation() const;
+        void resetModifiedSinceValidation() const;
+        // result of own checks can be reused as long as the object is not modified, only if the checks depend on nothing else than
+        // state of the object, state of the objects it adds as dependent objects and existence of other scene objects
+        [[nodiscard]] virtual bool isValidationResultCacheable() const;
+        // called on the validating thread before own checks of scene objects run in parallel (see SceneValidator), prepares
+        // what cannot be done concurrently, e.g. loading of resources
+        virtual void prepareValidation() const;
+
+        bool setName(std::string_view name) override;
+
         [[nodiscard]] std::string getIdentificationString() const final;
 
     protected:
@@ -54,5 +67,7 @@ namespace ramses::internal
     private:
         SceneImpl& m_scene;
         SceneObjectRegistryHandle m_objectRegistryHandle;
+        SceneObjectRegistry* m_objectRegistry = nullptr;
+        mutable bool m_modifiedSinceValidation = true;
     };
 }
@@ -15,19 +15,24 @@
 #include "impl/RamsesObjectTypeUtils.h"
 #include "internal/PlatformAbstraction/PlatformStringUtils.h"
 
+#include <algorithm>
+
 namespace ramses::internal
 {
-    void SceneObjectRegistry::registerObjectInternal(SceneObject& object)
+    void SceneObjectRegistry::registerObjectInternal(SceneObjectUniquePtr object)
     {
-        assert(!object.isOfType(ERamsesObjectType::LogicObject)); // logic objects have their own registry in corresponding LogicEngine
-        assert(!containsObject(object));
+        assert(!object->isOfType(ERamsesObjectType::LogicObject)); // logic objects have their own registry in corresponding LogicEngine
+        assert(!containsObject(*object));
 
-        const ERamsesObjectType type = object.impl().getType();
+        SceneObject& objectRef = *object;
+        const ERamsesObjectType type = objectRef.impl().getType();
         const SceneObjectRegistryHandle handle = m_objects[static_cast<int>(type)].allocate();
-        *m_objects[static_cast<int>(type)].getMemory(handle) = &object;
-        object.impl().setObjectRegistryHandle(handle);
+        *m_objects[static_cast<int>(type)].getMemory(handle) = std::move(object);
+        objectRef.impl().setObjectRegistryHandle(*this, handle);
 
-        trackSceneObjectById(object);
+        trackSceneObjectById(objectRef);
+        registerObjectName(objectRef);
+        ++m_revision;
     }
 
     void SceneObjectRegistry::destroyAndUnregisterObject(SceneObject& object)
@@ -44,18 +49,19 @@ namespace ramses::internal
             m_objectsById.erase(sceneObjectId);
         }
 
+        unregisterObjectName(object);
+
         const SceneObjectRegistryHandle handle = object.impl().getObjectRegistryHandle();
         const auto type = static_cast<int>(object.impl().getType());
+        m_objects[type].getMemory(handle)->reset();
         m_objects[type].release(handle);
-
-        auto it = std::find_if(m_objectsOwningContainer.begin(), m_objectsOwningContainer.end(), [&object](auto& ro) { return ro.get() == &object; });
-        assert(it != m_objectsOwningContainer.end());
-        m_objectsOwningContainer.erase(it);
+        ++m_revision;
     }
 
     void SceneObjectRegistry::reserveAdditionalGeneralCapacity(uint32_t additionalCount)
     {
-        m_objectsOwningContainer.reserve(m_objectsOwningContainer.size() + additionalCount);
+        m_objectsById.reserve(m_objectsById.size() + additionalCount);
+        m_objectsByName.reserve(m_objectsByName.size() + additionalCount);
     }
 
     void SceneObjectRegistry::reserveAdditionalObjectCapacity(ERamsesObjectType type, uint32_t additionalCount)
@@ -71,12 +77,17 @@ namespace ramses::internal
         return m_objects[static_cast<int>(type)].getActualCount();
     }
 
+    uint64_t SceneObjectRegistry::getRevision() const
+    {
+        return m_revision;
+    }
+
     bool SceneObjectRegistry::containsObject(const SceneObject& object) const
     {
         const SceneObjectRegistryHandle handle = object.impl().getObjectRegistryHandle();
         const ERamsesObjectType type = object.impl().getType();
         const SceneObjectsPool& objectsPool = m_objects[static_cast<int>(type)];
-        return objectsPool.isAllocated(handle) && (*objectsPool.getMemory(handle) == &object);
+        return objectsPool.isAllocated(handle) && (objectsPool.getMemory(handle)->get() == &object);
     }
 
     void SceneObjectRegistry::trackSceneObjectById(SceneObject& object)
@@ -90,6 +101,44 @@ namespace ramses::internal
         }
     }
 
+    void SceneObjectRegistry::unregisterObjectName(const SceneObject& object)
+    {
+        assert(containsObject(object));
+        const auto range = m_objectsByName.equal_range(object.getName());
+        const auto it = std::find_if(range.first, range.second, [&object](const auto& entry) { return entry.second == &object; });
+        assert(it != range.second);
+        m_objectsByName.erase(it);
+    }
+
+    void SceneObjectRegistry::registerObjectName(SceneObject& object)
+    {
+        assert(containsObject(object));
+        m_objectsByName.emplace(object.getName(), &object);
+    }
+
+    SceneObject* SceneObjectRegistry::findIndexedObjectByName(std::string_view name, ERamsesObjectType ofType) const
+    {
+        // names are not unique, in case of multiple matches prefer lowest type and registry handle to give
+        // same result as iterating over all objects
+        SceneObject* result = nullptr;
+        const auto range = m_objectsByName.equal_range(name);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            SceneObject* candidate = it->second;
+            const ERamsesObjectType type = candidate->impl().getType();
+            if (!RamsesObjectTypeUtils::IsTypeMatchingBaseType(type, ofType))
+                continue;
+
+            if (result == nullptr || type < result->impl().getType() ||
+                (type == result->impl().getType() && candidate->impl().getObjectRegistryHandle() < result->impl().getObjectRegistryHandle()))
+            {
+                result = candidate;
+            }
+        }
+
+        return result;
+    }
+
     SceneObject* SceneObjectRegistry::findObjectById(sceneObjectId_t id)
     {
         const auto it = m_objectsById.find(id);
@@ -139,7 +188,7 @@ namespace ramses::internal
                 {
                     if (objectsPool.isAllocated(handle))
                     {
-                        objects.push_back(*objectsPool.getMemory(handle));
+                        objects.push_back(objectsPool.getMemory(handle)->get());
                     }
                 }
             }
@@ -39,6 +39,8 @@ namespace ramses::internal
         void reserveAdditionalGeneralCapacity(uint32_t additionalCount);
         void reserveAdditionalObjectCapacity(ERamsesObjectType type, uint32_t additionalCount);
         [[nodiscard]] uint32_t getNumberOfObjects(ERamsesObjectType type) const;
+        // changes whenever an object is registered or unregistered
+        [[nodiscard]] uint64_t getRevision() const;
 
         void getObjectsOfType(SceneObjectVector& objects, ERamsesObjectType ofType) const;
 
@@ -48,6 +50,10 @@ namespace ramses::internal
         [[nodiscard]] const SceneObject* findObjectById(sceneObjectId_t id) const;
         SceneObject* findObjectById(sceneObjectId_t id);
 
+        // name index refers to the current name of an object, so it has to be updated around every rename
+        void unregisterObjectName(const SceneObject& object);
+        void registerObjectName(SceneObject& object);
+
         void setNodeDirty(NodeImpl& node, bool dirty);
         [[nodiscard]] bool isNodeDirty(const NodeImpl& node) const;
 
@@ -55,19 +61,23 @@ namespace ramses::internal
         void clearDirtyNodes();
 
     private:
-        void registerObjectInternal(SceneObject& object);
+        using SceneObjectUniquePtr = std::unique_ptr<SceneObject, std::function<void(SceneObject*)>>;
+
+        void registerObjectInternal(SceneObjectUniquePtr object);
         [[nodiscard]] bool containsObject(const SceneObject& object) const;
         void trackSceneObjectById(SceneObject& object);
+        [[nodiscard]] SceneObject* findIndexedObjectByName(std::string_view name, ERamsesObjectType ofType) const;
 
         std::unordered_map<sceneObjectId_t, SceneObject*> m_objectsById;
+        // keys are views of the names owned by the mapped objects
+        std::unordered_multimap<std::string_view, SceneObject*> m_objectsByName;
 
-        using SceneObjectsPool = ramses::internal::MemoryPool<SceneObject *, SceneObjectRegistryHandle>;
+        // pools own the objects, registry handle of object is used for O(1) removal
+        using SceneObjectsPool = ramses::internal::MemoryPool<SceneObjectUniquePtr, SceneObjectRegistryHandle>;
         std::array<SceneObjectsPool, RamsesObjectTypeCount> m_objects;
 
-        using SceneObjectUniquePtr = std::unique_ptr<SceneObject, std::function<void(SceneObject*)>>;
-        std::vector<SceneObjectUniquePtr> m_objectsOwningContainer;
-
         NodeImplSet m_dirtyNodes;
+        uint64_t m_revision = 0u;
 
         friend class SceneObjectRegistryIterator;
     };
@@ -77,13 +87,11 @@ namespace ramses::internal
     {
         static_assert(std::is_base_of_v<SceneObject, T>, "Meant for SceneObject instances only");
 
-        std::unique_ptr<T, std::function<void(SceneObject*)>> object{ new T{ std::move(impl) }, [](SceneObject* o) { delete o; } };
-        T* objectRawPtr = object.get();
-        this->m_objectsOwningContainer.push_back(std::move(object));
-
-        this->registerObjectInternal(*objectRawPtr);
+        SceneObjectUniquePtr object{ new T{ std::move(impl) }, [](SceneObject* o) { delete o; } };
+        auto& objectRef = static_cast<T&>(*object);
+        this->registerObjectInternal(std::move(object));
 
-        return *objectRawPtr;
+        return objectRef;
     }
 
     template <typename T> T* SceneObjectRegistry::findObjectByName(std::string_view name)
@@ -91,17 +99,9 @@ namespace ramses::internal
         if constexpr (!std::is_base_of_v<LogicObject, T>) // if searching for logic object don't bother going thru scene registry
         {
             constexpr ERamsesObjectType typeToReturn = TYPE_ID_OF_RAMSES_OBJECT<T>::ID;
-            for (size_t typeIdx = 0u; typeIdx < RamsesObjectTypeCount; ++typeIdx)
-            {
-                const auto type = static_cast<ERamsesObjectType>(typeIdx);
-                if (RamsesObjectTypeUtils::IsConcreteType(type) && RamsesObjectTypeUtils::IsTypeMatchingBaseType(type, typeToReturn))
-                {
-                    const auto& objs = m_objects[typeIdx];
-                    const auto it = std::find_if(objs.begin(), objs.end(), [name](const auto o) { return (*o.second)->getName() == name; });
-                    if (it != objs.end())
-                        return (*it->second)->template as<T>();
-                }
-            }
+            SceneObject* obj = findIndexedObjectByName(name, typeToReturn);
+            if (obj)
+                return obj->template as<T>();
         }
 
         // NOLINTNEXTLINE(readability-misleading-indentation) for some reason clang is confused about constexpr branch above
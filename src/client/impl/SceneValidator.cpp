@@ -0,0 +1,207 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/SceneValidator.h"
+#include "impl/SceneObjectImpl.h"
+#include "impl/SceneObjectRegistry.h"
+#include "impl/SceneObjectRegistryIterator.h"
+#include "impl/ValidationReportImpl.h"
+#include "impl/RamsesObjectTypeUtils.h"
+#include "internal/Core/TaskFramework/ParallelTaskGroup.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace ramses::internal
+{
+    // number of objects checked by a single task, checks of most objects are cheap
+    static constexpr size_t ObjectsPerTask = 64u;
+
+    SceneValidator::SceneValidator(const SceneObjectRegistry& registry, ITaskQueue* taskQueue, bool incremental)
+        : m_registry(registry)
+        , m_taskQueue(taskQueue)
+        , m_incremental(incremental)
+    {
+    }
+
+    void SceneValidator::validate(ValidationReportImpl& report)
+    {
+        std::vector<const SceneObjectImpl*> objects;
+        collectObjects(objects);
+
+        // results refer to other objects and checks report missing objects, creating or destroying any object outdates all of them
+        if (m_resultsRegistryRevision != m_registry.getRevision())
+        {
+            m_results.clear();
+            m_resultsRegistryRevision = m_registry.getRevision();
+        }
+
+        std::vector<const SceneObjectImpl*> objectsToCheck;
+        collectObjectsToCheck(objects, objectsToCheck);
+        checkObjects(objectsToCheck);
+        m_numObjectsChecked = objectsToCheck.size();
+
+        for (const auto* object : objects)
+            mergeResult(report, *object);
+
+        if (!m_incremental)
+            m_results.clear();
+    }
+
+    size_t SceneValidator::getNumberOfObjectsCheckedInLastValidation() const
+    {
+        return m_numObjectsChecked;
+    }
+
+    void SceneValidator::collectObjects(std::vector<const SceneObjectImpl*>& objects) const
+    {
+        for (size_t i = 0u; i < RamsesObjectTypeCount; ++i)
+        {
+            const auto type = static_cast<ERamsesObjectType>(i);
+            if (RamsesObjectTypeUtils::IsTypeMatchingBaseType(type, ERamsesObjectType::SceneObject)
+                && RamsesObjectTypeUtils::IsConcreteType(type))
+            {
+                SceneObjectRegistryIterator iter(m_registry, type);
+                while (const auto* obj = iter.getNext())
+                    objects.push_back(&obj->impl());
+            }
+        }
+    }
+
+    void SceneValidator::collectObjectsToCheck(const std::vector<const SceneObjectImpl*>& objects, std::vector<const SceneObjectImpl*>& objectsToCheck) const
+    {
+        if (m_results.empty())
+        {
+            objectsToCheck = objects;
+            return;
+        }
+
+        // results of objects depending on a modified object (directly or indirectly) are outdated as well
+        std::unordered_set<const RamsesObjectImpl*> outdated;
+        std::vector<const RamsesObjectImpl*> outdatedToPropagate;
+        for (const auto* object : objects)
+        {
+            if (object->isModifiedSinceValidation() || m_results.count(object) == 0u)
+            {
+                outdated.insert(object);
+                outdatedToPropagate.push_back(object);
+            }
+        }
+
+        if (!outdatedToPropagate.empty())
+        {
+            std::unordered_map<const RamsesObjectImpl*, std::vector<const RamsesObjectImpl*>> dependingObjects;
+            for (const auto& result : m_results)
+            {
+                for (const auto* dependency : result.second.dependencies)
+                    dependingObjects[dependency].push_back(result.first);
+            }
+
+            while (!outdatedToPropagate.empty())
+            {
+                const auto* object = outdatedToPropagate.back();
+                outdatedToPropagate.pop_back();
+                const auto it = dependingObjects.find(object);
+                if (it == dependingObjects.cend())
+                    continue;
+                for (const auto* dependingObject : it->second)
+                {
+                    if (outdated.insert(dependingObject).second)
+                        outdatedToPropagate.push_back(dependingObject);
+                }
+            }
+        }
+
+        for (const auto* object : objects)
+        {
+            if (!object->isValidationResultCacheable() || outdated.count(object) != 0u)
+                objectsToCheck.push_back(object);
+        }
+    }
+
+    void SceneValidator::checkObjects(const std::vector<const SceneObjectImpl*>& objectsToCheck)
+    {
+        std::vector<ObjectResult> results(objectsToCheck.size());
+
+        // loading and decompressing of resources is done on calling thread (see SceneObjectImpl::prepareValidation),
+        // logic engines access their lua environment when checked and are checked on calling thread as well
+        std::vector<size_t> concurrentChecks;
+        concurrentChecks.reserve(objectsToCheck.size());
+        for (size_t i = 0u; i < objectsToCheck.size(); ++i)
+        {
+            if (objectsToCheck[i]->getType() == ERamsesObjectType::LogicEngine)
+            {
+                CheckObject(*objectsToCheck[i], results[i]);
+            }
+            else
+            {
+                objectsToCheck[i]->prepareValidation();
+                concurrentChecks.push_back(i);
+            }
+        }
+
+        // every object reports into its own result, merging them does not depend on order of execution
+        ParallelTaskGroup taskGroup(m_taskQueue);
+        for (size_t begin = 0u; begin < concurrentChecks.size(); begin += ObjectsPerTask)
+        {
+            const size_t end = std::min(begin + ObjectsPerTask, concurrentChecks.size());
+            taskGroup.add([&, begin, end]() {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const size_t objectIndex = concurrentChecks[i];
+                    CheckObject(*objectsToCheck[objectIndex], results[objectIndex]);
+                }
+            });
+        }
+        taskGroup.execute();
+
+        for (auto& result : results)
+        {
+            const SceneObjectImpl* object = result.object;
+            object->resetModifiedSinceValidation();
+            m_results[object] = std::move(result);
+        }
+    }
+
+    void SceneValidator::CheckObject(const SceneObjectImpl& object, ObjectResult& result)
+    {
+        ValidationReportImpl objectReport;
+        object.validateWithoutDependencies(objectReport);
+
+        result.object = &object;
+        result.issues = objectReport.getIssues();
+        result.dependencies = objectReport.getDependentObjects(&object);
+    }
+
+    void SceneValidator::mergeResult(ValidationReportImpl& report, const RamsesObjectImpl& object) const
+    {
+        // same traversal as RamsesObjectImpl::validate
+        if (!report.addVisit(&object))
+            return;
+
+        const auto it = m_results.find(&object);
+        if (it == m_results.cend())
+        {
+            // not an object of this scene, checked as in serial validation
+            object.validateWithoutDependencies(report);
+            for (const auto* dependency : report.getDependentObjects(&object))
+                mergeResult(report, *dependency);
+            return;
+        }
+
+        const ObjectResult& result = it->second;
+
+        for (const auto& issue : result.issues)
+            report.add(issue.type, issue.message, issue.object);
+        for (const auto* dependency : result.dependencies)
+            report.addDependentObject(object, *dependency);
+
+        for (const auto* dependency : result.dependencies)
+            mergeResult(report, *dependency);
+    }
+}
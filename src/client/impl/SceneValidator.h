@@ -0,0 +1,60 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses/framework/Issue.h"
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace ramses::internal
+{
+    class ITaskQueue;
+    class RamsesObjectImpl;
+    class SceneObjectImpl;
+    class SceneObjectRegistry;
+    class ValidationReportImpl;
+
+    // Validates all objects of a scene. Checks of the objects run in parallel on given task queue, their results are merged
+    // in the order of serial validation (see RamsesObjectImpl::validate) so that the report does not depend on scheduling.
+    // With incremental validation results of objects are kept and reused for objects which were not modified since last validation
+    // (see SceneObjectImpl::isValidationResultCacheable), objects depending on modified objects are always checked again.
+    class SceneValidator
+    {
+    public:
+        SceneValidator(const SceneObjectRegistry& registry, ITaskQueue* taskQueue, bool incremental);
+
+        void validate(ValidationReportImpl& report);
+
+        [[nodiscard]] size_t getNumberOfObjectsCheckedInLastValidation() const;
+
+    private:
+        struct ObjectResult
+        {
+            const SceneObjectImpl* object = nullptr;
+            std::vector<Issue> issues;
+            std::vector<const RamsesObjectImpl*> dependencies;
+        };
+
+        void collectObjects(std::vector<const SceneObjectImpl*>& objects) const;
+        void collectObjectsToCheck(const std::vector<const SceneObjectImpl*>& objects, std::vector<const SceneObjectImpl*>& objectsToCheck) const;
+        void checkObjects(const std::vector<const SceneObjectImpl*>& objectsToCheck);
+        static void CheckObject(const SceneObjectImpl& object, ObjectResult& result);
+        void mergeResult(ValidationReportImpl& report, const RamsesObjectImpl& object) const;
+
+        const SceneObjectRegistry& m_registry;
+        ITaskQueue* m_taskQueue;
+        const bool m_incremental;
+
+        std::unordered_map<const RamsesObjectImpl*, ObjectResult> m_results;
+        uint64_t m_resultsRegistryRevision = 0u;
+        size_t m_numObjectsChecked = 0u;
+    };
+}
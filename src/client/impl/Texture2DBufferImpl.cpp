@@ -114,6 +114,36 @@ namespace ramses::internal
         return true;
     }
 
+    bool Texture2DBufferImpl::getMipLevelSubregionData(size_t mipLevel, uint32_t offsetX, uint32_t offsetY, uint32_t width, uint32_t height, std::byte* buffer) const
+    {
+        const auto& texBuffer = getIScene().getTextureBuffer(m_textureBufferHandle);
+        if (mipLevel >= texBuffer.mipMaps.size())
+        {
+            getErrorReporting().set("Texture2DBuffer::getMipLevelSubregionData failed, requested mipLevel does not exist in Texture2DBuffer.");
+            return false;
+        }
+
+        const auto& mip = texBuffer.mipMaps[mipLevel];
+        if (offsetX + width > mip.width || offsetY + height > mip.height)
+        {
+            getErrorReporting().set("Texture2DBuffer::getMipLevelSubregionData failed, requested subregion exceeds the size of the mipLevel.");
+            return false;
+        }
+
+        const uint32_t texelSize = ramses::internal::GetTexelSizeFromFormat(texBuffer.textureFormat);
+        const size_t rowSize = size_t(width) * texelSize;
+        const size_t mipRowSize = size_t(mip.width) * texelSize;
+        const std::byte* sourcePtr = mip.data.data() + size_t(offsetY) * mipRowSize + size_t(offsetX) * texelSize;
+        for (uint32_t i = 0u; i < height; ++i)
+        {
+            ramses::internal::PlatformMemory::Copy(buffer, sourcePtr, rowSize);
+            buffer += rowSize;
+            sourcePtr += mipRowSize;
+        }
+
+        return true;
+    }
+
     bool Texture2DBufferImpl::getMipLevelSize(size_t mipLevel, uint32_t& widthOut, uint32_t& heightOut) const
     {
         const auto& mipMaps = getIScene().getTextureBuffer(m_textureBufferHandle).mipMaps;
@@ -34,6 +34,8 @@ namespace ramses::internal
         [[nodiscard]] size_t getMipLevelCount() const;
         [[nodiscard]] ETextureFormat getTexelFormat() const;
         bool getMipLevelData(size_t mipLevel, char* buffer, size_t bufferSize) const;
+        // reads back a subregion in row-major order, buffer must be able to hold width * height texels
+        bool getMipLevelSubregionData(size_t mipLevel, uint32_t offsetX, uint32_t offsetY, uint32_t width, uint32_t height, std::byte* buffer) const;
         bool getMipLevelSize(size_t mipLevel, uint32_t& widthOut, uint32_t& heightOut) const;
         [[nodiscard]] size_t getMipLevelDataSizeInBytes(size_t mipLevel) const;
 
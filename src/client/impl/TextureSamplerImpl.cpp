@@ -265,6 +265,11 @@ namespace ramses::internal
         }
     }
 
+    bool TextureSamplerImpl::isValidationResultCacheable() const
+    {
+        return true;
+    }
+
     void TextureSamplerImpl::validateRenderBuffer(ValidationReportImpl& report, ramses::internal::RenderBufferHandle renderBufferHandle) const
     {
         bool foundRenderBuffer = false;
@@ -50,6 +50,7 @@ namespace ramses::internal
         [[nodiscard]] bool serialize(ramses::internal::IOutputStream& outStream, SerializationContext& serializationContext) const override;
         [[nodiscard]] bool deserialize(ramses::internal::IInputStream& inStream, DeserializationContext& serializationContext) override;
         void onValidate(ValidationReportImpl& report) const override;
+        [[nodiscard]] bool isValidationResultCacheable() const override;
 
         [[nodiscard]] ETextureAddressMode getWrapUMode() const;
         [[nodiscard]] ETextureAddressMode getWrapVMode() const;
@@ -143,6 +143,11 @@ namespace ramses::internal
         return std::nullopt;
     }
 
+    bool AnchorPointImpl::readsRamsesObjects() const
+    {
+        return true;
+    }
+
     NodeBindingImpl& AnchorPointImpl::getNodeBinding()
     {
         return m_nodeBinding;
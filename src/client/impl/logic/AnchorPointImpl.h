@@ -54,6 +54,7 @@ namespace ramses::internal
         [[nodiscard]] CameraBindingImpl& getCameraBinding();
 
         std::optional<LogicNodeRuntimeError> update() override;
+        [[nodiscard]] bool readsRamsesObjects() const override;
 
         void createRootProperties() final;
 
@@ -16,6 +16,8 @@
 #include "ramses/client/logic/Property.h"
 
 #include "impl/logic/PropertyImpl.h"
+#include "impl/AppearanceImpl.h"
+#include "impl/EffectInputImpl.h"
 
 #include "internal/logic/RamsesHelper.h"
 #include "impl/ErrorReporting.h"
@@ -171,17 +173,33 @@ namespace ramses::internal
     }
 
     std::optional<LogicNodeRuntimeError> AppearanceBindingImpl::update()
+    {
+        if (collectChanges())
+            writeCollectedChanges();
+
+        return std::nullopt;
+    }
+
+    std::optional<LogicNodeRuntimeError> AppearanceBindingImpl::updateBatched(BindingWriteBatch& writeBatch)
+    {
+        if (collectChanges())
+            writeBatch.push_back(this);
+
+        return std::nullopt;
+    }
+
+    bool AppearanceBindingImpl::collectChanges()
     {
         const size_t childCount = getInputs()->getChildCount();
         for (size_t i = 0; i < childCount; ++i)
         {
-            setInputValueToUniform(i);
+            collectInputValue(i);
         }
 
-        return std::nullopt;
+        return !m_collectedUniforms.empty();
     }
 
-    void AppearanceBindingImpl::setInputValueToUniform(size_t inputIndex)
+    void AppearanceBindingImpl::collectInputValue(size_t inputIndex)
     {
         assert(inputIndex < m_uniforms.size());
         PropertyImpl& inputProperty = getInputs()->getChild(inputIndex)->impl();
@@ -191,17 +209,8 @@ namespace ramses::internal
         {
             if (inputProperty.checkForBindingInputNewValueAndReset())
             {
-                std::visit([&](auto v) {
-                    using ValueType = std::remove_const_t<std::remove_reference_t<decltype(v)>>;
-                    if constexpr (ramses::IsUniformInputDataType<ValueType>())
-                    {
-                        m_ramsesAppearance.get().setInputValue(m_uniforms[inputIndex], ValueType{ std::move(v) });
-                    }
-                    else
-                    {
-                        assert(false && "This should never happen");
-                    }
-                }, inputProperty.getValue());
+                m_collectedUniforms.push_back({ inputIndex, m_collectedValues.size(), 1u });
+                m_collectedValues.push_back(inputProperty.getValue());
             }
         }
         else
@@ -220,34 +229,56 @@ namespace ramses::internal
 
             if (anyArrayElementWasSet)
             {
-                std::visit([&](const auto& v) {
-                    using ValueType = std::remove_const_t<std::remove_reference_t<decltype(v)>>;
-                    if constexpr (ramses::IsUniformInputDataType<ValueType>())
+                m_collectedUniforms.push_back({ inputIndex, m_collectedValues.size(), arraySize });
+                for (size_t i = 0; i < arraySize; ++i)
+                    m_collectedValues.push_back(inputProperty.getChild(i)->impl().getValue());
+            }
+        }
+    }
+
+    void AppearanceBindingImpl::writeCollectedChanges()
+    {
+        // set through appearance implementation directly, uniforms and value types were validated when creating the binding
+        AppearanceImpl& appearance = m_ramsesAppearance.get().impl();
+        for (const auto& collected : m_collectedUniforms)
+        {
+            const EffectInputImpl& uniform = m_uniforms[collected.inputIndex].impl();
+            std::visit([&](const auto& v) {
+                using ValueType = std::remove_const_t<std::remove_reference_t<decltype(v)>>;
+                if constexpr (ramses::IsUniformInputDataType<ValueType>())
+                {
+                    if (collected.valueCount == 1u)
                     {
-                        if constexpr (std::is_same_v<ValueType, bool>) // special handling for bool array, cannot use vector<bool>
-                        {
-                            // NOLINTNEXTLINE(modernize-avoid-c-arrays)
-                            auto values = std::make_unique<bool[]>(inputProperty.getChildCount());
-                            for (size_t i = 0u; i < inputProperty.getChildCount(); ++i)
-                                values[i] = *inputProperty.getChild(i)->get<bool>();
-
-                            m_ramsesAppearance.get().setInputValue(m_uniforms[inputIndex], inputProperty.getChildCount(), values.get());
-                        }
-                        else
-                        {
-                            std::vector<ValueType> values;
-                            values.reserve(inputProperty.getChildCount());
-                            for (size_t i = 0u; i < inputProperty.getChildCount(); ++i)
-                                values.push_back(ValueType{ *inputProperty.getChild(i)->get<ValueType>() });
-
-                            m_ramsesAppearance.get().setInputValue(m_uniforms[inputIndex], values.size(), values.data());
-                        }
+                        appearance.setInputValue(uniform, 1u, &v);
+                    }
+                    else if constexpr (std::is_same_v<ValueType, bool>) // special handling for bool array, cannot use vector<bool>
+                    {
+                        // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+                        auto values = std::make_unique<bool[]>(collected.valueCount);
+                        for (size_t i = 0u; i < collected.valueCount; ++i)
+                            values[i] = std::get<bool>(m_collectedValues[collected.firstValue + i]);
+
+                        appearance.setInputValue(uniform, collected.valueCount, values.get());
                     }
                     else
-                        assert(false && "This should never happen");
-                }, inputProperty.getChild(0u)->impl().getValue()); // small trick to determine the element type so that the flattened array can be declared in templated code
-            }
+                    {
+                        std::vector<ValueType> values;
+                        values.reserve(collected.valueCount);
+                        for (size_t i = 0u; i < collected.valueCount; ++i)
+                            values.push_back(std::get<ValueType>(m_collectedValues[collected.firstValue + i]));
+
+                        appearance.setInputValue(uniform, values.size(), values.data());
+                    }
+                }
+                else
+                {
+                    assert(false && "This should never happen");
+                }
+            }, m_collectedValues[collected.firstValue]); // type of first element determines type of the whole array
         }
+
+        m_collectedUniforms.clear();
+        m_collectedValues.clear();
     }
 
     ramses::Appearance& AppearanceBindingImpl::getRamsesAppearance() const
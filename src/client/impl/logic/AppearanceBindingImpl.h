@@ -62,14 +62,27 @@ namespace ramses::internal
         [[nodiscard]] ramses::Appearance& getRamsesAppearance() const;
 
         std::optional<LogicNodeRuntimeError> update() override;
+        std::optional<LogicNodeRuntimeError> updateBatched(BindingWriteBatch& writeBatch) override;
+        void writeCollectedChanges() override;
 
         void createRootProperties() final;
 
     private:
+        // Array uniforms are collected as a range of element values
+        struct CollectedUniformValue
+        {
+            size_t inputIndex;
+            size_t firstValue;
+            size_t valueCount;
+        };
+
         std::reference_wrapper<ramses::Appearance> m_ramsesAppearance;
         std::vector<ramses::UniformInput> m_uniforms;
+        std::vector<CollectedUniformValue> m_collectedUniforms;
+        std::vector<PropertyValue> m_collectedValues;
 
-        void setInputValueToUniform(size_t inputIndex);
+        [[nodiscard]] bool collectChanges();
+        void collectInputValue(size_t inputIndex);
 
         static std::optional<EPropertyType> GetPropertyTypeForUniform(const ramses::UniformInput& uniform);
     };
@@ -16,6 +16,7 @@
 #include "ramses/client/logic/Property.h"
 
 #include "impl/logic/PropertyImpl.h"
+#include "impl/CameraNodeImpl.h"
 #include "fmt/format.h"
 
 #include "internal/logic/RamsesHelper.h"
@@ -193,7 +194,8 @@ namespace ramses::internal
                 return LogicNodeRuntimeError{ fmt::format("Camera viewport size must be positive! (width: {}; height: {})", vpW, vpH) };
             }
 
-            if (!m_ramsesCamera.get().setViewport(vpX, vpY, vpW, vpH))
+            // cameras are not batched because their values can fail validation, still skip the API logging
+            if (!m_ramsesCamera.get().impl().setViewport(vpX, vpY, static_cast<uint32_t>(vpW), static_cast<uint32_t>(vpH)))
                 return LogicNodeRuntimeError{ getErrorReporting().getError()->message };
         }
 
@@ -217,7 +219,7 @@ namespace ramses::internal
                 || bottomPlane.checkForBindingInputNewValueAndReset()
                 || topPlane.checkForBindingInputNewValueAndReset())
             {
-                if (!m_ramsesCamera.get().setFrustum(
+                if (!m_ramsesCamera.get().impl().setFrustum(
                     leftPlane.getValueAs<float>(),
                     rightPlane.getValueAs<float>(),
                     bottomPlane.getValueAs<float>(),
@@ -240,8 +242,7 @@ namespace ramses::internal
                 || aR.checkForBindingInputNewValueAndReset())
             {
                 assert(m_ramsesCamera.get().isOfType(ramses::ERamsesObjectType::PerspectiveCamera));
-                auto* perspectiveCam = m_ramsesCamera.get().as<PerspectiveCamera>();
-                if (!perspectiveCam->setFrustum(fov.getValueAs<float>(), aR.getValueAs<float>(), nearPlane.getValueAs<float>(), farPlane.getValueAs<float>()))
+                if (!m_ramsesCamera.get().impl().setPerspectiveFrustum(fov.getValueAs<float>(), aR.getValueAs<float>(), nearPlane.getValueAs<float>(), farPlane.getValueAs<float>()))
                     return LogicNodeRuntimeError{ getErrorReporting().getError()->message };
             }
         }
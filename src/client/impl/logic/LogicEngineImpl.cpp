@@ -450,14 +450,20 @@ namespace ramses::internal
                     continue;
             }
 
+            // changes collected from bindings so far must be visible to nodes reading Ramses objects
+            if (node.readsRamsesObjects())
+                writeBatchedBindingChanges();
+
             if (m_updateReportEnabled)
                 m_updateReport.nodeExecutionStarted(node);
             if (m_statisticsEnabled)
                 m_statistics.nodeExecuted();
 
-            const std::optional<LogicNodeRuntimeError> potentialError = node.update();
+            const std::optional<LogicNodeRuntimeError> potentialError = node.updateBatched(m_bindingWriteBatch);
             if (potentialError)
             {
+                // changes of bindings updated before the failing node are written, as if they were not batched
+                writeBatchedBindingChanges();
                 getErrorReporting().set(potentialError->message, &node.getLogicObject());
                 return false;
             }
@@ -477,9 +483,18 @@ namespace ramses::internal
             node.setDirty(false);
         }
 
+        writeBatchedBindingChanges();
+
         return true;
     }
 
+    void LogicEngineImpl::writeBatchedBindingChanges()
+    {
+        for (RamsesBindingImpl* binding : m_bindingWriteBatch)
+            binding->writeCollectedChanges();
+        m_bindingWriteBatch.clear();
+    }
+
     void LogicEngineImpl::setNodeToBeAlwaysUpdatedDirty()
     {
         // force timer nodes dirty so they can update their ticker
@@ -679,8 +694,9 @@ namespace ramses::internal
         inStream >> size;
         m_byteBuffer.resize(size);
         inStream.read(m_byteBuffer.data(), size);
-        // we need to parse the byte buffer later when all scene objects are available
-        serializationContext.addForDependencyResolve(this);
+        // we need to parse the byte buffer later when all scene objects are available,
+        // logic engines only read the scene when loading and can be loaded in parallel to each other
+        serializationContext.addForConcurrentDependencyResolve(this);
         return true;
     }
 
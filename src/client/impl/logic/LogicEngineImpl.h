@@ -19,6 +19,7 @@
 #include "internal/logic/UpdateReport.h"
 #include "internal/logic/LogicNodeUpdateStatistics.h"
 #include "internal/logic/ApiObjectsSerializedSize.h"
+#include "impl/logic/LogicNodeImpl.h"
 
 #include "ramses/framework/RamsesFrameworkTypes.h"
 #include "ramses/framework/ERotationType.h"
@@ -137,6 +138,7 @@ namespace ramses::internal
         void setNodeToBeAlwaysUpdatedDirty();
 
         [[nodiscard]] bool updateNodes(const NodeVector& nodes);
+        void writeBatchedBindingChanges();
 
         [[nodiscard]] bool loadFromByteData(const void* byteData, size_t byteSize, bool enableMemoryVerification, const std::string& dataSourceDescription);
 
@@ -149,6 +151,7 @@ namespace ramses::internal
         bool m_statisticsEnabled   = true;
         UpdateReport m_updateReport;
         LogicNodeUpdateStatistics m_statistics;
+        BindingWriteBatch         m_bindingWriteBatch;
         std::vector<char>         m_byteBuffer;
     };
 
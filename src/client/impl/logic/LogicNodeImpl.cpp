@@ -41,6 +41,16 @@ namespace ramses::internal
         return m_outputs.get();
     }
 
+    std::optional<LogicNodeRuntimeError> LogicNodeImpl::updateBatched(BindingWriteBatch& /*writeBatch*/)
+    {
+        return update();
+    }
+
+    bool LogicNodeImpl::readsRamsesObjects() const
+    {
+        return false;
+    }
+
     void LogicNodeImpl::setDirty(bool dirty)
     {
         m_dirty = dirty;
@@ -20,6 +20,9 @@ namespace ramses::internal
 {
     struct LogicNodeRuntimeError { std::string message; };
 
+    class RamsesBindingImpl;
+    using BindingWriteBatch = std::vector<RamsesBindingImpl*>;
+
     class LogicNodeImpl : public LogicObjectImpl
     {
     public:
@@ -36,6 +39,12 @@ namespace ramses::internal
         virtual void createRootProperties() = 0;
         virtual std::optional<LogicNodeRuntimeError> update() = 0;
 
+        // Used by logic engine instead of update(). Bindings supporting it only collect their changes and add themselves
+        // to the batch, logic engine then writes changes of all batched bindings to Ramses in one pass.
+        virtual std::optional<LogicNodeRuntimeError> updateBatched(BindingWriteBatch& writeBatch);
+        // Nodes reading Ramses objects need the batched changes written before they are updated
+        [[nodiscard]] virtual bool readsRamsesObjects() const;
+
         void setDirty(bool dirty);
         [[nodiscard]] bool isDirty() const;
 
@@ -31,6 +31,7 @@ namespace ramses::internal
         , m_dependencies{ std::move(module.source.userModules) }
         , m_stdModules{ std::move(module.source.stdModules) }
         , m_hasDebugLogFunctions{ module.source.hasDebugLogFunctions }
+        , m_contentHash{ module.contentHash }
     {
         assert(m_module != sol::lua_nil);
     }
@@ -40,6 +41,11 @@ namespace ramses::internal
         return m_module;
     }
 
+    size_t LuaModuleImpl::getContentHash() const
+    {
+        return m_contentHash;
+    }
+
     flatbuffers::Offset<rlogic_serialization::LuaModule> LuaModuleImpl::Serialize(
         const LuaModuleImpl& module,
         flatbuffers::FlatBufferBuilder& builder,
@@ -46,6 +46,7 @@ namespace ramses::internal
         [[nodiscard]] const sol::table& getModule() const;
         [[nodiscard]] const ModuleMapping& getDependencies() const;
         [[nodiscard]] bool hasDebugLogFunctions() const;
+        [[nodiscard]] size_t getContentHash() const;
 
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::LuaModule> Serialize(
             const LuaModuleImpl& module,
@@ -66,5 +67,6 @@ namespace ramses::internal
         ModuleMapping m_dependencies;
         StandardModules m_stdModules;
         bool m_hasDebugLogFunctions;
+        size_t m_contentHash;
     };
 }
@@ -13,6 +13,7 @@
 #include "ramses/client/logic/Property.h"
 
 #include "impl/logic/PropertyImpl.h"
+#include "impl/NodeImpl.h"
 #include "internal/Core/Utils/LogMacros.h"
 
 #include "impl/ErrorReporting.h"
@@ -20,6 +21,7 @@
 
 #include "internal/logic/flatbuffers/generated/NodeBindingGen.h"
 #include "glm/gtc/type_ptr.hpp"
+#include <cassert>
 
 namespace ramses::internal
 {
@@ -146,6 +148,22 @@ namespace ramses::internal
     }
 
     std::optional<LogicNodeRuntimeError> NodeBindingImpl::update()
+    {
+        if (collectChanges())
+            writeCollectedChanges();
+
+        return std::nullopt;
+    }
+
+    std::optional<LogicNodeRuntimeError> NodeBindingImpl::updateBatched(BindingWriteBatch& writeBatch)
+    {
+        if (collectChanges())
+            writeBatch.push_back(this);
+
+        return std::nullopt;
+    }
+
+    bool NodeBindingImpl::collectChanges()
     {
         PropertyImpl& visibility = getInputs()->getChild(static_cast<size_t>(ENodePropertyStaticIndex::Visibility))->impl();
         PropertyImpl& enabled = getInputs()->getChild(static_cast<size_t>(ENodePropertyStaticIndex::Enabled))->impl();
@@ -160,46 +178,64 @@ namespace ramses::internal
             if (!enabled.getValueAs<bool>())
                 visibilityMode = ramses::EVisibilityMode::Off;
 
-            if (!m_ramsesNode.get().setVisibility(visibilityMode))
-                return LogicNodeRuntimeError{ getErrorReporting().getError()->message };
+            m_collectedChanges.visibility = visibilityMode;
         }
 
         PropertyImpl& rotation = getInputs()->getChild(static_cast<size_t>(ENodePropertyStaticIndex::Rotation))->impl();
         if (rotation.checkForBindingInputNewValueAndReset())
         {
-            bool status = false;
             if (m_rotationType == ramses::ERotationType::Quaternion)
             {
-                const auto& value = rotation.getValueAs<vec4f>();
-                status = m_ramsesNode.get().setRotation(quat(value[3], value[0], value[1], value[2]));
+                m_collectedChanges.rotation = rotation.getValueAs<vec4f>();
             }
             else
             {
                 const auto& valuesEuler = rotation.getValueAs<vec3f>();
-                status = m_ramsesNode.get().setRotation(valuesEuler, m_rotationType);
+                m_collectedChanges.rotation = vec4f{ valuesEuler, 0.f };
             }
-
-            if (!status)
-                return LogicNodeRuntimeError{getErrorReporting().getError()->message};
         }
 
         PropertyImpl& translation = getInputs()->getChild(static_cast<size_t>(ENodePropertyStaticIndex::Translation))->impl();
         if (translation.checkForBindingInputNewValueAndReset())
-        {
-            const auto& value = translation.getValueAs<vec3f>();
-            if (!m_ramsesNode.get().setTranslation(value))
-                return LogicNodeRuntimeError{ getErrorReporting().getError()->message };
-        }
+            m_collectedChanges.translation = translation.getValueAs<vec3f>();
 
         PropertyImpl& scaling = getInputs()->getChild(static_cast<size_t>(ENodePropertyStaticIndex::Scaling))->impl();
         if (scaling.checkForBindingInputNewValueAndReset())
+            m_collectedChanges.scaling = scaling.getValueAs<vec3f>();
+
+        return m_collectedChanges.visibility || m_collectedChanges.rotation || m_collectedChanges.translation || m_collectedChanges.scaling;
+    }
+
+    void NodeBindingImpl::writeCollectedChanges()
+    {
+        // values were validated by property types already, setters of the node implementation cannot fail for them
+        // and are used directly to skip the API logging for every value
+        NodeImpl& node = m_ramsesNode.get().impl();
+
+        if (m_collectedChanges.visibility)
+            node.setVisibility(*m_collectedChanges.visibility);
+
+        if (m_collectedChanges.rotation)
         {
-            const auto& value = scaling.getValueAs<vec3f>();
-            if (!m_ramsesNode.get().setScaling(value))
-                return LogicNodeRuntimeError{ getErrorReporting().getError()->message };
+            const auto& value = *m_collectedChanges.rotation;
+            if (m_rotationType == ramses::ERotationType::Quaternion)
+            {
+                node.setRotation(quat(value[3], value[0], value[1], value[2]));
+            }
+            else
+            {
+                [[maybe_unused]] const bool status = node.setRotation(vec3f{ value }, m_rotationType);
+                assert(status);
+            }
         }
 
-        return std::nullopt;
+        if (m_collectedChanges.translation)
+            node.setTranslation(*m_collectedChanges.translation);
+
+        if (m_collectedChanges.scaling)
+            node.setScaling(*m_collectedChanges.scaling);
+
+        m_collectedChanges = {};
     }
 
     ramses::Node& NodeBindingImpl::getRamsesNode() const
@@ -13,8 +13,11 @@
 #include "internal/logic/SerializationMap.h"
 #include "internal/logic/DeserializationMap.h"
 #include "ramses/framework/ERotationType.h"
+#include "ramses/framework/EVisibilityMode.h"
+#include "ramses/framework/DataTypes.h"
 
 #include <memory>
+#include <optional>
 
 namespace ramses
 {
@@ -71,12 +74,27 @@ namespace ramses::internal
         [[nodiscard]] ramses::ERotationType getRotationType() const;
 
         std::optional<LogicNodeRuntimeError> update() override;
+        std::optional<LogicNodeRuntimeError> updateBatched(BindingWriteBatch& writeBatch) override;
+        void writeCollectedChanges() override;
 
         void createRootProperties() final;
 
     private:
+        // Values are copied when collected, weakly linked inputs can receive new values before the batch is written
+        struct CollectedChanges
+        {
+            std::optional<ramses::EVisibilityMode> visibility;
+            std::optional<vec4f> rotation;
+            std::optional<vec3f> translation;
+            std::optional<vec3f> scaling;
+        };
+
+        [[nodiscard]] bool collectChanges();
+
         static void ApplyRamsesValuesToInputProperties(NodeBindingImpl& binding, ramses::Node& ramsesNode);
 
+        CollectedChanges m_collectedChanges;
+
         std::reference_wrapper<ramses::Node> m_ramsesNode;
         ramses::ERotationType m_rotationType;
     };
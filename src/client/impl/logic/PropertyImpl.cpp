@@ -14,6 +14,7 @@
 
 #include "internal/logic/SerializationHelper.h"
 #include "internal/logic/TypeUtils.h"
+#include "internal/logic/StructFieldIndex.h"
 #include "impl/ErrorReporting.h"
 #include "internal/logic/TypeUtils.h"
 
@@ -73,10 +74,9 @@ namespace ramses::internal
         }
         else
         {
-            for (const auto& childType : type.children)
-            {
-                m_children.emplace_back(CreateProperty(std::make_unique<PropertyImpl>(childType, semantics)));
-            }
+            // Structs of the same type within this property (e.g. elements of an array of structs) share one field index
+            StructFieldIndexCache structFieldIndices;
+            createChildren(type, structFieldIndices);
         }
     }
 
@@ -405,6 +405,8 @@ namespace ramses::internal
 
                 impl->m_children.push_back(CreateProperty(std::move(deserializedChild)));
             }
+
+            impl->assignStructFieldIndex(deserializationMap.getStructFieldIndexCache());
         }
 
         deserializationMap.storePropertyImpl(prop, *impl);
@@ -457,12 +459,10 @@ namespace ramses::internal
 
     const Property* PropertyImpl::getChild(std::string_view name) const
     {
-        auto it = std::find_if(m_children.begin(), m_children.end(), [&name](const auto& property) {
-            return property->getName() == name;
-        });
-        if (it != m_children.end())
+        const std::optional<size_t> childIndex = findChildIndex(name);
+        if (childIndex)
         {
-            return it->get();
+            return m_children[*childIndex].get();
         }
         LOG_ERROR_P(CONTEXT_CLIENT, "No child property with name '{}' found in '{}'", name, m_typeData.name);
         return nullptr;
@@ -470,9 +470,49 @@ namespace ramses::internal
 
     bool PropertyImpl::hasChild(std::string_view name) const
     {
-        return m_children.end() != std::find_if(m_children.begin(), m_children.end(), [&name](const auto& property) {
+        return findChildIndex(name).has_value();
+    }
+
+    std::optional<size_t> PropertyImpl::findChildIndex(std::string_view name) const
+    {
+        if (m_structFieldIndex)
+            return m_structFieldIndex->find(name);
+
+        auto it = std::find_if(m_children.begin(), m_children.end(), [&name](const auto& property) {
             return property->getName() == name;
-            });
+        });
+        if (it != m_children.end())
+            return static_cast<size_t>(std::distance(m_children.begin(), it));
+
+        return std::nullopt;
+    }
+
+    void PropertyImpl::createChildren(const HierarchicalTypeData& type, StructFieldIndexCache& structFieldIndices)
+    {
+        for (const auto& childType : type.children)
+        {
+            auto child = std::make_unique<PropertyImpl>(HierarchicalTypeData(childType.typeData, {}), m_semantics);
+            child->createChildren(childType, structFieldIndices);
+            m_children.emplace_back(CreateProperty(std::move(child)));
+        }
+
+        // Types of Lua scripts carry their field indices, these are shared by all instances of the script
+        if (type.structFieldIndex)
+            m_structFieldIndex = type.structFieldIndex;
+        else
+            assignStructFieldIndex(structFieldIndices);
+    }
+
+    void PropertyImpl::assignStructFieldIndex(StructFieldIndexCache& structFieldIndices)
+    {
+        if (m_typeData.type != EPropertyType::Struct || m_children.size() < StructFieldIndex::MinFieldCount)
+            return;
+
+        std::vector<std::string> fieldNames;
+        fieldNames.reserve(m_children.size());
+        for (const auto& child : m_children)
+            fieldNames.emplace_back(child->getName());
+        m_structFieldIndex = structFieldIndices.get(std::move(fieldNames));
     }
 
     std::vector<const Property*> PropertyImpl::collectLeafChildren() const
@@ -43,6 +43,8 @@ namespace ramses::internal
 {
     class LogicNodeImpl;
     class ErrorReporting;
+    class StructFieldIndex;
+    class StructFieldIndexCache;
 
     using PropertyValue = std::variant<int32_t, int64_t, float, bool, std::string, vec2f, vec3f, vec4f, vec2i, vec3i, vec4i>;
     using PropertyUniquePtr = std::unique_ptr<Property, std::function<void(Property*)>>;
@@ -94,6 +96,7 @@ namespace ramses::internal
         [[nodiscard]] Property* getChild(std::string_view name);
         [[nodiscard]] const Property* getChild(std::string_view name) const;
         [[nodiscard]] bool hasChild(std::string_view name) const;
+        [[nodiscard]] std::optional<size_t> findChildIndex(std::string_view name) const;
 
         [[nodiscard]] std::vector<const Property*> collectLeafChildren() const;
 
@@ -143,6 +146,8 @@ namespace ramses::internal
         TypeData        m_typeData;
         PropertyList    m_children;
         PropertyValue   m_value;
+        // Only for structs with many fields, shared with other struct properties of the same type (see StructFieldIndexCache)
+        std::shared_ptr<const StructFieldIndex> m_structFieldIndex;
 
         Link m_incomingLink;
         std::vector<Link> m_outgoingLinks;
@@ -153,6 +158,9 @@ namespace ramses::internal
         bool m_bindingInputHasNewValue = false;
         EPropertySemantics m_semantics;
 
+        void createChildren(const HierarchicalTypeData& type, StructFieldIndexCache& structFieldIndices);
+        void assignStructFieldIndex(StructFieldIndexCache& structFieldIndices);
+
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::Property> SerializeRecursive(
             const PropertyImpl& prop,
             flatbuffers::FlatBufferBuilder& builder,
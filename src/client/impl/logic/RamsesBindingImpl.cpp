@@ -23,6 +23,10 @@ namespace ramses::internal
         setDirty(false);
     }
 
+    void RamsesBindingImpl::writeCollectedChanges()
+    {
+    }
+
     flatbuffers::Offset<rlogic_serialization::RamsesReference> RamsesBindingImpl::SerializeRamsesReference(const ramses::SceneObject& object, flatbuffers::FlatBufferBuilder& builder)
     {
         const ramses::sceneObjectId_t ramsesObjectId = object.getSceneObjectId();
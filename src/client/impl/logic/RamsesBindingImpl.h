@@ -34,6 +34,9 @@ namespace ramses::internal
     public:
         explicit RamsesBindingImpl(SceneImpl& scene, std::string_view name, sceneObjectId_t id) noexcept;
 
+        // Writes changes collected by updateBatched() to the bound Ramses object
+        virtual void writeCollectedChanges();
+
     protected:
         // Used by subclasses to handle serialization
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::RamsesReference> SerializeRamsesReference(const ramses::SceneObject& object, flatbuffers::FlatBufferBuilder& builder);
@@ -170,6 +170,11 @@ namespace ramses::internal
         return std::nullopt;
     }
 
+    bool SkinBindingImpl::readsRamsesObjects() const
+    {
+        return true;
+    }
+
     const std::vector<const NodeBindingImpl*>& SkinBindingImpl::getJoints() const
     {
         return m_joints;
@@ -65,6 +65,7 @@ namespace ramses::internal
         [[nodiscard]] const ramses::UniformInput& getAppearanceUniformInput() const;
 
         std::optional<LogicNodeRuntimeError> update() override;
+        [[nodiscard]] bool readsRamsesObjects() const override;
 
         void createRootProperties() final;
 
@@ -23,6 +23,7 @@
 #include "impl/EffectImpl.h"
 #include "impl/MeshNodeImpl.h"
 #include "impl/RamsesClientImpl.h"
+#include "impl/RamsesFrameworkImpl.h"
 #include "impl/RamsesObjectTypeUtils.h"
 #include "impl/PickableObjectImpl.h"
 
@@ -32,9 +33,13 @@
 #include "impl/SceneDumper.h"
 #include "internal/PlatformAbstraction/PlatformMemory.h"
 #include "internal/PlatformAbstraction/PlatformMath.h"
+#include "internal/Core/TaskFramework/ITask.h"
+#include "internal/Core/TaskFramework/ITaskQueue.h"
+#include "internal/Core/TaskFramework/ParallelTaskGroup.h"
 #include "lodepng.h"
 #include <iostream>
 #include <array>
+#include <functional>
 
 namespace ramses
 {
@@ -61,6 +66,158 @@ namespace ramses
 
             return pow;
         }
+
+        // box filters a mip level into next level of half the size, nextData must hold max(w/2,1) * max(h/2,1) pixels
+        void DownsampleMipLevel(const std::byte* originalData, uint32_t originalWidth, uint32_t originalHeight, uint8_t bytesPerPixel, std::byte* nextData)
+        {
+            const uint32_t nextWidth = std::max(originalWidth >> 1, 1u);
+            const uint32_t nextHeight = std::max(originalHeight >> 1, 1u);
+            const uint32_t originalRowSize = originalWidth * bytesPerPixel;
+            const uint32_t nextRowSize = nextWidth * bytesPerPixel;
+
+            for (uint32_t row = 0u; row < nextHeight; row++)
+            {
+                for (uint32_t col = 0u; col < nextWidth; col++)
+                {
+                    const uint32_t nextIndex = (row * nextRowSize) + col * bytesPerPixel;
+                    const uint32_t originalIndex = ((row * originalRowSize * 2u) + col * 2u * bytesPerPixel);
+                    for (uint32_t i = 0u; i < bytesPerPixel; i++) // iterate through pixel components
+                    {
+                        // apply box filter
+                        uint32_t tmp = 0u;
+                        if (originalHeight > 1 && originalWidth > 1)
+                        {
+                            tmp = static_cast<uint32_t>(originalData[originalIndex + i]) +
+                                static_cast<uint32_t>(originalData[originalIndex + i + bytesPerPixel]) +
+                                static_cast<uint32_t>(originalData[originalIndex + originalRowSize + i]) +
+                                static_cast<uint32_t>(originalData[originalIndex + originalRowSize + i + bytesPerPixel]);
+                            tmp >>= 2; // divide by 4
+                        }
+                        else
+                        {
+                            if (originalHeight == 1)
+                            {
+                                tmp = static_cast<uint32_t>(originalData[originalIndex + i]) +
+                                    static_cast<uint32_t>(originalData[originalIndex + i + bytesPerPixel]);
+                                tmp >>= 1; // divide by 2
+                            }
+                            if (originalWidth == 1)
+                            {
+                                tmp = static_cast<uint32_t>(originalData[originalIndex + i]) +
+                                    static_cast<uint32_t>(originalData[originalIndex + originalRowSize + i]);
+                                tmp >>= 1; // divide by 2
+                            }
+                        }
+
+                        nextData[nextIndex + i] = std::byte{static_cast<uint8_t>(tmp)};
+                    }
+                }
+            }
+        }
+
+        DecodedImage CreateDecodedImage(const std::vector<unsigned char>& data, uint32_t width, uint32_t height, bool generateMipMaps)
+        {
+            constexpr uint8_t bytesPerPixel = 4u;
+            DecodedImage image;
+            image.width = width;
+            image.height = height;
+
+            size_t mipCount = 1u;
+            if (generateMipMaps && IsPowerOfTwo(width) && IsPowerOfTwo(height))
+                mipCount = std::max(Log2(width), Log2(height)) + 1u;
+            image.mipLevels.reserve(mipCount);
+
+            const auto* firstLevelData = reinterpret_cast<const std::byte*>(data.data()); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            image.mipLevels.emplace_back(firstLevelData, firstLevelData + data.size());
+            uint32_t levelWidth = width;
+            uint32_t levelHeight = height;
+            while (image.mipLevels.size() < mipCount)
+            {
+                const uint32_t nextWidth = std::max(levelWidth >> 1, 1u);
+                const uint32_t nextHeight = std::max(levelHeight >> 1, 1u);
+                std::vector<std::byte> nextLevel(size_t(nextWidth) * nextHeight * bytesPerPixel);
+                DownsampleMipLevel(image.mipLevels.back().data(), levelWidth, levelHeight, bytesPerPixel, nextLevel.data());
+                image.mipLevels.push_back(std::move(nextLevel));
+                levelWidth = nextWidth;
+                levelHeight = nextHeight;
+            }
+
+            return image;
+        }
+
+        DecodedImage DecodePngFile(const std::string& pngFilePath, bool generateMipMaps)
+        {
+            unsigned int width = 0;
+            unsigned int height = 0;
+            std::vector<unsigned char> data;
+
+            const unsigned int ret = lodepng::decode(data, width, height, pngFilePath);
+            if (ret != 0)
+            {
+                LOG_ERROR_P(ramses::internal::CONTEXT_CLIENT, "RamsesUtils: Could not load PNG. File not found or invalid format: {} (error {}: {})", pngFilePath, ret, lodepng_error_text(ret));
+                return {};
+            }
+
+            return CreateDecodedImage(data, width, height, generateMipMaps);
+        }
+
+        DecodedImage DecodePngBuffer(const std::vector<uint8_t>& pngData, bool generateMipMaps)
+        {
+            unsigned int width = 0;
+            unsigned int height = 0;
+            std::vector<unsigned char> data;
+
+            const unsigned int ret = lodepng::decode(data, width, height, pngData.data(), pngData.size());
+            if (ret != 0)
+            {
+                LOG_ERROR_P(ramses::internal::CONTEXT_CLIENT, "RamsesUtils: Could not load PNG. Invalid format (error {}: {})", ret, lodepng_error_text(ret));
+                return {};
+            }
+
+            return CreateDecodedImage(data, width, height, generateMipMaps);
+        }
+
+        class DecodePngTask : public ramses::internal::ITask
+        {
+        public:
+            explicit DecodePngTask(std::function<DecodedImage()> decode)
+                : m_decode(std::move(decode))
+            {
+            }
+
+            void execute() override
+            {
+                m_result.set_value(m_decode());
+            }
+
+            std::future<DecodedImage> getFuture()
+            {
+                return m_result.get_future();
+            }
+
+        private:
+            std::function<DecodedImage()> m_decode;
+            std::promise<DecodedImage> m_result;
+        };
+
+        std::future<DecodedImage> EnqueueDecoding(RamsesClient& client, std::function<DecodedImage()> decode)
+        {
+            auto* task = new DecodePngTask(std::move(decode));
+            auto result = task->getFuture();
+            if (!client.impl().getFramework().getTaskQueue().enqueue(*task))
+                task->execute();
+            task->release();
+            return result;
+        }
+
+        std::vector<Texture2D*> CreateTexturesFromDecodedImages(const std::vector<DecodedImage>& images, Scene& scene)
+        {
+            std::vector<Texture2D*> textures;
+            textures.reserve(images.size());
+            for (const auto& image : images)
+                textures.push_back(image.mipLevels.empty() ? nullptr : RamsesUtils::CreateTextureResourceFromDecodedImage(image, scene));
+            return textures;
+        }
     }
 
     Texture2D* RamsesUtils::CreateTextureResourceFromPng(const char* pngFilePath, Scene& scene, const TextureSwizzle& swizzle, std::string_view name/* = 0*/)
@@ -104,6 +261,53 @@ namespace ramses
         return scene.createTexture2D(ETextureFormat::RGBA8, width, height, mipLevelData, false, swizzle, name);
     }
 
+    std::future<DecodedImage> RamsesUtils::DecodePngAsync(RamsesClient& client, std::string pngFilePath, bool generateMipMaps)
+    {
+        return EnqueueDecoding(client, [pngFilePath = std::move(pngFilePath), generateMipMaps]() { return DecodePngFile(pngFilePath, generateMipMaps); });
+    }
+
+    std::future<DecodedImage> RamsesUtils::DecodePngBufferAsync(RamsesClient& client, std::vector<uint8_t> pngData, bool generateMipMaps)
+    {
+        return EnqueueDecoding(client, [pngData = std::move(pngData), generateMipMaps]() { return DecodePngBuffer(pngData, generateMipMaps); });
+    }
+
+    Texture2D* RamsesUtils::CreateTextureResourceFromDecodedImage(const DecodedImage& image, Scene& scene, const TextureSwizzle& swizzle, std::string_view name)
+    {
+        if (image.mipLevels.empty())
+        {
+            LOG_ERROR(ramses::internal::CONTEXT_CLIENT, "RamsesUtils::CreateTextureResourceFromDecodedImage: image has no data");
+            return nullptr;
+        }
+
+        std::vector<MipLevelData> mipLevelData;
+        mipLevelData.reserve(image.mipLevels.size());
+        for (const auto& level : image.mipLevels)
+            mipLevelData.emplace_back(static_cast<uint32_t>(level.size()), level.data());
+        return scene.createTexture2D(ETextureFormat::RGBA8, image.width, image.height, mipLevelData, false, swizzle, name);
+    }
+
+    std::vector<Texture2D*> RamsesUtils::CreateTextureResourcesFromPngs(const std::vector<std::string>& pngFilePaths, Scene& scene, bool generateMipMaps)
+    {
+        std::vector<DecodedImage> images(pngFilePaths.size());
+        ramses::internal::ParallelTaskGroup decodeTasks(&scene.getRamsesClient().impl().getFramework().getTaskQueue());
+        for (size_t i = 0u; i < pngFilePaths.size(); ++i)
+            decodeTasks.add([&, i]() { images[i] = DecodePngFile(pngFilePaths[i], generateMipMaps); });
+        decodeTasks.execute();
+
+        return CreateTexturesFromDecodedImages(images, scene);
+    }
+
+    std::vector<Texture2D*> RamsesUtils::CreateTextureResourcesFromPngBuffers(const std::vector<std::vector<uint8_t>>& pngBuffers, Scene& scene, bool generateMipMaps)
+    {
+        std::vector<DecodedImage> images(pngBuffers.size());
+        ramses::internal::ParallelTaskGroup decodeTasks(&scene.getRamsesClient().impl().getFramework().getTaskQueue());
+        for (size_t i = 0u; i < pngBuffers.size(); ++i)
+            decodeTasks.add([&, i]() { images[i] = DecodePngBuffer(pngBuffers[i], generateMipMaps); });
+        decodeTasks.execute();
+
+        return CreateTexturesFromDecodedImages(images, scene);
+    }
+
     bool RamsesUtils::SaveImageBufferToPng(const std::string& filePath, const std::vector<uint8_t>& imageData, uint32_t width, uint32_t height)
     {
         if (width <= 0 || height <= 0)
@@ -208,47 +412,7 @@ namespace ramses
             uint32_t nextSize = nextWidth * nextHeight * bytesPerPixel;
             auto* nextData = new std::byte[nextSize];
 
-            uint32_t originalRowSize = originalWidth * bytesPerPixel;
-            uint32_t nextRowSize = nextWidth * bytesPerPixel;
-
-            for (uint32_t row = 0u; row < nextHeight; row++)
-            {
-                for (uint32_t col = 0u; col < nextWidth; col++)
-                {
-                    const uint32_t nextIndex = (row * nextRowSize) + col * bytesPerPixel;
-                    const uint32_t originalIndex = ((row * originalRowSize * 2u) + col * 2u * bytesPerPixel);
-                    for (uint32_t i = 0u; i < bytesPerPixel; i++) // iterate through pixel components
-                    {
-                        // apply box filter
-                        uint32_t tmp = 0u;
-                        if (originalHeight > 1 && originalWidth > 1)
-                        {
-                            tmp = static_cast<uint32_t>(originalData[originalIndex + i]) +
-                                static_cast<uint32_t>(originalData[originalIndex + i + bytesPerPixel]) +
-                                static_cast<uint32_t>(originalData[originalIndex + originalRowSize + i]) +
-                                static_cast<uint32_t>(originalData[originalIndex + originalRowSize + i + bytesPerPixel]);
-                            tmp >>= 2; // divide by 4
-                        }
-                        else
-                        {
-                            if (originalHeight == 1)
-                            {
-                                tmp = static_cast<uint32_t>(originalData[originalIndex + i]) +
-                                    static_cast<uint32_t>(originalData[originalIndex + i + bytesPerPixel]);
-                                tmp >>= 1; // divide by 2
-                            }
-                            if (originalWidth == 1)
-                            {
-                                tmp = static_cast<uint32_t>(originalData[originalIndex + i]) +
-                                    static_cast<uint32_t>(originalData[originalIndex + originalRowSize + i]);
-                                tmp >>= 1; // divide by 2
-                            }
-                        }
-
-                        nextData[nextIndex + i] = std::byte{static_cast<uint8_t>(tmp)};
-                    }
-                }
-            }
+            DownsampleMipLevel(originalData, originalWidth, originalHeight, bytesPerPixel, nextData);
 
             mipLevelData[currentMipMapIndex].m_size = nextSize;
             mipLevelData[currentMipMapIndex].m_data = nextData;
@@ -82,16 +82,17 @@ namespace ramses::internal
             }
         }
 
-        // actually put new glyphs on page
+        // actually put new glyphs on page, all of them are uploaded together to merge texture updates of neighbouring glyphs
         assert(glyphsOnPage.size() == tomap.size());
         auto it = glyphsOnPage.begin();
         for (auto const& glyphkey : tomap)
         {
             GlyphInfo& glyphInfo = m_glyphInfoMap.at(glyphkey);
             glyphInfo.glyphMapping.emplace(atlasPage, GlyphMapping{ 1u, *it });
-            getPage(atlasPage).updateDataWithPadding(*it, &glyphInfo.data[0], m_cacheForGlyphPageDataUpdate);
+            getPage(atlasPage).addPendingDataWithPadding(*it, glyphInfo.data.data());
             it++;
         }
+        getPage(atlasPage).flushPendingData(m_cacheForGlyphPageDataUpdate);
 
         // increase ref count on the glyphs already there
         for (auto const& glyphkey : mapped)
@@ -10,6 +10,8 @@
 #include "ramses/client/Scene.h"
 #include "ramses/client/TextureSampler.h"
 #include "ramses/client/Texture2DBuffer.h"
+#include "impl/Texture2DBufferImpl.h"
+#include <algorithm>
 #include <cassert>
 
 
@@ -25,6 +27,15 @@ namespace
         remainingSpaceOut = freeSpace.getArea() - quadToFit.getArea();
         return true;
     }
+
+    ramses::Quad GetBoundingQuad(const ramses::Quad& a, const ramses::Quad& b)
+    {
+        const uint32_t minX = std::min(a.getOrigin().x, b.getOrigin().x);
+        const uint32_t minY = std::min(a.getOrigin().y, b.getOrigin().y);
+        const uint32_t maxX = std::max(a.getOrigin().x + a.getSize().x, b.getOrigin().x + b.getSize().x);
+        const uint32_t maxY = std::max(a.getOrigin().y + a.getSize().y, b.getOrigin().y + b.getSize().y);
+        return { ramses::QuadOffset(minX, minY), ramses::QuadSize(maxX - minX, maxY - minY) };
+    }
 }
 
 namespace ramses::internal
@@ -71,11 +82,74 @@ namespace ramses::internal
             cacheForDataUpdate.resize(targetQuadArea);
         }
 
-        CopyPaddingToCache(targetQuad, cacheForDataUpdate);
-        CopyUpdateDataWithoutPaddingToCache(targetQuad, sourceData, cacheForDataUpdate);
+        CopyGlyphWithPadding(targetQuad, sourceData, cacheForDataUpdate.data(), targetQuad.getSize().x);
         updateTextureResource(targetQuad, cacheForDataUpdate);
     }
 
+    void GlyphTexturePage::addPendingDataWithPadding(const Quad& targetQuad, const uint8_t* sourceData)
+    {
+        assert(targetQuad.getSize().x >= 2);
+        assert(targetQuad.getSize().y >= 2);
+        assert(targetQuad.getOrigin().x + targetQuad.getSize().x <= m_size.x);
+        assert(targetQuad.getOrigin().y + targetQuad.getSize().y <= m_size.y);
+        m_pendingData.push_back({ targetQuad, sourceData });
+    }
+
+    void GlyphTexturePage::flushPendingData(GlyphPageData& cacheForDataUpdate)
+    {
+        // sort by rows so that neighbouring glyphs are next to each other, then greedily grow region as long as
+        // the region does not contain too many texels which are not updated
+        std::sort(m_pendingData.begin(), m_pendingData.end(), [](const PendingGlyphData& a, const PendingGlyphData& b) {
+            return std::make_pair(a.targetQuad.getOrigin().y, a.targetQuad.getOrigin().x) < std::make_pair(b.targetQuad.getOrigin().y, b.targetQuad.getOrigin().x);
+        });
+
+        auto regionBegin = m_pendingData.cbegin();
+        while (regionBegin != m_pendingData.cend())
+        {
+            Quad region = regionBegin->targetQuad;
+            uint32_t glyphsArea = region.getSize().getArea();
+            auto regionEnd = std::next(regionBegin);
+            for (; regionEnd != m_pendingData.cend(); ++regionEnd)
+            {
+                const Quad grownRegion = GetBoundingQuad(region, regionEnd->targetQuad);
+                const uint32_t grownGlyphsArea = glyphsArea + regionEnd->targetQuad.getSize().getArea();
+                if (grownRegion.getSize().getArea() > MaxMergedRegionOverhead * grownGlyphsArea)
+                    break;
+                region = grownRegion;
+                glyphsArea = grownGlyphsArea;
+            }
+
+            updateMergedRegion(region, regionBegin, regionEnd, cacheForDataUpdate);
+            regionBegin = regionEnd;
+        }
+
+        m_pendingData.clear();
+    }
+
+    void GlyphTexturePage::updateMergedRegion(const Quad& region, PendingGlyphDataVector::const_iterator begin, PendingGlyphDataVector::const_iterator end, GlyphPageData& cacheForDataUpdate)
+    {
+        const uint32_t regionArea = region.getSize().getArea();
+        if (cacheForDataUpdate.size() < regionArea)
+            cacheForDataUpdate.resize(regionArea);
+
+        // texels between the glyphs must keep content of glyphs mapped earlier
+        if (std::next(begin) != end)
+        {
+            [[maybe_unused]] const bool status = m_textureBuffer.impl().getMipLevelSubregionData(0u, region.getOrigin().x, region.getOrigin().y,
+                region.getSize().x, region.getSize().y, reinterpret_cast<std::byte*>(cacheForDataUpdate.data()));
+            assert(status);
+        }
+
+        const uint32_t regionRowSize = region.getSize().x;
+        for (auto it = begin; it != end; ++it)
+        {
+            const uint32_t offsetInRegion = (it->targetQuad.getOrigin().y - region.getOrigin().y) * regionRowSize + (it->targetQuad.getOrigin().x - region.getOrigin().x);
+            CopyGlyphWithPadding(it->targetQuad, it->sourceData, cacheForDataUpdate.data() + offsetInRegion, regionRowSize);
+        }
+
+        updateTextureResource(region, cacheForDataUpdate);
+    }
+
     const TextureSampler& GlyphTexturePage::getSampler() const
     {
         return m_textureSampler;
@@ -160,41 +234,23 @@ namespace ramses::internal
         return false;
     }
 
-    void GlyphTexturePage::CopyPaddingToCache(const Quad& updateQuad, GlyphPageData& cacheForDataUpdate)
+    void GlyphTexturePage::CopyGlyphWithPadding(const Quad& updateQuad, const uint8_t* data, uint8_t* target, uint32_t targetRowSize)
     {
         const uint32_t targetRowCount = updateQuad.getSize().y;
         const uint32_t targetColumnCount = updateQuad.getSize().x;
+        const uint32_t sourceColumnCount = targetColumnCount - 2;
 
-        for (uint32_t i = 0u; i < targetRowCount; ++i)
-        {
-            cacheForDataUpdate[i * targetColumnCount] = 0; //first column
-            cacheForDataUpdate[i * targetColumnCount + targetColumnCount - 1] = 0; //last column
-        }
-
-        for (uint32_t i = 0u; i < targetColumnCount; ++i)
-        {
-            cacheForDataUpdate[i] = 0; //first row
-            cacheForDataUpdate[i + (targetRowCount - 1) * targetColumnCount] = 0; // last row
-        }
-    }
+        // first and last row are padding
+        std::fill_n(target, targetColumnCount, uint8_t(0u));
+        std::fill_n(target + (targetRowCount - 1u) * targetRowSize, targetColumnCount, uint8_t(0u));
 
-    void GlyphTexturePage::CopyUpdateDataWithoutPaddingToCache(const Quad& updateQuad, const uint8_t* data, GlyphPageData& cacheForDataUpdate)
-    {
-        const uint32_t targetRowCount = updateQuad.getSize().y;
-        const uint32_t targetColumnCount = updateQuad.getSize().x;
-        const uint32_t sourceColumnCount = targetColumnCount - 2;
         for (uint32_t targetRow = 1u; targetRow < targetRowCount - 1u; ++targetRow)
         {
-            for (uint32_t targetCol = 1u; targetCol < targetColumnCount - 1u; ++targetCol)
-            {
-                const uint32_t targetOffset = targetRow*(targetColumnCount)+targetCol;
-
-                // Exclude the padding
-                const uint32_t sourceRow = targetRow - 1;
-                const uint32_t sourceCol = targetCol - 1;
-
-                cacheForDataUpdate[targetOffset] = data[sourceColumnCount * sourceRow + sourceCol];
-            }
+            uint8_t* targetRowPtr = target + targetRow * targetRowSize;
+            // first and last column are padding
+            targetRowPtr[0] = 0;
+            targetRowPtr[targetColumnCount - 1u] = 0;
+            std::copy_n(data + sourceColumnCount * (targetRow - 1u), sourceColumnCount, targetRowPtr + 1u);
         }
     }
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "impl/text/Quad.h"
+#include <vector>
 
 namespace ramses
 {
@@ -44,14 +45,30 @@ namespace ramses::internal
         [[nodiscard]] const Texture2DBuffer& getTextureBuffer() const;
         [[nodiscard]] const TextureSampler& getSampler() const;
 
+        // Batched texture data management, source data must stay valid until flushed.
+        // Glyphs close to each other are merged into a single texture update.
+        void addPendingDataWithPadding(const Quad& targetQuad, const uint8_t* sourceData);
+        void flushPendingData(GlyphPageData& cacheForDataUpdate);
+
     private:
+        struct PendingGlyphData
+        {
+            Quad targetQuad;
+            const uint8_t* sourceData;
+        };
+        using PendingGlyphDataVector = std::vector<PendingGlyphData>;
+
         bool mergeFreeQuad(Quad& freeQuadInAndOut);
-        static void CopyPaddingToCache(const Quad& updateQuad, GlyphPageData& cacheForDataUpdate);
-        static void CopyUpdateDataWithoutPaddingToCache(const Quad& updateQuad, const uint8_t* data, GlyphPageData& cacheForDataUpdate);
+        static void CopyGlyphWithPadding(const Quad& updateQuad, const uint8_t* data, uint8_t* target, uint32_t targetRowSize);
+        void updateMergedRegion(const Quad& region, PendingGlyphDataVector::const_iterator begin, PendingGlyphDataVector::const_iterator end, GlyphPageData& cacheForDataUpdate);
         void updateTextureResource(const Quad& updateQuade, const GlyphPageData& pageData);
 
+        // merged region may be at most this many times bigger than the sum of glyphs in it
+        static constexpr uint32_t MaxMergedRegionOverhead = 4u;
+
         const QuadSize m_size;
         Quads m_freeQuads;
+        PendingGlyphDataVector m_pendingData;
         Scene& m_ownerScene;
         Texture2DBuffer& m_textureBuffer;
         TextureSampler&  m_textureSampler;
@@ -24,7 +24,10 @@
 #include "internal/Core/Utils/LogMacros.h"
 #include "impl/RamsesFrameworkTypesImpl.h"
 #include "impl/text/TextTypesImpl.h"
+#include "internal/PlatformAbstraction/Hash.h"
+#include <algorithm>
 #include <limits>
+#include <unordered_set>
 
 namespace ramses::internal
 {
@@ -35,7 +38,57 @@ namespace ramses::internal
     {
     }
 
+    bool TextCacheImpl::ShapedRunKey::operator==(const ShapedRunKey& other) const
+    {
+        return str == other.str && std::equal(fontOffsets.cbegin(), fontOffsets.cend(), other.fontOffsets.cbegin(), other.fontOffsets.cend(),
+            [](const FontInstanceOffset& a, const FontInstanceOffset& b) { return a.fontInstance == b.fontInstance && a.beginOffset == b.beginOffset; });
+    }
+
+    size_t TextCacheImpl::ShapedRunKeyHash::operator()(const ShapedRunKey& key) const
+    {
+        size_t seed = std::hash<std::u32string>{}(key.str);
+        for (const auto& fontOffset : key.fontOffsets)
+            HashCombine(seed, fontOffset.fontInstance.getValue(), fontOffset.beginOffset);
+        return seed;
+    }
+
     GlyphMetricsVector TextCacheImpl::getPositionedGlyphs(const std::u32string& str, const FontInstanceOffsets& fontOffsets)
+    {
+        ShapedRunKey key{ str, fontOffsets };
+        const auto cachedIt = m_shapedRunLookup.find(key);
+        if (cachedIt != m_shapedRunLookup.cend())
+        {
+            // font instance might have been removed meanwhile, cached run must not outlive it
+            const bool allFontsValid = std::all_of(fontOffsets.cbegin(), fontOffsets.cend(), [this](const FontInstanceOffset& fontOffset) {
+                return m_fontAccessor.getFontInstance(fontOffset.fontInstance) != nullptr;
+            });
+            if (allFontsValid)
+            {
+                m_shapedRuns.splice(m_shapedRuns.begin(), m_shapedRuns, cachedIt->second);
+                return cachedIt->second->glyphs;
+            }
+
+            m_shapedRuns.erase(cachedIt->second);
+            m_shapedRunLookup.erase(cachedIt);
+        }
+
+        bool allFontsFound = true;
+        GlyphMetricsVector positionedGlyphs = shapeGlyphs(str, fontOffsets, allFontsFound);
+        if (!allFontsFound)
+            return positionedGlyphs;
+
+        if (m_shapedRuns.size() >= ShapedRunCacheCapacity)
+        {
+            m_shapedRunLookup.erase(m_shapedRuns.back().key);
+            m_shapedRuns.pop_back();
+        }
+        m_shapedRuns.push_front({ key, positionedGlyphs });
+        m_shapedRunLookup.emplace(std::move(key), m_shapedRuns.begin());
+
+        return positionedGlyphs;
+    }
+
+    GlyphMetricsVector TextCacheImpl::shapeGlyphs(const std::u32string& str, const FontInstanceOffsets& fontOffsets, bool& allFontsFound) const
     {
         GlyphMetricsVector positionedGlyphs;
         positionedGlyphs.reserve(str.size());
@@ -55,6 +108,7 @@ namespace ramses::internal
             else
             {
                 LOG_ERROR(CONTEXT_TEXT, "TextCache::getPositionedGlyphs: Could not find font instance " << fontIt->fontInstance);
+                allFontsFound = false;
             }
         }
 
@@ -84,21 +138,8 @@ namespace ramses::internal
             return {};
         }
 
-        for (const auto& glyph : glyphs)
-        {
-            if (!m_textureAtlas.isGlyphRegistered(glyph.key))
-            {
-                IFontInstance* fontInstance = m_fontAccessor.getFontInstance(glyph.key.fontInstanceId);
-                if (fontInstance == nullptr)
-                {
-                    LOG_ERROR(CONTEXT_TEXT, "TextCache::createTextLine: Could not find font instance " << glyph.key.fontInstanceId);
-                    return {};
-                }
-                QuadSize glyphSize;
-                GlyphData data = fontInstance->loadGlyphBitmapData(glyph.key.identifier, glyphSize.x, glyphSize.y);
-                m_textureAtlas.registerGlyph(glyph.key, glyphSize, std::move(data));
-            }
-        }
+        if (!loadMissingGlyphs(glyphs))
+            return {};
 
         const bool allGlyphsEmpty = !TextCache::ContainsRenderableGlyphs(glyphs);
 
@@ -158,6 +199,43 @@ namespace ramses::internal
         return textLineId;
     }
 
+    bool TextCacheImpl::loadMissingGlyphs(const GlyphMetricsVector& glyphs)
+    {
+        // Collect every missing glyph once and rasterize them grouped by font instance, so that each
+        // font face is set up only once per batch instead of alternating between fonts per glyph.
+        std::vector<GlyphKey> missingGlyphs;
+        std::unordered_set<GlyphKey> missingGlyphsLookup;
+        for (const auto& glyph : glyphs)
+        {
+            if (!m_textureAtlas.isGlyphRegistered(glyph.key) && missingGlyphsLookup.insert(glyph.key).second)
+                missingGlyphs.push_back(glyph.key);
+        }
+        std::stable_sort(missingGlyphs.begin(), missingGlyphs.end(), [](const GlyphKey& a, const GlyphKey& b) {
+            return a.fontInstanceId.getValue() < b.fontInstanceId.getValue();
+        });
+
+        IFontInstance* fontInstance = nullptr;
+        FontInstanceId currentFontInstanceId;
+        for (const auto& glyphKey : missingGlyphs)
+        {
+            if (fontInstance == nullptr || glyphKey.fontInstanceId != currentFontInstanceId)
+            {
+                fontInstance = m_fontAccessor.getFontInstance(glyphKey.fontInstanceId);
+                currentFontInstanceId = glyphKey.fontInstanceId;
+            }
+            if (fontInstance == nullptr)
+            {
+                LOG_ERROR(CONTEXT_TEXT, "TextCache::createTextLine: Could not find font instance " << glyphKey.fontInstanceId);
+                return false;
+            }
+            QuadSize glyphSize;
+            GlyphData data = fontInstance->loadGlyphBitmapData(glyphKey.identifier, glyphSize.x, glyphSize.y);
+            m_textureAtlas.registerGlyph(glyphKey, glyphSize, std::move(data));
+        }
+
+        return true;
+    }
+
     TextLine const* TextCacheImpl::getTextLine(TextLineId textId) const
     {
         const auto it = m_textLines.find(textId);
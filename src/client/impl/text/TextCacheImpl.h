@@ -13,6 +13,7 @@
 #include "ramses/client/text/FontInstanceOffsets.h"
 #include <unordered_map>
 #include <string>
+#include <list>
 
 namespace ramses
 {
@@ -44,6 +45,35 @@ namespace ramses::internal
         TextCacheImpl& operator=(TextCacheImpl&&) = delete;
 
     private:
+        struct ShapedRunKey
+        {
+            std::u32string str;
+            FontInstanceOffsets fontOffsets;
+
+            bool operator==(const ShapedRunKey& other) const;
+        };
+
+        struct ShapedRunKeyHash
+        {
+            size_t operator()(const ShapedRunKey& key) const;
+        };
+
+        struct ShapedRun
+        {
+            ShapedRunKey key;
+            GlyphMetricsVector glyphs;
+        };
+
+        using ShapedRunList = std::list<ShapedRun>;
+
+        [[nodiscard]] GlyphMetricsVector shapeGlyphs(const std::u32string& str, const FontInstanceOffsets& fontOffsets, bool& allFontsFound) const;
+        bool loadMissingGlyphs(const GlyphMetricsVector& glyphs);
+
+        // Least recently used shaped runs are at the back of the list and evicted first
+        static constexpr size_t ShapedRunCacheCapacity = 512u;
+        ShapedRunList m_shapedRuns;
+        std::unordered_map<ShapedRunKey, ShapedRunList::iterator, ShapedRunKeyHash> m_shapedRunLookup;
+
         ramses::Scene& m_scene;
         IFontAccessor& m_fontAccessor;
         GlyphTextureAtlas m_textureAtlas;
@@ -40,11 +40,11 @@ namespace ramses::internal
         m_scenegraphProviderComponent = nullptr;
     }
 
-    void ClientApplicationLogic::createScene(ClientScene& scene, bool enableLocalOnlyOptimization)
+    void ClientApplicationLogic::createScene(ClientScene& scene, bool useDirectSceneLogic)
     {
         PlatformGuard guard(m_frameworkLock);
         LOG_TRACE(CONTEXT_CLIENT, "ClientApplicationLogic::createScene:  '" << scene.getName() << "' with id '" << scene.getSceneId().getValue() << "'");
-        m_scenegraphProviderComponent->handleCreateScene(scene, enableLocalOnlyOptimization, *this);
+        m_scenegraphProviderComponent->handleCreateScene(scene, useDirectSceneLogic, *this);
     }
 
     void ClientApplicationLogic::publishScene(SceneId sceneId, EScenePublicationMode publicationMode)
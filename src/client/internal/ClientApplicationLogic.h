@@ -41,7 +41,7 @@ namespace ramses::internal
         void deinit();
 
         // Scene handling
-        void createScene(ClientScene& scene, bool enableLocalOnlyOptimization);
+        void createScene(ClientScene& scene, bool useDirectSceneLogic);
         void publishScene(SceneId sceneId, EScenePublicationMode publicationMode);
         void unpublishScene(SceneId sceneId);
         [[nodiscard]] bool isScenePublished(SceneId sceneId) const;
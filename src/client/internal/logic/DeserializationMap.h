@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "internal/logic/StructFieldIndex.h"
+
 #include <unordered_map>
 
 namespace rlogic_serialization
@@ -79,6 +81,12 @@ namespace ramses::internal
             return nullptr;
         }
 
+        // Shared by all deserialized properties, so that structs of the same type use the same field index
+        StructFieldIndexCache& getStructFieldIndexCache()
+        {
+            return m_structFieldIndices;
+        }
+
     private:
         template <typename Key, typename Value>
         static void Store(Key key, Value value, std::unordered_map<Key, Value>& container)
@@ -99,6 +107,7 @@ namespace ramses::internal
         std::unordered_map<const rlogic_serialization::Property*, PropertyImpl*> m_properties;
         std::unordered_map<const rlogic_serialization::DataArray*, const DataArray*> m_dataArrays;
         std::unordered_map<sceneObjectId_t, LogicObjectImpl*> m_logicObjects;
+        StructFieldIndexCache m_structFieldIndices;
         SceneImpl& m_scene;
     };
 
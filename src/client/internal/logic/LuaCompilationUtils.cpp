@@ -18,6 +18,7 @@
 #include "internal/logic/PropertyTypeExtractor.h"
 #include "internal/logic/EPropertySemantics.h"
 #include "internal/logic/EnvironmentProtection.h"
+#include "internal/logic/StructFieldIndex.h"
 #include "fmt/format.h"
 #include "SolHelper.h"
 
@@ -35,6 +36,23 @@ namespace ramses::internal
         std::unique_ptr<PropertyImpl> outputsFromPrecompiledScript,
         bool enableDebugLogFunctions)
     {
+        // Identical script compiled before: skip parsing, module dependency cross-check and interface extraction
+        // and only execute the cached byte code in the new environment of this instance
+        std::optional<LuaCompilationKey> compilationKey;
+        if (byteCodeFromPrecompiledScript.empty())
+        {
+            compilationKey = MakeCompilationKey(source, userModules, stdModules, enableDebugLogFunctions, false);
+            const LuaCompilationResult* cachedCompilation = solState.findCachedCompilation(*compilationKey);
+            if (cachedCompilation)
+            {
+                assert(cachedCompilation->inputs && cachedCompilation->outputs);
+                byteCodeFromPrecompiledScript = cachedCompilation->byteCode;
+                inputsFromPrecompiledScript = std::make_unique<PropertyImpl>(*cachedCompilation->inputs, EPropertySemantics::ScriptInput);
+                outputsFromPrecompiledScript = std::make_unique<PropertyImpl>(*cachedCompilation->outputs, EPropertySemantics::ScriptOutput);
+                compilationKey.reset();
+            }
+        }
+
         sol::environment env = solState.createEnvironment(stdModules, userModules, enableDebugLogFunctions);
         sol::table internalEnv = EnvironmentProtection::GetProtectedEnvironmentTable(env);
 
@@ -130,6 +148,7 @@ namespace ramses::internal
 
         std::unique_ptr<PropertyImpl> resultInputs;
         std::unique_ptr<PropertyImpl> resultOutputs;
+        LuaCompilationResult compilationResult;
 
         if (inputsFromPrecompiledScript)
         {
@@ -179,13 +198,25 @@ namespace ramses::internal
             // Remove names
             extractedInputsType.typeData.name = "";
             extractedOutputsType.typeData.name = "";
+            // Field indices are cached along with the types, instances of this script do not create their own
+            StructFieldIndexCache structFieldIndices;
+            structFieldIndices.attachTo(extractedInputsType);
+            structFieldIndices.attachTo(extractedOutputsType);
 
             resultInputs = std::make_unique<PropertyImpl>(extractedInputsType, EPropertySemantics::ScriptInput);
             resultOutputs = std::make_unique<PropertyImpl>(extractedOutputsType, EPropertySemantics::ScriptOutput);
+            compilationResult.inputs = std::move(extractedInputsType);
+            compilationResult.outputs = std::move(extractedOutputsType);
         }
 
         sol::bytecode resultByteCode = (byteCodeFromPrecompiledScript.empty() ? mainFunction.dump() : std::move(byteCodeFromPrecompiledScript));
 
+        if (compilationKey && compilationResult.inputs)
+        {
+            compilationResult.byteCode = resultByteCode;
+            solState.cacheCompilation(std::move(*compilationKey), std::move(compilationResult));
+        }
+
         EnvironmentProtection::SetEnvironmentProtectionLevel(env, EEnvProtectionFlag::RunFunction);
 
         return LuaCompiledScript{
@@ -300,6 +331,20 @@ namespace ramses::internal
         sol::bytecode byteCodeFromPrecompiledModule,
         bool enableDebugLogFunctions)
     {
+        LuaCompilationKey compilationKey = MakeCompilationKey(
+            (source.empty() ? byteCodeFromPrecompiledModule.as_string_view() : std::string_view{ source }), userModules, stdModules, enableDebugLogFunctions, true);
+        const size_t contentHash = std::hash<LuaCompilationKey>{}(compilationKey);
+
+        bool storeInCache = false;
+        if (byteCodeFromPrecompiledModule.empty())
+        {
+            const LuaCompilationResult* cachedCompilation = solState.findCachedCompilation(compilationKey);
+            if (cachedCompilation)
+                byteCodeFromPrecompiledModule = cachedCompilation->byteCode;
+            else
+                storeInCache = true;
+        }
+
         sol::environment env = solState.createEnvironment(stdModules, userModules, enableDebugLogFunctions);
         sol::table internalEnv = EnvironmentProtection::GetProtectedEnvironmentTable(env);
         // interface definitions can be provided within module, in order to be able to extract them
@@ -375,6 +420,9 @@ namespace ramses::internal
         //for serialization
         sol::bytecode resultByteCode = (byteCodeFromPrecompiledModule.empty() ? mainFunction.dump() : std::move(byteCodeFromPrecompiledModule));
 
+        if (storeInCache)
+            solState.cacheCompilation(std::move(compilationKey), LuaCompilationResult{ resultByteCode, std::nullopt, std::nullopt });
+
         auto compiledModule = LuaCompiledModule{
             LuaCompiledSource{
                 std::move(source),
@@ -384,7 +432,8 @@ namespace ramses::internal
                 userModules,
                 enableDebugLogFunctions
             },
-            LuaCompilationUtils::MakeTableReadOnly(solState, moduleTable)
+            LuaCompilationUtils::MakeTableReadOnly(solState, moduleTable),
+            contentHash
         };
 
         // Applies environment protection to the module until it's destroyed
@@ -395,6 +444,22 @@ namespace ramses::internal
         return compiledModule;
     }
 
+    LuaCompilationKey LuaCompilationUtils::MakeCompilationKey(
+        std::string_view code,
+        const ModuleMapping& userModules,
+        const StandardModules& stdModules,
+        bool enableDebugLogFunctions,
+        bool isModule)
+    {
+        LuaCompilationKey key{ std::string{ code }, stdModules, {}, enableDebugLogFunctions, isModule };
+        key.userModules.reserve(userModules.size());
+        for (const auto& module : userModules)
+            key.userModules.emplace_back(module.first, module.second->impl().getContentHash());
+        std::sort(key.userModules.begin(), key.userModules.end());
+
+        return key;
+    }
+
     // Implements https://www.lua.org/pil/13.4.4.html
     sol::table LuaCompilationUtils::MakeTableReadOnly(SolState& solState, sol::table table)
     {
@@ -23,6 +23,7 @@ namespace ramses
 namespace ramses::internal
 {
     class SolState;
+    struct LuaCompilationKey;
     class ErrorReporting;
     class PropertyImpl;
 
@@ -58,6 +59,9 @@ namespace ramses::internal
     {
         LuaCompiledSource source;
         sol::table moduleTable;
+
+        // Identifies modules with identical content, scripts depending on such modules can share compilation results
+        std::size_t contentHash;
     };
 
     class LuaCompilationUtils
@@ -102,6 +106,13 @@ namespace ramses::internal
         [[nodiscard]] static sol::table MakeTableReadOnly(SolState& solState, sol::table table);
 
     private:
+        [[nodiscard]] static LuaCompilationKey MakeCompilationKey(
+            std::string_view code,
+            const ModuleMapping& userModules,
+            const StandardModules& stdModules,
+            bool enableDebugLogFunctions,
+            bool isModule);
+
         [[nodiscard]] static bool CrossCheckDeclaredAndProvidedModules(
             std::string_view source,
             const ModuleMapping& modules,
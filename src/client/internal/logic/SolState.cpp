@@ -16,11 +16,34 @@
 #include "internal/logic/SolHelper.h"
 #include "internal/logic/LuaTypeConversions.h"
 #include "internal/logic/EnvironmentProtection.h"
+#include "internal/PlatformAbstraction/Hash.h"
 
 #include <iostream>
 
+namespace std
+{
+    size_t hash<ramses::internal::LuaCompilationKey>::operator()(const ramses::internal::LuaCompilationKey& key) const
+    {
+        size_t seed = ramses::internal::HashValue(key.code, key.debugLogFunctions, key.isModule);
+        for (const auto stdModule : key.stdModules)
+            ramses::internal::HashCombine(seed, stdModule);
+        for (const auto& userModule : key.userModules)
+            ramses::internal::HashCombine(seed, userModule.first, userModule.second);
+        return seed;
+    }
+}
+
 namespace ramses::internal
 {
+    bool LuaCompilationKey::operator==(const LuaCompilationKey& other) const
+    {
+        return code == other.code
+            && stdModules == other.stdModules
+            && userModules == other.userModules
+            && debugLogFunctions == other.debugLogFunctions
+            && isModule == other.isModule;
+    }
+
     // NOLINTNEXTLINE(performance-unnecessary-value-param) The signature is forced by SOL. Therefore we have to disable this warning.
     static int solExceptionHandler(lua_State* L, sol::optional<const std::exception&> maybe_exception, sol::string_view description)
     {
@@ -185,6 +208,24 @@ namespace ramses::internal
         return m_solState.create_table();
     }
 
+    const LuaCompilationResult* SolState::findCachedCompilation(const LuaCompilationKey& key) const
+    {
+        const auto it = m_compilationCache.find(key);
+        return (it != m_compilationCache.cend() ? &it->second : nullptr);
+    }
+
+    void SolState::cacheCompilation(LuaCompilationKey key, LuaCompilationResult result)
+    {
+        if (m_compilationCache.size() >= MaxCachedCompilations)
+            m_compilationCache.clear();
+        m_compilationCache.insert_or_assign(std::move(key), std::move(result));
+    }
+
+    size_t SolState::getNumCachedCompilations() const
+    {
+        return m_compilationCache.size();
+    }
+
     int SolState::getNumElementsInLuaStack() const
     {
         return lua_gettop(m_solState.lua_state());
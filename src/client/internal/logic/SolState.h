@@ -10,9 +10,12 @@
 
 #include "impl/logic/LuaConfigImpl.h"
 #include "internal/logic/SolWrapper.h"
+#include "internal/logic/TypeData.h"
 
 #include <string_view>
 #include <utility>
+#include <optional>
+#include <unordered_map>
 
 namespace ramses::internal
 {
@@ -33,6 +36,45 @@ namespace ramses::internal
 
     static_assert(StdModules.size() == SolLibs.size());
 
+    // Everything which influences the compilation result of a script or module source
+    struct LuaCompilationKey
+    {
+        // Source code, or byte code if no source code is available
+        std::string code;
+        StandardModules stdModules;
+        // Alias and content hash of every user module dependency, sorted by alias
+        std::vector<std::pair<std::string, std::size_t>> userModules;
+        bool debugLogFunctions = false;
+        bool isModule = false;
+
+        bool operator==(const LuaCompilationKey& other) const;
+    };
+
+    // Compilation results which do not depend on the script/module instance and can be shared between all instances
+    // created from an identical compilation key. Only the environment and the result of executing the byte code within it
+    // (run function, module table, GLOBAL) have to be created per instance.
+    struct LuaCompilationResult
+    {
+        sol::bytecode byteCode;
+        // Extracted interface of scripts, not used for modules
+        std::optional<HierarchicalTypeData> inputs;
+        std::optional<HierarchicalTypeData> outputs;
+    };
+}
+
+namespace std
+{
+    template <>
+    struct hash<ramses::internal::LuaCompilationKey>
+    {
+    public:
+        size_t operator()(const ramses::internal::LuaCompilationKey& key) const;
+    };
+}
+
+namespace ramses::internal
+{
+
     class SolState
     {
     public:
@@ -55,6 +97,10 @@ namespace ramses::internal
         void copyTableIntoEnvironment(const sol::table& table, std::string_view name, sol::environment& env);
         sol::table createTable();
 
+        [[nodiscard]] const LuaCompilationResult* findCachedCompilation(const LuaCompilationKey& key) const;
+        void cacheCompilation(LuaCompilationKey key, LuaCompilationResult result);
+        [[nodiscard]] size_t getNumCachedCompilations() const;
+
         [[nodiscard]] int getNumElementsInLuaStack() const;
 
         [[nodiscard]] static bool IsReservedModuleName(std::string_view name);
@@ -63,6 +109,9 @@ namespace ramses::internal
         sol::state m_solState;
         // Cached to avoid unnecessary heap allocations
         std::vector<std::string> m_safeBaselibSymbols;
+        // Shares compilation results between scripts/modules created from identical source, flushed completely when full
+        std::unordered_map<LuaCompilationKey, LuaCompilationResult> m_compilationCache;
+        static constexpr size_t MaxCachedCompilations = 1024u;
 
         void mapStandardModules(const StandardModules& stdModules, sol::environment& env);
         [[nodiscard]] static std::optional<std::string_view> GetStdModuleName(EStandardModule m);
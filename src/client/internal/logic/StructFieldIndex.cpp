@@ -0,0 +1,74 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/logic/StructFieldIndex.h"
+
+#include <functional>
+
+namespace ramses::internal
+{
+    StructFieldIndex::StructFieldIndex(std::vector<std::string> fieldNames)
+        : m_fieldNames(std::move(fieldNames))
+    {
+        // keep load factor at or below 0.5 so that probe sequences stay short
+        size_t slotCount = 1u;
+        while (slotCount < 2u * m_fieldNames.size())
+            slotCount <<= 1u;
+        m_slots.resize(slotCount, 0u);
+        m_slotMask = slotCount - 1u;
+
+        for (size_t i = 0u; i < m_fieldNames.size(); ++i)
+        {
+            size_t slot = std::hash<std::string_view>{}(m_fieldNames[i]) & m_slotMask;
+            while (m_slots[slot] != 0u && m_fieldNames[m_slots[slot] - 1u] != m_fieldNames[i])
+                slot = (slot + 1u) & m_slotMask;
+
+            // in case of duplicate names the first field is found, same as with linear search
+            if (m_slots[slot] == 0u)
+                m_slots[slot] = static_cast<uint32_t>(i + 1u);
+        }
+    }
+
+    std::optional<size_t> StructFieldIndex::find(std::string_view fieldName) const
+    {
+        for (size_t slot = std::hash<std::string_view>{}(fieldName) & m_slotMask; m_slots[slot] != 0u; slot = (slot + 1u) & m_slotMask)
+        {
+            const size_t fieldIndex = m_slots[slot] - 1u;
+            if (m_fieldNames[fieldIndex] == fieldName)
+                return fieldIndex;
+        }
+
+        return std::nullopt;
+    }
+
+    std::shared_ptr<const StructFieldIndex> StructFieldIndexCache::get(std::vector<std::string> fieldNames)
+    {
+        if (fieldNames.size() < StructFieldIndex::MinFieldCount)
+            return nullptr;
+
+        auto& index = m_indices[fieldNames];
+        if (!index)
+            index = std::make_shared<const StructFieldIndex>(std::move(fieldNames));
+        return index;
+    }
+
+    void StructFieldIndexCache::attachTo(HierarchicalTypeData& type)
+    {
+        for (auto& childType : type.children)
+            attachTo(childType);
+
+        if (type.typeData.type != EPropertyType::Struct || type.children.size() < StructFieldIndex::MinFieldCount || type.structFieldIndex)
+            return;
+
+        std::vector<std::string> fieldNames;
+        fieldNames.reserve(type.children.size());
+        for (const auto& childType : type.children)
+            fieldNames.push_back(childType.typeData.name);
+        type.structFieldIndex = get(std::move(fieldNames));
+    }
+}
@@ -0,0 +1,57 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/logic/TypeData.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <cstdint>
+
+namespace ramses::internal
+{
+    // Hash table mapping field names of a struct property to child indices, avoids comparing the name of every
+    // field on each access to a wide struct (e.g. 'IN.foo' in Lua). Immutable after creation and therefore shared
+    // between struct properties of identical type (e.g. elements of an array of structs).
+    class StructFieldIndex
+    {
+    public:
+        explicit StructFieldIndex(std::vector<std::string> fieldNames);
+
+        [[nodiscard]] std::optional<size_t> find(std::string_view fieldName) const;
+
+        // Structs with less fields are searched linearly, which is not slower than hashing the name
+        static constexpr size_t MinFieldCount = 8u;
+
+    private:
+        std::vector<std::string> m_fieldNames;
+        // Open addressing with linear probing, a slot holds field index + 1 or 0 if empty
+        std::vector<uint32_t> m_slots;
+        size_t m_slotMask = 0u;
+    };
+
+    // Creates a single index for all wide structs with identical field names, e.g. for all elements of an array of structs
+    // or for all structs of the same type within a script interface or a loaded file
+    class StructFieldIndexCache
+    {
+    public:
+        // Returns nullptr if there are less than StructFieldIndex::MinFieldCount fields
+        [[nodiscard]] std::shared_ptr<const StructFieldIndex> get(std::vector<std::string> fieldNames);
+
+        // Sets the index of all wide structs within given type, properties created from the type use these indices
+        void attachTo(HierarchicalTypeData& type);
+
+    private:
+        std::map<std::vector<std::string>, std::shared_ptr<const StructFieldIndex>> m_indices;
+    };
+}
@@ -11,6 +11,7 @@
 #include "ramses/client/logic/EPropertyType.h"
 
 #include <vector>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <algorithm>
@@ -18,6 +19,8 @@
 
 namespace ramses::internal
 {
+    class StructFieldIndex;
+
     struct TypeData
     {
         TypeData(std::string _name, EPropertyType _type);
@@ -39,6 +42,8 @@ namespace ramses::internal
 
         TypeData typeData;
         std::vector<HierarchicalTypeData> children;
+        // Optional, not part of the type. Set by StructFieldIndexCache for wide structs and shared by all properties created from this type
+        std::shared_ptr<const StructFieldIndex> structFieldIndex;
     };
 
     inline HierarchicalTypeData MakeType(std::string name, EPropertyType type)
@@ -225,12 +225,10 @@ namespace ramses::internal
                 sol_helper::throwSolException("Bad access to property '{}'! {}", m_wrappedProperty.get().getName(), structFieldName.getError());
             }
 
-            for (size_t i = 0; i < m_wrappedChildProperties.size(); ++i)
+            const std::optional<size_t> childIndex = m_wrappedProperty.get().findChildIndex(structFieldName.getData());
+            if (childIndex)
             {
-                if (m_wrappedChildProperties[i].m_wrappedProperty.get().getName() == structFieldName.getData())
-                {
-                    return i;
-                }
+                return *childIndex;
             }
 
             throw BadStructAccess(std::string(structFieldName.getData()), fmt::format("Tried to access undefined struct property '{}'", structFieldName.getData()));
@@ -8,6 +8,7 @@
 
 #include "ramses/framework/RamsesFrameworkConfig.h"
 #include "impl/RamsesFrameworkConfigImpl.h"
+#include "internal/Core/Utils/LogMacros.h"
 
 namespace ramses
 {
@@ -148,6 +149,32 @@ namespace ramses
         return true;
     }
 
+    void RamsesFrameworkConfig::setSceneActionCompressionThresholdForTCPCommunication(uint32_t thresholdBytes)
+    {
+        m_impl->m_tcpConfig.setSceneActionCompressionThreshold(thresholdBytes);
+    }
+
+    void RamsesFrameworkConfig::setSocketDirectoryForSharedMemoryCommunication(std::string_view directory)
+    {
+        m_impl->m_shmConfig.setSocketDirectory(directory);
+    }
+
+    bool RamsesFrameworkConfig::setRingBufferSizeForSharedMemoryCommunication(uint32_t sizeBytes)
+    {
+        if (sizeBytes < internal::SHMConfig::MinimumRingBufferSize)
+        {
+            LOG_ERROR_P(CONTEXT_CLIENT, "RamsesFrameworkConfig::setRingBufferSizeForSharedMemoryCommunication: size {} below minimum of {} bytes", sizeBytes, internal::SHMConfig::MinimumRingBufferSize);
+            return false;
+        }
+        m_impl->m_shmConfig.setRingBufferSize(sizeBytes);
+        return true;
+    }
+
+    bool RamsesFrameworkConfig::setMetricsEndpoint(std::string_view address)
+    {
+        return m_impl->setMetricsEndpoint(address);
+    }
+
     internal::RamsesFrameworkConfigImpl& RamsesFrameworkConfig::impl()
     {
         return *m_impl;
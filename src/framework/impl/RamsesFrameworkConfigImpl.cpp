@@ -13,6 +13,9 @@
 #include "internal/Communication/TransportCommon/EConnectionProtocol.h"
 #include "internal/Communication/TransportCommon/RamsesTransportProtocolVersion.h"
 #include "impl/EFeatureLevelImpl.h"
+#if defined(HAS_METRICS_ENDPOINT)
+#include "internal/Communication/MetricsEndpoint/MetricsEndpoint.h"
+#endif
 #include <map>
 
 namespace ramses::internal
@@ -190,10 +193,39 @@ namespace ramses::internal
         case EConnectionSystem::Off:
             m_usedProtocol = EConnectionProtocol::Off;
             break;
+        case EConnectionSystem::SharedMemory:
+#if defined(HAS_SHM_COMM)
+            m_usedProtocol = EConnectionProtocol::SharedMemory;
+            break;
+#else
+            LOG_ERROR_P(CONTEXT_CLIENT, "RamsesFrameworkConfig::setConnectionSystem: shared memory connection system not supported by this build");
+            return false;
+#endif
         }
         return true;
     }
 
+    bool RamsesFrameworkConfigImpl::setMetricsEndpoint(std::string_view address)
+    {
+#if defined(HAS_METRICS_ENDPOINT)
+        if (!MetricsEndpoint::ParseAddress(address))
+        {
+            LOG_ERROR_P(CONTEXT_CLIENT, "RamsesFrameworkConfig::setMetricsEndpoint: invalid address '{}', expected 'unix:<absolute path>' or 'tcp:<port>'", address);
+            return false;
+        }
+        m_metricsEndpoint = address;
+        return true;
+#else
+        LOG_ERROR_P(CONTEXT_CLIENT, "RamsesFrameworkConfig::setMetricsEndpoint: metrics endpoint not supported by this build, cannot use '{}'", address);
+        return false;
+#endif
+    }
+
+    const std::string& RamsesFrameworkConfigImpl::getMetricsEndpoint() const
+    {
+        return m_metricsEndpoint;
+    }
+
     Guid RamsesFrameworkConfigImpl::getUserProvidedGuid() const
     {
         return m_userProvidedGuid;
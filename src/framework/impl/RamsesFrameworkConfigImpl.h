@@ -9,6 +9,7 @@
 #pragma once
 
 #include "TCPConfig.h"
+#include "SHMConfig.h"
 #include "internal/Core/Utils/RamsesLogger.h"
 #include "ramses/framework/IThreadWatchdogNotification.h"
 #include "ramses/framework/EFeatureLevel.h"
@@ -63,7 +64,11 @@ namespace ramses::internal
 
         [[nodiscard]] bool setConnectionSystem(EConnectionSystem connectionSystem);
 
+        [[nodiscard]] bool setMetricsEndpoint(std::string_view address);
+        [[nodiscard]] const std::string& getMetricsEndpoint() const;
+
         TCPConfig        m_tcpConfig;
+        SHMConfig        m_shmConfig;
         ERamsesShellType m_shellType;
         ThreadWatchdogConfig m_watchdogConfig;
         bool m_periodicLogsEnabled;
@@ -79,5 +84,6 @@ namespace ramses::internal
         std::string m_participantName;
         bool m_enableDltApplicationRegistration = true;
         Guid m_userProvidedGuid;
+        std::string m_metricsEndpoint;
     };
 }
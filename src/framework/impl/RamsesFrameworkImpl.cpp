@@ -22,12 +22,16 @@
 #include "internal/PlatformAbstraction/PlatformTime.h"
 #include "PublicRamshCommand.h"
 #include "ramses/framework/IRamshCommand.h"
+#if defined(HAS_METRICS_ENDPOINT)
+#include "internal/Communication/MetricsEndpoint/MetricsEndpoint.h"
+#endif
 #include <random>
 
 namespace ramses::internal
 {
     RamsesFrameworkImpl::RamsesFrameworkImpl(const RamsesFrameworkConfigImpl& config, const ParticipantIdentifier& participantAddress)
         : m_ramsh(new RamshStandardSetup(config.m_shellType))
+        , m_metricsRegistry(m_statisticCollection)
         , m_participantAddress(participantAddress)
         // NOTE: if you add something here consider using m_frameworkLock for all locking purposes inside this new class
         , m_connectionProtocol(config.getUsedProtocol())
@@ -238,6 +242,11 @@ namespace ramses::internal
         return m_statisticCollection;
     }
 
+    MetricsRegistry& RamsesFrameworkImpl::getMetricsRegistry()
+    {
+        return m_metricsRegistry;
+    }
+
     bool RamsesFrameworkImpl::addRamshCommand(const std::shared_ptr<IRamshCommand>& command)
     {
         if (!command)
@@ -368,6 +377,19 @@ namespace ramses::internal
             LOG_INFO_P(CONTEXT_FRAMEWORK, "RamsesFramework: periodic logs disabled");
         }
 
+#if defined(HAS_METRICS_ENDPOINT)
+        const auto metricsEndpointAddress = MetricsEndpoint::ParseAddress(config.impl().getMetricsEndpoint());
+        if (metricsEndpointAddress)
+        {
+            impl->m_metricsEndpoint = std::make_unique<MetricsEndpoint>(impl->m_metricsRegistry, *metricsEndpointAddress);
+            if (!impl->m_metricsEndpoint->start())
+            {
+                LOG_ERROR_P(CONTEXT_FRAMEWORK, "RamsesFramework: failed to start metrics endpoint on {}", config.impl().getMetricsEndpoint());
+                impl->m_metricsEndpoint.reset();
+            }
+        }
+#endif
+
         return impl;
     }
 
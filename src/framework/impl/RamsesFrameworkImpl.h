@@ -14,6 +14,7 @@
 #include "internal/Core/Common/ParticipantIdentifier.h"
 #include "internal/Core/Utils/PeriodicLogger.h"
 #include "internal/Core/Utils/StatisticCollection.h"
+#include "internal/Core/Utils/MetricsRegistry.h"
 #include "internal/Communication/TransportCommon/LogConnectionInfo.h"
 #include "internal/Communication/TransportCommon/EConnectionProtocol.h"
 #include "ramses/framework/RamsesFrameworkTypes.h"
@@ -44,6 +45,7 @@ namespace ramses::internal
     class Ramsh;
     class PublicRamshCommand;
     class RamsesFrameworkConfigImpl;
+    class MetricsEndpoint;
 
     class RamsesFrameworkImpl
     {
@@ -75,6 +77,7 @@ namespace ramses::internal
         ITaskQueue& getTaskQueue();
         PeriodicLogger& getPeriodicLogger();
         StatisticCollectionFramework& getStatisticCollection();
+        MetricsRegistry& getMetricsRegistry();
         static void SetLogHandler(const LogHandlerFunc& logHandlerFunc);
         bool addRamshCommand(const std::shared_ptr<IRamshCommand>& command);
         bool executeRamshCommand(const std::string& input);
@@ -94,6 +97,7 @@ namespace ramses::internal
         std::unique_ptr<RamshStandardSetup> m_ramsh;
         std::vector<std::shared_ptr<PublicRamshCommand>> m_publicRamshCommands;
         StatisticCollectionFramework m_statisticCollection;
+        MetricsRegistry m_metricsRegistry;
         ParticipantIdentifier m_participantAddress;
         EConnectionProtocol m_connectionProtocol;
         std::unique_ptr<ICommunicationSystem> m_communicationSystem;
@@ -104,6 +108,9 @@ namespace ramses::internal
         ResourceComponent m_resourceComponent;
         SceneGraphComponent m_scenegraphComponent;
         std::shared_ptr<LogConnectionInfo> m_ramshCommandLogConnectionInformation;
+#if defined(HAS_METRICS_ENDPOINT)
+        std::unique_ptr<MetricsEndpoint> m_metricsEndpoint;
+#endif
 
         EFeatureLevel m_featureLevel;
         ErrorReporting m_errorReporting;
@@ -118,4 +118,9 @@ namespace ramses::internal
             }
         }
     }
+
+    void RamsesObjectImpl::validateWithoutDependencies(ValidationReportImpl& report) const
+    {
+        onValidate(report);
+    }
 }
@@ -54,6 +54,8 @@ namespace ramses::internal
         virtual void deinitializeFrameworkData() = 0;
 
         void validate(ValidationReportImpl& report) const;
+        // runs checks of this object only, dependent objects are added to report but not validated
+        void validateWithoutDependencies(ValidationReportImpl& report) const;
 
     protected:
         virtual void onValidate(ValidationReportImpl& /*report*/) const {};
@@ -0,0 +1,40 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "SHMConfig.h"
+
+namespace ramses::internal
+{
+    const uint32_t SHMConfig::MinimumRingBufferSize(64u * 1024u);
+
+    SHMConfig::SHMConfig()
+        : m_socketDirectory("/tmp/ramses-shm")
+        , m_ringBufferSize(16u * 1024u * 1024u)
+    {
+    }
+
+    const std::string& SHMConfig::getSocketDirectory() const
+    {
+        return m_socketDirectory;
+    }
+
+    uint32_t SHMConfig::getRingBufferSize() const
+    {
+        return m_ringBufferSize;
+    }
+
+    void SHMConfig::setSocketDirectory(std::string_view directory)
+    {
+        m_socketDirectory = std::string(directory);
+    }
+
+    void SHMConfig::setRingBufferSize(uint32_t sizeBytes)
+    {
+        m_ringBufferSize = sizeBytes;
+    }
+}
@@ -0,0 +1,34 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace ramses::internal
+{
+    class SHMConfig
+    {
+    public:
+        SHMConfig();
+
+        [[nodiscard]] const std::string& getSocketDirectory() const;
+        [[nodiscard]] uint32_t getRingBufferSize() const;
+
+        void setSocketDirectory(std::string_view directory);
+        void setRingBufferSize(uint32_t sizeBytes);
+
+        static const uint32_t MinimumRingBufferSize;
+
+    private:
+        std::string m_socketDirectory;
+        uint32_t m_ringBufferSize;
+    };
+}
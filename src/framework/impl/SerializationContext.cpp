@@ -9,6 +9,9 @@
 #include "impl/SerializationContext.h"
 #include "RamsesObjectImpl.h"
 #include "ramses/framework/RamsesObject.h"
+#include "internal/Core/TaskFramework/ParallelTaskGroup.h"
+#include <algorithm>
+#include <memory>
 
 namespace ramses::internal
 {
@@ -28,8 +31,9 @@ namespace ramses::internal
         return ObjectIDType(0u);
     }
 
-    DeserializationContext::DeserializationContext(const SceneConfigImpl& loadConfig)
+    DeserializationContext::DeserializationContext(const SceneConfigImpl& loadConfig, ITaskQueue* taskQueue)
         : m_loadConfig(loadConfig)
+        , m_taskQueue(taskQueue)
     {
     }
 
@@ -77,6 +81,11 @@ namespace ramses::internal
         m_dependingObjects.put(obj);
     }
 
+    void DeserializationContext::addForConcurrentDependencyResolve(RamsesObjectImpl* obj)
+    {
+        m_concurrentlyDependingObjects.push_back(obj);
+    }
+
     bool DeserializationContext::resolveDependencies()
     {
         for (auto obj : m_dependingObjects)
@@ -85,7 +94,22 @@ namespace ramses::internal
                 return false;
         }
 
-        return true;
+        if (m_concurrentlyDependingObjects.size() <= 1u)
+        {
+            return std::all_of(m_concurrentlyDependingObjects.cbegin(), m_concurrentlyDependingObjects.cend(),
+                [this](RamsesObjectImpl* obj) { return obj->resolveDeserializationDependencies(*this); });
+        }
+
+        // every object reports into its own slot, result does not depend on order of execution
+        auto results = std::make_unique<bool[]>(m_concurrentlyDependingObjects.size());
+        ParallelTaskGroup taskGroup(m_taskQueue);
+        for (size_t i = 0u; i < m_concurrentlyDependingObjects.size(); ++i)
+        {
+            taskGroup.add([this, i, &results]() { results[i] = m_concurrentlyDependingObjects[i]->resolveDeserializationDependencies(*this); });
+        }
+        taskGroup.execute();
+
+        return std::all_of(results.get(), results.get() + m_concurrentlyDependingObjects.size(), [](bool result) { return result; });
     }
 
     void DeserializationContext::addNodeHandleToNodeImplMapping(NodeHandle nodeHandle, NodeImpl* node)
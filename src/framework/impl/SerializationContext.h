@@ -21,6 +21,7 @@ namespace ramses::internal
     class NodeImpl;
     class SaveFileConfigImpl;
     class SceneConfigImpl;
+    class ITaskQueue;
 
     using ObjectIDType = uint32_t;
 
@@ -29,7 +30,7 @@ namespace ramses::internal
         using RamsesObjectImplSet = HashSet<RamsesObjectImpl *>;
 
     public:
-        explicit DeserializationContext(const SceneConfigImpl& loadConfig);
+        explicit DeserializationContext(const SceneConfigImpl& loadConfig, ITaskQueue* taskQueue = nullptr);
 
         void resize(uint32_t totalObjects, uint32_t nodeCount);
         static ObjectIDType GetObjectIDNull();
@@ -42,6 +43,9 @@ namespace ramses::internal
         static void ReadDependentPointerAndStoreAsID(IInputStream& inStream, PTR_TYPE*& ptr);
 
         void addForDependencyResolve(RamsesObjectImpl* obj);
+        // resolved after all other objects, in parallel on the task queue if there is one,
+        // object must only read other objects and not modify shared state when resolving
+        void addForConcurrentDependencyResolve(RamsesObjectImpl* obj);
 
         // phase 2: resolve dependencies
         bool resolveDependencies();
@@ -56,7 +60,9 @@ namespace ramses::internal
         std::vector<RamsesObjectImpl*> m_objectImpls;
         std::vector<NodeImpl*>         m_nodeMap;
         RamsesObjectImplSet m_dependingObjects;
+        std::vector<RamsesObjectImpl*> m_concurrentlyDependingObjects;
         const SceneConfigImpl&     m_loadConfig;
+        ITaskQueue*                m_taskQueue;
     };
 
     class SerializationContext
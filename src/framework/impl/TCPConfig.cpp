@@ -84,4 +84,14 @@ namespace ramses::internal
     {
         m_aliveTimeout = timeout;
     }
+
+    uint32_t TCPConfig::getSceneActionCompressionThreshold() const
+    {
+        return m_sceneActionCompressionThreshold;
+    }
+
+    void TCPConfig::setSceneActionCompressionThreshold(uint32_t thresholdBytes)
+    {
+        m_sceneActionCompressionThreshold = thresholdBytes;
+    }
 }
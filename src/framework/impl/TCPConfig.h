@@ -35,6 +35,9 @@ namespace ramses::internal
         void setAliveInterval(std::chrono::milliseconds interval);
         void setAliveTimeout(std::chrono::milliseconds timeout);
 
+        [[nodiscard]] uint32_t getSceneActionCompressionThreshold() const;
+        void setSceneActionCompressionThreshold(uint32_t thresholdBytes);
+
     private:
         static const uint16_t DefaultPort;
         static const uint16_t DefaultDaemonPort;
@@ -46,5 +49,6 @@ namespace ramses::internal
         std::string m_daemonIP;
         std::chrono::milliseconds m_aliveInterval;
         std::chrono::milliseconds m_aliveTimeout;
+        uint32_t m_sceneActionCompressionThreshold{0u};
     };
 }
@@ -0,0 +1,282 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Communication/MetricsEndpoint/MetricsEndpoint.h"
+#include "internal/Core/Utils/MetricsRegistry.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <unistd.h>
+#include <charconv>
+#include <cerrno>
+#include <cstring>
+
+namespace ramses::internal
+{
+    static constexpr size_t MaxRequestSize = 8u * 1024u;
+    static constexpr int ClientTimeoutMs = 1000;
+    static constexpr std::string_view UnixAddressPrefix{"unix:"};
+    static constexpr std::string_view TcpAddressPrefix{"tcp:"};
+
+    MetricsEndpoint::MetricsEndpoint(const MetricsRegistry& registry, MetricsEndpointAddress address)
+        : m_registry(registry)
+        , m_address(std::move(address))
+        , m_thread("R_Metrics")
+    {
+    }
+
+    MetricsEndpoint::~MetricsEndpoint()
+    {
+        stop();
+    }
+
+    std::optional<MetricsEndpointAddress> MetricsEndpoint::ParseAddress(std::string_view address)
+    {
+        MetricsEndpointAddress result;
+        if (address.substr(0, UnixAddressPrefix.size()) == UnixAddressPrefix)
+        {
+            result.unixSocketPath = address.substr(UnixAddressPrefix.size());
+            if (result.unixSocketPath.empty() || result.unixSocketPath.front() != '/' || result.unixSocketPath.size() >= sizeof(sockaddr_un::sun_path))
+                return std::nullopt;
+            return result;
+        }
+        if (address.substr(0, TcpAddressPrefix.size()) == TcpAddressPrefix)
+        {
+            const auto portString = address.substr(TcpAddressPrefix.size());
+            const auto parseResult = std::from_chars(portString.data(), portString.data() + portString.size(), result.port);
+            if (portString.empty() || parseResult.ec != std::errc() || parseResult.ptr != portString.data() + portString.size())
+                return std::nullopt;
+            return result;
+        }
+        return std::nullopt;
+    }
+
+    bool MetricsEndpoint::start()
+    {
+        if (m_running)
+            return false;
+
+        if (!openListenSocket())
+        {
+            closeListenSocket();
+            return false;
+        }
+
+        LOG_INFO_P(CONTEXT_FRAMEWORK, "MetricsEndpoint: serving metrics on {}",
+            m_address.unixSocketPath.empty() ? fmt::format("127.0.0.1:{}", m_boundPort) : m_address.unixSocketPath);
+        m_running = true;
+        resetCancel();
+        m_thread.start(*this);
+        return true;
+    }
+
+    void MetricsEndpoint::stop()
+    {
+        if (!m_running)
+            return;
+
+        cancel();
+        const uint64_t value = 1u;
+        [[maybe_unused]] const auto written = ::write(m_wakeupEvent, &value, sizeof(value));
+        m_thread.join();
+        closeListenSocket();
+        m_running = false;
+    }
+
+    uint16_t MetricsEndpoint::getPort() const
+    {
+        return m_boundPort;
+    }
+
+    bool MetricsEndpoint::openListenSocket()
+    {
+        m_wakeupEvent = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        const int domain = m_address.unixSocketPath.empty() ? AF_INET : AF_UNIX;
+        m_listenSocket = ::socket(domain, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (m_wakeupEvent < 0 || m_listenSocket < 0)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "MetricsEndpoint::openListenSocket: socket creation failed. {}", std::strerror(errno));
+            return false;
+        }
+
+        int bindResult = -1;
+        if (domain == AF_UNIX)
+        {
+            sockaddr_un address = {};
+            address.sun_family = AF_UNIX;
+            std::memcpy(address.sun_path, m_address.unixSocketPath.c_str(), m_address.unixSocketPath.size());
+            if (!removeStaleUnixSocket())
+                return false;
+            bindResult = ::bind(m_listenSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+            m_unixSocketBound = (bindResult == 0);
+        }
+        else
+        {
+            const int reuse = 1;
+            ::setsockopt(m_listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+            sockaddr_in address = {};
+            address.sin_family = AF_INET;
+            address.sin_port = htons(m_address.port);
+            // never expose metrics outside of the host
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            bindResult = ::bind(m_listenSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+            if (bindResult == 0)
+            {
+                socklen_t addressSize = sizeof(address);
+                ::getsockname(m_listenSocket, reinterpret_cast<sockaddr*>(&address), &addressSize);
+                m_boundPort = ntohs(address.sin_port);
+            }
+        }
+
+        if (bindResult != 0 || ::listen(m_listenSocket, SOMAXCONN) != 0)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "MetricsEndpoint::openListenSocket: bind/listen failed. {}", std::strerror(errno));
+            return false;
+        }
+        return true;
+    }
+
+    bool MetricsEndpoint::removeStaleUnixSocket() const
+    {
+        // only a socket left over from a previous run (nobody listening anymore) is removed, anything else at the path is kept
+        const char* path = m_address.unixSocketPath.c_str();
+        struct stat fileStatus = {};
+        if (::lstat(path, &fileStatus) != 0)
+        {
+            if (errno == ENOENT)
+                return true;
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "MetricsEndpoint::removeStaleUnixSocket: cannot access {}. {}", m_address.unixSocketPath, std::strerror(errno));
+            return false;
+        }
+
+        if (!S_ISSOCK(fileStatus.st_mode))
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "MetricsEndpoint::removeStaleUnixSocket: {} exists and is not a socket", m_address.unixSocketPath);
+            return false;
+        }
+
+        const int probeSocket = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (probeSocket < 0)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "MetricsEndpoint::removeStaleUnixSocket: socket creation failed. {}", std::strerror(errno));
+            return false;
+        }
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, m_address.unixSocketPath.c_str(), m_address.unixSocketPath.size());
+        const bool isStale = ::connect(probeSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 && errno == ECONNREFUSED;
+        ::close(probeSocket);
+
+        if (!isStale)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "MetricsEndpoint::removeStaleUnixSocket: {} is in use by another process", m_address.unixSocketPath);
+            return false;
+        }
+        if (::unlink(path) != 0)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "MetricsEndpoint::removeStaleUnixSocket: cannot remove stale socket {}. {}", m_address.unixSocketPath, std::strerror(errno));
+            return false;
+        }
+        return true;
+    }
+
+    void MetricsEndpoint::closeListenSocket()
+    {
+        if (m_listenSocket >= 0)
+        {
+            if (m_unixSocketBound)
+                ::unlink(m_address.unixSocketPath.c_str());
+            m_unixSocketBound = false;
+            ::close(m_listenSocket);
+            m_listenSocket = -1;
+        }
+        if (m_wakeupEvent >= 0)
+        {
+            ::close(m_wakeupEvent);
+            m_wakeupEvent = -1;
+        }
+    }
+
+    void MetricsEndpoint::run()
+    {
+        while (!isCancelRequested())
+        {
+            pollfd pollFds[] = { { m_wakeupEvent, POLLIN, 0 }, { m_listenSocket, POLLIN, 0 } };
+            if (::poll(pollFds, 2, -1) < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                LOG_ERROR_P(CONTEXT_FRAMEWORK, "MetricsEndpoint::run: poll failed. {}", std::strerror(errno));
+                break;
+            }
+
+            if ((pollFds[1].revents & POLLIN) != 0)
+            {
+                const int clientSocket = ::accept4(m_listenSocket, nullptr, nullptr, SOCK_CLOEXEC);
+                if (clientSocket >= 0)
+                {
+                    serveClient(clientSocket);
+                    ::close(clientSocket);
+                }
+            }
+        }
+    }
+
+    void MetricsEndpoint::serveClient(int clientSocket) const
+    {
+        // a stuck client must not block the endpoint for longer than the timeout
+        timeval timeout = {};
+        timeout.tv_sec = ClientTimeoutMs / 1000;
+        timeout.tv_usec = (ClientTimeoutMs % 1000) * 1000;
+        ::setsockopt(clientSocket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        ::setsockopt(clientSocket, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+        std::string request;
+        char buffer[1024];
+        while (request.size() < MaxRequestSize && request.find("\r\n\r\n") == std::string::npos)
+        {
+            const auto readBytes = ::recv(clientSocket, buffer, sizeof(buffer), 0);
+            if (readBytes <= 0)
+                break;
+            request.append(buffer, static_cast<size_t>(readBytes));
+        }
+
+        std::string response;
+        const std::string_view requestLine = std::string_view(request).substr(0, request.find("\r\n"));
+        if (requestLine.substr(0, 4) != "GET " ||
+            (requestLine.substr(4, 9) != "/metrics " && requestLine.substr(4, 2) != "/ "))
+        {
+            response = "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+        }
+        else
+        {
+            const std::string body = m_registry.collectPrometheusText();
+            response = fmt::format("HTTP/1.1 200 OK\r\nContent-Type: text/plain; version=0.0.4; charset=utf-8\r\nContent-Length: {}\r\nConnection: close\r\n\r\n", body.size());
+            response += body;
+        }
+
+        size_t sent = 0u;
+        while (sent < response.size())
+        {
+            const auto sentBytes = ::send(clientSocket, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+            if (sentBytes <= 0)
+            {
+                LOG_WARN_P(CONTEXT_FRAMEWORK, "MetricsEndpoint::serveClient: send failed after {} of {} bytes. {}", sent, response.size(), std::strerror(errno));
+                return;
+            }
+            sent += static_cast<size_t>(sentBytes);
+        }
+    }
+}
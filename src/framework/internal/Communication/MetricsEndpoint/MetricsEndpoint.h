@@ -0,0 +1,65 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/PlatformAbstraction/PlatformThread.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace ramses::internal
+{
+    class MetricsRegistry;
+
+    struct MetricsEndpointAddress
+    {
+        // either a Unix domain socket path or a TCP port on the loopback interface
+        std::string unixSocketPath;
+        uint16_t port = 0u;
+    };
+
+    // Serves content of MetricsRegistry in Prometheus text format over HTTP, one request per connection.
+    // Requests are handled on own thread which never takes the framework lock.
+    class MetricsEndpoint final : public Runnable
+    {
+    public:
+        MetricsEndpoint(const MetricsRegistry& registry, MetricsEndpointAddress address);
+        ~MetricsEndpoint() override;
+
+        bool start();
+        void stop();
+
+        // actual port the endpoint listens on, relevant if port 0 was requested
+        [[nodiscard]] uint16_t getPort() const;
+
+        // accepts "unix:<absolute path>" or "tcp:<port>"
+        static std::optional<MetricsEndpointAddress> ParseAddress(std::string_view address);
+
+    private:
+        void run() override;
+
+        bool openListenSocket();
+        [[nodiscard]] bool removeStaleUnixSocket() const;
+        void closeListenSocket();
+        void serveClient(int clientSocket) const;
+
+        const MetricsRegistry& m_registry;
+        const MetricsEndpointAddress m_address;
+        PlatformThread m_thread;
+
+        bool m_running = false;
+        uint16_t m_boundPort = 0u;
+        int m_listenSocket = -1;
+        // socket file is only removed by the endpoint which created it
+        bool m_unixSocketBound = false;
+        int m_wakeupEvent = -1;
+    };
+}
@@ -21,6 +21,10 @@
 #include "internal/Communication/TransportTCP/TcpDiscoveryDaemon.h"
 #endif
 
+#if defined(HAS_SHM_COMM)
+#include "internal/Communication/TransportSHM/SHMConnectionSystem.h"
+#endif
+
 #include "impl/RamsesFrameworkConfigImpl.h"
 #include "ramses/framework/RamsesFrameworkConfig.h"
 #include <memory>
@@ -49,7 +53,20 @@ namespace ramses::internal
             LOG_DEBUG(CONTEXT_COMMUNICATION, "ConstructTCPConnectionManager: Daemon Address: " << daemonNetworkAddress.getIp() << ":" << daemonNetworkAddress.getPort());
 
             // allocate
-            return std::make_unique<TCPConnectionSystem>(participantNetworkAddress, config.getProtocolVersion(), daemonNetworkAddress, false, frameworkLock, statisticCollection, config.m_tcpConfig.getAliveInterval(), config.m_tcpConfig.getAliveTimeout());
+            return std::make_unique<TCPConnectionSystem>(participantNetworkAddress, config.getProtocolVersion(), daemonNetworkAddress, false, frameworkLock, statisticCollection, config.m_tcpConfig.getAliveInterval(), config.m_tcpConfig.getAliveTimeout(),
+                config.m_tcpConfig.getSceneActionCompressionThreshold());
+        }
+#endif
+
+#if defined(HAS_SHM_COMM)
+        // Construct SHMConnectionSystem, keepalive settings are shared with TCP
+        auto ConstructSHMConnectionManager(const RamsesFrameworkConfigImpl& config, const ParticipantIdentifier& participantIdentifier,
+            PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection)
+        {
+            LOG_INFO(CONTEXT_COMMUNICATION, "Use SHMConnectionSystem");
+
+            return std::make_unique<SHMConnectionSystem>(participantIdentifier, config.getProtocolVersion(), config.m_shmConfig.getSocketDirectory(), config.m_shmConfig.getRingBufferSize(),
+                frameworkLock, statisticCollection, config.m_tcpConfig.getAliveInterval(), config.m_tcpConfig.getAliveTimeout());
         }
 #endif
     }
@@ -71,6 +88,8 @@ namespace ramses::internal
                 break;
 
             case EConnectionProtocol::Off:
+            case EConnectionProtocol::SharedMemory:
+                // shared memory participants discover each other through their socket directory
                 constructedDaemon = std::make_unique<FakeDiscoveryDaemon>();
                 break;
 
@@ -92,6 +111,12 @@ namespace ramses::internal
         {
             return ConstructTCPConnectionManager(config, participantIdentifier, frameworkLock, statisticCollection);
         }
+#endif
+#if defined(HAS_SHM_COMM)
+        case EConnectionProtocol::SharedMemory:
+        {
+            return ConstructSHMConnectionManager(config, participantIdentifier, frameworkLock, statisticCollection);
+        }
 #endif
         case EConnectionProtocol::Off:
         {
@@ -99,7 +124,7 @@ namespace ramses::internal
             return std::make_unique<FakeConnectionSystem>();
         }
         default:
-            LOG_FATAL(CONTEXT_COMMUNICATION, "Unable to construct connection system for given protocol: " << config.getUsedProtocol() << ". Ensure that TCP or the fake connection system is enabled.");
+            LOG_FATAL(CONTEXT_COMMUNICATION, "Unable to construct connection system for given protocol: " << config.getUsedProtocol() << ". Ensure that TCP, shared memory or the fake connection system is enabled.");
             assert(false && "Unable to construct connection system for given protocol. Ensure that TCP or the fake connection system is enabled.");
             return nullptr;
         }
@@ -18,6 +18,8 @@ namespace ramses::internal
     {
     public:
         virtual ~ISceneUpdateSerializer() = default;
-        virtual bool writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) const = 0;
+        // actionCompressionThreshold: scene action blocks of at least this size get LZ4 compressed, 0 disables compression.
+        // Only pass a value != 0 when the receiver announced support for compressed scene actions.
+        virtual bool writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, uint32_t actionCompressionThreshold) const = 0;
     };
 }
@@ -17,9 +17,9 @@ namespace ramses::internal
     {
     }
 
-    bool SceneUpdateSerializer::writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) const
+    bool SceneUpdateSerializer::writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, uint32_t actionCompressionThreshold) const
     {
-        SingleSceneUpdateWriter writer(m_update, packetMem, writeDoneFunc, m_sceneStatistics);
+        SingleSceneUpdateWriter writer(m_update, packetMem, writeDoneFunc, m_sceneStatistics, actionCompressionThreshold);
         return writer.write();
     }
 
@@ -19,7 +19,7 @@ namespace ramses::internal
     {
     public:
         explicit SceneUpdateSerializer(const SceneUpdate& update, StatisticCollectionScene& sceneStatistics);
-        bool writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) const override;
+        bool writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, uint32_t actionCompressionThreshold) const override;
 
         [[nodiscard]] const SceneUpdate& getUpdate() const;
         [[nodiscard]] const StatisticCollectionScene& getStatisticCollection() const;
@@ -11,6 +11,9 @@
 #include "internal/Communication/TransportCommon/SceneUpdateSerializationHelper.h"
 #include "internal/Core/Utils/LogMacros.h"
 #include "internal/Core/Utils/BinaryInputStream.h"
+#include "internal/SceneGraph/Resource/LZ4CompressionUtils.h"
+
+#include <chrono>
 
 namespace ramses::internal
 {
@@ -134,6 +137,11 @@ namespace ramses::internal
             if (!handleSceneActionCollection())
                 return false;
         }
+        else if (blockType == SingleSceneUpdateWriter::BlockType::CompressedSceneActionCollection)
+        {
+            if (!handleCompressedSceneActionCollection())
+                return false;
+        }
         else if (blockType == SingleSceneUpdateWriter::BlockType::Resource)
         {
             if (!handleResource())
@@ -185,6 +193,43 @@ namespace ramses::internal
         return true;
     }
 
+    bool SceneUpdateStreamDeserializer::handleCompressedSceneActionCollection()
+    {
+        if (m_currentBlock.size() <= sizeof(uint32_t)*2)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleCompressedSceneActionCollection: Block too small ({})", m_currentBlock.size());
+            return false;
+        }
+        if (m_currentResult.actions.numberOfActions() != 0)
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleCompressedSceneActionCollection: More than one SceneActionCollection in packet");
+            return false;
+        }
+
+        BinaryInputStream is(m_currentBlock.data());
+        uint32_t descSize = 0;
+        uint32_t dataSize = 0;
+        is >> descSize
+           >> dataSize;
+
+        const auto startTime = std::chrono::steady_clock::now();
+        const absl::Span<const std::byte> compressedData(is.readPosition(), m_currentBlock.size() - is.getCurrentReadBytes());
+        m_decompressedActions.resize(static_cast<size_t>(descSize) + dataSize);
+        if (!LZ4CompressionUtils::decompress(compressedData, absl::MakeSpan(m_decompressedActions)))
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleCompressedSceneActionCollection: Decompression of {} bytes to {} bytes failed",
+                        compressedData.size(), m_decompressedActions.size());
+            return false;
+        }
+
+        const absl::Span<const std::byte> plainData(m_decompressedActions);
+        m_currentResult.actions = SceneActionSerialization::Deserialize(plainData.subspan(0, descSize), plainData.subspan(descSize, dataSize));
+
+        LOG_TRACE_P(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleCompressedSceneActionCollection: Decompressed {} to {} bytes in {}us", compressedData.size(), plainData.size(),
+                    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count());
+        return true;
+    }
+
     bool SceneUpdateStreamDeserializer::handleResource()
     {
         if (m_currentBlock.size() < sizeof(uint32_t)*2)
@@ -51,6 +51,7 @@ namespace ramses::internal
 
         bool finalizeBlock();
         bool handleSceneActionCollection();
+        bool handleCompressedSceneActionCollection();
         bool handleResource();
         bool handleFlushInfos();
 
@@ -59,6 +60,7 @@ namespace ramses::internal
         uint32_t m_currentBlockSize = 0;
         uint32_t m_blockType = 0;
         std::vector<std::byte> m_currentBlock;
+        std::vector<std::byte> m_decompressedActions;
         Result m_currentResult;
     };
 }
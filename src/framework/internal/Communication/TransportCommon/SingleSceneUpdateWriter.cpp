@@ -10,17 +10,21 @@
 #include "internal/Communication/TransportCommon/SceneUpdateSerializationHelper.h"
 #include "internal/Core/Utils/StatisticCollection.h"
 #include "internal/Core/Utils/LogMacros.h"
+#include "internal/SceneGraph/Resource/LZ4CompressionUtils.h"
 
 #include <functional>
+#include <chrono>
 
 namespace ramses::internal
 {
-    SingleSceneUpdateWriter::SingleSceneUpdateWriter(const SceneUpdate& update, absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, StatisticCollectionScene& sceneStatistics)
+    SingleSceneUpdateWriter::SingleSceneUpdateWriter(const SceneUpdate& update, absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, StatisticCollectionScene& sceneStatistics,
+        uint32_t actionCompressionThreshold)
         : m_update(update)
         , m_packetMem(packetMem)
         , m_writeDoneFunc(writeDoneFunc)
         , m_packetWriter(m_packetMem.data(), static_cast<uint32_t>(m_packetMem.size()))
         , m_sceneStatistics(sceneStatistics)
+        , m_actionCompressionThreshold(actionCompressionThreshold)
     {
         /*
           Packet format
@@ -41,6 +45,11 @@ namespace ramses::internal
           - type list blob
           - data blob
 
+          Compressed SceneAction data (only when receiver supports it and size >= threshold)
+          - type list length : uint32_t (uncompressed)
+          - data length : uint32_t (uncompressed)
+          - LZ4 compressed blob of (type list blob + data blob)
+
           Resource data
           - metadata length : uin32_t
           - blob length : uint32_t
@@ -91,6 +100,9 @@ namespace ramses::internal
         const auto descSpan = SceneActionSerialization::SerializeDescription(m_update.actions, m_temporaryMemToSerializeDescription);
         const auto dataSpan = SceneActionSerialization::SerializeData(m_update.actions);
 
+        if (m_actionCompressionThreshold != 0u && descSpan.size() + dataSpan.size() >= m_actionCompressionThreshold)
+            return writeCompressedSceneActionCollection(descSpan, dataSpan);
+
         std::array<std::byte, sizeof(uint32_t)*2> header{};
         RawBinaryOutputStream os(header.data(), header.size());
         os << static_cast<uint32_t>(descSpan.size())
@@ -98,6 +110,40 @@ namespace ramses::internal
         return writeBlock(BlockType::SceneActionCollection, {{os.getData(), os.getSize()}, descSpan, dataSpan});
     }
 
+    bool SingleSceneUpdateWriter::writeCompressedSceneActionCollection(absl::Span<const std::byte> descSpan, absl::Span<const std::byte> dataSpan)
+    {
+        const auto startTime = std::chrono::steady_clock::now();
+
+        // compress type list and data in one go, type list alone is too small to compress well
+        std::vector<std::byte> plainData;
+        plainData.reserve(descSpan.size() + dataSpan.size());
+        plainData.insert(plainData.end(), descSpan.begin(), descSpan.end());
+        plainData.insert(plainData.end(), dataSpan.begin(), dataSpan.end());
+
+        const bool compressed = LZ4CompressionUtils::compress(plainData, m_temporaryMemToCompressActions, LZ4CompressionUtils::CompressionLevel::Fast);
+        const auto compressionTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+
+        std::array<std::byte, sizeof(uint32_t)*2> header{};
+        RawBinaryOutputStream os(header.data(), header.size());
+        os << static_cast<uint32_t>(descSpan.size())
+           << static_cast<uint32_t>(dataSpan.size());
+
+        if (!compressed || m_temporaryMemToCompressActions.size() >= plainData.size())
+        {
+            LOG_DEBUG_P(CONTEXT_COMMUNICATION, "SingleSceneUpdateWriter::writeCompressedSceneActionCollection: Compression not beneficial for {} bytes, send uncompressed", plainData.size());
+            return writeBlock(BlockType::SceneActionCollection, {{os.getData(), os.getSize()}, descSpan, dataSpan});
+        }
+
+        m_sceneStatistics.statSceneActionsCompressedInputSize.incCounter(static_cast<uint32_t>(plainData.size()));
+        m_sceneStatistics.statSceneActionsCompressedOutputSize.incCounter(static_cast<uint32_t>(m_temporaryMemToCompressActions.size()));
+        m_sceneStatistics.statSceneActionsCompressionTime.incCounter(static_cast<uint32_t>(compressionTime.count()));
+
+        LOG_TRACE_P(CONTEXT_COMMUNICATION, "SingleSceneUpdateWriter::writeCompressedSceneActionCollection: Compressed {} to {} bytes in {}us",
+                    plainData.size(), m_temporaryMemToCompressActions.size(), compressionTime.count());
+
+        return writeBlock(BlockType::CompressedSceneActionCollection, {{os.getData(), os.getSize()}, m_temporaryMemToCompressActions});
+    }
+
     bool SingleSceneUpdateWriter::writeResource(const IResource& res)
     {
         m_temporaryMemToSerializeDescription.clear();
@@ -19,7 +19,8 @@ namespace ramses::internal
     class SingleSceneUpdateWriter
     {
     public:
-        SingleSceneUpdateWriter(const SceneUpdate& update, absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, StatisticCollectionScene& sceneStatistics);
+        SingleSceneUpdateWriter(const SceneUpdate& update, absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, StatisticCollectionScene& sceneStatistics,
+            uint32_t actionCompressionThreshold = 0u);
 
         bool write();
 
@@ -28,6 +29,7 @@ namespace ramses::internal
             SceneActionCollection = 10,
             Resource              = 11,
             FlushInfos            = 12,
+            CompressedSceneActionCollection = 13,
         };
 
         static constexpr const uint32_t hasMorePacketsFlag = 0xCA;
@@ -38,6 +40,7 @@ namespace ramses::internal
         bool finalizePacket(bool more);
 
         bool writeSceneActionCollection();
+        bool writeCompressedSceneActionCollection(absl::Span<const std::byte> descSpan, absl::Span<const std::byte> dataSpan);
         bool writeResource(const IResource& resource);
         bool writeFlushInfos(const FlushInformation& infos);
 
@@ -52,5 +55,7 @@ namespace ramses::internal
         std::vector<std::byte>             m_temporaryMemToSerializeDescription;  // optimization to avoid allocations
         StatisticCollectionScene&          m_sceneStatistics;
         uint64_t                           m_overallSize{0};
+        const uint32_t                     m_actionCompressionThreshold;
+        std::vector<std::byte>             m_temporaryMemToCompressActions;
     };
 }
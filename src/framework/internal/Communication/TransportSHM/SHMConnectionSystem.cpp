@@ -0,0 +1,1167 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Communication/TransportSHM/SHMConnectionSystem.h"
+
+#include "internal/Communication/TransportCommon/ISceneUpdateSerializer.h"
+#include "internal/Core/Utils/BinaryInputStream.h"
+#include "internal/Core/Utils/RawBinaryOutputStream.h"
+#include "internal/Core/Utils/StatisticCollection.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <dirent.h>
+#include <poll.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+namespace ramses::internal
+{
+    static constexpr uint32_t SceneUpdatePacketSize = 1024u * 1024u;
+    static constexpr size_t ReadChunkSize = 64u * 1024u;
+    static constexpr size_t MaxReadsPerWakeup = 16u;
+    static constexpr size_t MaxFileDescriptorsPerRead = 4u;
+    static constexpr int PollTimeoutMs = 50;
+    static constexpr std::chrono::milliseconds DiscoveryInterval{100};
+    static constexpr std::string_view SocketFilePrefix{"ramses-"};
+    static constexpr std::string_view SocketFileSuffix{".sock"};
+
+    SHMConnectionSystem::SHMConnectionSystem(ParticipantIdentifier participant,
+                                             uint32_t protocolVersion,
+                                             std::string socketDirectory,
+                                             uint32_t ringBufferSize,
+                                             PlatformLock& frameworkLock,
+                                             StatisticCollectionFramework& statisticCollection,
+                                             std::chrono::milliseconds aliveInterval,
+                                             std::chrono::milliseconds aliveTimeout)
+        : m_participant(std::move(participant))
+        , m_protocolVersion(protocolVersion)
+        , m_socketDirectory(std::move(socketDirectory))
+        , m_ringBufferSize(ringBufferSize)
+        , m_aliveInterval(aliveInterval)
+        , m_aliveIntervalTimeout(aliveTimeout)
+        , m_frameworkLock(frameworkLock)
+        , m_thread("R_SHM_ConnSys")
+        , m_statisticCollection(statisticCollection)
+        , m_ramsesConnectionStatusUpdateNotifier(m_participant.getParticipantName(), CONTEXT_COMMUNICATION, "ramses", frameworkLock)
+    {
+    }
+
+    SHMConnectionSystem::~SHMConnectionSystem()
+    {
+        if (m_running)
+            disconnectServices();
+    }
+
+    std::string SHMConnectionSystem::getSocketPath(const Guid& participant) const
+    {
+        return fmt::format("{}/{}{}{}", m_socketDirectory, SocketFilePrefix, participant.get(), SocketFileSuffix);
+    }
+
+    bool SHMConnectionSystem::connectServices()
+    {
+        LOG_INFO(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::connectServices: "
+                 << m_participant.getParticipantId() << "/" << m_participant.getParticipantName()
+                 << " at " << getSocketPath(m_participant.getParticipantId())
+                 << ", ringBufferSize " << m_ringBufferSize
+                 << ", aliveInterval " << m_aliveInterval.count() << "ms, aliveTimeout " << m_aliveIntervalTimeout.count() << "ms");
+        if (m_aliveIntervalTimeout < m_aliveInterval + std::chrono::milliseconds{100})
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << "): Alive timeout very low, expect issues " <<
+                     "(alive " << m_aliveInterval.count() << ", timeout " << m_aliveIntervalTimeout.count() << ")");
+        }
+
+        PlatformGuard guard(m_frameworkLock);
+        if (m_running)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::connectServices: called more than once");
+            return false;
+        }
+
+        if (!openListenSocket())
+        {
+            closeListenSocket();
+            return false;
+        }
+
+        m_running = true;
+        resetCancel();
+        m_thread.start(*this);
+
+        return true;
+    }
+
+    bool SHMConnectionSystem::disconnectServices()
+    {
+        LOG_INFO(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::disconnectServices");
+
+        PlatformGuard guard(m_frameworkLock);
+        if (!m_running)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::disconnectServices: called without being connected");
+            return false;
+        }
+
+        // Signal thread to exit run and join it
+        cancel();
+        wakeupConnectionThread();
+        {
+            // must release lock to let things finish in thread
+            m_frameworkLock.unlock();
+            m_thread.join();
+            m_frameworkLock.lock();
+        }
+        closeListenSocket();
+        m_running = false;
+
+        LOG_DEBUG(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::disconnectServices: done");
+        return true;
+    }
+
+    IConnectionStatusUpdateNotifier& SHMConnectionSystem::getRamsesConnectionStatusUpdateNotifier()
+    {
+        return m_ramsesConnectionStatusUpdateNotifier;
+    }
+
+    void SHMConnectionSystem::setSceneProviderServiceHandler(ISceneProviderServiceHandler* handler)
+    {
+        m_sceneProviderHandler = handler;
+    }
+
+    void SHMConnectionSystem::setSceneRendererServiceHandler(ISceneRendererServiceHandler* handler)
+    {
+        m_sceneRendererHandler = handler;
+    }
+
+    bool SHMConnectionSystem::openListenSocket()
+    {
+        if (::mkdir(m_socketDirectory.c_str(), 0770) != 0 && errno != EEXIST)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::openListenSocket: cannot create directory " << m_socketDirectory << ". " << std::strerror(errno));
+            return false;
+        }
+
+        const std::string socketPath = getSocketPath(m_participant.getParticipantId());
+        sockaddr_un address = {};
+        if (socketPath.size() >= sizeof(address.sun_path))
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::openListenSocket: socket path too long " << socketPath);
+            return false;
+        }
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size());
+
+        m_wakeupEvent = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        m_listenSocket = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (m_wakeupEvent < 0 || m_listenSocket < 0)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::openListenSocket: socket creation failed. " << std::strerror(errno));
+            return false;
+        }
+
+        // left over from a previous run with same guid
+        ::unlink(socketPath.c_str());
+        if (::bind(m_listenSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::openListenSocket: bind to " << socketPath << " failed. " << std::strerror(errno));
+            return false;
+        }
+
+        if (::listen(m_listenSocket, SOMAXCONN) != 0)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::openListenSocket: listen failed. " << std::strerror(errno));
+            ::unlink(socketPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    void SHMConnectionSystem::closeListenSocket()
+    {
+        if (m_listenSocket >= 0)
+        {
+            ::unlink(getSocketPath(m_participant.getParticipantId()).c_str());
+            ::close(m_listenSocket);
+            m_listenSocket = -1;
+        }
+        if (m_wakeupEvent >= 0)
+        {
+            ::close(m_wakeupEvent);
+            m_wakeupEvent = -1;
+        }
+    }
+
+    void SHMConnectionSystem::wakeupConnectionThread() const
+    {
+        const uint64_t value = 1u;
+        [[maybe_unused]] const auto written = ::write(m_wakeupEvent, &value, sizeof(value));
+    }
+
+    void SHMConnectionSystem::run()
+    {
+        std::vector<pollfd> pollFds;
+        std::vector<ParticipantPtr> polledParticipants;
+        std::chrono::steady_clock::time_point nextDiscovery;
+
+        while (!isCancelRequested())
+        {
+            {
+                PlatformGuard guard(m_frameworkLock);
+                const auto now = std::chrono::steady_clock::now();
+                if (now >= nextDiscovery)
+                {
+                    discoverParticipants();
+                    nextDiscovery = now + DiscoveryInterval;
+                }
+                checkAliveStates(now);
+
+                pollFds.clear();
+                polledParticipants.clear();
+                pollFds.push_back({m_wakeupEvent, POLLIN, 0});
+                pollFds.push_back({m_listenSocket, POLLIN, 0});
+                const auto addToPoll = [&](const ParticipantPtr& pp) {
+                    const short events = pp->outQueue.empty() ? POLLIN : (POLLIN | POLLOUT);
+                    pollFds.push_back({pp->socket, events, 0});
+                    polledParticipants.push_back(pp);
+                };
+                for (const auto& pp : m_connectingParticipants)
+                    addToPoll(pp);
+                for (const auto& p : m_establishedParticipants)
+                    addToPoll(p.value);
+            }
+
+            if (::poll(pollFds.data(), pollFds.size(), PollTimeoutMs) < 0 && errno != EINTR)
+            {
+                LOG_ERROR(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::run: poll failed. " << std::strerror(errno));
+                break;
+            }
+
+            PlatformGuard guard(m_frameworkLock);
+            if ((pollFds[0].revents & POLLIN) != 0)
+            {
+                uint64_t value = 0u;
+                [[maybe_unused]] const auto readBytes = ::read(m_wakeupEvent, &value, sizeof(value));
+            }
+            if ((pollFds[1].revents & POLLIN) != 0)
+                acceptIncomingConnections();
+
+            for (size_t i = 0u; i < polledParticipants.size(); ++i)
+            {
+                const ParticipantPtr& pp = polledParticipants[i];
+                const short revents = pollFds[i + 2u].revents;
+                if (pp->state == EParticipantState::Invalid)
+                    continue;
+
+                if ((revents & POLLOUT) != 0 && !flushOutQueue(*pp))
+                    pp->sendFailed = true;
+                if (pp->sendFailed)
+                {
+                    LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::run: Send to " << pp->id.getParticipantId() << "/" << pp->id.getParticipantName() <<
+                             " failed. Remove participant");
+                    removeParticipant(pp);
+                    continue;
+                }
+                if ((revents & (POLLIN | POLLHUP | POLLERR)) != 0 && !readFromParticipant(pp))
+                    removeParticipant(pp);
+            }
+        }
+
+        PlatformGuard guard(m_frameworkLock);
+        for (const auto& pp : m_establishedParticipants)
+            triggerConnectionUpdateNotification(pp.key, EConnectionStatus_NotConnected);
+        m_connectingParticipants.clear();
+        m_establishedParticipants.clear();
+    }
+
+    void SHMConnectionSystem::acceptIncomingConnections()
+    {
+        for (;;)
+        {
+            const int socket = ::accept4(m_listenSocket, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (socket < 0)
+            {
+                if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                    LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::acceptIncomingConnections: accept failed. " << std::strerror(errno));
+                return;
+            }
+
+            LOG_INFO(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::acceptIncomingConnections: Accepted new connection");
+            initializeNewParticipant(std::make_shared<Participant>(socket, Guid()));
+        }
+    }
+
+    void SHMConnectionSystem::discoverParticipants()
+    {
+        DIR* directory = ::opendir(m_socketDirectory.c_str());
+        if (directory == nullptr)
+            return;
+
+        std::vector<Guid> newParticipants;
+        while (const dirent* entry = ::readdir(directory))
+        {
+            const std::string_view fileName(entry->d_name);
+            if (fileName.size() <= SocketFilePrefix.size() + SocketFileSuffix.size() ||
+                fileName.substr(0, SocketFilePrefix.size()) != SocketFilePrefix ||
+                fileName.substr(fileName.size() - SocketFileSuffix.size()) != SocketFileSuffix)
+            {
+                continue;
+            }
+
+            const std::string guidString(fileName.substr(SocketFilePrefix.size(), fileName.size() - SocketFilePrefix.size() - SocketFileSuffix.size()));
+            char* parseEnd = nullptr;
+            errno = 0;
+            const uint64_t guidValue = std::strtoull(guidString.c_str(), &parseEnd, 10);
+            if (errno != 0 || parseEnd == guidString.c_str() || *parseEnd != '\0')
+                continue;
+            const Guid guid(guidValue);
+
+            // participant with higher guid connects, same as in TCPConnectionSystem
+            if (guid.isInvalid() || guid.get() >= m_participant.getParticipantId().get() || m_establishedParticipants.contains(guid))
+                continue;
+            const bool alreadyConnecting = std::any_of(m_connectingParticipants.cbegin(), m_connectingParticipants.cend(),
+                                                       [&](const ParticipantPtr& pp) { return pp->expectedId == guid; });
+            if (!alreadyConnecting)
+                newParticipants.push_back(guid);
+        }
+        ::closedir(directory);
+
+        for (const auto& guid : newParticipants)
+            connectToParticipant(guid);
+    }
+
+    void SHMConnectionSystem::connectToParticipant(const Guid& guid)
+    {
+        const std::string socketPath = getSocketPath(guid);
+        sockaddr_un address = {};
+        if (socketPath.size() >= sizeof(address.sun_path))
+            return;
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size());
+
+        const int socket = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (socket < 0)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::connectToParticipant: socket creation failed. " << std::strerror(errno));
+            return;
+        }
+
+        if (::connect(socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+        {
+            // stale socket files of terminated participants are expected, retried on next discovery
+            LOG_TRACE(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::connectToParticipant: connect to " << socketPath << " failed. " << std::strerror(errno));
+            ::close(socket);
+            return;
+        }
+
+        LOG_INFO(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::connectToParticipant: Connected to " << guid << " at " << socketPath);
+        initializeNewParticipant(std::make_shared<Participant>(socket, guid));
+    }
+
+    void SHMConnectionSystem::initializeNewParticipant(const ParticipantPtr& pp)
+    {
+        pp->sendRingBuffer = SharedMemoryRingBuffer::Create(fmt::format("ramses-shm-{}", m_participant.getParticipantId()), m_ringBufferSize);
+        if (!pp->sendRingBuffer)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::initializeNewParticipant: failed to create shared memory of size " << m_ringBufferSize);
+            return;
+        }
+
+        pp->lastSent = std::chrono::steady_clock::now();
+        pp->lastReceived = pp->lastSent;
+        m_connectingParticipants.push_back(pp);
+
+        OutMessage msg(std::vector<Guid>(), EMessageId::ConnectionDescriptionMessage);
+        msg.stream << m_participant.getParticipantId()
+                   << m_participant.getParticipantName()
+                   << m_ringBufferSize;
+        queueMessage(pp, serializeMessage(msg), pp->sendRingBuffer->getFileDescriptor());
+        if (!flushOutQueue(*pp))
+            pp->sendFailed = true;
+    }
+
+    void SHMConnectionSystem::checkAliveStates(std::chrono::steady_clock::time_point now)
+    {
+        std::vector<ParticipantPtr> timedOut;
+        const auto check = [&](const ParticipantPtr& pp) {
+            if (now - pp->lastReceived > m_aliveIntervalTimeout)
+            {
+                timedOut.push_back(pp);
+            }
+            else if (pp->state == EParticipantState::Established && pp->outQueue.empty() && now - pp->lastSent >= m_aliveInterval)
+            {
+                OutMessage msg(std::vector<Guid>(), EMessageId::Alive);
+                queueMessage(pp, serializeMessage(msg));
+                if (!flushOutQueue(*pp))
+                    pp->sendFailed = true;
+            }
+        };
+        for (const auto& pp : m_connectingParticipants)
+            check(pp);
+        for (const auto& p : m_establishedParticipants)
+            check(p.value);
+
+        for (const auto& pp : timedOut)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::checkAliveStates: alive message from " << pp->id.getParticipantId() <<
+                     " too old. lastReceived " << std::chrono::duration_cast<std::chrono::milliseconds>(now - pp->lastReceived).count() << "ms ago, latest " <<
+                     std::chrono::duration_cast<std::chrono::milliseconds>(now - pp->lastReceived - m_aliveIntervalTimeout).count() << "ms ago");
+            removeParticipant(pp);
+        }
+    }
+
+    void SHMConnectionSystem::removeParticipant(const ParticipantPtr& pp)
+    {
+        if (pp->state == EParticipantState::Invalid)
+            return;
+
+        LOG_INFO(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::removeParticipant: " << pp->id.getParticipantId() << "/" << pp->id.getParticipantName() <<
+                 ", state " << EnumToString(pp->state));
+
+        const bool wasEstablished = (pp->state == EParticipantState::Established);
+        pp->state = EParticipantState::Invalid;
+        ::close(pp->socket);
+        pp->socket = -1;
+        pp->outQueue.clear();
+
+        m_connectingParticipants.erase(std::remove(m_connectingParticipants.begin(), m_connectingParticipants.end(), pp), m_connectingParticipants.end());
+        if (wasEstablished)
+        {
+            m_establishedParticipants.remove(pp->id.getParticipantId());
+            triggerConnectionUpdateNotification(pp->id.getParticipantId(), EConnectionStatus_NotConnected);
+        }
+    }
+
+    const char* SHMConnectionSystem::EnumToString(EParticipantState e)
+    {
+        switch (e)
+        {
+        case EParticipantState::Invalid: return "Invalid";
+        case EParticipantState::WaitingForHello: return "WaitingForHello";
+        case EParticipantState::Established: return "Established";
+        };
+        return "<Unknown>";
+    }
+
+    SHMConnectionSystem::ParticipantPtr SHMConnectionSystem::getEstablishedParticipant(const Guid& guid) const
+    {
+        ParticipantPtr pp;
+        if (m_establishedParticipants.get(guid, pp) != EStatus::Ok)
+            return nullptr;
+        return pp;
+    }
+
+    std::vector<std::byte> SHMConnectionSystem::serializeMessage(OutMessage& msg) const
+    {
+        std::vector<std::byte> data = msg.stream.release();
+        RawBinaryOutputStream s(data.data(), data.size());
+        s << static_cast<uint32_t>(data.size() - sizeof(uint32_t))
+          << m_protocolVersion;
+        return data;
+    }
+
+    bool SHMConnectionSystem::postMessageForSending(OutMessage msg)
+    {
+        // expect framework lock to be held
+        if (!m_running)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::postMessageForSending: called without being connected");
+            return false;
+        }
+
+        m_statisticCollection.statMessagesSent.incCounter(1);
+
+        // Skip if broadcast with no participants
+        if (msg.to.empty())
+            return true;
+
+        const std::vector<Guid> receivers = std::move(msg.to);
+        std::vector<std::byte> data = serializeMessage(msg);
+        bool wakeupNeeded = false;
+        for (size_t i = 0u; i < receivers.size(); ++i)
+        {
+            const ParticipantPtr pp = getEstablishedParticipant(receivers[i]);
+            if (!pp)
+            {
+                // skip invalid participant in broadcast. might happen due to disconnect race
+                if (receivers.size() == 1u)
+                {
+                    LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::postMessageForSending: post message " << msg.messageType <<
+                             " to not (fully) connected participant " << receivers[i]);
+                }
+                continue;
+            }
+
+            queueMessage(pp, (i + 1u == receivers.size()) ? std::move(data) : data);
+            if (!flushOutQueue(*pp))
+                pp->sendFailed = true;
+            wakeupNeeded = wakeupNeeded || pp->sendFailed || !pp->outQueue.empty();
+        }
+
+        // let connection thread continue with blocked sockets or clean up failed ones
+        if (wakeupNeeded)
+            wakeupConnectionThread();
+        return true;
+    }
+
+    void SHMConnectionSystem::queueMessage(const ParticipantPtr& pp, std::vector<std::byte> data, int attachedFileDescriptor)
+    {
+        pp->outQueue.push_back({std::move(data), attachedFileDescriptor});
+    }
+
+    bool SHMConnectionSystem::flushOutQueue(Participant& pp)
+    {
+        if (pp.socket < 0 || pp.sendFailed)
+            return false;
+
+        while (!pp.outQueue.empty())
+        {
+            OutBuffer& out = pp.outQueue.front();
+            iovec iov = {out.data.data() + pp.currentOutOffset, out.data.size() - pp.currentOutOffset};
+            msghdr header = {};
+            header.msg_iov = &iov;
+            header.msg_iovlen = 1;
+
+            union
+            {
+                char buffer[CMSG_SPACE(sizeof(int))];
+                cmsghdr align;
+            } control = {};
+            if (out.attachedFileDescriptor >= 0 && pp.currentOutOffset == 0u)
+            {
+                header.msg_control = control.buffer;
+                header.msg_controllen = sizeof(control.buffer);
+                cmsghdr* cmsg = CMSG_FIRSTHDR(&header);
+                cmsg->cmsg_level = SOL_SOCKET;
+                cmsg->cmsg_type = SCM_RIGHTS;
+                cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+                std::memcpy(CMSG_DATA(cmsg), &out.attachedFileDescriptor, sizeof(int));
+            }
+
+            const ssize_t sentBytes = ::sendmsg(pp.socket, &header, MSG_DONTWAIT | MSG_NOSIGNAL);
+            if (sentBytes < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                return errno == EAGAIN || errno == EWOULDBLOCK;
+            }
+
+            pp.currentOutOffset += static_cast<size_t>(sentBytes);
+            if (pp.currentOutOffset == out.data.size())
+            {
+                pp.outQueue.pop_front();
+                pp.currentOutOffset = 0u;
+                pp.lastSent = std::chrono::steady_clock::now();
+            }
+        }
+        return true;
+    }
+
+    bool SHMConnectionSystem::readFromParticipant(const ParticipantPtr& pp)
+    {
+        for (size_t readCount = 0u; readCount < MaxReadsPerWakeup && pp->state != EParticipantState::Invalid; ++readCount)
+        {
+            if (pp->receiveBuffer.size() < pp->receiveBufferUsed + ReadChunkSize)
+                pp->receiveBuffer.resize(pp->receiveBufferUsed + ReadChunkSize);
+
+            iovec iov = {pp->receiveBuffer.data() + pp->receiveBufferUsed, ReadChunkSize};
+            msghdr header = {};
+            header.msg_iov = &iov;
+            header.msg_iovlen = 1;
+            union
+            {
+                char buffer[CMSG_SPACE(sizeof(int) * MaxFileDescriptorsPerRead)];
+                cmsghdr align;
+            } control = {};
+            header.msg_control = control.buffer;
+            header.msg_controllen = sizeof(control.buffer);
+
+            const ssize_t receivedBytes = ::recvmsg(pp->socket, &header, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+            if (receivedBytes < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK)
+                    return true;
+                LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::readFromParticipant: read from " << pp->id.getParticipantId() << " failed. " << std::strerror(errno));
+                return false;
+            }
+
+            for (cmsghdr* cmsg = CMSG_FIRSTHDR(&header); cmsg != nullptr; cmsg = CMSG_NXTHDR(&header, cmsg))
+            {
+                if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS)
+                {
+                    const size_t numFileDescriptors = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+                    for (size_t i = 0u; i < numFileDescriptors; ++i)
+                    {
+                        int fd = -1;
+                        std::memcpy(&fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+                        pp->receivedFileDescriptors.push_back(fd);
+                    }
+                }
+            }
+
+            if (receivedBytes == 0)
+            {
+                LOG_INFO(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::readFromParticipant: connection closed by " << pp->id.getParticipantId());
+                return false;
+            }
+
+            pp->receiveBufferUsed += static_cast<size_t>(receivedBytes);
+            pp->lastReceived = std::chrono::steady_clock::now();
+
+            // handle all complete messages and keep the remainder for next read
+            size_t offset = 0u;
+            while (pp->state != EParticipantState::Invalid && pp->receiveBufferUsed - offset >= sizeof(uint32_t))
+            {
+                uint32_t messageSize = 0u;
+                std::memcpy(&messageSize, pp->receiveBuffer.data() + offset, sizeof(messageSize));
+                if (messageSize < 2u * sizeof(uint32_t))
+                {
+                    LOG_ERROR(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::readFromParticipant: Invalid message size " << messageSize << " from " << pp->id.getParticipantId());
+                    return false;
+                }
+                if (pp->receiveBufferUsed - offset - sizeof(uint32_t) < messageSize)
+                    break;
+
+                m_statisticCollection.statMessagesReceived.incCounter(1);
+                handleReceivedMessage(pp, {pp->receiveBuffer.data() + offset + sizeof(uint32_t), messageSize});
+                offset += sizeof(uint32_t) + messageSize;
+            }
+            if (pp->state == EParticipantState::Invalid)
+                return true;
+
+            std::memmove(pp->receiveBuffer.data(), pp->receiveBuffer.data() + offset, pp->receiveBufferUsed - offset);
+            pp->receiveBufferUsed -= offset;
+        }
+        return true;
+    }
+
+    void SHMConnectionSystem::handleReceivedMessage(const ParticipantPtr& pp, absl::Span<const std::byte> message)
+    {
+        BinaryInputStream stream(message.data());
+
+        uint32_t recvProtocolVersion = 0;
+        stream >> recvProtocolVersion;
+
+        if (m_protocolVersion != recvProtocolVersion)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleReceivedMessage: Invalid protocol version received (expected "
+                     << m_protocolVersion << ", got " << recvProtocolVersion << "). Drop connection");
+            removeParticipant(pp);
+            return;
+        }
+
+        uint32_t messageTypeTmp = 0;
+        stream >> messageTypeTmp;
+        auto messageType = static_cast<EMessageId>(messageTypeTmp);
+
+        LOG_TRACE(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleReceivedMessage: From " <<
+                  pp->id.getParticipantId() << ", type " << messageType);
+
+        if (pp->state != EParticipantState::Established && messageType != EMessageId::ConnectionDescriptionMessage)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleReceivedMessage: Unexpected messagetype " << messageType << " before connection description");
+            removeParticipant(pp);
+            return;
+        }
+
+        switch (messageType)
+        {
+        case EMessageId::Alive:
+            // no-op. every message updates lastReceived
+            break;
+        case EMessageId::ConnectionDescriptionMessage:
+            handleConnectionDescriptionMessage(pp, stream);
+            break;
+        case EMessageId::PublishScene:
+            handlePublishScene(pp, stream);
+            break;
+        case EMessageId::UnpublishScene:
+            handleUnpublishScene(pp, stream);
+            break;
+        case EMessageId::SubscribeScene:
+            handleSubscribeScene(pp, stream);
+            break;
+        case EMessageId::UnsubscribeScene:
+            handleUnsubscribeScene(pp, stream);
+            break;
+        case EMessageId::SendSceneUpdate:
+            handleSceneUpdate(pp, stream);
+            break;
+        case EMessageId::SendSceneUpdateSharedMemory:
+            handleSceneUpdateSharedMemory(pp, stream);
+            break;
+        case EMessageId::CreateScene:
+            handleCreateScene(pp, stream);
+            break;
+        case EMessageId::RendererEvent:
+            handleRendererEvent(pp, stream);
+            break;
+        default:
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleReceivedMessage: Invalid messagetype " << messageType << " From " << pp->id.getParticipantId());
+            removeParticipant(pp);
+        }
+    }
+
+    void SHMConnectionSystem::handleConnectionDescriptionMessage(const ParticipantPtr& pp, BinaryInputStream& stream)
+    {
+        if (pp->state == EParticipantState::Established)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleConnectionDescriptionMessage: Duplicate connection description while established from " << pp->id.getParticipantId());
+            return;
+        }
+
+        Guid guid;
+        std::string name;
+        uint32_t ringBufferSize = 0u;
+        stream >> guid
+               >> name
+               >> ringBufferSize;
+
+        if (guid.isInvalid() || guid == m_participant.getParticipantId() || pp->receivedFileDescriptors.empty())
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleConnectionDescriptionMessage: Invalid connection description from " << guid <<
+                      ", received shared memory " << !pp->receivedFileDescriptors.empty());
+            removeParticipant(pp);
+            return;
+        }
+        if (pp->expectedId.isValid() && pp->expectedId != guid)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleConnectionDescriptionMessage: Expected " << pp->expectedId << " but got hello from " << guid);
+        }
+        if (m_establishedParticipants.contains(guid))
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleConnectionDescriptionMessage: Already connected to " << guid << ". Drop duplicate connection");
+            removeParticipant(pp);
+            return;
+        }
+
+        pp->receiveRingBuffer = SharedMemoryRingBuffer::Open(pp->receivedFileDescriptors.front());
+        pp->receivedFileDescriptors.pop_front();
+        if (!pp->receiveRingBuffer)
+        {
+            removeParticipant(pp);
+            return;
+        }
+
+        LOG_INFO(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleConnectionDescriptionMessage: Hello from " <<
+                 guid << "/" << name << ", ringBufferSize " << ringBufferSize << ". Established now");
+
+        pp->id = ParticipantIdentifier(guid, name);
+        pp->state = EParticipantState::Established;
+
+        m_connectingParticipants.erase(std::remove(m_connectingParticipants.begin(), m_connectingParticipants.end(), pp), m_connectingParticipants.end());
+        m_establishedParticipants.put(guid, pp);
+
+        triggerConnectionUpdateNotification(guid, EConnectionStatus_Connected);
+    }
+
+    // --- user message handling ---
+    bool SHMConnectionSystem::sendSubscribeScene(const Guid& to, const SceneId& sceneId)
+    {
+        LOG_DEBUG(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::sendSubscribeScene: to " << to << ", sceneId " << sceneId);
+        OutMessage msg(to, EMessageId::SubscribeScene);
+        msg.stream << sceneId.getValue();
+        return postMessageForSending(std::move(msg));
+    }
+
+    void SHMConnectionSystem::handleSubscribeScene(const ParticipantPtr& pp, BinaryInputStream& stream)
+    {
+        if (m_sceneProviderHandler)
+        {
+            SceneId sceneId;
+            stream >> sceneId.getReference();
+
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleSubscribeScene: from " << pp->id.getParticipantId() << ", sceneId " << sceneId);
+            PlatformGuard guard(m_frameworkLock);
+            m_sceneProviderHandler->handleSubscribeScene(sceneId, pp->id.getParticipantId());
+        }
+    }
+
+    // --
+    bool SHMConnectionSystem::sendUnsubscribeScene(const Guid& to, const SceneId& sceneId)
+    {
+        LOG_DEBUG(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::sendUnsubscribeScene: to " << to << ", sceneId " << sceneId);
+        OutMessage msg(to, EMessageId::UnsubscribeScene);
+        msg.stream << sceneId.getValue();
+        return postMessageForSending(std::move(msg));
+    }
+
+    void SHMConnectionSystem::handleUnsubscribeScene(const ParticipantPtr& pp, BinaryInputStream& stream)
+    {
+        if (m_sceneProviderHandler)
+        {
+            SceneId sceneId;
+            stream >> sceneId.getReference();
+
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleUnsubscribeScene: from " << pp->id.getParticipantId() << ", sceneId " << sceneId);
+            PlatformGuard guard(m_frameworkLock);
+            m_sceneProviderHandler->handleUnsubscribeScene(sceneId, pp->id.getParticipantId());
+        }
+    }
+
+    // --
+    bool SHMConnectionSystem::sendInitializeScene(const Guid& to, const SceneId& sceneId)
+    {
+        LOG_DEBUG(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::sendInitializeScene: to " << to << ", sceneId " << sceneId);
+        OutMessage msg(to, EMessageId::CreateScene);
+        msg.stream << sceneId.getValue();
+        return postMessageForSending(std::move(msg));
+    }
+
+    void SHMConnectionSystem::handleCreateScene(const ParticipantPtr& pp, BinaryInputStream& stream)
+    {
+        if (m_sceneRendererHandler)
+        {
+            SceneId sceneId;
+            stream >> sceneId.getReference();
+
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleCreateScene: from " << pp->id.getParticipantId() <<
+                      ", sceneId " << sceneId);
+            PlatformGuard guard(m_frameworkLock);
+            m_sceneRendererHandler->handleInitializeScene(sceneId, pp->id.getParticipantId());
+        }
+    }
+
+    // --
+    bool SHMConnectionSystem::sendSceneUpdate(const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer)
+    {
+        LOG_TRACE(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::sendSceneUpdate: to " << to);
+
+        // expect framework lock to be held
+        if (!m_running)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::sendSceneUpdate: called without being connected");
+            return false;
+        }
+
+        const ParticipantPtr pp = getEstablishedParticipant(to);
+        if (!pp)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::sendSceneUpdate: to not (fully) connected participant " << to);
+            return true;
+        }
+
+        m_sceneUpdatePacketBuffer.resize(SceneUpdatePacketSize);
+        return serializer.writeToPackets({m_sceneUpdatePacketBuffer.data(), m_sceneUpdatePacketBuffer.size()}, [&](size_t size) {
+            const auto usedSize = static_cast<uint32_t>(size);
+            const auto position = pp->sendRingBuffer->write({m_sceneUpdatePacketBuffer.data(), size});
+            if (position)
+            {
+                OutMessage msg(to, EMessageId::SendSceneUpdateSharedMemory);
+                msg.stream << sceneId.getValue()
+                           << *position
+                           << usedSize;
+                return postMessageForSending(std::move(msg));
+            }
+
+            // receiver did not catch up yet, send payload through the socket instead
+            ++pp->numSceneUpdatesNotFittingRingBuffer;
+            OutMessage msg(to, EMessageId::SendSceneUpdate);
+            msg.stream << sceneId.getValue()
+                       << usedSize;
+            msg.stream.write(m_sceneUpdatePacketBuffer.data(), usedSize);
+            return postMessageForSending(std::move(msg));
+        }, 0u);
+    }
+
+    void SHMConnectionSystem::handleSceneUpdate(const ParticipantPtr& pp, BinaryInputStream& stream)
+    {
+        if (m_sceneRendererHandler)
+        {
+            SceneId sceneId;
+            stream >> sceneId.getReference();
+            uint32_t dataSize = 0;
+            stream >> dataSize;
+
+            LOG_TRACE(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleSceneUpdate: from " << pp->id.getParticipantId() << ", size " << dataSize);
+
+            PlatformGuard guard(m_frameworkLock);
+            m_sceneRendererHandler->handleSceneUpdate(sceneId, {stream.readPosition(), dataSize}, pp->id.getParticipantId());
+        }
+    }
+
+    void SHMConnectionSystem::handleSceneUpdateSharedMemory(const ParticipantPtr& pp, BinaryInputStream& stream)
+    {
+        SceneId sceneId;
+        uint64_t position = 0u;
+        uint32_t dataSize = 0u;
+        stream >> sceneId.getReference()
+               >> position
+               >> dataSize;
+
+        const absl::Span<const std::byte> data = pp->receiveRingBuffer->read(position, dataSize, pp->ringWrapBuffer);
+        if (data.empty())
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleSceneUpdateSharedMemory: Invalid shared memory block from " << pp->id.getParticipantId() <<
+                      " at " << position << ", size " << dataSize << ". Drop connection");
+            removeParticipant(pp);
+            return;
+        }
+
+        if (m_sceneRendererHandler)
+        {
+            LOG_TRACE(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleSceneUpdateSharedMemory: from " << pp->id.getParticipantId() << ", size " << dataSize);
+
+            PlatformGuard guard(m_frameworkLock);
+            m_sceneRendererHandler->handleSceneUpdate(sceneId, data, pp->id.getParticipantId());
+        }
+        pp->receiveRingBuffer->release(position, dataSize);
+    }
+
+    // --
+    bool SHMConnectionSystem::broadcastNewScenesAvailable(const SceneInfoVector& newScenes, EFeatureLevel featureLevel)
+    {
+        LOG_DEBUG_F(CONTEXT_COMMUNICATION, ([&](StringOutputStream& sos) {
+                                                sos << "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::broadcastNewScenesAvailable: to all [";
+                                                for (const auto& s : newScenes)
+                                                    sos << s.sceneID << "/" << s.friendlyName << "; ";
+                                                sos << "]";
+                                            }));
+
+        OutMessage msg(m_connectedParticipantsForBroadcasts, EMessageId::PublishScene);
+        msg.stream << static_cast<uint32_t>(newScenes.size());
+        for (const auto& s : newScenes)
+        {
+            msg.stream << s.sceneID.getValue()
+                       << s.friendlyName;
+        }
+        msg.stream << static_cast<uint32_t>(featureLevel);
+        return postMessageForSending(std::move(msg));
+    }
+
+    bool SHMConnectionSystem::sendScenesAvailable(const Guid& to, const SceneInfoVector& availableScenes, EFeatureLevel featureLevel)
+    {
+        LOG_DEBUG_F(CONTEXT_COMMUNICATION, ([&](StringOutputStream& sos) {
+                                                sos << "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::sendScenesAvailable: to " << to << " [";
+                                                for (const auto& s : availableScenes)
+                                                    sos << s.sceneID << "/" << s.friendlyName << "; ";
+                                                sos << "]";
+                                            }));
+
+        OutMessage msg(to, EMessageId::PublishScene);
+        msg.stream << static_cast<uint32_t>(availableScenes.size());
+        for (const auto& s : availableScenes)
+        {
+            msg.stream << s.sceneID.getValue()
+                       << s.friendlyName;
+        }
+        msg.stream << static_cast<uint32_t>(featureLevel);
+        return postMessageForSending(std::move(msg));
+    }
+
+    void SHMConnectionSystem::handlePublishScene(const ParticipantPtr& pp, BinaryInputStream& stream)
+    {
+        if (m_sceneRendererHandler)
+        {
+            uint32_t numScenes = 0u;
+            stream >> numScenes;
+
+            SceneInfoVector newScenes;
+            newScenes.reserve(numScenes);
+
+            for (uint32_t i = 0; i < numScenes; ++i)
+            {
+                SceneInfo sceneInfo;
+                stream >> sceneInfo.sceneID.getReference()
+                       >> sceneInfo.friendlyName;
+                newScenes.push_back(sceneInfo);
+            }
+
+            uint32_t featureLevelInt = 0u;
+            stream >> featureLevelInt;
+            const auto featureLevel = static_cast<EFeatureLevel>(featureLevelInt);
+
+            LOG_DEBUG_F(CONTEXT_COMMUNICATION, ([&](StringOutputStream& sos) {
+                                                    sos << "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handlePublishScene: from " << pp->id.getParticipantId() << " [";
+                                                    for (const auto& s : newScenes)
+                                                        sos << s.sceneID << "/" << s.friendlyName << "; ";
+                                                    sos << "]";
+                                                }));
+
+            PlatformGuard guard(m_frameworkLock);
+            m_sceneRendererHandler->handleNewScenesAvailable(newScenes, pp->id.getParticipantId(), featureLevel);
+        }
+    }
+
+    // --
+    bool SHMConnectionSystem::broadcastScenesBecameUnavailable(const SceneInfoVector& unavailableScenes)
+    {
+        LOG_DEBUG_F(CONTEXT_COMMUNICATION, ([&](StringOutputStream& sos) {
+                                                sos << "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::broadcastScenesBecameUnavailable: to all [";
+                                                for (const auto& s : unavailableScenes)
+                                                    sos << s.sceneID << "/" << s.friendlyName << "; ";
+                                                sos << "]";
+                                            }));
+
+        OutMessage msg(m_connectedParticipantsForBroadcasts, EMessageId::UnpublishScene);
+        msg.stream << static_cast<uint32_t>(unavailableScenes.size());
+        for (const auto& s : unavailableScenes)
+        {
+            msg.stream << s.sceneID.getValue()
+                       << s.friendlyName;
+        }
+        return postMessageForSending(std::move(msg));
+    }
+
+    void SHMConnectionSystem::handleUnpublishScene(const ParticipantPtr& pp, BinaryInputStream& stream)
+    {
+        if (m_sceneRendererHandler)
+        {
+            uint32_t numScenes = 0u;
+            stream >> numScenes;
+
+            SceneInfoVector unavailableScenes;
+            unavailableScenes.reserve(numScenes);
+
+            for (uint32_t i = 0; i < numScenes; ++i)
+            {
+                SceneInfo sceneInfo;
+                stream >> sceneInfo.sceneID.getReference()
+                       >> sceneInfo.friendlyName;
+                unavailableScenes.push_back(sceneInfo);
+            }
+
+            LOG_DEBUG_F(CONTEXT_COMMUNICATION, ([&](StringOutputStream& sos) {
+                                                    sos << "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleUnpublishScene: from " << pp->id.getParticipantId() << " [";
+                                                    for (const auto& s : unavailableScenes)
+                                                        sos << s.sceneID << "/" << s.friendlyName << "; ";
+                                                    sos << "]";
+                                                }));
+
+            PlatformGuard guard(m_frameworkLock);
+            m_sceneRendererHandler->handleScenesBecameUnavailable(unavailableScenes, pp->id.getParticipantId());
+        }
+    }
+
+    // --
+    bool SHMConnectionSystem::sendRendererEvent(const Guid& to, const SceneId& sceneId, const std::vector<std::byte>& data)
+    {
+        LOG_DEBUG(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::sendRendererEvent: to " << to << ", size " << data.size());
+        if (data.size() > 32000)  // same limit as TCPConnectionSystem
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::sendRendererEvent: to " << to << " failed because size too large " << data.size());
+            return false;
+        }
+        OutMessage msg(to, EMessageId::RendererEvent);
+        msg.stream << sceneId.getValue()
+                   << static_cast<uint32_t>(data.size());
+        msg.stream.write(data.data(), static_cast<uint32_t>(data.size()));
+        return postMessageForSending(std::move(msg));
+    }
+
+    void SHMConnectionSystem::handleRendererEvent(const ParticipantPtr& pp, BinaryInputStream& stream)
+    {
+        if (m_sceneProviderHandler)
+        {
+            SceneId sceneId;
+            stream >> sceneId.getReference();
+
+            uint32_t dataSize = 0;
+            stream >> dataSize;
+
+            std::vector<std::byte> data(dataSize);
+            stream.read(data.data(), dataSize);
+
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "SHMConnectionSystem(" << m_participant.getParticipantName() << ")::handleRendererEvent: from " << pp->id.getParticipantId() << ", size " << dataSize);
+            PlatformGuard guard(m_frameworkLock);
+            m_sceneProviderHandler->handleRendererEvent(sceneId, data, pp->id.getParticipantId());
+        }
+    }
+
+    // --- log triggers ---
+    void SHMConnectionSystem::logConnectionInfo()
+    {
+        PlatformGuard guard(m_frameworkLock);
+        LOG_INFO_F(CONTEXT_COMMUNICATION, ([&](StringOutputStream& sos) {
+                       sos << "SHMConnectionSystem(" << m_participant.getParticipantName() << "):\n";
+                       sos << "  Self: " << m_participant.getParticipantId() << " at " << getSocketPath(m_participant.getParticipantId()) << (m_running ? "" : " (not connected)") << "\n";
+                       sos << "  Established participants:\n";
+                       for (const auto& p : m_establishedParticipants)
+                       {
+                           const Participant& pp = *p.value;
+                           sos << "  - " << pp.id.getParticipantId() << "/" << pp.id.getParticipantName()
+                               << " send ring " << pp.sendRingBuffer->getUsedSize() << "/" << pp.sendRingBuffer->getCapacity()
+                               << ", receive ring " << pp.receiveRingBuffer->getUsedSize() << "/" << pp.receiveRingBuffer->getCapacity()
+                               << ", sent through socket " << pp.numSceneUpdatesNotFittingRingBuffer
+                               << ", queued " << pp.outQueue.size() << "\n";
+                       }
+                       sos << "  Connecting participants:\n";
+                       for (const auto& pp : m_connectingParticipants)
+                       {
+                           sos << "  - " << pp->expectedId << " " << EnumToString(pp->state) << "\n";
+                       }
+                   }));
+    }
+
+    void SHMConnectionSystem::triggerLogMessageForPeriodicLog()
+    {
+        // expect framework lock to be held
+        if (!m_running)
+        {
+            LOG_INFO(CONTEXT_PERIODIC, "SHMConnectionSystem(" << m_participant.getParticipantName() << "): Not connected");
+            return;
+        }
+
+        LOG_INFO_F(CONTEXT_PERIODIC, ([&](StringOutputStream& sos) {
+                       sos << "Connected Participant(s): ";
+                       if (m_establishedParticipants.size() == 0)
+                       {
+                           sos << "None";
+                       }
+                       else
+                       {
+                           for (const auto& p : m_establishedParticipants)
+                           {
+                               sos << p.key << "; ";
+                           }
+                       }
+                   }));
+    }
+
+    void SHMConnectionSystem::triggerConnectionUpdateNotification(Guid participant, EConnectionStatus status)
+    {
+        PlatformGuard guard(m_frameworkLock);
+        if (status == EConnectionStatus_Connected)
+        {
+            assert(std::find(m_connectedParticipantsForBroadcasts.begin(), m_connectedParticipantsForBroadcasts.end(), participant) == m_connectedParticipantsForBroadcasts.end());
+            m_connectedParticipantsForBroadcasts.push_back(participant);
+        }
+        else
+        {
+            m_connectedParticipantsForBroadcasts.erase(std::remove(m_connectedParticipantsForBroadcasts.begin(),
+                                                                   m_connectedParticipantsForBroadcasts.end(),
+                                                                   participant),
+                                                       m_connectedParticipantsForBroadcasts.end());
+        }
+        m_ramsesConnectionStatusUpdateNotifier.triggerNotification(participant, status);
+    }
+
+
+    // --- SHMConnectionSystem::Participant ---
+    SHMConnectionSystem::Participant::Participant(int socket_, const Guid& expectedId_)
+        : socket(socket_)
+        , expectedId(expectedId_)
+    {}
+
+    SHMConnectionSystem::Participant::~Participant()
+    {
+        if (socket >= 0)
+            ::close(socket);
+        for (const int fd : receivedFileDescriptors)
+            ::close(fd);
+    }
+}
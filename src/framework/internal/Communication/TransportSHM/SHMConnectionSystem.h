@@ -0,0 +1,193 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Communication/TransportCommon/ICommunicationSystem.h"
+#include "internal/Communication/TransportCommon/ConnectionStatusUpdateNotifier.h"
+#include "internal/Communication/TransportSHM/SharedMemoryRingBuffer.h"
+#include "internal/Communication/TransportTCP/EMessageId.h"
+#include "internal/Core/Common/ParticipantIdentifier.h"
+#include "internal/Core/Utils/BinaryOutputStream.h"
+#include "internal/PlatformAbstraction/PlatformThread.h"
+#include "internal/PlatformAbstraction/Collections/HashMap.h"
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ramses::internal
+{
+    class StatisticCollectionFramework;
+    class BinaryInputStream;
+
+    // Connection system for participants on the same host. Every participant listens on a Unix domain socket
+    // in a shared directory which is also used for discovery. Control messages use the same framing and
+    // message ids as TCPConnectionSystem, scene update payload is passed in a memfd ring buffer per direction
+    // whose file descriptor is handed over with the connection description.
+    class SHMConnectionSystem final : public Runnable, public ICommunicationSystem
+    {
+    public:
+        SHMConnectionSystem(ParticipantIdentifier participant, uint32_t protocolVersion, std::string socketDirectory, uint32_t ringBufferSize,
+                            PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection,
+                            std::chrono::milliseconds aliveInterval, std::chrono::milliseconds aliveTimeout);
+        ~SHMConnectionSystem() override;
+
+        bool connectServices() override;
+        bool disconnectServices() override;
+
+        IConnectionStatusUpdateNotifier& getRamsesConnectionStatusUpdateNotifier() override;
+
+        // scene
+        bool broadcastNewScenesAvailable(const SceneInfoVector& newScenes, EFeatureLevel featureLevel) override;
+        bool broadcastScenesBecameUnavailable(const SceneInfoVector& unavailableScenes) override;
+        bool sendScenesAvailable(const Guid& to, const SceneInfoVector& availableScenes, EFeatureLevel featureLevel) override;
+
+        bool sendSubscribeScene(const Guid& to, const SceneId& sceneId) override;
+        bool sendUnsubscribeScene(const Guid& to, const SceneId& sceneId) override;
+
+        bool sendInitializeScene(const Guid& to, const SceneId& sceneId) override;
+        bool sendSceneUpdate(const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) override;
+
+        bool sendRendererEvent(const Guid& to, const SceneId& sceneId, const std::vector<std::byte>& data) override;
+
+        // set service handlers
+        void setSceneProviderServiceHandler(ISceneProviderServiceHandler* handler) override;
+        void setSceneRendererServiceHandler(ISceneRendererServiceHandler* handler) override;
+
+        // log triggers
+        void logConnectionInfo() override;
+        void triggerLogMessageForPeriodicLog() override;
+
+        [[nodiscard]] std::string getSocketPath(const Guid& participant) const;
+
+    private:
+        enum class EParticipantState
+        {
+            Invalid,
+            WaitingForHello,
+            Established,
+        };
+
+        struct OutMessage
+        {
+            OutMessage(const Guid& to_, EMessageId messageType_)
+                : OutMessage(std::vector<Guid>({to_}), messageType_)
+            {
+                assert(to_.isValid());
+            }
+
+            OutMessage(std::vector<Guid> to_, EMessageId messageType_)
+                : to(std::move(to_))
+                , messageType(messageType_)
+            {
+                stream << static_cast<uint32_t>(0)  // fill in size later
+                       << static_cast<uint32_t>(0)  // fill in protocol version later
+                       << static_cast<uint32_t>(messageType);
+            }
+
+            std::vector<Guid> to;
+            EMessageId messageType;
+            BinaryOutputStream stream;
+        };
+
+        struct OutBuffer
+        {
+            std::vector<std::byte> data;
+            int attachedFileDescriptor = -1;
+        };
+
+        struct Participant
+        {
+            Participant(int socket_, const Guid& expectedId_);
+            ~Participant();
+
+            int socket;
+            Guid expectedId;
+            ParticipantIdentifier id;
+            EParticipantState state = EParticipantState::WaitingForHello;
+
+            std::deque<OutBuffer> outQueue;
+            size_t currentOutOffset = 0u;
+            bool sendFailed = false;
+
+            std::vector<std::byte> receiveBuffer;
+            size_t receiveBufferUsed = 0u;
+            std::deque<int> receivedFileDescriptors;
+
+            std::unique_ptr<SharedMemoryRingBuffer> sendRingBuffer;
+            std::unique_ptr<SharedMemoryRingBuffer> receiveRingBuffer;
+            std::vector<std::byte> ringWrapBuffer;
+            uint32_t numSceneUpdatesNotFittingRingBuffer = 0u;
+
+            std::chrono::steady_clock::time_point lastSent;
+            std::chrono::steady_clock::time_point lastReceived;
+        };
+        using ParticipantPtr = std::shared_ptr<Participant>;
+
+        void run() override;
+
+        bool openListenSocket();
+        void closeListenSocket();
+        void wakeupConnectionThread() const;
+
+        void acceptIncomingConnections();
+        void discoverParticipants();
+        void connectToParticipant(const Guid& guid);
+        void initializeNewParticipant(const ParticipantPtr& pp);
+        void checkAliveStates(std::chrono::steady_clock::time_point now);
+        void removeParticipant(const ParticipantPtr& pp);
+
+        [[nodiscard]] std::vector<std::byte> serializeMessage(OutMessage& msg) const;
+        bool postMessageForSending(OutMessage msg);
+        void queueMessage(const ParticipantPtr& pp, std::vector<std::byte> data, int attachedFileDescriptor = -1);
+        bool flushOutQueue(Participant& pp);
+        bool readFromParticipant(const ParticipantPtr& pp);
+        void handleReceivedMessage(const ParticipantPtr& pp, absl::Span<const std::byte> message);
+        void triggerConnectionUpdateNotification(Guid participant, EConnectionStatus status);
+        [[nodiscard]] ParticipantPtr getEstablishedParticipant(const Guid& guid) const;
+
+        void handleConnectionDescriptionMessage(const ParticipantPtr& pp, BinaryInputStream& stream);
+        void handleSubscribeScene(const ParticipantPtr& pp, BinaryInputStream& stream);
+        void handleUnsubscribeScene(const ParticipantPtr& pp, BinaryInputStream& stream);
+        void handleCreateScene(const ParticipantPtr& pp, BinaryInputStream& stream);
+        void handleSceneUpdate(const ParticipantPtr& pp, BinaryInputStream& stream);
+        void handleSceneUpdateSharedMemory(const ParticipantPtr& pp, BinaryInputStream& stream);
+        void handlePublishScene(const ParticipantPtr& pp, BinaryInputStream& stream);
+        void handleUnpublishScene(const ParticipantPtr& pp, BinaryInputStream& stream);
+        void handleRendererEvent(const ParticipantPtr& pp, BinaryInputStream& stream);
+
+        static const char* EnumToString(EParticipantState e);
+
+        const ParticipantIdentifier m_participant;
+        const uint32_t m_protocolVersion;
+        const std::string m_socketDirectory;
+        const uint32_t m_ringBufferSize;
+        const std::chrono::milliseconds m_aliveInterval;
+        const std::chrono::milliseconds m_aliveIntervalTimeout;
+
+        PlatformLock& m_frameworkLock;
+        PlatformThread m_thread;
+        StatisticCollectionFramework& m_statisticCollection;
+
+        ConnectionStatusUpdateNotifier m_ramsesConnectionStatusUpdateNotifier;
+        std::vector<Guid> m_connectedParticipantsForBroadcasts;
+
+        ISceneProviderServiceHandler* m_sceneProviderHandler = nullptr;
+        ISceneRendererServiceHandler* m_sceneRendererHandler = nullptr;
+
+        // all below guarded by framework lock
+        bool m_running = false;
+        int m_listenSocket = -1;
+        int m_wakeupEvent = -1;
+        std::vector<ParticipantPtr>   m_connectingParticipants;
+        HashMap<Guid, ParticipantPtr> m_establishedParticipants;
+        std::vector<std::byte>        m_sceneUpdatePacketBuffer;
+    };
+}
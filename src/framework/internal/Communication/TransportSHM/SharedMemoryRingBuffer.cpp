@@ -0,0 +1,188 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Communication/TransportSHM/SharedMemoryRingBuffer.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <new>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        constexpr uint32_t RingBufferMagic = 0x52534d52u; // 'RSMR'
+        constexpr int RequiredSeals = F_SEAL_SHRINK | F_SEAL_GROW;
+    }
+
+    std::unique_ptr<SharedMemoryRingBuffer> SharedMemoryRingBuffer::Create(const std::string& name, uint32_t capacity)
+    {
+        if (capacity == 0u)
+            return nullptr;
+
+        const int fd = ::memfd_create(name.c_str(), MFD_CLOEXEC | MFD_ALLOW_SEALING);
+        if (fd < 0)
+        {
+            LOG_ERROR_P(CONTEXT_COMMUNICATION, "SharedMemoryRingBuffer::Create: memfd_create failed: {}", std::strerror(errno));
+            return nullptr;
+        }
+
+        const size_t mappingSize = DataOffset + capacity;
+        if (::ftruncate(fd, static_cast<off_t>(mappingSize)) != 0 ||
+            ::fcntl(fd, F_ADD_SEALS, RequiredSeals | F_SEAL_SEAL) != 0)
+        {
+            LOG_ERROR_P(CONTEXT_COMMUNICATION, "SharedMemoryRingBuffer::Create: failed to size and seal {} bytes: {}", mappingSize, std::strerror(errno));
+            ::close(fd);
+            return nullptr;
+        }
+
+        void* mapping = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mapping == MAP_FAILED)
+        {
+            LOG_ERROR_P(CONTEXT_COMMUNICATION, "SharedMemoryRingBuffer::Create: mmap failed: {}", std::strerror(errno));
+            ::close(fd);
+            return nullptr;
+        }
+
+        auto* header = new (mapping) Header;
+        header->magic = RingBufferMagic;
+        header->capacity = capacity;
+        header->writePosition.store(0u, std::memory_order_relaxed);
+        header->readPosition.store(0u, std::memory_order_release);
+
+        return std::unique_ptr<SharedMemoryRingBuffer>(new SharedMemoryRingBuffer(fd, mapping, capacity));
+    }
+
+    std::unique_ptr<SharedMemoryRingBuffer> SharedMemoryRingBuffer::Open(int fileDescriptor)
+    {
+        // only accept memory that cannot be shrunk by the producer to not risk SIGBUS on access
+        const int seals = ::fcntl(fileDescriptor, F_GET_SEALS);
+        struct stat fileStat = {};
+        if (seals < 0 || (seals & RequiredSeals) != RequiredSeals || ::fstat(fileDescriptor, &fileStat) != 0 ||
+            fileStat.st_size <= static_cast<off_t>(DataOffset))
+        {
+            LOG_ERROR_P(CONTEXT_COMMUNICATION, "SharedMemoryRingBuffer::Open: invalid or unsealed shared memory (seals {}, size {})", seals, fileStat.st_size);
+            ::close(fileDescriptor);
+            return nullptr;
+        }
+
+        const auto mappingSize = static_cast<size_t>(fileStat.st_size);
+        void* mapping = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+        if (mapping == MAP_FAILED)
+        {
+            LOG_ERROR_P(CONTEXT_COMMUNICATION, "SharedMemoryRingBuffer::Open: mmap failed: {}", std::strerror(errno));
+            ::close(fileDescriptor);
+            return nullptr;
+        }
+
+        // header is written by other process, only trust it after validation against the actual size
+        const auto* header = static_cast<const Header*>(mapping);
+        if (header->magic != RingBufferMagic || DataOffset + header->capacity != mappingSize)
+        {
+            LOG_ERROR_P(CONTEXT_COMMUNICATION, "SharedMemoryRingBuffer::Open: header mismatch (capacity {}, size {})", header->capacity, mappingSize);
+            ::munmap(mapping, mappingSize);
+            ::close(fileDescriptor);
+            return nullptr;
+        }
+
+        auto ringBuffer = std::unique_ptr<SharedMemoryRingBuffer>(new SharedMemoryRingBuffer(fileDescriptor, mapping, header->capacity));
+        ringBuffer->m_localPosition = header->readPosition.load(std::memory_order_acquire);
+        return ringBuffer;
+    }
+
+    SharedMemoryRingBuffer::SharedMemoryRingBuffer(int fileDescriptor, void* mapping, uint32_t capacity)
+        : m_fileDescriptor(fileDescriptor)
+        , m_mapping(mapping)
+        , m_capacity(capacity)
+    {
+    }
+
+    SharedMemoryRingBuffer::~SharedMemoryRingBuffer()
+    {
+        ::munmap(m_mapping, DataOffset + m_capacity);
+        ::close(m_fileDescriptor);
+    }
+
+    int SharedMemoryRingBuffer::getFileDescriptor() const
+    {
+        return m_fileDescriptor;
+    }
+
+    uint32_t SharedMemoryRingBuffer::getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    uint32_t SharedMemoryRingBuffer::getUsedSize() const
+    {
+        const uint64_t used = header().writePosition.load(std::memory_order_acquire) - header().readPosition.load(std::memory_order_acquire);
+        return static_cast<uint32_t>(std::min<uint64_t>(used, m_capacity));
+    }
+
+    std::optional<uint64_t> SharedMemoryRingBuffer::write(absl::Span<const std::byte> data)
+    {
+        const uint64_t readPosition = header().readPosition.load(std::memory_order_acquire);
+        const uint64_t usedSize = m_localPosition - readPosition;
+        if (usedSize > m_capacity || data.size() > m_capacity - usedSize)
+            return std::nullopt;
+
+        const uint64_t position = m_localPosition;
+        const auto offset = static_cast<size_t>(position % m_capacity);
+        const size_t firstPart = std::min(data.size(), m_capacity - offset);
+        std::memcpy(this->data() + offset, data.data(), firstPart);
+        if (firstPart < data.size())
+            std::memcpy(this->data(), data.data() + firstPart, data.size() - firstPart);
+
+        m_localPosition += data.size();
+        header().writePosition.store(m_localPosition, std::memory_order_release);
+        return position;
+    }
+
+    absl::Span<const std::byte> SharedMemoryRingBuffer::read(uint64_t position, uint32_t size, std::vector<std::byte>& wrapBuffer) const
+    {
+        if (position != m_localPosition || size == 0u || size > m_capacity ||
+            position + size > header().writePosition.load(std::memory_order_acquire))
+        {
+            return {};
+        }
+
+        const auto offset = static_cast<size_t>(position % m_capacity);
+        if (offset + size <= m_capacity)
+            return {data() + offset, size};
+
+        const size_t firstPart = m_capacity - offset;
+        wrapBuffer.resize(size);
+        std::memcpy(wrapBuffer.data(), data() + offset, firstPart);
+        std::memcpy(wrapBuffer.data() + firstPart, data(), size - firstPart);
+        return {wrapBuffer.data(), wrapBuffer.size()};
+    }
+
+    void SharedMemoryRingBuffer::release(uint64_t position, uint32_t size)
+    {
+        assert(position == m_localPosition);
+        m_localPosition = position + size;
+        header().readPosition.store(m_localPosition, std::memory_order_release);
+    }
+
+    SharedMemoryRingBuffer::Header& SharedMemoryRingBuffer::header() const
+    {
+        return *static_cast<Header*>(m_mapping);
+    }
+
+    std::byte* SharedMemoryRingBuffer::data() const
+    {
+        return static_cast<std::byte*>(m_mapping) + DataOffset;
+    }
+}
@@ -0,0 +1,73 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "absl/types/span.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ramses::internal
+{
+    // Single producer / single consumer byte ring buffer in a sealed memfd.
+    // The producer creates the buffer and passes its file descriptor to the consumer process which
+    // opens it. Positions are monotonic byte offsets, the consumer has to read blocks in the order
+    // they were written and release each one after use to free space for the producer.
+    class SharedMemoryRingBuffer
+    {
+    public:
+        static std::unique_ptr<SharedMemoryRingBuffer> Create(const std::string& name, uint32_t capacity);
+        // takes ownership of fileDescriptor, also when failing
+        static std::unique_ptr<SharedMemoryRingBuffer> Open(int fileDescriptor);
+
+        ~SharedMemoryRingBuffer();
+
+        SharedMemoryRingBuffer(const SharedMemoryRingBuffer&) = delete;
+        SharedMemoryRingBuffer& operator=(const SharedMemoryRingBuffer&) = delete;
+
+        [[nodiscard]] int getFileDescriptor() const;
+        [[nodiscard]] uint32_t getCapacity() const;
+        [[nodiscard]] uint32_t getUsedSize() const;
+
+        // producer: returns position of written block or nullopt when not enough free space
+        [[nodiscard]] std::optional<uint64_t> write(absl::Span<const std::byte> data);
+
+        // consumer: returns view of block at position, wrapped blocks are copied to wrapBuffer
+        // returns empty span when position or size are not the expected next block
+        [[nodiscard]] absl::Span<const std::byte> read(uint64_t position, uint32_t size, std::vector<std::byte>& wrapBuffer) const;
+        void release(uint64_t position, uint32_t size);
+
+    private:
+        struct Header
+        {
+            uint32_t magic;
+            uint32_t capacity;
+            alignas(64) std::atomic<uint64_t> writePosition;
+            alignas(64) std::atomic<uint64_t> readPosition;
+        };
+        static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared memory ring buffer requires lock free atomics");
+
+        static constexpr size_t DataOffset = 256u;
+        static_assert(sizeof(Header) <= DataOffset, "header does not fit");
+
+        SharedMemoryRingBuffer(int fileDescriptor, void* mapping, uint32_t capacity);
+
+        [[nodiscard]] Header& header() const;
+        [[nodiscard]] std::byte* data() const;
+
+        const int m_fileDescriptor;
+        void* const m_mapping;
+        const uint32_t m_capacity;
+        uint64_t m_localPosition = 0u;
+    };
+}
@@ -34,6 +34,9 @@ namespace ramses::internal
 
         // scene
         CreateScene,
+
+        // scene update payload in shared memory, only used by local transport
+        SendSceneUpdateSharedMemory,
     };
 
     const std::array EMessageIdNames = {
@@ -49,6 +52,7 @@ namespace ramses::internal
         "RendererEvent",
         "Alive",
         "CreateScene",
+        "SendSceneUpdateSharedMemory",
     };
 
     inline IOutputStream& operator<<(IOutputStream& outputStream, EMessageId messageId)
@@ -68,4 +72,4 @@ namespace ramses::internal
 MAKE_ENUM_CLASS_PRINTABLE(ramses::internal::EMessageId,
                           "EMessageId",
                           ramses::internal::EMessageIdNames,
-                          ramses::internal::EMessageId::CreateScene);
+                          ramses::internal::EMessageId::SendSceneUpdateSharedMemory);
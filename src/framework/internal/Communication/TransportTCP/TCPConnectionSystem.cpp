@@ -13,6 +13,7 @@
 #include "internal/Core/Utils/RawBinaryOutputStream.h"
 #include "internal/Core/Utils/StatisticCollection.h"
 #include "internal/Core/Utils/LogMacros.h"
+#include <algorithm>
 #include <thread>
 #include <utility>
 #include "internal/Communication/TransportCommon/ISceneUpdateSerializer.h"
@@ -21,6 +22,8 @@ namespace ramses::internal
 {
     static const constexpr uint32_t ResourceDataSize = 300000;
     static const constexpr uint32_t SceneActionDataSize = 300000;
+    // scene update packets of at least this size are sent in bulk lane
+    static const constexpr uint32_t BulkSceneUpdatePacketSize = SceneActionDataSize / 4;
 
     TCPConnectionSystem::TCPConnectionSystem(NetworkParticipantAddress participantAddress,
                                                      uint32_t protocolVersion,
@@ -29,7 +32,8 @@ namespace ramses::internal
                                                      PlatformLock& frameworkLock,
                                                      StatisticCollectionFramework& statisticCollection,
                                                      std::chrono::milliseconds aliveInterval,
-                                                     std::chrono::milliseconds aliveTimeout)
+                                                     std::chrono::milliseconds aliveTimeout,
+                                                     uint32_t sceneActionCompressionThreshold)
         : m_participantAddress(std::move(participantAddress))
         , m_protocolVersion(protocolVersion)
         , m_daemonAddress(std::move(daemonAddress))
@@ -43,6 +47,7 @@ namespace ramses::internal
                             : EParticipantType::Client)
         , m_aliveInterval(aliveInterval)
         , m_aliveIntervalTimeout(aliveTimeout)
+        , m_sceneActionCompressionThreshold(sceneActionCompressionThreshold)
         , m_frameworkLock(frameworkLock)
         , m_thread("R_TCP_ConnSys")
         , m_statisticCollection(statisticCollection)
@@ -71,7 +76,8 @@ namespace ramses::internal
                                                    << m_participantAddress.getParticipantId() << "/" << m_participantAddress.getParticipantName()
                                                    << " at " << m_participantAddress.getIp() << ":" << m_participantAddress.getPort()
                                                    << ", type " << EnumToString(m_participantType)
-                                                   << ", aliveInterval " << m_aliveInterval.count() << "ms, aliveTimeout " << m_aliveIntervalTimeout.count() << "ms";
+                                                   << ", aliveInterval " << m_aliveInterval.count() << "ms, aliveTimeout " << m_aliveIntervalTimeout.count() << "ms"
+                                                   << ", sceneActionCompressionThreshold " << m_sceneActionCompressionThreshold;
                                                if (m_hasOtherDaemon)
                                                    sos << ", other daemon at " << m_daemonAddress.getIp() << ":" << m_daemonAddress.getPort();
                                            }));
@@ -345,20 +351,33 @@ namespace ramses::internal
 
     void TCPConnectionSystem::doSendQueuedMessage(const ParticipantPtr& pp)
     {
-        if (pp->currentOutBuffer.empty() && !pp->outQueue.empty())
-        {
-            OutMessage msg = std::move(pp->outQueue.front());
-            pp->outQueue.pop_front();
+        if (!pp->currentOutBuffer.empty())
+            return;
 
-            sendMessageToParticipant(pp, std::move(msg));
-        }
+        const std::optional<ESendLaneStatisticIndex> lane = pp->sendLanes.getNextLane();
+        if (!lane)
+            return;
+
+        auto queuedMsg = pp->sendLanes.pop(*lane);
+        const auto waitTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - queuedMsg.queuedTime);
+        m_statisticCollection.statSendQueueMaxWaitTime[*lane].setCounterValueIfCurrent<std::less<>>(static_cast<uint32_t>(waitTime.count()));
+
+        sendMessageToParticipant(pp, std::move(queuedMsg.msg));
+    }
+
+    void TCPConnectionSystem::queueMessageForParticipant(const ParticipantPtr& pp, OutMessage msg)
+    {
+        const ESendLaneStatisticIndex lane = pp->sendLanes.push(std::move(msg));
+        m_statisticCollection.statSendQueueMaxDepth[lane].setCounterValueIfCurrent<std::less<>>(static_cast<uint32_t>(pp->sendLanes.size(lane)));
+
+        doSendQueuedMessage(pp);
     }
 
     void TCPConnectionSystem::doTrySendAliveMessage(const ParticipantPtr& pp)
     {
         if (pp->currentOutBuffer.empty())
         {
-            assert(pp->outQueue.empty());
+            assert(pp->sendLanes.empty());
 
             sendMessageToParticipant(pp, OutMessage(std::vector<Guid>(), EMessageId::Alive));
         }
@@ -461,6 +480,9 @@ namespace ramses::internal
         if (!pp->address.getParticipantId().isInvalid())
         {
             m_establishedParticipants.remove(pp->address.getParticipantId());
+
+            PlatformGuard guard(m_frameworkLock);
+            m_participantsSupportingCompressedSceneActions.remove(pp->address.getParticipantId());
         }
 
         // check if should be tried again
@@ -559,9 +581,7 @@ namespace ramses::internal
                                     assert(pp);
 
                                     // cannot move here when broadcast to more than 1 participant
-                                    pp->outQueue.push_back(msg);
-
-                                    doSendQueuedMessage(pp);
+                                    queueMessageForParticipant(pp, msg);
                                 }
                             }
                             else
@@ -575,9 +595,7 @@ namespace ramses::internal
                                 }
                                 assert(pp);
 
-                                pp->outQueue.push_back(std::move(msg));
-
-                                doSendQueuedMessage(pp);
+                                queueMessageForParticipant(pp, std::move(msg));
                             }
             });
 
@@ -654,7 +672,8 @@ namespace ramses::internal
                    << m_participantAddress.getParticipantName()
                    << m_participantAddress.getIp()
                    << static_cast<uint16_t>(m_runState->m_acceptor.local_endpoint().port())
-                   << m_participantType;
+                   << m_participantType
+                   << static_cast<uint32_t>(ECapability::CompressedSceneActions);
         sendMessageToParticipant(pp, std::move(msg));
     }
 
@@ -680,16 +699,24 @@ namespace ramses::internal
         std::string ip;
         uint16_t port = 0u;
         EParticipantType participantType;
+        uint32_t capabilities = 0u;
         stream >> guid
                >> name
                >> ip
                >> port
-               >> participantType;
+               >> participantType
+               >> capabilities;
         pp->address = NetworkParticipantAddress(guid, name, ip, port);
         assert(!guid.isInvalid());
 
         LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::handleConnectionDescriptionMessage: Hello from " <<
-                 guid << "/" << name << " type " << EnumToString(participantType) << " at " << ip << ":" << port << ". Established now");
+                 guid << "/" << name << " type " << EnumToString(participantType) << " at " << ip << ":" << port << ", capabilities " << capabilities << ". Established now");
+
+        if ((capabilities & static_cast<uint32_t>(ECapability::CompressedSceneActions)) != 0u)
+        {
+            PlatformGuard guard(m_frameworkLock);
+            m_participantsSupportingCompressedSceneActions.put(guid);
+        }
 
         pp->type = participantType;
         pp->state = EParticipantState::Established;
@@ -880,6 +907,7 @@ namespace ramses::internal
         LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendInitializeScene: to " << to << ", sceneId " << sceneId);
         OutMessage msg(to, EMessageId::CreateScene);
         msg.stream << sceneId.getValue();
+        msg.sceneId = sceneId;
         return postMessageForSending(std::move(msg));
     }
 
@@ -904,6 +932,9 @@ namespace ramses::internal
 
         static_assert(SceneActionDataSize < 1000000, "SceneActionDataSize too big");
 
+        // expect framework lock to be held
+        const uint32_t actionCompressionThreshold = m_participantsSupportingCompressedSceneActions.contains(to) ? m_sceneActionCompressionThreshold : 0u;
+
         std::vector<std::byte> buffer(SceneActionDataSize);
         return serializer.writeToPackets({buffer.data(), buffer.size()}, [&](size_t size) {
 
@@ -912,9 +943,11 @@ namespace ramses::internal
             msg.stream << sceneId.getValue()
                        << usedSize;
             msg.stream.write(buffer.data(), usedSize);
+            msg.sceneId = sceneId;
+            msg.isBulkData = usedSize >= BulkSceneUpdatePacketSize;
 
             return postMessageForSending(std::move(msg));
-        });
+        }, actionCompressionThreshold);
     }
 
 
@@ -1124,6 +1157,9 @@ namespace ramses::internal
                                     sos << "  "  << addr.getParticipantId() << " / " << addr.getParticipantName() << " at " << addr.getIp() << ":" << addr.getPort();
                                     if (m_hasOtherDaemon && addr.getIp() == m_daemonAddress.getIp() && addr.getPort() == m_daemonAddress.getPort())
                                         sos << " (daemon)";
+                                    const auto& lanes = p.value->sendLanes;
+                                    sos << ", queued messages " << lanes.size(ESendLaneStatisticIndex_Control) << "/" << lanes.size(ESendLaneStatisticIndex_Scene)
+                                        << "/" << lanes.size(ESendLaneStatisticIndex_Bulk) << " (control/scene/bulk)";
                                     sos << "\n";
                                 }
 
@@ -13,17 +13,20 @@
 #include "internal/PlatformAbstraction/PlatformThread.h"
 #include "internal/Communication/TransportTCP/NetworkParticipantAddress.h"
 #include "internal/Communication/TransportTCP/EMessageId.h"
+#include "internal/Communication/TransportTCP/TCPSendLanes.h"
 #include "internal/Core/Utils/BinaryOutputStream.h"
+#include "internal/Core/Utils/StatisticCollection.h"
 #include "internal/PlatformAbstraction/Collections/HashSet.h"
 #include "internal/PlatformAbstraction/Collections/HashMap.h"
 #include "internal/Communication/TransportTCP/AsioWrapper.h"
+#include <array>
+#include <chrono>
 #include <deque>
 #include <utility>
 
 
 namespace ramses::internal
 {
-    class StatisticCollectionFramework;
     class BinaryInputStream;
 
     class TCPConnectionSystem final : public Runnable, public ICommunicationSystem
@@ -31,7 +34,7 @@ namespace ramses::internal
     public:
         TCPConnectionSystem(NetworkParticipantAddress  participantAddress, uint32_t protocolVersion, NetworkParticipantAddress  daemonAddress, bool pureDaemon,
                             PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection,
-                            std::chrono::milliseconds aliveInterval, std::chrono::milliseconds aliveTimeout);
+                            std::chrono::milliseconds aliveInterval, std::chrono::milliseconds aliveTimeout, uint32_t sceneActionCompressionThreshold = 0u);
         ~TCPConnectionSystem() override;
 
         static Guid GetDaemonId();
@@ -78,6 +81,13 @@ namespace ramses::internal
             PureDaemon
         };
 
+        // announced in connection description, bit flags
+        enum class ECapability : uint32_t
+        {
+            None                   = 0u,
+            CompressedSceneActions = 1u,
+        };
+
         struct OutMessage
         {
             OutMessage(const Guid& to_, EMessageId messageType_)
@@ -103,6 +113,10 @@ namespace ramses::internal
             std::vector<Guid> to;
             EMessageId messageType;
             BinaryOutputStream stream;
+            // set for messages belonging to a single scene, their order is kept even if they are sent in different lanes
+            SceneId sceneId;
+            // large scene update packet, sent after all other messages to not block them
+            bool isBulkData = false;
         };
 
         struct Participant
@@ -115,7 +129,7 @@ namespace ramses::internal
             asio::ip::tcp::socket socket;
             asio::steady_timer connectTimer;
 
-            std::deque<OutMessage> outQueue;
+            TCPSendLanes<OutMessage> sendLanes;
             std::vector<std::byte> currentOutBuffer;
 
             uint32_t lengthReceiveBuffer;
@@ -153,6 +167,7 @@ namespace ramses::internal
         void doAcceptIncomingConnections();
 
         void sendMessageToParticipant(const ParticipantPtr& pp, OutMessage msg);
+        void queueMessageForParticipant(const ParticipantPtr& pp, OutMessage msg);
         void removeParticipant(const ParticipantPtr& pp, bool reconnectWithBackoff = false);
         void addNewParticipantByAddress(const NetworkParticipantAddress& address);
         void initializeNewlyConnectedParticipant(const ParticipantPtr& pp);
@@ -185,6 +200,7 @@ namespace ramses::internal
         const EParticipantType m_participantType;
         const std::chrono::milliseconds m_aliveInterval;
         const std::chrono::milliseconds m_aliveIntervalTimeout;
+        const uint32_t m_sceneActionCompressionThreshold;
 
         PlatformLock& m_frameworkLock;
         PlatformThread m_thread;
@@ -199,5 +215,8 @@ namespace ramses::internal
         std::unique_ptr<RunState>     m_runState;
         HashSet<ParticipantPtr>       m_connectingParticipants;
         HashMap<Guid, ParticipantPtr> m_establishedParticipants;
+
+        // guarded by framework lock, accessed when sending from outside of connection thread
+        HashSet<Guid>                 m_participantsSupportingCompressedSceneActions;
     };
 }
@@ -0,0 +1,123 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Communication/TransportTCP/EMessageId.h"
+#include "internal/Core/Utils/StatisticCollection.h"
+#include "internal/PlatformAbstraction/Collections/HashMap.h"
+#include "internal/SceneGraph/SceneAPI/SceneId.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <deque>
+#include <optional>
+
+namespace ramses::internal
+{
+    // Queues of messages to a single participant. Messages are sent from the first non-empty lane (control, scene, bulk), so that
+    // large scene updates do not delay alive messages, renderer events or small scene updates of other scenes. Messages of a single
+    // scene keep their order even if they are queued in different lanes. MessageT needs members messageType, sceneId and isBulkData.
+    template <typename MessageT>
+    class TCPSendLanes
+    {
+    public:
+        struct QueuedMessage
+        {
+            MessageT msg;
+            std::chrono::steady_clock::time_point queuedTime;
+        };
+
+        // returns lane the message was queued in
+        ESendLaneStatisticIndex push(MessageT msg)
+        {
+            const ESendLaneStatisticIndex lane = getLane(msg);
+            if (lane == ESendLaneStatisticIndex_Bulk && msg.sceneId.isValid())
+            {
+                uint32_t* numBulkMessages = m_bulkMessagesPerScene.get(msg.sceneId);
+                if (numBulkMessages)
+                    ++(*numBulkMessages);
+                else
+                    m_bulkMessagesPerScene.put(msg.sceneId, 1u);
+            }
+
+            m_queues[lane].push_back({ std::move(msg), std::chrono::steady_clock::now() });
+            return lane;
+        }
+
+        [[nodiscard]] std::optional<ESendLaneStatisticIndex> getNextLane() const
+        {
+            for (size_t lane = 0; lane < ESendLaneStatisticIndex_NumIndices; ++lane)
+            {
+                if (!m_queues[lane].empty())
+                    return static_cast<ESendLaneStatisticIndex>(lane);
+            }
+            return std::nullopt;
+        }
+
+        QueuedMessage pop(ESendLaneStatisticIndex lane)
+        {
+            auto& queue = m_queues[lane];
+            assert(!queue.empty());
+            QueuedMessage queuedMsg = std::move(queue.front());
+            queue.pop_front();
+
+            if (lane == ESendLaneStatisticIndex_Bulk && queuedMsg.msg.sceneId.isValid())
+            {
+                uint32_t* numBulkMessages = m_bulkMessagesPerScene.get(queuedMsg.msg.sceneId);
+                assert(numBulkMessages && *numBulkMessages > 0u);
+                if (--(*numBulkMessages) == 0u)
+                    m_bulkMessagesPerScene.remove(queuedMsg.msg.sceneId);
+            }
+
+            return queuedMsg;
+        }
+
+        [[nodiscard]] ESendLaneStatisticIndex getLane(const MessageT& msg) const
+        {
+            switch (msg.messageType)
+            {
+            case EMessageId::PublishScene:
+            case EMessageId::UnpublishScene:
+                // may refer to any scene, must not overtake scene messages in bulk lane
+                return m_queues[ESendLaneStatisticIndex_Bulk].empty() ? ESendLaneStatisticIndex_Scene : ESendLaneStatisticIndex_Bulk;
+            case EMessageId::CreateScene:
+            case EMessageId::SendSceneUpdate:
+            case EMessageId::SendSceneUpdateSharedMemory:
+                return (msg.isBulkData || m_bulkMessagesPerScene.contains(msg.sceneId)) ? ESendLaneStatisticIndex_Bulk : ESendLaneStatisticIndex_Scene;
+            case EMessageId::Invalid:
+            case EMessageId::SubscribeScene:
+            case EMessageId::UnsubscribeScene:
+            case EMessageId::ConnectionDescriptionMessage:
+            case EMessageId::ConnectorAddressExchange:
+            case EMessageId::InputEvent:
+            case EMessageId::RendererEvent:
+            case EMessageId::Alive:
+                break;
+            }
+            return ESendLaneStatisticIndex_Control;
+        }
+
+        [[nodiscard]] size_t size(ESendLaneStatisticIndex lane) const
+        {
+            return m_queues[lane].size();
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return std::all_of(m_queues.cbegin(), m_queues.cend(), [](const auto& queue) { return queue.empty(); });
+        }
+
+    private:
+        std::array<std::deque<QueuedMessage>, ESendLaneStatisticIndex_NumIndices> m_queues;
+        // number of messages of a scene queued in bulk lane, following messages of that scene must be queued behind them
+        HashMap<SceneId, uint32_t> m_bulkMessagesPerScene;
+    };
+}
@@ -19,6 +19,8 @@
 #include "internal/Components/IResourceProviderComponent.h"
 #include "internal/Components/SceneUpdate.h"
 
+#include <algorithm>
+
 namespace ramses::internal
 {
     ClientSceneLogicBase::ClientSceneLogicBase(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress)
@@ -193,6 +195,23 @@ namespace ramses::internal
         return "Unpublished";
     }
 
+    void ClientSceneLogicBase::applyResourceChangesToResourcesInUse()
+    {
+        // both added and removed resources are sorted, keep resources in use sorted without rebuilding it
+        const auto& removed = m_resourceChangesSinceLastFlush.m_resourcesRemoved;
+        if (!removed.empty())
+        {
+            m_lastFlushResourcesInUse.erase(std::remove_if(m_lastFlushResourcesInUse.begin(), m_lastFlushResourcesInUse.end(), [&removed](const ResourceContentHash& hash) {
+                return std::binary_search(removed.cbegin(), removed.cend(), hash);
+            }), m_lastFlushResourcesInUse.end());
+        }
+
+        const auto& added = m_resourceChangesSinceLastFlush.m_resourcesAdded;
+        const auto numResourcesKept = static_cast<std::ptrdiff_t>(m_lastFlushResourcesInUse.size());
+        m_lastFlushResourcesInUse.insert(m_lastFlushResourcesInUse.end(), added.cbegin(), added.cend());
+        std::inplace_merge(m_lastFlushResourcesInUse.begin(), m_lastFlushResourcesInUse.begin() + numResourcesKept, m_lastFlushResourcesInUse.end());
+    }
+
     void ClientSceneLogicBase::updateResourceStatistics()
     {
         // reset locally gathered resource statistics
@@ -200,7 +219,7 @@ namespace ramses::internal
         std::fill(m_resourceMaxSize.begin(), m_resourceMaxSize.end(), 0);
         std::fill(m_resourceDataSize.begin(), m_resourceDataSize.end(), 0);
 
-        for (auto const& hash : m_currentFlushResourcesInUse)
+        for (auto const& hash : m_lastFlushResourcesInUse)
         {
             if (!m_resourceComponent.knowsResource(hash))
                 continue; // no log, this will be logged when trying to load it
@@ -275,9 +294,19 @@ namespace ramses::internal
         ResourceChangeState result = ResourceChangeState::NoChange;
         if (m_scene.haveResourcesChanged())
         {
-            m_currentFlushResourcesInUse.clear();
-            ResourceUtils::GetAllResourcesFromScene(m_currentFlushResourcesInUse, m_scene);
-            ResourceUtils::DiffResources(m_lastFlushResourcesInUse, m_currentFlushResourcesInUse, m_resourceChangesSinceLastFlush);
+            // scene keeps track of resources in use, only resources whose usage changed since last flush need to be checked
+            m_changedResourcesSinceLastFlush = m_scene.getResourcesWithChangedUsage();
+            std::sort(m_changedResourcesSinceLastFlush.begin(), m_changedResourcesSinceLastFlush.end());
+            m_changedResourcesSinceLastFlush.erase(std::unique(m_changedResourcesSinceLastFlush.begin(), m_changedResourcesSinceLastFlush.end()), m_changedResourcesSinceLastFlush.end());
+            for (const auto& hash : m_changedResourcesSinceLastFlush)
+            {
+                const bool wasInUse = std::binary_search(m_lastFlushResourcesInUse.cbegin(), m_lastFlushResourcesInUse.cend(), hash);
+                const bool isInUse = m_scene.isResourceInUse(hash);
+                if (isInUse && !wasInUse)
+                    m_resourceChangesSinceLastFlush.m_resourcesAdded.push_back(hash);
+                else if (!isInUse && wasInUse)
+                    m_resourceChangesSinceLastFlush.m_resourcesRemoved.push_back(hash);
+            }
 
             if (!m_resourceChangesSinceLastFlush.m_resourcesAdded.empty())
             {
@@ -286,9 +315,9 @@ namespace ramses::internal
                     return ResourceChangeState::MissingResource;
             }
 
+            applyResourceChangesToResourcesInUse();
             updateResourceStatistics();
 
-            m_lastFlushResourcesInUse.swap(m_currentFlushResourcesInUse);
             result = ResourceChangeState::HasChanges;
         }
 
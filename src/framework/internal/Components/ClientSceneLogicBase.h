@@ -50,6 +50,7 @@ namespace ramses::internal
         void sendSceneToWaitingSubscribers(const IScene& scene, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag);
         void printFlushInfo(StringOutputStream& sos, const char* name, const SceneUpdate& update) const;
         ResourceChangeState verifyAndGetResourceChanges(SceneUpdate& sceneUpdate, bool hasNewActions);
+        void applyResourceChangesToResourcesInUse();
         void updateResourceStatistics();
         void fillStatisticsCollection();
         bool updateExpirationAndCheckIfChanged(const FlushTimeInformation& flushTimeInfo);
@@ -71,7 +72,7 @@ namespace ramses::internal
         FlushTime::Clock::time_point m_lastFlushedExpirationTimestamp{ FlushTime::InvalidTimestamp };
 
         ResourceChanges m_resourceChangesSinceLastFlush; // keep container memory allocated
-        ResourceContentHashVector m_currentFlushResourcesInUse; // keep container memory allocated
+        ResourceContentHashVector m_changedResourcesSinceLastFlush; // keep container memory allocated
 
         // resource statistics gathered while flushing the last time
         std::array<uint64_t, EResourceStatisticIndex_NumIndices> m_resourceCount{};
@@ -13,6 +13,8 @@
 
 namespace ramses::internal
 {
+    // Does not keep any copy of the scene between flushes. The client scene is described only at the end of a flush with
+    // subscribers waiting, this single description is sent to all of them and dropped afterwards.
     class ClientSceneLogicDirect final : public ClientSceneLogicBase
     {
     public:
@@ -14,6 +14,7 @@
 
 namespace ramses::internal
 {
+    // Keeps a copy of the scene as of the last flush, so that new subscribers can be sent the scene immediately
     class ClientSceneLogicShadowCopy final : public ClientSceneLogicBase
     {
     public:
@@ -293,12 +293,12 @@ namespace ramses::internal
         }
     }
 
-    void SceneGraphComponent::handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, ISceneProviderEventConsumer& eventConsumer)
+    void SceneGraphComponent::handleCreateScene(ClientScene& scene, bool useDirectSceneLogic, ISceneProviderEventConsumer& eventConsumer)
     {
         const SceneId sceneId = scene.getSceneId();
         assert(!m_clientSceneLogicMap.contains(sceneId));
         ClientSceneLogicBase* sceneLogic = nullptr;
-        if (enableLocalOnlyOptimization)
+        if (useDirectSceneLogic)
         {
             LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleCreateScene: creating scene " << scene.getSceneId() << " (direct)");
             sceneLogic = new ClientSceneLogicDirect(*this, scene, m_resourceComponent, m_myID);
@@ -74,7 +74,7 @@ namespace ramses::internal
         void participantHasDisconnected(const Guid& disconnnectedParticipant) override;
 
         // ISceneGraphProviderComponent
-        void handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, ISceneProviderEventConsumer& eventConsumer) override;
+        void handleCreateScene(ClientScene& scene, bool useDirectSceneLogic, ISceneProviderEventConsumer& eventConsumer) override;
         void handlePublishScene(SceneId sceneId, EScenePublicationMode publicationMode) override;
         void handleUnpublishScene(SceneId sceneId) override;
         bool handleFlush(SceneId sceneId, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) override;
@@ -0,0 +1,90 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/TaskFramework/ParallelTaskGroup.h"
+#include "internal/Core/TaskFramework/ITaskQueue.h"
+#include "internal/Core/TaskFramework/ITask.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace ramses::internal
+{
+    struct ParallelTaskGroup::SharedState
+    {
+        std::vector<Job> jobs;
+        std::atomic<size_t> nextJob{0u};
+        size_t finishedJobs = 0u;
+        std::mutex lock;
+        std::condition_variable finishedCondition;
+
+        // runs jobs until none is left to claim
+        void runJobs()
+        {
+            for (size_t jobIndex = nextJob++; jobIndex < jobs.size(); jobIndex = nextJob++)
+            {
+                jobs[jobIndex]();
+
+                std::lock_guard<std::mutex> guard(lock);
+                if (++finishedJobs == jobs.size())
+                    finishedCondition.notify_all();
+            }
+        }
+    };
+
+    // keeps shared state alive in case the queue executes the runner after the group finished
+    class ParallelTaskGroup::JobRunner final : public ITask
+    {
+    public:
+        explicit JobRunner(std::shared_ptr<SharedState> state)
+            : m_state(std::move(state))
+        {
+        }
+
+        void execute() override
+        {
+            m_state->runJobs();
+        }
+
+    private:
+        std::shared_ptr<SharedState> m_state;
+    };
+
+    ParallelTaskGroup::ParallelTaskGroup(ITaskQueue* taskQueue)
+        : m_taskQueue(taskQueue)
+        , m_state(std::make_shared<SharedState>())
+    {
+    }
+
+    void ParallelTaskGroup::add(Job job)
+    {
+        m_state->jobs.push_back(std::move(job));
+    }
+
+    void ParallelTaskGroup::execute()
+    {
+        const size_t jobCount = m_state->jobs.size();
+        if (m_taskQueue != nullptr)
+        {
+            // calling thread takes one of the jobs itself
+            for (size_t i = 1u; i < jobCount; ++i)
+            {
+                auto* runner = new JobRunner(m_state);
+                const bool enqueued = m_taskQueue->enqueue(*runner);
+                runner->release();
+                if (!enqueued)
+                    break;
+            }
+        }
+
+        m_state->runJobs();
+
+        std::unique_lock<std::mutex> guard(m_state->lock);
+        m_state->finishedCondition.wait(guard, [&]() { return m_state->finishedJobs == jobCount; });
+    }
+}
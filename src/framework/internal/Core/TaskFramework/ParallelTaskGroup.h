@@ -0,0 +1,42 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ramses::internal
+{
+    class ITaskQueue;
+
+    /**
+     * Runs a group of independent jobs on a task queue and blocks until all of them are finished.
+     * The calling thread executes jobs which were not yet picked up by the queue, therefore it is safe
+     * to wait for a group from within a task executed by the same queue. Without a queue (or if the
+     * queue does not accept tasks) all jobs are executed on the calling thread in order of adding.
+     */
+    class ParallelTaskGroup
+    {
+    public:
+        using Job = std::function<void()>;
+
+        explicit ParallelTaskGroup(ITaskQueue* taskQueue);
+
+        void add(Job job);
+        void execute();
+
+    private:
+        struct SharedState;
+        class JobRunner;
+
+        ITaskQueue* m_taskQueue;
+        std::shared_ptr<SharedState> m_state;
+    };
+}
@@ -0,0 +1,23 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+namespace ramses::internal
+{
+    class MetricsWriter;
+
+    class IMetricsSource
+    {
+    public:
+        virtual ~IMetricsSource() = default;
+
+        // called from metrics endpoint thread, must only read data which is safe to access concurrently (e.g. atomics)
+        virtual void writeMetrics(MetricsWriter& writer) const = 0;
+    };
+}
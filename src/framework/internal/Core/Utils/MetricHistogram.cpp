@@ -0,0 +1,58 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/Utils/MetricHistogram.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace ramses::internal
+{
+    MetricHistogram::MetricHistogram(std::vector<uint64_t> upperBounds)
+        : m_upperBounds(std::move(upperBounds))
+        , m_bucketCounts(std::make_unique<std::atomic<uint64_t>[]>(m_upperBounds.size() + 1u))
+    {
+        assert(std::is_sorted(m_upperBounds.cbegin(), m_upperBounds.cend()));
+        for (size_t i = 0u; i <= m_upperBounds.size(); ++i)
+            m_bucketCounts[i].store(0u, std::memory_order_relaxed);
+    }
+
+    void MetricHistogram::observe(uint64_t value)
+    {
+        const auto bucket = static_cast<size_t>(std::lower_bound(m_upperBounds.cbegin(), m_upperBounds.cend(), value) - m_upperBounds.cbegin());
+        m_bucketCounts[bucket].fetch_add(1u, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+        m_count.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    const std::vector<uint64_t>& MetricHistogram::getUpperBounds() const
+    {
+        return m_upperBounds;
+    }
+
+    size_t MetricHistogram::getNumberOfBuckets() const
+    {
+        return m_upperBounds.size() + 1u;
+    }
+
+    uint64_t MetricHistogram::getBucketCount(size_t bucket) const
+    {
+        assert(bucket < getNumberOfBuckets());
+        return m_bucketCounts[bucket].load(std::memory_order_relaxed);
+    }
+
+    uint64_t MetricHistogram::getCount() const
+    {
+        return m_count.load(std::memory_order_relaxed);
+    }
+
+    uint64_t MetricHistogram::getSum() const
+    {
+        return m_sum.load(std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,39 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ramses::internal
+{
+    // Histogram with fixed bucket upper bounds, can be updated from one thread and read from any other thread without locking.
+    // Bucket i counts values in (upperBounds[i-1], upperBounds[i]], the last bucket counts all values above the largest bound.
+    class MetricHistogram
+    {
+    public:
+        explicit MetricHistogram(std::vector<uint64_t> upperBounds);
+
+        void observe(uint64_t value);
+
+        [[nodiscard]] const std::vector<uint64_t>& getUpperBounds() const;
+        [[nodiscard]] size_t getNumberOfBuckets() const;
+        [[nodiscard]] uint64_t getBucketCount(size_t bucket) const;
+        [[nodiscard]] uint64_t getCount() const;
+        [[nodiscard]] uint64_t getSum() const;
+
+    private:
+        const std::vector<uint64_t> m_upperBounds;
+        std::unique_ptr<std::atomic<uint64_t>[]> m_bucketCounts;
+        std::atomic<uint64_t> m_count{0u};
+        std::atomic<uint64_t> m_sum{0u};
+    };
+}
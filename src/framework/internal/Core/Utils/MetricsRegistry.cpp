@@ -0,0 +1,107 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/Utils/MetricsRegistry.h"
+#include "internal/Core/Utils/MetricsWriter.h"
+#include "internal/Core/Utils/StatisticCollection.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        void WriteFrameworkMetrics(MetricsWriter& writer, const StatisticCollectionFramework& stats)
+        {
+            const MetricLabels noLabels;
+            writer.addCounter("ramses_framework_messages_sent_total", "Messages sent by the communication system", noLabels, stats.statMessagesSent.getTotalValue());
+            writer.addCounter("ramses_framework_messages_received_total", "Messages received by the communication system", noLabels, stats.statMessagesReceived.getTotalValue());
+            writer.addCounter("ramses_framework_resources_created_total", "Client resources created", noLabels, stats.statResourcesCreated.getTotalValue());
+            writer.addCounter("ramses_framework_resources_destroyed_total", "Client resources destroyed", noLabels, stats.statResourcesDestroyed.getTotalValue());
+            writer.addGauge("ramses_framework_resources", "Client resources currently existing", noLabels,
+                static_cast<double>(stats.statResourcesCreated.getTotalValue()) - static_cast<double>(stats.statResourcesDestroyed.getTotalValue()));
+            writer.addCounter("ramses_framework_resources_loaded_from_file_total", "Client resources loaded from file", noLabels, stats.statResourcesLoadedFromFileNumber.getTotalValue());
+            writer.addCounter("ramses_framework_resources_loaded_from_file_bytes_total", "Size of client resources loaded from file", noLabels, stats.statResourcesLoadedFromFileSize.getTotalValue());
+
+            const std::array<const char*, ESendLaneStatisticIndex_NumIndices> laneNames = { "control", "scene", "bulk" };
+            for (size_t lane = 0; lane < ESendLaneStatisticIndex_NumIndices; ++lane)
+            {
+                const MetricLabels laneLabels{ { "lane", laneNames[lane] } };
+                writer.addGauge("ramses_framework_send_queue_max_depth", "Maximum number of messages queued for sending in current statistic interval", laneLabels,
+                    static_cast<double>(stats.statSendQueueMaxDepth[lane].getCounterValue()));
+                writer.addGauge("ramses_framework_send_queue_max_wait_microseconds", "Maximum time a message waited for sending in current statistic interval", laneLabels,
+                    static_cast<double>(stats.statSendQueueMaxWaitTime[lane].getCounterValue()));
+            }
+        }
+
+        void WriteSceneMetrics(MetricsWriter& writer, const SceneId& sceneId, const StatisticCollectionScene& stats)
+        {
+            const MetricLabels labels{ { "scene", std::to_string(sceneId.getValue()) } };
+            writer.addCounter("ramses_scene_flushes_total", "Flushes triggered on client scene", labels, stats.statFlushesTriggered.getTotalValue());
+            writer.addCounter("ramses_scene_objects_created_total", "Scene objects created", labels, stats.statObjectsCreated.getTotalValue());
+            writer.addCounter("ramses_scene_objects_destroyed_total", "Scene objects destroyed", labels, stats.statObjectsDestroyed.getTotalValue());
+            writer.addGauge("ramses_scene_objects", "Scene objects currently existing", labels,
+                static_cast<double>(stats.statObjectsCreated.getTotalValue()) - static_cast<double>(stats.statObjectsDestroyed.getTotalValue()));
+            writer.addCounter("ramses_scene_actions_generated_total", "Scene actions generated by flushes", labels, stats.statSceneActionsGenerated.getTotalValue());
+            writer.addCounter("ramses_scene_actions_generated_bytes_total", "Size of scene actions generated by flushes", labels, stats.statSceneActionsGeneratedSize.getTotalValue());
+            writer.addCounter("ramses_scene_actions_sent_total", "Scene actions sent to subscribers", labels, stats.statSceneActionsSent.getTotalValue());
+            writer.addCounter("ramses_scene_actions_sent_skipped_total", "Scene actions not sent because there were no subscribers", labels, stats.statSceneActionsSentSkipped.getTotalValue());
+            writer.addCounter("ramses_scene_update_packets_total", "Scene update packets generated", labels, stats.statSceneUpdatesGeneratedPackets.getTotalValue());
+            writer.addCounter("ramses_scene_update_bytes_total", "Size of scene update packets generated", labels, stats.statSceneUpdatesGeneratedSize.getTotalValue());
+            writer.addCounter("ramses_scene_actions_compression_input_bytes_total", "Size of scene actions before compression", labels, stats.statSceneActionsCompressedInputSize.getTotalValue());
+            writer.addCounter("ramses_scene_actions_compression_output_bytes_total", "Size of scene actions after compression", labels, stats.statSceneActionsCompressedOutputSize.getTotalValue());
+            writer.addCounter("ramses_scene_actions_compression_microseconds_total", "Time spent compressing scene actions", labels, stats.statSceneActionsCompressionTime.getTotalValue());
+        }
+    }
+
+    MetricsRegistry::MetricsRegistry(const StatisticCollectionFramework& statisticCollection)
+        : m_statisticCollection(statisticCollection)
+    {
+    }
+
+    void MetricsRegistry::registerMetricsSource(const IMetricsSource* source)
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        assert(std::find(m_metricsSources.cbegin(), m_metricsSources.cend(), source) == m_metricsSources.cend());
+        m_metricsSources.push_back(source);
+    }
+
+    void MetricsRegistry::removeMetricsSource(const IMetricsSource* source)
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_metricsSources.erase(std::remove(m_metricsSources.begin(), m_metricsSources.end(), source), m_metricsSources.end());
+    }
+
+    void MetricsRegistry::registerStatisticCollectionScene(const SceneId& sceneId, const StatisticCollectionScene& statisticCollectionScene)
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_statisticCollectionScenes.put(sceneId, &statisticCollectionScene);
+    }
+
+    void MetricsRegistry::removeStatisticCollectionScene(const SceneId& sceneId)
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_statisticCollectionScenes.remove(sceneId);
+    }
+
+    std::string MetricsRegistry::collectPrometheusText() const
+    {
+        MetricsWriter writer;
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            WriteFrameworkMetrics(writer, m_statisticCollection);
+            for (const auto& scene : m_statisticCollectionScenes)
+                WriteSceneMetrics(writer, scene.key, *scene.value);
+            for (const auto* source : m_metricsSources)
+                source->writeMetrics(writer);
+        }
+        return writer.toPrometheusText();
+    }
+}
@@ -0,0 +1,46 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Core/Utils/IMetricsSource.h"
+#include "internal/PlatformAbstraction/Collections/HashMap.h"
+#include "internal/SceneGraph/SceneAPI/SceneId.h"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ramses::internal
+{
+    class StatisticCollectionFramework;
+    class StatisticCollectionScene;
+
+    // Keeps track of everything that is exported through the metrics endpoint.
+    // The registry lock is only taken when (un)registering and when collecting metrics, sources are expected
+    // to provide their data in a way that can be read without synchronization with the threads producing it.
+    class MetricsRegistry
+    {
+    public:
+        explicit MetricsRegistry(const StatisticCollectionFramework& statisticCollection);
+
+        void registerMetricsSource(const IMetricsSource* source);
+        void removeMetricsSource(const IMetricsSource* source);
+
+        void registerStatisticCollectionScene(const SceneId& sceneId, const StatisticCollectionScene& statisticCollectionScene);
+        void removeStatisticCollectionScene(const SceneId& sceneId);
+
+        [[nodiscard]] std::string collectPrometheusText() const;
+
+    private:
+        mutable std::mutex m_lock;
+        const StatisticCollectionFramework& m_statisticCollection;
+        std::vector<const IMetricsSource*> m_metricsSources;
+        HashMap<SceneId, const StatisticCollectionScene*> m_statisticCollectionScenes;
+    };
+}
@@ -0,0 +1,109 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/Utils/MetricsWriter.h"
+#include "internal/Core/Utils/MetricHistogram.h"
+#include "fmt/format.h"
+
+namespace ramses::internal
+{
+    void MetricsWriter::addCounter(std::string_view name, std::string_view help, const MetricLabels& labels, uint64_t value)
+    {
+        AppendSample(getFamily(name, help, "counter").samples, name, labels, {}, fmt::format("{}", value));
+    }
+
+    void MetricsWriter::addGauge(std::string_view name, std::string_view help, const MetricLabels& labels, double value)
+    {
+        AppendSample(getFamily(name, help, "gauge").samples, name, labels, {}, fmt::format("{}", value));
+    }
+
+    void MetricsWriter::addHistogram(std::string_view name, std::string_view help, const MetricLabels& labels, const MetricHistogram& histogram)
+    {
+        auto& samples = getFamily(name, help, "histogram").samples;
+        const std::string bucketName = fmt::format("{}_bucket", name);
+
+        // buckets are updated independently, derive count from them so that output is always consistent
+        uint64_t cumulativeCount = 0u;
+        const auto& upperBounds = histogram.getUpperBounds();
+        for (size_t i = 0u; i < upperBounds.size(); ++i)
+        {
+            cumulativeCount += histogram.getBucketCount(i);
+            AppendSample(samples, bucketName, labels, fmt::format("le=\"{}\"", upperBounds[i]), fmt::format("{}", cumulativeCount));
+        }
+        cumulativeCount += histogram.getBucketCount(upperBounds.size());
+        AppendSample(samples, bucketName, labels, "le=\"+Inf\"", fmt::format("{}", cumulativeCount));
+        AppendSample(samples, fmt::format("{}_sum", name), labels, {}, fmt::format("{}", histogram.getSum()));
+        AppendSample(samples, fmt::format("{}_count", name), labels, {}, fmt::format("{}", cumulativeCount));
+    }
+
+    std::string MetricsWriter::toPrometheusText() const
+    {
+        std::string out;
+        for (const auto& family : m_families)
+        {
+            out += fmt::format("# HELP {} {}\n# TYPE {} {}\n", family.first, family.second.help, family.first, family.second.type);
+            out += family.second.samples;
+        }
+        return out;
+    }
+
+    MetricsWriter::Family& MetricsWriter::getFamily(std::string_view name, std::string_view help, std::string_view type)
+    {
+        auto it = m_families.find(name);
+        if (it == m_families.end())
+            it = m_families.emplace(std::string{ name }, Family{ type, std::string{ help }, {} }).first;
+        return it->second;
+    }
+
+    void MetricsWriter::AppendSample(std::string& out, std::string_view name, const MetricLabels& labels, std::string_view extraLabel, std::string_view value)
+    {
+        out += name;
+        if (!labels.empty() || !extraLabel.empty())
+        {
+            out += '{';
+            bool first = true;
+            for (const auto& label : labels)
+            {
+                if (!first)
+                    out += ',';
+                first = false;
+                out += label.first;
+                out += "=\"";
+                for (const char c : label.second)
+                {
+                    switch (c)
+                    {
+                    case '\\':
+                        out += "\\\\";
+                        break;
+                    case '"':
+                        out += "\\\"";
+                        break;
+                    case '\n':
+                        out += "\\n";
+                        break;
+                    default:
+                        out += c;
+                        break;
+                    }
+                }
+                out += '"';
+            }
+            if (!extraLabel.empty())
+            {
+                if (!first)
+                    out += ',';
+                out += extraLabel;
+            }
+            out += '}';
+        }
+        out += ' ';
+        out += value;
+        out += '\n';
+    }
+}
@@ -0,0 +1,49 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ramses::internal
+{
+    class MetricHistogram;
+
+    using MetricLabels = std::vector<std::pair<std::string_view, std::string>>;
+
+    // Collects metric samples and formats them in Prometheus text exposition format.
+    // Samples of same metric name are grouped under one HELP/TYPE header regardless of the order they were added in.
+    class MetricsWriter
+    {
+    public:
+        void addCounter(std::string_view name, std::string_view help, const MetricLabels& labels, uint64_t value);
+        void addGauge(std::string_view name, std::string_view help, const MetricLabels& labels, double value);
+        void addHistogram(std::string_view name, std::string_view help, const MetricLabels& labels, const MetricHistogram& histogram);
+
+        [[nodiscard]] std::string toPrometheusText() const;
+
+    private:
+        struct Family
+        {
+            std::string_view type;
+            std::string help;
+            std::string samples;
+        };
+
+        Family& getFamily(std::string_view name, std::string_view help, std::string_view type);
+        static void AppendSample(std::string& out, std::string_view name, const MetricLabels& labels, std::string_view extraLabel, std::string_view value);
+
+        // ordered to keep output stable between scrapes
+        std::map<std::string, Family, std::less<>> m_families;
+    };
+}
@@ -157,6 +157,18 @@ namespace ramses::internal
                     logStatisticSummaryEntry(output, m_statisticCollection.statResourcesLoadedFromFileNumber.getSummary(), numberTimeIntervals);
                     output << " resFS ";
                     logStatisticSummaryEntry(output, m_statisticCollection.statResourcesLoadedFromFileSize.getSummary(), numberTimeIntervals);
+                    const std::array<const char*, ESendLaneStatisticIndex_NumIndices> laneNames = { "Ctl", "Scn", "Blk" };
+                    for (size_t lane = 0; lane < ESendLaneStatisticIndex_NumIndices; ++lane)
+                    {
+                        const auto& queueDepthSummary = m_statisticCollection.statSendQueueMaxDepth[lane].getSummary();
+                        if (queueDepthSummary.sum > 0u)
+                        {
+                            output << " q" << laneNames[lane] << " ";
+                            logStatisticSummaryEntry(output, queueDepthSummary, numberTimeIntervals);
+                            output << " q" << laneNames[lane] << "W ";
+                            logStatisticSummaryEntry(output, m_statisticCollection.statSendQueueMaxWaitTime[lane].getSummary(), numberTimeIntervals);
+                        }
+                    }
         }));
 
         m_statisticCollection.resetSummaries();
@@ -190,6 +202,16 @@ namespace ramses::internal
                             logStatisticSummaryEntry(output, entry.value->statSceneUpdatesGeneratedSize.getSummary(), numberTimeIntervals);
                             output << " suX ";
                             logStatisticSummaryEntry(output, entry.value->statMaximumSizeSingleSceneUpdate.getSummary(), numberTimeIntervals);
+                            const auto& compressedInputSummary = entry.value->statSceneActionsCompressedInputSize.getSummary();
+                            if (compressedInputSummary.sum > 0u)
+                            {
+                                const auto& compressedOutputSummary = entry.value->statSceneActionsCompressedOutputSize.getSummary();
+                                output << " actCS ";
+                                logStatisticSummaryEntry(output, compressedOutputSummary, numberTimeIntervals);
+                                output << " actCR " << (static_cast<uint64_t>(compressedOutputSummary.sum) * 100u / compressedInputSummary.sum) << "%";
+                                output << " actCT ";
+                                logStatisticSummaryEntry(output, entry.value->statSceneActionsCompressionTime.getSummary(), numberTimeIntervals);
+                            }
                             output << " ar# ";
                             logStatisticSummaryEntry(output, entry.value->statResourceCount[EResourceStatisticIndex_ArrayResource].getSummary(), numberTimeIntervals);
                             output << " aras ";
@@ -42,6 +42,12 @@ namespace ramses::internal
         statResourcesNumber.reset();
         statResourcesLoadedFromFileNumber.reset();
         statResourcesLoadedFromFileSize.reset();
+
+        for (size_t lane = 0; lane < ESendLaneStatisticIndex_NumIndices; lane++)
+        {
+            statSendQueueMaxDepth[lane].reset();
+            statSendQueueMaxWaitTime[lane].reset();
+        }
     }
 
     void StatisticCollectionFramework::resetSummaries()
@@ -55,6 +61,12 @@ namespace ramses::internal
         statResourcesNumber.getSummary().reset();
         statResourcesLoadedFromFileNumber.getSummary().reset();
         statResourcesLoadedFromFileSize.getSummary().reset();
+
+        for (size_t lane = 0; lane < ESendLaneStatisticIndex_NumIndices; lane++)
+        {
+            statSendQueueMaxDepth[lane].getSummary().reset();
+            statSendQueueMaxWaitTime[lane].getSummary().reset();
+        }
     }
 
     void StatisticCollectionFramework::nextTimeInterval()
@@ -71,6 +83,12 @@ namespace ramses::internal
         statResourcesNumber.incCounter(resourcesCreated);
         statResourcesNumber.decCounter(resourcesDestroyed);
         statResourcesNumber.updateSummary();
+
+        for (size_t lane = 0; lane < ESendLaneStatisticIndex_NumIndices; lane++)
+        {
+            statSendQueueMaxDepth[lane].updateSummaryAndResetCounter();
+            statSendQueueMaxWaitTime[lane].updateSummaryAndResetCounter();
+        }
     }
 
     void StatisticCollectionScene::reset()
@@ -88,6 +106,9 @@ namespace ramses::internal
         statSceneUpdatesGeneratedPackets.reset();
         statSceneUpdatesGeneratedSize.reset();
         statMaximumSizeSingleSceneUpdate.reset();
+        statSceneActionsCompressedInputSize.reset();
+        statSceneActionsCompressedOutputSize.reset();
+        statSceneActionsCompressionTime.reset();
 
         for (size_t type = 0; type < EResourceStatisticIndex_NumIndices; type++)
         {
@@ -112,6 +133,9 @@ namespace ramses::internal
         statSceneUpdatesGeneratedPackets.getSummary().reset();
         statSceneUpdatesGeneratedSize.getSummary().reset();
         statMaximumSizeSingleSceneUpdate.getSummary().reset();
+        statSceneActionsCompressedInputSize.getSummary().reset();
+        statSceneActionsCompressedOutputSize.getSummary().reset();
+        statSceneActionsCompressionTime.getSummary().reset();
         for (size_t type = 0; type < EResourceStatisticIndex_NumIndices; type++)
         {
             statResourceCount[type].getSummary().reset();
@@ -137,6 +161,9 @@ namespace ramses::internal
         statSceneUpdatesGeneratedSize.updateSummaryAndResetCounter();
 
         statMaximumSizeSingleSceneUpdate.updateSummaryAndResetCounter();
+        statSceneActionsCompressedInputSize.updateSummaryAndResetCounter();
+        statSceneActionsCompressedOutputSize.updateSummaryAndResetCounter();
+        statSceneActionsCompressionTime.updateSummaryAndResetCounter();
 
         statObjectsCount.incCounter(objectsCreated);
         statObjectsCount.decCounter(objectsDestroyed);
@@ -96,6 +96,7 @@ namespace ramses::internal
         void incCounter(DataType increment)
         {
             m_counter += increment;
+            m_total.fetch_add(increment, std::memory_order_relaxed);
         }
 
         void decCounter(DataType decrement)
@@ -120,6 +121,12 @@ namespace ramses::internal
             return m_counter.load();
         }
 
+        // sum of all increments since construction, not affected by time intervals or reset (used for metrics export)
+        [[nodiscard]] uint64_t getTotalValue() const
+        {
+            return m_total.load(std::memory_order_relaxed);
+        }
+
         void reset()
         {
             m_counter = 0;
@@ -145,6 +152,7 @@ namespace ramses::internal
 
     private:
         std::atomic<DataType> m_counter;
+        std::atomic<uint64_t> m_total{0u};
         SummaryType           m_summary;
     };
 
@@ -163,6 +171,15 @@ namespace ramses::internal
         uint32_t m_numberTimeIntervalsSinceLastSummaryReset{0u};
     };
 
+    enum ESendLaneStatisticIndex : std::size_t // deliberately not enum class, supposed to be implicitly convertible
+    {
+        ESendLaneStatisticIndex_Control,
+        ESendLaneStatisticIndex_Scene,
+        ESendLaneStatisticIndex_Bulk,
+
+        ESendLaneStatisticIndex_NumIndices
+    };
+
     class StatisticCollectionFramework : public StatisticCollection
     {
     public:
@@ -177,6 +194,10 @@ namespace ramses::internal
         StatisticEntry<uint32_t, SummaryEntry> statResourcesNumber; //updated by values of statResourcesCreated and statResourcesDestroyed
         StatisticEntry<uint32_t, SummaryEntry> statResourcesLoadedFromFileNumber;
         StatisticEntry<uint32_t, SummaryEntry> statResourcesLoadedFromFileSize;
+
+        // per send lane of the communication system, maximum within time interval
+        std::array<StatisticEntry<uint32_t, SummaryEntry>, ESendLaneStatisticIndex_NumIndices> statSendQueueMaxDepth;
+        std::array<StatisticEntry<uint32_t, SummaryEntry>, ESendLaneStatisticIndex_NumIndices> statSendQueueMaxWaitTime; // in microseconds
     };
 
     enum EResourceStatisticIndex : std::size_t // deliberately not enum class, supposed to be implicitly convertible
@@ -209,6 +230,9 @@ namespace ramses::internal
         StatisticEntry<uint32_t, SummaryEntry> statSceneUpdatesGeneratedPackets;
         StatisticEntry<uint32_t, SummaryEntry> statSceneUpdatesGeneratedSize;
         StatisticEntry<uint64_t, FirstFiveElements> statMaximumSizeSingleSceneUpdate;
+        StatisticEntry<uint32_t, SummaryEntry> statSceneActionsCompressedInputSize;
+        StatisticEntry<uint32_t, SummaryEntry> statSceneActionsCompressedOutputSize;
+        StatisticEntry<uint32_t, SummaryEntry> statSceneActionsCompressionTime; // in microseconds
 
         std::array<StatisticEntry<uint64_t, SummaryEntry>, EResourceStatisticIndex_NumIndices> statResourceCount;
         std::array<StatisticEntry<uint64_t, SummaryEntry>, EResourceStatisticIndex_NumIndices> statResourceAvgSize;
@@ -69,5 +69,58 @@ namespace ramses::internal
 
             return plainBuffer;
         }
+
+        bool compress(absl::Span<const std::byte> plainData, std::vector<std::byte>& compressedData, CompressionLevel level)
+        {
+            const int plainSize = static_cast<int>(plainData.size());
+            if (plainSize == 0)
+                return false;
+
+            compressedData.resize(LZ4_compressBound(plainSize));
+            int realCompressedSize = 0;
+            if (level == CompressionLevel::Fast)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+                realCompressedSize = LZ4_compress_default(reinterpret_cast<const char*>(plainData.data()),
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+                    reinterpret_cast<char*>(compressedData.data()),
+                    plainSize,
+                    static_cast<int>(compressedData.size()));
+            }
+            else
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+                realCompressedSize = LZ4_compress_HC(reinterpret_cast<const char*>(plainData.data()),
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+                    reinterpret_cast<char*>(compressedData.data()),
+                    plainSize,
+                    static_cast<int>(compressedData.size()),
+                    LZ4HC_CLEVEL_DEFAULT);
+            }
+
+            if (realCompressedSize <= 0)
+            {
+                compressedData.clear();
+                return false;
+            }
+
+            compressedData.resize(static_cast<size_t>(realCompressedSize));
+            return true;
+        }
+
+        bool decompress(absl::Span<const std::byte> compressedData, absl::Span<std::byte> plainData)
+        {
+            if (compressedData.empty() || plainData.empty())
+                return false;
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+            const int bytesDecompressed = LZ4_decompress_safe(reinterpret_cast<const char*>(compressedData.data()),
+                                                              // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+                                                              reinterpret_cast<char*>(plainData.data()),
+                                                              static_cast<int>(compressedData.size()),
+                                                              static_cast<int>(plainData.size()));
+
+            return bytesDecompressed == static_cast<int>(plainData.size());
+        }
     }
 }
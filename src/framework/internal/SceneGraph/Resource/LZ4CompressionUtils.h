@@ -10,6 +10,9 @@
 
 #include "internal/PlatformAbstraction/Collections/HeapArray.h"
 #include "internal/SceneGraph/Resource/ResourceTypes.h"
+#include "absl/types/span.h"
+
+#include <vector>
 
 namespace ramses::internal
 {
@@ -23,6 +26,11 @@ namespace ramses::internal
 
         CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level);
         ResourceBlob decompress(const CompressedResourceBlob& compressedData, uint32_t uncompressedSize);
+
+        // raw variants used for data that is not owned by a resource (e.g. scene action blobs on the network path)
+        // compress returns false when data could not be compressed, decompress expects plainData to be sized to the exact uncompressed size
+        bool compress(absl::Span<const std::byte> plainData, std::vector<std::byte>& compressedData, CompressionLevel level);
+        bool decompress(absl::Span<const std::byte> compressedData, absl::Span<std::byte> plainData);
     }
 }
 
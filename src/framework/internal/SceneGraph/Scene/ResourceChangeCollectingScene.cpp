@@ -8,9 +8,31 @@
 
 #include "internal/SceneGraph/Scene/ResourceChangeCollectingScene.h"
 #include "internal/Core/Utils/MemoryPoolExplicit.h"
+#include "internal/SceneGraph/SceneAPI/Renderable.h"
+#include "internal/SceneGraph/SceneAPI/TextureSampler.h"
+#include "internal/SceneGraph/Scene/DataLayout.h"
+
+#include <cassert>
 
 namespace ramses::internal
 {
+    namespace
+    {
+        template <typename HANDLE>
+        uint32_t GetUsage(const std::vector<uint32_t>& usage, HANDLE handle)
+        {
+            return handle.asMemoryHandle() < usage.size() ? usage[handle.asMemoryHandle()] : 0u;
+        }
+
+        template <typename HANDLE>
+        uint32_t& GetUsageForUpdate(std::vector<uint32_t>& usage, HANDLE handle)
+        {
+            if (handle.asMemoryHandle() >= usage.size())
+                usage.resize(handle.asMemoryHandle() + 1u, 0u);
+            return usage[handle.asMemoryHandle()];
+        }
+    }
+
     ResourceChangeCollectingScene::ResourceChangeCollectingScene(const SceneInfo& sceneInfo)
         : TransformationCachedScene(sceneInfo)
     {
@@ -30,19 +52,36 @@ namespace ramses::internal
     {
         m_sceneResourceActions.clear();
         m_resourcesChanged = false;
+        m_resourcesWithChangedUsage.clear();
     }
 
+    bool ResourceChangeCollectingScene::isResourceInUse(const ResourceContentHash& hash) const
+    {
+        return m_resourceRefCounts.contains(hash);
+    }
+
+    const ResourceContentHashVector& ResourceChangeCollectingScene::getResourcesWithChangedUsage() const
+    {
+        return m_resourcesWithChangedUsage;
+    }
 
     void ResourceChangeCollectingScene::releaseRenderable(RenderableHandle renderableHandle)
     {
         m_resourcesChanged = true;
+        if (getRenderable(renderableHandle).visibilityMode != EVisibilityMode::Off)
+            updateRenderableResourceUsage(getRenderable(renderableHandle), false);
         TransformationCachedScene::releaseRenderable(renderableHandle);
-
     }
 
     void ResourceChangeCollectingScene::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
     {
         m_resourcesChanged = true;
+        if (getRenderable(renderableHandle).visibilityMode != EVisibilityMode::Off)
+        {
+            const DataInstanceHandle oldDataInstance = getRenderable(renderableHandle).dataInstances[slot];
+            updateDataInstanceUsage(newDataInstance, true);
+            updateDataInstanceUsage(oldDataInstance, false);
+        }
         TransformationCachedScene::setRenderableDataInstance(renderableHandle, slot, newDataInstance);
     }
 
@@ -50,7 +89,10 @@ namespace ramses::internal
     {
         auto oldVisibility = getRenderable(renderableHandle).visibilityMode;
         if (oldVisibility != visibility && (oldVisibility == EVisibilityMode::Off || visibility == EVisibilityMode::Off))
+        {
             m_resourcesChanged = true;
+            updateRenderableResourceUsage(getRenderable(renderableHandle), visibility != EVisibilityMode::Off);
+        }
 
         TransformationCachedScene::setRenderableVisibility(renderableHandle, visibility);
     }
@@ -58,21 +100,52 @@ namespace ramses::internal
     void ResourceChangeCollectingScene::setDataResource(DataInstanceHandle dataInstanceHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, uint32_t instancingDivisor, uint16_t offsetWithinElementInBytes, uint16_t stride)
     {
         m_resourcesChanged = true;
+        if (GetUsage(m_dataInstanceUsage, dataInstanceHandle) > 0u)
+        {
+            const ResourceContentHash oldHash = getDataResource(dataInstanceHandle, field).hash;
+            updateResourceRefCount(hash, true);
+            updateResourceRefCount(oldHash, false);
+        }
         TransformationCachedScene::setDataResource(dataInstanceHandle, field, hash, dataBuffer, instancingDivisor, offsetWithinElementInBytes, stride);
     }
 
     void ResourceChangeCollectingScene::setDataTextureSamplerHandle(DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle)
     {
         m_resourcesChanged = true;
+        if (GetUsage(m_dataInstanceUsage, containerHandle) > 0u)
+        {
+            const TextureSamplerHandle oldSamplerHandle = getDataTextureSamplerHandle(containerHandle, field);
+            updateTextureSamplerUsage(samplerHandle, true);
+            updateTextureSamplerUsage(oldSamplerHandle, false);
+        }
         TransformationCachedScene::setDataTextureSamplerHandle(containerHandle, field, samplerHandle);
     }
 
+    DataInstanceHandle ResourceChangeCollectingScene::allocateDataInstance(DataLayoutHandle finishedLayoutHandle, DataInstanceHandle instanceHandle)
+    {
+        const DataInstanceHandle newHandle = TransformationCachedScene::allocateDataInstance(finishedLayoutHandle, instanceHandle);
+        // renderables can refer to data instance before it is allocated
+        if (GetUsage(m_dataInstanceUsage, newHandle) > 0u)
+            updateDataInstanceResources(newHandle, true);
+        return newHandle;
+    }
+
+    void ResourceChangeCollectingScene::releaseDataInstance(DataInstanceHandle containerHandle)
+    {
+        if (GetUsage(m_dataInstanceUsage, containerHandle) > 0u)
+            updateDataInstanceResources(containerHandle, false);
+        TransformationCachedScene::releaseDataInstance(containerHandle);
+    }
+
     TextureSamplerHandle ResourceChangeCollectingScene::allocateTextureSampler(const TextureSampler& sampler, TextureSamplerHandle handle /*= TextureSamplerHandle::Invalid()*/)
     {
         if (sampler.textureResource.isValid())
             m_resourcesChanged = true;
 
-        return TransformationCachedScene::allocateTextureSampler(sampler, handle);
+        const TextureSamplerHandle newHandle = TransformationCachedScene::allocateTextureSampler(sampler, handle);
+        if (GetUsage(m_textureSamplerUsage, newHandle) > 0u)
+            updateResourceRefCount(sampler.textureResource, true);
+        return newHandle;
     }
 
     void ResourceChangeCollectingScene::releaseTextureSampler(TextureSamplerHandle handle)
@@ -80,6 +153,8 @@ namespace ramses::internal
         if (getTextureSampler(handle).textureResource.isValid())
             m_resourcesChanged = true;
 
+        if (GetUsage(m_textureSamplerUsage, handle) > 0u)
+            updateResourceRefCount(getTextureSampler(handle).textureResource, false);
         TransformationCachedScene::releaseTextureSampler(handle);
     }
 
@@ -87,12 +162,16 @@ namespace ramses::internal
     {
         if (dataSlot.attachedTexture.isValid())
             m_resourcesChanged = true;
+        updateResourceRefCount(dataSlot.attachedTexture, true);
         return TransformationCachedScene::allocateDataSlot(dataSlot, handle);
     }
 
     void ResourceChangeCollectingScene::setDataSlotTexture(DataSlotHandle providerHandle, const ResourceContentHash& texture)
     {
         m_resourcesChanged = true;
+        const ResourceContentHash oldTexture = getDataSlot(providerHandle).attachedTexture;
+        updateResourceRefCount(texture, true);
+        updateResourceRefCount(oldTexture, false);
         TransformationCachedScene::setDataSlotTexture(providerHandle, texture);
     }
 
@@ -102,6 +181,7 @@ namespace ramses::internal
         if (textureHash.isValid())
             m_resourcesChanged = true;
 
+        updateResourceRefCount(textureHash, false);
         TransformationCachedScene::releaseDataSlot(handle);
     }
 
@@ -181,4 +261,72 @@ namespace ramses::internal
         TransformationCachedScene::updateTextureBuffer(handle, mipLevel, x, y, width, height, data);
         m_sceneResourceActions.push_back({ handle.asMemoryHandle(), ESceneResourceAction_UpdateTextureBuffer });
     }
+
+    void ResourceChangeCollectingScene::updateRenderableResourceUsage(const Renderable& renderable, bool inUse)
+    {
+        for (auto type : { ERenderableDataSlotType_Geometry, ERenderableDataSlotType_Uniforms })
+            updateDataInstanceUsage(renderable.dataInstances[type], inUse);
+    }
+
+    void ResourceChangeCollectingScene::updateDataInstanceUsage(DataInstanceHandle dataInstance, bool inUse)
+    {
+        if (!dataInstance.isValid())
+            return;
+
+        // resources of data instance are counted once no matter how many renderables use it
+        uint32_t& usage = GetUsageForUpdate(m_dataInstanceUsage, dataInstance);
+        assert(inUse || usage > 0u);
+        const bool firstOrLastUse = inUse ? (usage++ == 0u) : (--usage == 0u);
+        if (firstOrLastUse && isDataInstanceAllocated(dataInstance))
+            updateDataInstanceResources(dataInstance, inUse);
+    }
+
+    void ResourceChangeCollectingScene::updateDataInstanceResources(DataInstanceHandle dataInstance, bool inUse)
+    {
+        const DataLayout& layout = getDataLayout(getLayoutOfDataInstance(dataInstance));
+        updateResourceRefCount(layout.getEffectHash(), inUse);
+
+        for (DataFieldHandle fieldHandle(0u); fieldHandle < layout.getFieldCount(); ++fieldHandle)
+        {
+            const EDataType fieldType = layout.getField(fieldHandle).dataType;
+            if (IsBufferDataType(fieldType))
+                updateResourceRefCount(getDataResource(dataInstance, fieldHandle).hash, inUse);
+            else if (IsTextureSamplerType(fieldType))
+                updateTextureSamplerUsage(getDataTextureSamplerHandle(dataInstance, fieldHandle), inUse);
+        }
+    }
+
+    void ResourceChangeCollectingScene::updateTextureSamplerUsage(TextureSamplerHandle sampler, bool inUse)
+    {
+        if (!sampler.isValid())
+            return;
+
+        uint32_t& usage = GetUsageForUpdate(m_textureSamplerUsage, sampler);
+        assert(inUse || usage > 0u);
+        const bool firstOrLastUse = inUse ? (usage++ == 0u) : (--usage == 0u);
+        if (firstOrLastUse && isTextureSamplerAllocated(sampler))
+            updateResourceRefCount(getTextureSampler(sampler).textureResource, inUse);
+    }
+
+    void ResourceChangeCollectingScene::updateResourceRefCount(const ResourceContentHash& hash, bool inUse)
+    {
+        if (!hash.isValid())
+            return;
+
+        if (inUse)
+        {
+            if (m_resourceRefCounts[hash]++ == 0u)
+                m_resourcesWithChangedUsage.push_back(hash);
+        }
+        else
+        {
+            uint32_t* refCount = m_resourceRefCounts.get(hash);
+            assert(refCount != nullptr && *refCount > 0u);
+            if (--(*refCount) == 0u)
+            {
+                m_resourceRefCounts.remove(hash);
+                m_resourcesWithChangedUsage.push_back(hash);
+            }
+        }
+    }
 }
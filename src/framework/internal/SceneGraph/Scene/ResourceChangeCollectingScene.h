@@ -10,6 +10,9 @@
 
 #include "internal/SceneGraph/Scene/TransformationCachedScene.h"
 #include "internal/SceneGraph/Scene/ResourceChanges.h"
+#include "internal/PlatformAbstraction/Collections/HashMap.h"
+
+#include <vector>
 
 namespace ramses::internal
 {
@@ -22,6 +25,12 @@ namespace ramses::internal
         [[nodiscard]] bool                                haveResourcesChanged() const;
         void                                resetResourceChanges();
 
+        // Client resources used by visible renderables or data slots, reference counted while scene is modified.
+        // Matches the set of resources collected by ResourceUtils::GetAllResourcesFromScene.
+        [[nodiscard]] bool                                isResourceInUse(const ResourceContentHash& hash) const;
+        // Resources which started or stopped being in use since last reset, can contain duplicates
+        [[nodiscard]] const ResourceContentHashVector&    getResourcesWithChangedUsage() const;
+
         // functions which affect client resources
         void                        releaseRenderable(RenderableHandle renderableHandle) override;
         void                        setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance) override;
@@ -30,6 +39,9 @@ namespace ramses::internal
         void                        setDataResource(DataInstanceHandle dataInstanceHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, uint32_t instancingDivisor, uint16_t offsetWithinElementInBytes, uint16_t stride) override;
         void                        setDataTextureSamplerHandle(DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle) override;
 
+        DataInstanceHandle          allocateDataInstance(DataLayoutHandle finishedLayoutHandle, DataInstanceHandle instanceHandle) override;
+        void                        releaseDataInstance(DataInstanceHandle containerHandle) override;
+
         TextureSamplerHandle        allocateTextureSampler(const TextureSampler& sampler, TextureSamplerHandle handle) override;
         void                        releaseTextureSampler(TextureSamplerHandle handle) override;
 
@@ -56,8 +68,19 @@ namespace ramses::internal
         void                        updateTextureBuffer(TextureBufferHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::byte* data) override;
 
     private:
+        void updateRenderableResourceUsage(const Renderable& renderable, bool inUse);
+        void updateDataInstanceUsage(DataInstanceHandle dataInstance, bool inUse);
+        void updateDataInstanceResources(DataInstanceHandle dataInstance, bool inUse);
+        void updateTextureSamplerUsage(TextureSamplerHandle sampler, bool inUse);
+        void updateResourceRefCount(const ResourceContentHash& hash, bool inUse);
 
         SceneResourceActionVector   m_sceneResourceActions;
         bool                        m_resourcesChanged = false;
+
+        // number of references from visible renderables per data instance and from used data instances per texture sampler
+        std::vector<uint32_t>       m_dataInstanceUsage;
+        std::vector<uint32_t>       m_textureSamplerUsage;
+        HashMap<ResourceContentHash, uint32_t> m_resourceRefCounts;
+        ResourceContentHashVector   m_resourcesWithChangedUsage;
     };
 }
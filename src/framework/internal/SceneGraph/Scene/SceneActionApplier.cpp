@@ -1328,6 +1328,16 @@ namespace ramses::internal
         }
     }
 
+    void SceneActionApplier::ApplyActionsOnScene(IScene& scene, const SceneActionCollection& actions, size_t firstAction, size_t numActions)
+    {
+        assert(firstAction + numActions <= actions.numberOfActions());
+        for (size_t i = firstAction; i < firstAction + numActions; ++i)
+        {
+            auto reader = actions[i];
+            ApplySingleActionOnScene(scene, reader);
+        }
+    }
+
     void SceneActionApplier::GetSceneSizeInformation(SceneActionCollection::SceneActionReader& action, SceneSizeInformation& sizeInfo)
     {
         action.read(sizeInfo.nodeCount);
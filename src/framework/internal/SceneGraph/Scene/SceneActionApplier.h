@@ -28,6 +28,8 @@ namespace ramses::internal
         using ResourceVector = std::vector<std::unique_ptr<IResource>>;
 
         static void ApplyActionsOnScene(IScene& scene, const SceneActionCollection& actions);
+        // applies actions [firstAction, firstAction + numActions), allows applying a collection over multiple calls
+        static void ApplyActionsOnScene(IScene& scene, const SceneActionCollection& actions, size_t firstAction, size_t numActions);
 
     private:
         static void GetSceneSizeInformation(SceneActionCollection::SceneActionReader& action, SceneSizeInformation& sizeInfo);
@@ -26,7 +26,7 @@ namespace ramses
         auto* fw = cli.add_option_group("Framework Options");
         auto* logger = cli.add_option_group("Logger Options");
 
-        std::map<std::string, EConnectionSystem> mapConn{{"tcp", EConnectionSystem::TCP}, {"off", EConnectionSystem::Off}};
+        std::map<std::string, EConnectionSystem> mapConn{{"tcp", EConnectionSystem::TCP}, {"shm", EConnectionSystem::SharedMemory}, {"off", EConnectionSystem::Off}};
         fw->add_option_function<EConnectionSystem>(
             "--connection", [&](const EConnectionSystem value) { config.setConnectionSystem(value); }, "Connection system")
             ->transform(CLI::CheckedTransformer(mapConn, CLI::ignore_case));
@@ -63,6 +63,15 @@ namespace ramses
                 config.setConnectionKeepaliveSettings(value.first, value.second);
             },
             "TCP keepalive settings in milliseconds. 1st value: interval, 2nd value: timeout");
+        fw->add_option_function<uint32_t>(
+            "--tcp-compress-actions", [&](uint32_t threshold) { config.setSceneActionCompressionThresholdForTCPCommunication(threshold); },
+            "Compress scene actions sent over TCP starting at given size in bytes (0 disables compression)");
+
+        // shared memory options
+        fw->add_option_function<std::string>(
+            "--shm-dir", [&](const std::string& dir) { config.setSocketDirectoryForSharedMemoryCommunication(dir); }, "Socket directory for shared memory connection");
+        fw->add_option_function<uint32_t>(
+            "--shm-ring-size", [&](uint32_t size) { config.setRingBufferSizeForSharedMemoryCommunication(size); }, "Shared memory ring buffer size in bytes");
 
         // Logger options
         logger->add_option_function<std::chrono::seconds>(
@@ -136,6 +136,20 @@ namespace ramses
         return status;
     }
 
+    bool DisplayConfig::setAsyncEffectUploadThreadCount(uint32_t threadCount)
+    {
+        const auto status = m_impl->setAsyncEffectUploadThreadCount(threadCount);
+        LOG_HL_RENDERER_API1(status, threadCount);
+        return status;
+    }
+
+    bool DisplayConfig::setEffectPrewarmingEnabled(bool enabled)
+    {
+        const auto status = m_impl->setEffectPrewarmingEnabled(enabled);
+        LOG_HL_RENDERER_API1(status, enabled);
+        return status;
+    }
+
     void* DisplayConfig::getAndroidNativeWindow() const
     {
         return m_impl->getAndroidNativeWindow();
@@ -211,6 +211,23 @@ namespace ramses::internal
         return true;
     }
 
+    bool DisplayConfigImpl::setAsyncEffectUploadThreadCount(uint32_t threadCount)
+    {
+        if (threadCount == 0)
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "DisplayConfig::setAsyncEffectUploadThreadCount failed - threadCount cannot be 0!");
+            return false;
+        }
+        m_internalConfig.setAsyncEffectUploadThreadCount(threadCount);
+        return true;
+    }
+
+    bool DisplayConfigImpl::setEffectPrewarmingEnabled(bool enabled)
+    {
+        m_internalConfig.setEffectPrewarmingEnabled(enabled);
+        return true;
+    }
+
     bool DisplayConfigImpl::setWaylandEmbeddedCompositingSocketGroup(std::string_view groupname)
     {
         m_internalConfig.setWaylandEmbeddedCompositingSocketGroup(groupname);
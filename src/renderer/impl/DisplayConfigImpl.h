@@ -56,6 +56,8 @@ namespace ramses::internal
         [[nodiscard]] bool setWindowsWindowHandle(void* hwnd);
         [[nodiscard]] void*    getWindowsWindowHandle() const;
         [[nodiscard]] bool setAsyncEffectUploadEnabled(bool enabled);
+        [[nodiscard]] bool setAsyncEffectUploadThreadCount(uint32_t threadCount);
+        [[nodiscard]] bool setEffectPrewarmingEnabled(bool enabled);
 
         [[nodiscard]] bool setWaylandEmbeddedCompositingSocketGroup(std::string_view groupname);
         [[nodiscard]] std::string_view getWaylandSocketEmbeddedGroup() const;
@@ -217,10 +217,10 @@ namespace ramses
         return status;
     }
 
-    bool RamsesRenderer::setFrameTimerLimits(uint64_t limitForSceneResourcesUpload, uint64_t limitForClientResourcesUpload, uint64_t limitForOffscreenBufferRender)
+    bool RamsesRenderer::setFrameTimerLimits(uint64_t limitForSceneResourcesUpload, uint64_t limitForClientResourcesUpload, uint64_t limitForOffscreenBufferRender, uint64_t limitForSceneActionsApply)
     {
-        const bool status = m_impl->setFrameTimerLimits(limitForSceneResourcesUpload, limitForClientResourcesUpload, limitForOffscreenBufferRender);
-        LOG_HL_RENDERER_API3(status, limitForSceneResourcesUpload, limitForClientResourcesUpload, limitForOffscreenBufferRender);
+        const bool status = m_impl->setFrameTimerLimits(limitForSceneResourcesUpload, limitForClientResourcesUpload, limitForOffscreenBufferRender, limitForSceneActionsApply);
+        LOG_HL_RENDERER_API4(status, limitForSceneResourcesUpload, limitForClientResourcesUpload, limitForOffscreenBufferRender, limitForSceneActionsApply);
         return status;
     }
 
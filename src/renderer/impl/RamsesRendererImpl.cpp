@@ -40,7 +40,7 @@ namespace ramses::internal
         , m_binaryShaderCache(config.impl().getBinaryShaderCache() ? new BinaryShaderCacheProxy(*(config.impl().getBinaryShaderCache())) : nullptr)
         , m_rendererFrameworkLogic(framework.getScenegraphComponent(), m_rendererCommandBuffer, framework.getFrameworkLock())
         , m_threadWatchdog(framework.getThreadWatchdogConfig(), ERamsesThreadIdentifier::Renderer)
-        , m_displayDispatcher{ std::make_unique<DisplayDispatcher>(std::make_unique<PlatformFactory>(), config.impl().getInternalRendererConfig(), m_rendererFrameworkLogic, m_threadWatchdog) }
+        , m_displayDispatcher{ std::make_unique<DisplayDispatcher>(std::make_unique<PlatformFactory>(), config.impl().getInternalRendererConfig(), m_rendererFrameworkLogic, m_threadWatchdog, &framework.getMetricsRegistry()) }
         , m_systemCompositorEnabled(config.impl().getInternalRendererConfig().getSystemCompositorControlEnabled())
         , m_loopMode(ELoopMode::UpdateAndRender)
         , m_rendererLoopThreadType(ERendererLoopThreadType_Undefined)
@@ -533,6 +533,8 @@ namespace ramses::internal
                 break;
             case ERendererEventType::FrameTimingReport:
                 rendererEventHandler.renderThreadLoopTimings(displayId_t{ event.displayHandle.asMemoryHandle() }, event.frameTimings.maximumLoopTimeWithinPeriod, event.frameTimings.averageLoopTimeWithinPeriod);
+                rendererEventHandler.renderThreadLoopTimingPercentiles(displayId_t{ event.displayHandle.asMemoryHandle() },
+                    event.frameTimings.percentile50LoopTimeWithinPeriod, event.frameTimings.percentile90LoopTimeWithinPeriod, event.frameTimings.percentile99LoopTimeWithinPeriod);
                 break;
             case ERendererEventType::Invalid:
             case ERendererEventType::ScenePublished:
@@ -668,9 +670,9 @@ namespace ramses::internal
         return m_loopMode;
     }
 
-    bool RamsesRendererImpl::setFrameTimerLimits(uint64_t limitForSceneResourcesUpload, uint64_t limitForClientResourcesUpload, uint64_t limitForOffscreenBufferRender)
+    bool RamsesRendererImpl::setFrameTimerLimits(uint64_t limitForSceneResourcesUpload, uint64_t limitForClientResourcesUpload, uint64_t limitForOffscreenBufferRender, uint64_t limitForSceneActionsApply)
     {
-        m_pendingRendererCommands.push_back(RendererCommand::SetLimits_FrameBudgets{ limitForSceneResourcesUpload, limitForClientResourcesUpload, limitForOffscreenBufferRender });
+        m_pendingRendererCommands.push_back(RendererCommand::SetLimits_FrameBudgets{ limitForSceneResourcesUpload, limitForClientResourcesUpload, limitForOffscreenBufferRender, limitForSceneActionsApply });
         return true;
     }
 
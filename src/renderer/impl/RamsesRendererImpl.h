@@ -107,7 +107,7 @@ namespace ramses::internal
         float getFramerateLimit(displayId_t displayId) const;
         bool setLoopMode(ELoopMode loopMode);
         ELoopMode getLoopMode() const;
-        bool setFrameTimerLimits(uint64_t limitForSceneResourcesUpload, uint64_t limitForClientResourcesUpload, uint64_t limitForOffscreenBufferRender);
+        bool setFrameTimerLimits(uint64_t limitForSceneResourcesUpload, uint64_t limitForClientResourcesUpload, uint64_t limitForOffscreenBufferRender, uint64_t limitForSceneActionsApply);
         bool setExternallyOwnedWindowSize(displayId_t display, uint32_t width, uint32_t height);
 
         bool setPendingFlushLimits(uint32_t forceApplyFlushLimit, uint32_t forceUnsubscribeSceneLimit);
@@ -81,6 +81,18 @@ namespace ramses
         return m_impl->getRenderThreadLoopTimingReportingPeriod();
     }
 
+    bool RendererConfig::setFramePacingMode(EFramePacingMode mode)
+    {
+        const auto status = m_impl->setFramePacingMode(mode);
+        LOG_HL_RENDERER_API1(status, mode);
+        return status;
+    }
+
+    EFramePacingMode RendererConfig::getFramePacingMode() const
+    {
+        return m_impl->getFramePacingMode();
+    }
+
     internal::RendererConfigImpl& RendererConfig::impl()
     {
         return *m_impl;
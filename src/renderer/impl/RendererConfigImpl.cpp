@@ -57,6 +57,17 @@ namespace ramses::internal
         return m_internalConfig.getRenderThreadLoopTimingReportingPeriod();
     }
 
+    bool RendererConfigImpl::setFramePacingMode(EFramePacingMode mode)
+    {
+        m_internalConfig.setFramePacingMode(mode);
+        return true;
+    }
+
+    EFramePacingMode RendererConfigImpl::getFramePacingMode() const
+    {
+        return m_internalConfig.getFramePacingMode();
+    }
+
     const ramses::internal::RendererConfig& RendererConfigImpl::getInternalRendererConfig() const
     {
         return m_internalConfig;
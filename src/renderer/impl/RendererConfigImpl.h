@@ -35,6 +35,9 @@ namespace ramses::internal
         [[nodiscard]] bool setRenderThreadLoopTimingReportingPeriod(std::chrono::milliseconds period);
         [[nodiscard]] std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
 
+        [[nodiscard]] bool setFramePacingMode(EFramePacingMode mode);
+        [[nodiscard]] EFramePacingMode getFramePacingMode() const;
+
         //impl methods
         [[nodiscard]] const ramses::internal::RendererConfig& getInternalRendererConfig() const;
 
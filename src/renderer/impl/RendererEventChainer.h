@@ -88,6 +88,12 @@ namespace ramses::internal
             m_handler2.renderThreadLoopTimings(displayId, maximumLoopTime, averageLooptime);
         }
 
+        void renderThreadLoopTimingPercentiles(displayId_t displayId, std::chrono::microseconds percentile50LoopTime, std::chrono::microseconds percentile90LoopTime, std::chrono::microseconds percentile99LoopTime) override
+        {
+            m_handler1.renderThreadLoopTimingPercentiles(displayId, percentile50LoopTime, percentile90LoopTime, percentile99LoopTime);
+            m_handler2.renderThreadLoopTimingPercentiles(displayId, percentile50LoopTime, percentile90LoopTime, percentile99LoopTime);
+        }
+
         void externalBufferCreated(displayId_t displayId, externalBufferId_t externalBufferId, uint32_t textureGlId, ERendererEventResult result) override
         {
             m_handler1.externalBufferCreated(displayId, externalBufferId, textureGlId, result);
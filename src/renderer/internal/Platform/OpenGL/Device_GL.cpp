@@ -141,6 +141,7 @@ namespace ramses::internal
 #endif
 
         m_limits.logLimits();
+        invalidateStateCache();
 
         return true;
     }
@@ -338,11 +339,11 @@ namespace ramses::internal
         glViewport(x, y, static_cast<GLsizei>(std::min(width, m_limits.getMaxViewportWidth())), static_cast<GLsizei>(std::min(height, m_limits.getMaxViewportHeight())));
     }
 
-    GLHandle Device_GL::createTexture(uint32_t width, uint32_t height, EPixelStorageFormat storageFormat, uint32_t sampleCount) const
+    GLHandle Device_GL::createTexture(uint32_t width, uint32_t height, EPixelStorageFormat storageFormat, uint32_t sampleCount)
     {
         LOG_DEBUG(CONTEXT_RENDERER, "Device_GL::createTexture:  creating a new texture (texture render target)");
 
-        const GLHandle texID = GenerateAndBindTexture((sampleCount) != 0u ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D);
+        const GLHandle texID = generateAndBindTexture((sampleCount) != 0u ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D);
         GLTextureInfo texInfo;
         fillGLInternalTextureInfo((sampleCount) != 0u ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D,
                                   width,
@@ -499,7 +500,7 @@ namespace ramses::internal
 
     DeviceResourceHandle Device_GL::allocateTexture2D(uint32_t width, uint32_t height, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, uint32_t mipLevelCount, uint32_t totalSizeInBytes)
     {
-        const GLHandle texID = GenerateAndBindTexture(GL_TEXTURE_2D);
+        const GLHandle texID = generateAndBindTexture(GL_TEXTURE_2D);
         GLTextureInfo texInfo;
         fillGLInternalTextureInfo(GL_TEXTURE_2D, width, height, 1u, textureFormat, swizzle, texInfo);
         AllocateTextureStorage(texInfo, mipLevelCount);
@@ -509,7 +510,7 @@ namespace ramses::internal
 
     DeviceResourceHandle Device_GL::allocateTexture3D(uint32_t width, uint32_t height, uint32_t depth, EPixelStorageFormat textureFormat, uint32_t mipLevelCount, uint32_t totalSizeInBytes)
     {
-        const GLHandle texID = GenerateAndBindTexture(GL_TEXTURE_3D);
+        const GLHandle texID = generateAndBindTexture(GL_TEXTURE_3D);
         GLTextureInfo texInfo;
         fillGLInternalTextureInfo(GL_TEXTURE_3D, width, height, depth, textureFormat, DefaultTextureSwizzleArray, texInfo);
         AllocateTextureStorage(texInfo, mipLevelCount);
@@ -519,7 +520,7 @@ namespace ramses::internal
 
     DeviceResourceHandle Device_GL::allocateTextureCube(uint32_t faceSize, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, uint32_t mipLevelCount, uint32_t totalSizeInBytes)
     {
-        const GLHandle texID = GenerateAndBindTexture(GL_TEXTURE_CUBE_MAP);
+        const GLHandle texID = generateAndBindTexture(GL_TEXTURE_CUBE_MAP);
         GLTextureInfo texInfo;
         fillGLInternalTextureInfo(GL_TEXTURE_CUBE_MAP, faceSize, faceSize, 1u, textureFormat, swizzle, texInfo);
         AllocateTextureStorage(texInfo, mipLevelCount);
@@ -532,7 +533,7 @@ namespace ramses::internal
         if (m_limits.isExternalTextureExtensionSupported())
         {
             const auto textureTarget = GL_TEXTURE_EXTERNAL_OES;
-            const GLHandle texID = GenerateAndBindTexture(textureTarget);
+            const GLHandle texID = generateAndBindTexture(textureTarget);
             GLTextureInfo texInfo;
             fillGLInternalTextureInfo(textureTarget, 0u, 0u, 1u, EPixelStorageFormat::RGBA8, {}, texInfo);
 
@@ -551,6 +552,7 @@ namespace ramses::internal
     {
         const auto& gpuResource = m_resourceMapper.getResourceAs<TextureGPUResource_GL>(handle);
         glBindTexture(gpuResource.m_textureInfo.target, gpuResource.getGPUAddress());
+        trackTextureBinding(gpuResource.m_textureInfo.target, gpuResource.getGPUAddress());
     }
 
     void Device_GL::generateMipmaps(DeviceResourceHandle handle)
@@ -591,6 +593,7 @@ namespace ramses::internal
         LOG_DEBUG(CONTEXT_RENDERER, "Device_GL::uploadStreamTexture2D:  texid: " << texID << " width: " << width << " height: " << height << " format: " << EnumToString(format) << " textureSwizzle: " << EnumToString(swizzle[0]) << "," << EnumToString(swizzle[1]) << "," << EnumToString(swizzle[2]) << "," << EnumToString(swizzle[3]));
 
         glBindTexture(GL_TEXTURE_2D, texID);
+        trackTextureBinding(GL_TEXTURE_2D, texID);
 
         GLTextureInfo texInfo;
         fillGLInternalTextureInfo(GL_TEXTURE_2D, width, height, 1u, format, swizzle, texInfo);
@@ -607,6 +610,23 @@ namespace ramses::internal
         return handle;
     }
 
+    void Device_GL::updateStreamTexture2D(DeviceResourceHandle handle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t stride, EPixelStorageFormat format, const std::byte* data)
+    {
+        const GLHandle texID = getTextureAddress(handle);
+        assert(texID != InvalidGLHandle);
+        assert(data != nullptr);
+        LOG_TRACE(CONTEXT_RENDERER, "Device_GL::updateStreamTexture2D:  texid: " << texID << " x: " << x << " y: " << y << " width: " << width << " height: " << height << " stride: " << stride);
+
+        glBindTexture(GL_TEXTURE_2D, texID);
+        trackTextureBinding(GL_TEXTURE_2D, texID);
+
+        // texture info only used to determine upload format and validate region, swizzle is kept from last full upload
+        GLTextureInfo texInfo;
+        fillGLInternalTextureInfo(GL_TEXTURE_2D, stride, y + height, 1u, format, DefaultTextureSwizzleArray, texInfo);
+        assert(!texInfo.uploadParams.compressed);
+        UploadTextureMipMapData(0u, x, y, 0u, width, height, 1u, texInfo, data, 0u, stride);
+    }
+
     void Device_GL::fillGLInternalTextureInfo(GLenum target, uint32_t width, uint32_t height, uint32_t depth, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, GLTextureInfo& glTexInfoOut) const
     {
         glTexInfoOut.target = target;
@@ -786,7 +806,10 @@ namespace ramses::internal
         if(m_deviceExtension == nullptr)
             return {};
 
-        return m_deviceExtension->createDmaRenderBuffer(width, height, fourccFormat, usageFlags, modifiers);
+        const auto handle = m_deviceExtension->createDmaRenderBuffer(width, height, fourccFormat, usageFlags, modifiers);
+        // extension binds created texture to active texture unit
+        trackTextureBinding(0u, UnknownGLHandle);
+        return handle;
     }
 
     int Device_GL::getDmaRenderBufferFD(DeviceResourceHandle handle)
@@ -809,6 +832,7 @@ namespace ramses::internal
         if(m_deviceExtension == nullptr)
             return;
 
+        untrackTexture(m_resourceMapper.getResource(handle).getGPUAddress());
         m_deviceExtension->destroyDmaRenderBuffer(handle);
     }
 
@@ -819,6 +843,7 @@ namespace ramses::internal
         if (ERenderBufferAccessMode::ReadWrite == resource.getAccessMode())
         {
             glDeleteTextures(1, &glAddress);
+            untrackTexture(glAddress);
         }
         else if (ERenderBufferAccessMode::WriteOnly == resource.getAccessMode())
         {
@@ -908,11 +933,22 @@ namespace ramses::internal
         assert(static_cast<uint32_t>(textureSlot) < m_limits.getMaximumTextureUnits());
         const GLHandle glAddress = m_resourceMapper.getResource(handle).getGPUAddress();
         glBindSampler(textureSlot, glAddress);
+        ++m_stateChanges.issued;
+
+        m_textureUnitStates[static_cast<uint32_t>(textureSlot)].sampler = glAddress;
     }
 
     void Device_GL::activateTextureSamplerObject(const TextureSamplerStates& samplerStates, DataFieldHandle field)
     {
         const auto samplerStatesHash = samplerStates.hash();
+        const TextureSlot textureSlot = m_activeShader->getTextureSlot(field).slot;
+        auto& unitState = m_textureUnitStates[static_cast<uint32_t>(textureSlot)];
+        if (unitState.sampler != UnknownGLHandle && unitState.samplerStatesHash == samplerStatesHash)
+        {
+            ++m_stateChanges.skipped;
+            return;
+        }
+
         auto it = m_textureSamplerObjectsCache.find(samplerStatesHash);
         if (it == m_textureSamplerObjectsCache.end())
         {
@@ -922,6 +958,7 @@ namespace ramses::internal
         }
 
         activateTextureSampler(it->second, field);
+        unitState.samplerStatesHash = samplerStatesHash;
     }
 
     bool Device_GL::allBuffersHaveTheSameSize(const DeviceHandleVector& renderBuffers) const
@@ -1062,13 +1099,13 @@ namespace ramses::internal
 
     void Device_GL::activateRenderTarget(DeviceResourceHandle handle)
     {
-        const auto renderTargetPair = std::find_if(m_pairedRenderTargets.cbegin(), m_pairedRenderTargets.cend(), [handle](const RenderTargetPair& rtPair) -> bool {return rtPair.renderTargets[0] == handle; });
+        const auto renderTargetPair = m_pairedRenderTargets.find(handle);
 
         const GPUResource* rtResource = nullptr;
         if (renderTargetPair != m_pairedRenderTargets.cend())
         {
-            const uint8_t writingIndex = (renderTargetPair->readingIndex + 1) % 2;
-            rtResource = &m_resourceMapper.getResource(renderTargetPair->renderTargets[writingIndex]);
+            const uint8_t writingIndex = (renderTargetPair->second.readingIndex + 1) % 2;
+            rtResource = &m_resourceMapper.getResource(renderTargetPair->second.renderTargets[writingIndex]);
         }
         else
         {
@@ -1081,29 +1118,34 @@ namespace ramses::internal
 
     void Device_GL::pairRenderTargetsForDoubleBuffering(const std::array<DeviceResourceHandle, 2>& renderTargets, const std::array<DeviceResourceHandle, 2>& colorBuffers)
     {
-        m_pairedRenderTargets.push_back({ { renderTargets[0], renderTargets[1] },{ colorBuffers[0], colorBuffers[1] }, 0u });
+        const auto inserted = m_pairedRenderTargets.emplace(renderTargets[0], RenderTargetPair{ { renderTargets[0], renderTargets[1] },{ colorBuffers[0], colorBuffers[1] }, 0u });
+        assert(inserted.second);
+        // pointer to node stays valid until pair is erased
+        m_pairedColorBuffers[colorBuffers[0]] = &inserted.first->second;
     }
 
     void Device_GL::unpairRenderTargets(DeviceResourceHandle renderTarget)
     {
-        auto renderTargetPair = std::find_if(m_pairedRenderTargets.begin(), m_pairedRenderTargets.end(), [renderTarget](const RenderTargetPair& rtPair) -> bool {return rtPair.renderTargets[0] == renderTarget; });
+        auto renderTargetPair = m_pairedRenderTargets.find(renderTarget);
         assert(renderTargetPair != m_pairedRenderTargets.end());
+        m_pairedColorBuffers.erase(renderTargetPair->second.colorBuffers[0]);
         m_pairedRenderTargets.erase(renderTargetPair);
     }
 
     void Device_GL::swapDoubleBufferedRenderTarget(DeviceResourceHandle renderTarget)
     {
-        auto renderTargetPair = std::find_if(m_pairedRenderTargets.begin(), m_pairedRenderTargets.end(), [renderTarget](const RenderTargetPair& rtPair) -> bool {return rtPair.renderTargets[0] == renderTarget; });
+        auto renderTargetPair = m_pairedRenderTargets.find(renderTarget);
         assert(renderTargetPair != m_pairedRenderTargets.end());
-        renderTargetPair->readingIndex = (renderTargetPair->readingIndex + 1) % 2;
+        renderTargetPair->second.readingIndex = (renderTargetPair->second.readingIndex + 1) % 2;
     }
 
-    GLHandle Device_GL::GenerateAndBindTexture(GLenum target)
+    GLHandle Device_GL::generateAndBindTexture(GLenum target)
     {
         GLHandle texID = InvalidGLHandle;
         glGenTextures(1, &texID);
         assert(texID != InvalidGLHandle);
         glBindTexture(target, texID);
+        trackTextureBinding(target, texID);
 
         return texID;
     }
@@ -1122,15 +1164,23 @@ namespace ramses::internal
         const auto& vertexBuffer = m_resourceMapper.getResource(handle);
         assert(dataSize <= vertexBuffer.getTotalSizeInBytes());
 
-        glBindVertexArray(0u); // make sure no VAO affected
-        glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer.getGPUAddress());
+        bindVertexArray(0u); // make sure no VAO affected
+        bindArrayBuffer(vertexBuffer.getGPUAddress());
         glBufferData(GL_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
     }
 
+    void Device_GL::updateVertexBufferData(DeviceResourceHandle handle, uint32_t offset, const std::byte* data, uint32_t dataSize)
+    {
+        updateBufferData(GL_ARRAY_BUFFER, m_resourceMapper.getResource(handle), offset, data, dataSize);
+    }
+
     void Device_GL::deleteVertexBuffer(DeviceResourceHandle handle)
     {
         const GLHandle resourceAddress = m_resourceMapper.getResource(handle).getGPUAddress();
         glDeleteBuffers(1, &resourceAddress);
+        // deleted buffer is unbound by GL
+        if (m_boundArrayBuffer == resourceAddress)
+            m_boundArrayBuffer = 0u;
         m_resourceMapper.deleteResource(handle);
     }
 
@@ -1140,7 +1190,7 @@ namespace ramses::internal
 
         GLuint vertexArrayAddress = 0u;
         glGenVertexArrays(1, &vertexArrayAddress);
-        glBindVertexArray(vertexArrayAddress);
+        bindVertexArray(vertexArrayAddress);
 
         if (vertexArrayInfo.indexBuffer.isValid())
         {
@@ -1170,16 +1220,16 @@ namespace ramses::internal
             const void* offsetAsPointer = reinterpret_cast<const void*>(offsetInBytes);
             const auto attributeNumComponents = static_cast<GLint>(EnumToNumComponents(attributeDataType));
 
-            glBindBuffer(GL_ARRAY_BUFFER, arrayResource.getGPUAddress());
+            bindArrayBuffer(arrayResource.getGPUAddress());
             glEnableVertexAttribArray(vertexInputAddress.getValue());
             glVertexAttribPointer(vertexInputAddress.getValue(), attributeNumComponents, GL_FLOAT, GL_FALSE, vb.stride, offsetAsPointer);
 
             glVertexAttribDivisor(vertexInputAddress.getValue(), vb.instancingDivisor);
         }
 
-        glBindVertexArray(0u);
+        bindVertexArray(0u);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0u);
-        glBindBuffer(GL_ARRAY_BUFFER, 0u);
+        bindArrayBuffer(0u);
 
         return m_resourceMapper.registerResource(std::make_unique<VertexArrayGPUResource>(vertexArrayAddress, vertexArrayInfo.indexBuffer));
     }
@@ -1188,7 +1238,7 @@ namespace ramses::internal
     {
         assert(handle.isValid());
         const auto& vertexArrayResource = m_resourceMapper.getResourceAs<VertexArrayGPUResource>(handle);
-        glBindVertexArray(vertexArrayResource.getGPUAddress());
+        bindVertexArray(vertexArrayResource.getGPUAddress());
 
         const auto indexBuffer = vertexArrayResource.getIndexBufferHandle();
         if (indexBuffer.isValid())
@@ -1210,6 +1260,9 @@ namespace ramses::internal
         const GPUResource& vertexArrayResource = m_resourceMapper.getResource(handle);
         const GLuint vertexArray = vertexArrayResource.getGPUAddress();
         glDeleteVertexArrays(1, &vertexArray);
+        // deleting bound VAO reverts binding to default VAO
+        if (m_boundVertexArray == vertexArray)
+            m_boundVertexArray = 0u;
 
         m_resourceMapper.deleteResource(handle);
     }
@@ -1229,11 +1282,36 @@ namespace ramses::internal
         const auto& indexBuffer = m_resourceMapper.getResource(handle);
         assert(dataSize <= indexBuffer.getTotalSizeInBytes());
 
-        glBindVertexArray(0u); // make sure no VAO affected
+        bindVertexArray(0u); // make sure no VAO affected
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer.getGPUAddress());
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
     }
 
+    void Device_GL::updateIndexBufferData(DeviceResourceHandle handle, uint32_t offset, const std::byte* data, uint32_t dataSize)
+    {
+        updateBufferData(GL_ELEMENT_ARRAY_BUFFER, m_resourceMapper.getResource(handle), offset, data, dataSize);
+    }
+
+    void Device_GL::updateBufferData(GLenum target, const GPUResource& buffer, uint32_t offset, const std::byte* data, uint32_t dataSize)
+    {
+        assert(offset + dataSize <= buffer.getTotalSizeInBytes());
+
+        bindVertexArray(0u); // make sure no VAO affected
+        if (target == GL_ARRAY_BUFFER)
+            bindArrayBuffer(buffer.getGPUAddress());
+        else
+            glBindBuffer(target, buffer.getGPUAddress());
+        if (offset == 0u && dataSize == buffer.getTotalSizeInBytes())
+        {
+            // re-specifying whole storage orphans the previous one if still in use by GPU, avoiding synchronization
+            glBufferData(target, dataSize, data, GL_DYNAMIC_DRAW);
+        }
+        else
+        {
+            glBufferSubData(target, offset, dataSize, data);
+        }
+    }
+
     void Device_GL::deleteIndexBuffer(DeviceResourceHandle handle)
     {
         const GLHandle resourceAddress = m_resourceMapper.getResource(handle).getGPUAddress();
@@ -1257,7 +1335,13 @@ namespace ramses::internal
 
     DeviceResourceHandle Device_GL::registerShader(std::unique_ptr<const GPUResource> shaderResource)
     {
-        return m_resourceMapper.registerResource(std::move(shaderResource));
+        const auto handle = m_resourceMapper.registerResource(std::move(shaderResource));
+        if (handle.isValid())
+        {
+            activateShader(handle);
+            m_activeShader->assignTextureSlots();
+        }
+        return handle;
     }
 
     DeviceResourceHandle Device_GL::uploadBinaryShader(const EffectResource& shader, const std::byte* binaryShaderData, uint32_t binaryShaderDataSize, BinaryShaderFormatID binaryShaderFormat)
@@ -1269,7 +1353,7 @@ namespace ramses::internal
         if (uploadSuccessful)
         {
             LOG_DEBUG(CONTEXT_SMOKETEST, "Device_GL::uploadShader: renderer successfully uploaded binary shader for effect " << shader.getName());
-            return m_resourceMapper.registerResource(std::make_unique<ShaderGPUResource_GL>(shader, programInfo));
+            return registerShader(std::make_unique<ShaderGPUResource_GL>(shader, programInfo));
         }
         LOG_INFO(CONTEXT_RENDERER, "Device_GL::uploadShader: renderer failed to upload binary shader for effect " << shader.getName() << ". Error was: " << debugErrorLog);
         return DeviceResourceHandle::Invalid();
@@ -1292,14 +1376,30 @@ namespace ramses::internal
             m_activeShader = nullptr;
         }
 
+        // To be safe, unbind the program so that it can be deleted
+        // Generally, resources should not be deleted while rendering
+        if (m_boundProgram != 0u)
+        {
+            glUseProgram(0);
+            m_boundProgram = 0u;
+        }
+
         m_resourceMapper.deleteResource(handle);
     }
 
     void Device_GL::activateShader(DeviceResourceHandle handle)
     {
         const auto& shaderProgramGL = m_resourceMapper.getResourceAs<ShaderGPUResource_GL>(handle);
-        glUseProgram(shaderProgramGL.getGPUAddress());
         m_activeShader = &shaderProgramGL;
+        if (m_boundProgram == shaderProgramGL.getGPUAddress())
+        {
+            ++m_stateChanges.skipped;
+            return;
+        }
+
+        glUseProgram(shaderProgramGL.getGPUAddress());
+        m_boundProgram = shaderProgramGL.getGPUAddress();
+        ++m_stateChanges.issued;
     }
 
     void Device_GL::deleteTexture(DeviceResourceHandle handle)
@@ -1307,6 +1407,7 @@ namespace ramses::internal
         const GPUResource& resource = m_resourceMapper.getResource(handle);
         const GLHandle glAddress = resource.getGPUAddress();
         glDeleteTextures(1, &glAddress);
+        untrackTexture(glAddress);
         m_resourceMapper.deleteResource(handle);
     }
 
@@ -1316,25 +1417,33 @@ namespace ramses::internal
         if (uniformLocation.isValid())
         {
             const TextureSlotInfo textureSlot = m_activeShader->getTextureSlot(field);
-
-            assert(static_cast<uint32_t>(textureSlot.slot) < m_limits.getMaximumTextureUnits());
-            glActiveTexture(GL_TEXTURE0 + textureSlot.slot);
-
-            const auto renderTargetPair = std::find_if(m_pairedRenderTargets.cbegin(), m_pairedRenderTargets.cend(), [handle](const RenderTargetPair& rtPair) -> bool {return rtPair.colorBuffers[0] == handle; });
+            const auto textureUnit = static_cast<uint32_t>(textureSlot.slot);
+            assert(textureUnit < m_limits.getMaximumTextureUnits());
 
             const GPUResource* resource = nullptr;
-            if (renderTargetPair != m_pairedRenderTargets.cend())
+            const auto renderTargetPair = m_pairedColorBuffers.find(handle);
+            if (renderTargetPair != m_pairedColorBuffers.cend())
             {
-                resource = &m_resourceMapper.getResource(renderTargetPair->colorBuffers[renderTargetPair->readingIndex]);
+                resource = &m_resourceMapper.getResource(renderTargetPair->second->colorBuffers[renderTargetPair->second->readingIndex]);
             }
             else
             {
                 resource = &m_resourceMapper.getResource(handle);
             }
 
+            // texture unit was assigned to sampler uniform when program was registered
             const GLenum target = TypesConversion_GL::GetTextureTargetFromTextureInputType(textureSlot.textureType);
+            const TextureUnitState& unitState = m_textureUnitStates[textureUnit];
+            if (unitState.target == target && unitState.texture == resource->getGPUAddress())
+            {
+                ++m_stateChanges.skipped;
+                return;
+            }
+
+            selectTextureUnit(textureUnit);
             glBindTexture(target, resource->getGPUAddress());
-            glUniform1i(uniformLocation.getValue(), textureSlot.slot);
+            trackTextureBinding(target, resource->getGPUAddress());
+            ++m_stateChanges.issued;
         }
         else
         {
@@ -1541,4 +1650,73 @@ namespace ramses::internal
     {
         glFlush();
     }
+
+    void Device_GL::invalidateStateCache()
+    {
+        m_textureUnitStates.assign(m_limits.getMaximumTextureUnits(), {});
+        m_activeTextureUnit = UnknownTextureUnit;
+        m_boundProgram = UnknownGLHandle;
+        m_boundVertexArray = UnknownGLHandle;
+        m_boundArrayBuffer = UnknownGLHandle;
+    }
+
+    void Device_GL::selectTextureUnit(uint32_t unit)
+    {
+        if (m_activeTextureUnit == unit)
+        {
+            ++m_stateChanges.skipped;
+            return;
+        }
+
+        glActiveTexture(GL_TEXTURE0 + unit);
+        m_activeTextureUnit = unit;
+        ++m_stateChanges.issued;
+    }
+
+    void Device_GL::trackTextureBinding(GLenum target, GLHandle texture)
+    {
+        // if active unit is unknown all units are unknown
+        if (m_activeTextureUnit != UnknownTextureUnit)
+        {
+            auto& unitState = m_textureUnitStates[m_activeTextureUnit];
+            unitState.target = target;
+            unitState.texture = texture;
+        }
+    }
+
+    void Device_GL::untrackTexture(GLHandle texture)
+    {
+        // deleted texture is unbound by GL and its name can be reused for new texture
+        for (auto& unitState : m_textureUnitStates)
+        {
+            if (unitState.texture == texture)
+                unitState.texture = UnknownGLHandle;
+        }
+    }
+
+    void Device_GL::bindVertexArray(GLHandle vertexArray)
+    {
+        if (m_boundVertexArray == vertexArray)
+        {
+            ++m_stateChanges.skipped;
+            return;
+        }
+
+        glBindVertexArray(vertexArray);
+        m_boundVertexArray = vertexArray;
+        ++m_stateChanges.issued;
+    }
+
+    void Device_GL::bindArrayBuffer(GLHandle buffer)
+    {
+        if (m_boundArrayBuffer == buffer)
+        {
+            ++m_stateChanges.skipped;
+            return;
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        m_boundArrayBuffer = buffer;
+        ++m_stateChanges.issued;
+    }
 }
@@ -16,6 +16,7 @@
 
 #include <unordered_map>
 #include <string>
+#include <limits>
 
 namespace ramses::internal
 {
@@ -69,6 +70,7 @@ namespace ramses::internal
 
         DeviceResourceHandle    allocateVertexBuffer  (uint32_t totalSizeInBytes) override;
         void                    uploadVertexBufferData(DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) override;
+        void                    updateVertexBufferData(DeviceResourceHandle handle, uint32_t offset, const std::byte* data, uint32_t dataSize) override;
         void                    deleteVertexBuffer    (DeviceResourceHandle handle) override;
 
         DeviceResourceHandle    allocateVertexArray   (const VertexArrayInfo& vertexArrayInfo) override;
@@ -77,6 +79,7 @@ namespace ramses::internal
 
         DeviceResourceHandle    allocateIndexBuffer   (EDataType dataType, uint32_t sizeInBytes) override;
         void                    uploadIndexBufferData (DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) override;
+        void                    updateIndexBufferData (DeviceResourceHandle handle, uint32_t offset, const std::byte* data, uint32_t dataSize) override;
         void                    deleteIndexBuffer     (DeviceResourceHandle handle) override;
 
         std::unique_ptr<const GPUResource> uploadShader(const EffectResource& shader) override;
@@ -96,6 +99,7 @@ namespace ramses::internal
         void                    generateMipmaps     (DeviceResourceHandle handle) override;
         void                    uploadTextureData   (DeviceResourceHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t z, uint32_t width, uint32_t height, uint32_t depth, const std::byte* data, uint32_t dataSize, uint32_t stride) override;
         DeviceResourceHandle    uploadStreamTexture2D(DeviceResourceHandle handle, uint32_t width, uint32_t height, EPixelStorageFormat format, const std::byte* data, const TextureSwizzleArray& swizzle) override;
+        void                    updateStreamTexture2D(DeviceResourceHandle handle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t stride, EPixelStorageFormat format, const std::byte* data) override;
         void                    deleteTexture       (DeviceResourceHandle handle) override;
         void                    activateTexture     (DeviceResourceHandle handle, DataFieldHandle field) override;
         uint32_t                getTextureAddress   (DeviceResourceHandle handle) const override;
@@ -131,6 +135,7 @@ namespace ramses::internal
         uint32_t                  getTotalGpuMemoryUsageInKB() const override;
 
         void                    flush() override;
+        void                    invalidateStateCache() override;
 
     private:
         DeviceResourceHandle        m_framebufferRenderTarget;
@@ -142,7 +147,9 @@ namespace ramses::internal
             uint8_t readingIndex = 0;
         };
 
-        std::vector<RenderTargetPair> m_pairedRenderTargets;
+        // keyed by first render target of pair, lookup by first color buffer is needed for every texture activation
+        std::unordered_map<DeviceResourceHandle, RenderTargetPair> m_pairedRenderTargets;
+        std::unordered_map<DeviceResourceHandle, const RenderTargetPair*> m_pairedColorBuffers;
 
         // Active states for upcoming draw call(s)
         const ShaderGPUResource_GL* m_activeShader = nullptr;
@@ -159,22 +166,46 @@ namespace ramses::internal
 
         std::unordered_map<uint64_t, DeviceResourceHandle> m_textureSamplerObjectsCache;
 
+        // Shadow of GL bindings last set by device, used to skip calls which would not change driver state.
+        // Unknown state is never skipped, see invalidateStateCache.
+        static constexpr GLHandle UnknownGLHandle = std::numeric_limits<GLHandle>::max();
+        static constexpr uint32_t UnknownTextureUnit = std::numeric_limits<uint32_t>::max();
+        struct TextureUnitState
+        {
+            GLenum target = 0u;
+            GLHandle texture = UnknownGLHandle;
+            GLHandle sampler = UnknownGLHandle;
+            uint64_t samplerStatesHash = 0u;
+        };
+        std::vector<TextureUnitState> m_textureUnitStates;
+        uint32_t                    m_activeTextureUnit = UnknownTextureUnit;
+        GLHandle                    m_boundProgram = UnknownGLHandle;
+        GLHandle                    m_boundVertexArray = UnknownGLHandle;
+        GLHandle                    m_boundArrayBuffer = UnknownGLHandle;
+
+        void selectTextureUnit(uint32_t unit);
+        void trackTextureBinding(GLenum target, GLHandle texture);
+        void untrackTexture(GLHandle texture);
+        void bindVertexArray(GLHandle vertexArray);
+        void bindArrayBuffer(GLHandle buffer);
+
         bool allBuffersHaveTheSameSize(const DeviceHandleVector& renderBuffers) const;
         static void BindRenderBufferToRenderTarget(const RenderBufferGPUResource& renderBufferGpuResource, size_t colorBufferSlot);
         static void BindReadWriteRenderBufferToRenderTarget(EPixelStorageFormat bufferFormat, size_t colorBufferSlot, GLHandle bufferGLHandle, bool multiSample);
         static void BindWriteOnlyRenderBufferToRenderTarget(EPixelStorageFormat bufferFormat, size_t colorBufferSlot, GLHandle bufferGLHandle);
-        GLHandle createTexture(uint32_t width, uint32_t height, EPixelStorageFormat storageFormat, uint32_t sampleCount) const;
+        GLHandle createTexture(uint32_t width, uint32_t height, EPixelStorageFormat storageFormat, uint32_t sampleCount);
         static GLHandle CreateRenderBuffer(uint32_t width, uint32_t height, EPixelStorageFormat format, uint32_t sampleCount);
 
         DeviceResourceHandle    uploadTextureSampler(const TextureSamplerStates& samplerStates);
         void                    deleteTextureSampler(DeviceResourceHandle handle);
         void                    activateTextureSampler(DeviceResourceHandle handle, DataFieldHandle field);
 
-        static GLHandle GenerateAndBindTexture(GLenum target);
+        GLHandle generateAndBindTexture(GLenum target);
 
         void fillGLInternalTextureInfo(GLenum target, uint32_t width, uint32_t height, uint32_t depth, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, GLTextureInfo& texInfoOut) const;
         static uint32_t CheckAndClampNumberOfSamples(GLenum internalFormat, uint32_t numSamples);
 
+        void updateBufferData(GLenum target, const GPUResource& buffer, uint32_t offset, const std::byte* data, uint32_t dataSize);
         static void AllocateTextureStorage(const GLTextureInfo& texInfo, uint32_t mipLevels, uint32_t sampleCount = 0);
         static void UploadTextureMipMapData(uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t z, uint32_t width, uint32_t height, uint32_t depth, const GLTextureInfo& texInfo, const std::byte *pData, uint32_t dataSize, uint32_t stride);
 
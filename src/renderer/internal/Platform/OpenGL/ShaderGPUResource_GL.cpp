@@ -22,10 +22,7 @@ namespace ramses::internal
 
     ShaderGPUResource_GL::~ShaderGPUResource_GL()
     {
-        // To be safe, unbind the program so that it can be deleted
-        // Generally, resources should not be deleted while rendering
-        glUseProgram(0);
-
+        // Program is unbound by device before deletion if in use (device tracks bound program)
         if (0 != m_shaderProgramInfo.shaderProgramHandle)
         {
             glDeleteProgram(m_shaderProgramInfo.shaderProgramHandle);
@@ -62,6 +59,16 @@ namespace ramses::internal
         return slot;
     }
 
+    void ShaderGPUResource_GL::assignTextureSlots() const
+    {
+        for (const auto& bufferSlot : m_bufferSlots)
+        {
+            const GLInputLocation location = getUniformLocation(bufferSlot.key);
+            if (location.isValid())
+                glUniform1i(location.getValue(), bufferSlot.value.slot);
+        }
+    }
+
     void ShaderGPUResource_GL::preloadVariableLocations(const EffectResource& effect)
     {
         const EffectInputInformationVector& uniformInputs = effect.getUniformInputs();
@@ -36,6 +36,8 @@ namespace ramses::internal
         [[nodiscard]] GLInputLocation     getUniformLocation(DataFieldHandle field) const;
         [[nodiscard]] GLInputLocation     getAttributeLocation(DataFieldHandle field) const;
         [[nodiscard]] TextureSlotInfo     getTextureSlot(DataFieldHandle field) const;
+        // sampler uniforms are program state, so texture slots have to be assigned only once, program must be in use
+        void                assignTextureSlots() const;
 
         bool                getBinaryInfo(std::vector<std::byte>& binaryShader, BinaryShaderFormatID& binaryShaderFormat) const;
 
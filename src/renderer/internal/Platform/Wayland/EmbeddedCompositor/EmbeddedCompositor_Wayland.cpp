@@ -221,7 +221,7 @@ namespace ramses::internal
         m_serverDisplay.flushClients();
     }
 
-    uint32_t EmbeddedCompositor_Wayland::uploadCompositingContentForStreamTexture(WaylandIviSurfaceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter)
+    StreamTextureUploadResult EmbeddedCompositor_Wayland::uploadCompositingContentForStreamTexture(WaylandIviSurfaceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter, bool fullUpload)
     {
         assert(streamTextureSourceId.isValid());
         IWaylandSurface* waylandClientSurface = findWaylandSurfaceByIviSurfaceId(streamTextureSourceId);
@@ -230,11 +230,11 @@ namespace ramses::internal
         LOG_DEBUG(CONTEXT_RENDERER, "EmbeddedCompositor_Wayland::uploadCompositingContentForStreamTexture() " << streamTextureSourceId);
         LOG_INFO(CONTEXT_SMOKETEST, "embedded-compositing client surface found for existing streamtexture: " << streamTextureSourceId);
 
-        UploadCompositingContentForWaylandSurface(waylandClientSurface, textureHandle, textureUploadingAdapter);
-        return waylandClientSurface->getNumberOfCommitedFrames();
+        const uint64_t numBytesUploaded = uploadCompositingContentForWaylandSurface(waylandClientSurface, textureHandle, textureUploadingAdapter, fullUpload);
+        return { waylandClientSurface->getNumberOfCommitedFrames(), numBytesUploaded };
     }
 
-    void EmbeddedCompositor_Wayland::UploadCompositingContentForWaylandSurface(IWaylandSurface* waylandSurface, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter)
+    uint64_t EmbeddedCompositor_Wayland::uploadCompositingContentForWaylandSurface(IWaylandSurface* waylandSurface, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter, bool fullUpload)
     {
         IWaylandBuffer* waylandBuffer = waylandSurface->getWaylandBuffer();
         assert(nullptr != waylandBuffer);
@@ -245,6 +245,7 @@ namespace ramses::internal
         LinuxDmabufBufferData* linuxDmabufBuffer = LinuxDmabufBuffer::fromWaylandBufferResource(waylandBufferResource);
 
         const bool surfaceBufferTypeChanged = waylandSurface->dispatchBufferTypeChanged();
+        const WaylandSurfaceDamage damage = waylandSurface->dispatchDamage();
 
         if(surfaceBufferTypeChanged)
         {
@@ -258,10 +259,21 @@ namespace ramses::internal
 
         if (nullptr != sharedMemoryBufferData)
         {
+            const auto width = waylandBufferResource.getWidth();
+            const auto height = waylandBufferResource.getHeight();
+            auto& uploadedSize = m_uploadedSharedMemoryBufferSizes[waylandSurface->getIviSurfaceId()];
+            const bool sizeChanged = (uploadedSize != std::make_pair(width, height));
+
+            if (!fullUpload && !surfaceBufferTypeChanged && !damage.fullSurface && !sizeChanged)
+                return UploadSharedMemoryBufferDamage(textureHandle, textureUploadingAdapter, sharedMemoryBufferData, width, height, damage.regions);
+
             const TextureSwizzleArray swizzle = {ETextureChannelColor::Blue, ETextureChannelColor::Green, ETextureChannelColor::Red, ETextureChannelColor::Alpha};
-            textureUploadingAdapter.uploadTexture2D(textureHandle, waylandBufferResource.getWidth(), waylandBufferResource.getHeight(), EPixelStorageFormat::RGBA8, sharedMemoryBufferData, swizzle);
+            textureUploadingAdapter.uploadTexture2D(textureHandle, width, height, EPixelStorageFormat::RGBA8, sharedMemoryBufferData, swizzle);
+            uploadedSize = { width, height };
+            return uint64_t(width) * uint64_t(height) * GetTexelSizeFromFormat(EPixelStorageFormat::RGBA8);
         }
-        else if (nullptr != linuxDmabufBuffer)
+
+        if (nullptr != linuxDmabufBuffer)
         {
             const auto success = static_cast<TextureUploadingAdapter_Wayland&>(textureUploadingAdapter).uploadTextureFromLinuxDmabuf(textureHandle, linuxDmabufBuffer);
 
@@ -277,6 +289,32 @@ namespace ramses::internal
         {
             static_cast<TextureUploadingAdapter_Wayland&>(textureUploadingAdapter).uploadTextureFromWaylandResource(textureHandle, waylandBufferResource.getLowLevelHandle());
         }
+
+        // GPU buffers are imported without copying any data
+        m_uploadedSharedMemoryBufferSizes.remove(waylandSurface->getIviSurfaceId());
+        return 0u;
+    }
+
+    uint64_t EmbeddedCompositor_Wayland::UploadSharedMemoryBufferDamage(DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter, const std::byte* data, int32_t width, int32_t height, const std::vector<Quad>& damagedRegions)
+    {
+        uint64_t numBytesUploaded = 0u;
+        for (const auto& region : damagedRegions)
+        {
+            // damage is not bound to buffer size by clients
+            const int32_t x0 = std::min(region.x, width);
+            const int32_t y0 = std::min(region.y, height);
+            const int32_t x1 = std::min(region.x + region.width, width);
+            const int32_t y1 = std::min(region.y + region.height, height);
+            if (x1 <= x0 || y1 <= y0)
+                continue;
+
+            const auto regionWidth = static_cast<uint32_t>(x1 - x0);
+            const auto regionHeight = static_cast<uint32_t>(y1 - y0);
+            textureUploadingAdapter.updateTexture2D(textureHandle, static_cast<uint32_t>(x0), static_cast<uint32_t>(y0), regionWidth, regionHeight, static_cast<uint32_t>(width), EPixelStorageFormat::RGBA8, data);
+            numBytesUploaded += uint64_t(regionWidth) * regionHeight * GetTexelSizeFromFormat(EPixelStorageFormat::RGBA8);
+        }
+
+        return numBytesUploaded;
     }
 
     bool EmbeddedCompositor_Wayland::isContentAvailableForStreamTexture(WaylandIviSurfaceId streamTextureSourceId) const
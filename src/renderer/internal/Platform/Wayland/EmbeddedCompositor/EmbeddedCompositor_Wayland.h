@@ -18,8 +18,11 @@
 #include "internal/Platform/Wayland/EmbeddedCompositor/LinuxDmabufGlobal.h"
 #include "internal/RendererLib/PlatformInterface/IEmbeddedCompositor.h"
 #include "internal/PlatformAbstraction/Collections/HashMap.h"
+#include "internal/Core/Math3d/Quad.h"
 
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -46,7 +49,7 @@ namespace ramses::internal
         WaylandIviSurfaceIdSet dispatchNewStreamTextureSourceIds() override;
         WaylandIviSurfaceIdSet dispatchObsoleteStreamTextureSourceIds() override;
         void endFrame(bool notifyClients) override;
-        uint32_t uploadCompositingContentForStreamTexture(WaylandIviSurfaceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter) override;
+        StreamTextureUploadResult uploadCompositingContentForStreamTexture(WaylandIviSurfaceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter, bool fullUpload) override;
 
         [[nodiscard]] bool isContentAvailableForStreamTexture(WaylandIviSurfaceId streamTextureSourceId) const override;
 
@@ -80,7 +83,8 @@ namespace ramses::internal
     private:
         [[nodiscard]] IWaylandSurface* findWaylandSurfaceByIviSurfaceId(WaylandIviSurfaceId iviSurfaceId) const;
 
-        static void UploadCompositingContentForWaylandSurface(IWaylandSurface* waylandSurface, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter);
+        uint64_t uploadCompositingContentForWaylandSurface(IWaylandSurface* waylandSurface, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter, bool fullUpload);
+        static uint64_t UploadSharedMemoryBufferDamage(DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter, const std::byte* data, int32_t width, int32_t height, const std::vector<Quad>& damagedRegions);
 
         bool applyPermissionsGroupToEmbeddedCompositingSocket(const std::string& embeddedSocketName);
 
@@ -117,5 +121,8 @@ namespace ramses::internal
 
         using WaylandRegions = HashSet<IWaylandRegion *>;
         WaylandRegions m_regions;
+
+        // size of shared memory buffer content last fully uploaded to stream texture, partial upload is only possible with same size
+        HashMap<WaylandIviSurfaceId, std::pair<int32_t, int32_t>> m_uploadedSharedMemoryBufferSizes;
     };
 }
@@ -10,8 +10,10 @@
 
 #include "internal/Platform/Wayland/EmbeddedCompositor/IWaylandClient.h"
 #include "internal/RendererLib/Types.h"
+#include "internal/Core/Math3d/Quad.h"
 
 #include <string>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -22,6 +24,13 @@ namespace ramses::internal
     class RendererLogContext;
     class WaylandEGLExtensionProcs;
 
+    // damage of surface content accumulated over commits, in buffer coordinates
+    struct WaylandSurfaceDamage
+    {
+        bool fullSurface = false;
+        std::vector<Quad> regions;
+    };
+
     class IWaylandSurface
     {
     public:
@@ -54,5 +63,6 @@ namespace ramses::internal
         [[nodiscard]] virtual bool hasIviSurface() const = 0;
         [[nodiscard]] virtual WaylandClientCredentials getClientCredentials() const = 0;
         virtual bool dispatchBufferTypeChanged() = 0;
+        virtual WaylandSurfaceDamage dispatchDamage() = 0;
     };
 }
@@ -17,6 +17,7 @@
 #include "internal/Platform/Wayland/EmbeddedCompositor/WaylandBufferResource.h"
 #include "internal/Core/Utils/ThreadLocalLogForced.h"
 #include <cassert>
+#include <limits>
 
 namespace ramses::internal
 {
@@ -214,10 +215,11 @@ namespace ramses::internal
         m_removeBufferOnNextCommit = true;
     }
 
-    void
-    WaylandSurface::surfaceDamage([[maybe_unused]] IWaylandClient& client, [[maybe_unused]] int x, [[maybe_unused]] int y, [[maybe_unused]] int width, [[maybe_unused]] int height)
+    void WaylandSurface::surfaceDamage([[maybe_unused]] IWaylandClient& client, int x, int y, int width, int height)
     {
-        LOG_TRACE(CONTEXT_RENDERER, "WaylandSurface::surfaceDamage");
+        LOG_TRACE(CONTEXT_RENDERER, "WaylandSurface::surfaceDamage: x:" << x << " y:" << y << " w:" << width << " h:" << height);
+        // buffer scale and transform are not supported, surface coordinates are same as buffer coordinates
+        addPendingDamage(x, y, width, height);
     }
 
     void WaylandSurface::surfaceFrame(IWaylandClient& client, uint32_t id)
@@ -261,6 +263,15 @@ namespace ramses::internal
 
         m_pendingCallbacks.clear();
 
+        // Clients not sending any damage for new buffer get whole surface updated
+        if (m_pendingBuffer && m_pendingDamage.regions.empty())
+            m_pendingDamage.fullSurface = true;
+
+        m_damage.fullSurface = m_damage.fullSurface || m_pendingDamage.fullSurface;
+        for (const auto& region : m_pendingDamage.regions)
+            AddDamageRegion(m_damage, region);
+        m_pendingDamage = {};
+
         // If an attach is pending, current buffer is updated with pending one.
         if (m_pendingBuffer)
         {
@@ -295,10 +306,41 @@ namespace ramses::internal
         LOG_TRACE(CONTEXT_RENDERER, "WaylandSurface::surfaceSetBufferScale");
     }
 
-    void WaylandSurface::surfaceDamageBuffer(
-        [[maybe_unused]] IWaylandClient& client, [[maybe_unused]] int32_t x, [[maybe_unused]] int32_t y, [[maybe_unused]] int32_t width, [[maybe_unused]] int32_t height)
+    void WaylandSurface::surfaceDamageBuffer([[maybe_unused]] IWaylandClient& client, int32_t x, int32_t y, int32_t width, int32_t height)
     {
-        LOG_TRACE(CONTEXT_RENDERER, "WaylandSurface::surfaceDamageBuffer");
+        LOG_TRACE(CONTEXT_RENDERER, "WaylandSurface::surfaceDamageBuffer: x:" << x << " y:" << y << " w:" << width << " h:" << height);
+        addPendingDamage(x, y, width, height);
+    }
+
+    void WaylandSurface::addPendingDamage(int32_t x, int32_t y, int32_t width, int32_t height)
+    {
+        if (width <= 0 || height <= 0)
+            return;
+
+        // clients commonly damage whole surface using maximum int32 size, clip to positive range without overflow
+        constexpr int64_t maxCoordinate = std::numeric_limits<int32_t>::max();
+        const int64_t x0 = std::max<int64_t>(x, 0);
+        const int64_t y0 = std::max<int64_t>(y, 0);
+        const int64_t x1 = std::min<int64_t>(int64_t{ x } + width, maxCoordinate);
+        const int64_t y1 = std::min<int64_t>(int64_t{ y } + height, maxCoordinate);
+        if (x1 <= x0 || y1 <= y0)
+            return;
+
+        AddDamageRegion(m_pendingDamage, Quad(static_cast<int32_t>(x0), static_cast<int32_t>(y0), static_cast<int32_t>(x1 - x0), static_cast<int32_t>(y1 - y0)));
+    }
+
+    void WaylandSurface::AddDamageRegion(WaylandSurfaceDamage& damage, const Quad& region)
+    {
+        if (damage.regions.size() < MaxDamageRegions)
+        {
+            damage.regions.push_back(region);
+            return;
+        }
+
+        Quad boundingRegion = region;
+        for (const auto& r : damage.regions)
+            boundingRegion = boundingRegion.getBoundingQuad(r);
+        damage.regions.assign(1u, boundingRegion);
     }
 
     WaylandClientCredentials WaylandSurface::getClientCredentials() const
@@ -313,6 +355,13 @@ namespace ramses::internal
         return result;
     }
 
+    WaylandSurfaceDamage WaylandSurface::dispatchDamage()
+    {
+        WaylandSurfaceDamage result;
+        std::swap(result, m_damage);
+        return result;
+    }
+
     void WaylandSurface::SurfaceDestroyCallback([[maybe_unused]] wl_client* client, wl_resource* surfaceResource)
     {
         auto* surface = static_cast<WaylandSurface*>(wl_resource_get_user_data(surfaceResource));
@@ -55,12 +55,15 @@ namespace ramses::internal
         void surfaceDamageBuffer(IWaylandClient& client, int32_t x, int32_t y, int32_t width, int32_t height) override;
         [[nodiscard]] WaylandClientCredentials getClientCredentials() const override;
         bool dispatchBufferTypeChanged() override;
+        WaylandSurfaceDamage dispatchDamage() override;
 
     private:
         void setBufferToSurface(IWaylandBuffer& buffer);
         void unsetBufferFromSurface();
         void setWaylandBuffer(IWaylandBuffer* buffer);
         void logSurfaceAttach(ELogLevel level, const char* stage, IWaylandBuffer* buffer, int x, int y);
+        void addPendingDamage(int32_t x, int32_t y, int32_t width, int32_t height);
+        static void AddDamageRegion(WaylandSurfaceDamage& damage, const Quad& region);
 
         static void SurfaceDestroyCallback(wl_client* client, wl_resource* surfaceResource);
         static void SurfaceAttachCallback(wl_client* client, wl_resource* surfaceResource, wl_resource* bufferResource, int x, int y);
@@ -109,5 +112,10 @@ namespace ramses::internal
         } m_surfaceInterface;
 
         bool m_bufferTypeChanged = false;
+
+        // damage regions above this count are merged into their bounding region
+        static constexpr size_t MaxDamageRegions = 16u;
+        WaylandSurfaceDamage m_pendingDamage;
+        WaylandSurfaceDamage m_damage;
     };
 }
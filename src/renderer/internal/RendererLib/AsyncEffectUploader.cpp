@@ -20,33 +20,63 @@
 
 namespace ramses::internal
 {
-    AsyncEffectUploader::AsyncEffectUploader(IPlatform& platform, IRenderBackend& renderBackend, IThreadAliveNotifier& notifier, int logPrefixID)
+    AsyncEffectUploader::UploadThread::UploadThread(AsyncEffectUploader& uploader, uint32_t index, uint64_t aliveIdentifier)
+        : m_uploader(uploader)
+        , m_thread{ fmt::format("R_EffUp{}_{}", uploader.m_logPrefixID, index) }
+        , m_aliveIdentifier(aliveIdentifier)
+    {
+    }
+
+    void AsyncEffectUploader::UploadThread::run()
+    {
+        m_uploader.runUploadThread(*this);
+    }
+
+    AsyncEffectUploader::AsyncEffectUploader(IPlatform& platform, IRenderBackend& renderBackend, IThreadAliveNotifier& notifier, int logPrefixID, uint32_t threadCount)
         : m_platform(platform)
         , m_renderBackend(renderBackend)
-        , m_thread{ fmt::format("R_EffUpload{}", logPrefixID) }
         , m_notifier(notifier)
-        , m_aliveIdentifier(notifier.registerThread())
         , m_logPrefixID{ logPrefixID }
     {
+        assert(threadCount > 0u);
+        m_threads.reserve(threadCount);
+        for (uint32_t i = 0u; i < threadCount; ++i)
+            m_threads.push_back(std::make_unique<UploadThread>(*this, i, notifier.registerThread()));
     }
 
     AsyncEffectUploader::~AsyncEffectUploader()
     {
-        assert(!m_thread.isRunning());
-        m_notifier.unregisterThread(m_aliveIdentifier);
+        for (const auto& uploadThread : m_threads)
+        {
+            assert(!uploadThread->m_thread.isRunning());
+            m_notifier.unregisterThread(uploadThread->m_aliveIdentifier);
+        }
+
+        if (!m_prewarmedEffects.empty())
+            LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader discarding " << m_prewarmedEffects.size() << " prewarmed effects which were never requested");
     }
 
     bool AsyncEffectUploader::createResourceUploadRenderBackendAndStartThread()
     {
-        assert(!m_thread.isRunning());
-
-        //disable main context to be able to create shared context in new thread
+        //disable main context to be able to create shared contexts in new threads
         m_renderBackend.getContext().disable();
-        m_thread.start(*this);
 
-        const auto success = m_creationSuccess.get_future().get();
+        // upload threads are started one after another so that shared contexts are not created concurrently
+        bool success = true;
+        for (auto& uploadThread : m_threads)
+        {
+            assert(!uploadThread->m_thread.isRunning());
+            uploadThread->m_thread.start(*uploadThread);
+            if (!uploadThread->m_creationSuccess.get_future().get())
+            {
+                uploadThread->m_thread.join();
+                success = false;
+                break;
+            }
+        }
+
         if (!success)
-            m_thread.join();
+            stopThreads();
 
         // re-enable main context
         m_renderBackend.getContext().enable();
@@ -56,67 +86,99 @@ namespace ramses::internal
 
     void AsyncEffectUploader::destroyResourceUploadRenderBackendAndStopThread()
     {
-        assert(m_thread.isRunning() && !isCancelRequested());
+        assert(std::all_of(m_threads.cbegin(), m_threads.cend(), [](const auto& t) { return t->m_thread.isRunning() && !t->isCancelRequested(); }));
+        stopThreads();
+    }
+
+    void AsyncEffectUploader::stopThreads()
+    {
         {
             std::unique_lock<std::mutex> guard(m_mutex);
             //call thread cancel inside critical section to avoid having deadlock on wait() inside uploadEffectsOrWait
-            m_thread.cancel();
+            for (auto& uploadThread : m_threads)
+                uploadThread->m_thread.cancel();
         }
 
-        m_sleepConditionVar.notify_one();
-        m_thread.join();
+        m_sleepConditionVar.notify_all();
+        for (auto& uploadThread : m_threads)
+            uploadThread->m_thread.join();
     }
 
-    void AsyncEffectUploader::uploadEffectsOrWait(IResourceUploadRenderBackend& resourceUploadRenderBackend)
+    void AsyncEffectUploader::uploadEffectsOrWait(UploadThread& uploadThread, IResourceUploadRenderBackend& resourceUploadRenderBackend)
     {
         LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::uploadEffectsOrWait: starting");
 
-        EffectsRawResources effectsToUpload;
         {
             std::unique_lock<std::mutex> guard(m_mutex);
             do
             {
-                m_notifier.notifyAlive(m_aliveIdentifier);
+                m_notifier.notifyAlive(uploadThread.m_aliveIdentifier);
             } while (!m_sleepConditionVar.wait_for(
-                guard, m_notifier.calculateTimeout(), [&]() { return !m_effectsToUpload.empty() || !m_effectsUploadedCache.empty() || isCancelRequested(); }));
-
-            m_effectsUploaded.insert(m_effectsUploaded.end(), std::make_move_iterator(m_effectsUploadedCache.begin()), std::make_move_iterator(m_effectsUploadedCache.end()));
-            m_effectsUploadedCache.clear();
-
-            //assert none of the shaders to be uploaded next was already uploaded since last sync
-            assert(std::all_of(std::begin(m_effectsToUpload), std::end(m_effectsToUpload), [this](const auto& toUpload) {
-                return std::find_if(std::cbegin(m_effectsUploaded), std::cend(m_effectsUploaded), [&toUpload](const auto& uploaded) {
-                            return uploaded.first == toUpload->getHash();
-                        }) == m_effectsUploaded.cend();
-            }));
-
-            m_effectsToUpload.swap(effectsToUpload);
+                guard, m_notifier.calculateTimeout(), [&]() { return !m_effectsToUpload.empty() || !m_effectsToPrewarm.empty() || uploadThread.isCancelRequested(); }));
         }
 
-        LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::uploadEffectsOrWait: will upload: " << effectsToUpload.size() << ",  uploaded in cache:" << m_effectsUploadedCache.size());
-
         std::chrono::microseconds maxShaderUploadTime{ 0u };
         std::chrono::microseconds totalShaderUploadTime{ 0u };
         ResourceContentHash effectWithMaxUploadTime;
+        uint32_t numEffectsUploaded = 0u;
 
-        for (const auto effectRes : effectsToUpload)
+        // effects are taken one by one so that all threads of the pool can work on effects submitted together
+        while (!uploadThread.isCancelRequested())
         {
-            if (isCancelRequested())
+            const EffectResource* effectRes = nullptr;
+            // keeps effect being prewarmed alive during compilation, it might not be held by its scene anymore
+            ManagedResource effectToPrewarm;
             {
-                LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader uploading cancelled");
-                break;
+                std::lock_guard<std::mutex> guard(m_mutex);
+                if (!m_effectsToUpload.empty())
+                {
+                    effectRes = m_effectsToUpload.front();
+                    m_effectsToUpload.pop_front();
+                }
+                else if (!m_effectsToPrewarm.empty())
+                {
+                    effectToPrewarm = std::move(m_effectsToPrewarm.front());
+                    m_effectsToPrewarm.pop_front();
+                    effectRes = effectToPrewarm->convertTo<EffectResource>();
+                    assert(m_prewarmedEffects.count(effectRes->getHash()) != 0u);
+                    m_prewarmedEffects[effectRes->getHash()].state = EPrewarmState::Compiling;
+                }
             }
 
+            if (!effectRes)
+                break;
+
             const auto& effectHash = effectRes->getHash();
-            LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader uploading: " << effectHash);
+            LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader " << (effectToPrewarm ? "prewarming: " : "uploading: ") << effectHash);
 
-            assert(std::find_if(std::cbegin(m_effectsUploadedCache), std::cend(m_effectsUploadedCache), [&effectHash](const auto& u) {return effectHash == u.first; }) == m_effectsUploadedCache.cend());
-            m_notifier.notifyAlive(m_aliveIdentifier);
+            m_notifier.notifyAlive(uploadThread.m_aliveIdentifier);
             const auto shaderUploadStart = std::chrono::steady_clock::now();
             auto shaderResource = resourceUploadRenderBackend.getDevice().uploadShader(*effectRes);
             const auto shaderUploadTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - shaderUploadStart);
 
-            m_effectsUploadedCache.emplace_back(effectHash, std::move(shaderResource));
+            {
+                std::lock_guard<std::mutex> guard(m_mutex);
+                if (!effectToPrewarm)
+                {
+                    m_effectsUploaded.emplace_back(effectHash, std::move(shaderResource));
+                }
+                else
+                {
+                    auto prewarmedIt = m_prewarmedEffects.find(effectHash);
+                    assert(prewarmedIt != m_prewarmedEffects.end());
+                    if (prewarmedIt->second.state == EPrewarmState::CompilingRequested)
+                    {
+                        m_effectsUploaded.emplace_back(effectHash, std::move(shaderResource));
+                        m_prewarmedEffects.erase(prewarmedIt);
+                    }
+                    else
+                    {
+                        assert(prewarmedIt->second.state == EPrewarmState::Compiling);
+                        prewarmedIt->second.state = EPrewarmState::Compiled;
+                        prewarmedIt->second.gpuResource = std::move(shaderResource);
+                    }
+                }
+            }
 
             if (shaderUploadTime > maxShaderUploadTime || !effectWithMaxUploadTime.isValid())
             {
@@ -124,11 +186,12 @@ namespace ramses::internal
                 effectWithMaxUploadTime = effectHash;
             }
             totalShaderUploadTime += shaderUploadTime;
+            ++numEffectsUploaded;
         }
 
-        if (!effectsToUpload.empty())
+        if (numEffectsUploaded > 0u)
         {
-            LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader " << effectsToUpload.size() << " uploaded in "
+            LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader " << numEffectsUploaded << " uploaded in "
                 << totalShaderUploadTime.count() << " us ("
                 << "Max: " << maxShaderUploadTime.count() << " us " << effectWithMaxUploadTime << ")");
 
@@ -152,7 +215,8 @@ namespace ramses::internal
         {
             std::lock_guard<std::mutex> guard(m_mutex);
 
-            m_effectsToUpload.insert(m_effectsToUpload.cend(), effectsToUpload.cbegin(), effectsToUpload.cend());
+            for (const auto effect : effectsToUpload)
+                requestEffect(*effect);
             uploadedResourcesOut.swap(m_effectsUploaded);
 
             totalEffectsToUpload = m_effectsToUpload.size();
@@ -166,12 +230,72 @@ namespace ramses::internal
         }
 
         if (!effectsToUpload.empty())
-            m_sleepConditionVar.notify_one();
+            m_sleepConditionVar.notify_all();
 
         LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::sync: finished");
     }
 
-    void AsyncEffectUploader::run()
+    void AsyncEffectUploader::requestEffect(const EffectResource& effect)
+    {
+        const auto& hash = effect.getHash();
+        auto prewarmedIt = m_prewarmedEffects.find(hash);
+        if (prewarmedIt == m_prewarmedEffects.end())
+        {
+            m_effectsToUpload.push_back(&effect);
+            return;
+        }
+
+        switch (prewarmedIt->second.state)
+        {
+        case EPrewarmState::Queued:
+        {
+            // not picked up by any thread yet, move it to upload queue which takes precedence over prewarming
+            auto queuedIt = std::find_if(m_effectsToPrewarm.begin(), m_effectsToPrewarm.end(), [&hash](const auto& e) { return e->getHash() == hash; });
+            assert(queuedIt != m_effectsToPrewarm.end());
+            m_effectsToPrewarm.erase(queuedIt);
+            m_prewarmedEffects.erase(prewarmedIt);
+            m_effectsToUpload.push_back(&effect);
+            break;
+        }
+        case EPrewarmState::Compiling:
+            // result will be handed over as uploaded once compiled
+            prewarmedIt->second.state = EPrewarmState::CompilingRequested;
+            break;
+        case EPrewarmState::CompilingRequested:
+            assert(false && "effect requested for upload more than once");
+            break;
+        case EPrewarmState::Compiled:
+            LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader using prewarmed: " << hash);
+            m_effectsUploaded.emplace_back(hash, std::move(prewarmedIt->second.gpuResource));
+            m_prewarmedEffects.erase(prewarmedIt);
+            break;
+        }
+    }
+
+    void AsyncEffectUploader::prewarm(const ManagedResourceVector& effectsToPrewarm)
+    {
+        std::size_t numNewEffectsToPrewarm = 0u;
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            for (const auto& effect : effectsToPrewarm)
+            {
+                assert(effect->getTypeID() == EResourceType::Effect);
+                if (m_prewarmedEffects.try_emplace(effect->getHash()).second)
+                {
+                    m_effectsToPrewarm.push_back(effect);
+                    ++numNewEffectsToPrewarm;
+                }
+            }
+        }
+
+        if (numNewEffectsToPrewarm > 0u)
+        {
+            LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader newToPrewarm: " << numNewEffectsToPrewarm);
+            m_sleepConditionVar.notify_all();
+        }
+    }
+
+    void AsyncEffectUploader::runUploadThread(UploadThread& uploadThread)
     {
         ThreadLocalLog::SetPrefix(m_logPrefixID);
 
@@ -180,18 +304,17 @@ namespace ramses::internal
         if (!resourceUploadRenderBackend)
         {
             LOG_ERROR(CONTEXT_RENDERER, "AsyncEffectUploader failed creating resource upload render backend");
-            m_creationSuccess.set_value(false);
+            uploadThread.m_creationSuccess.set_value(false);
             return;
         }
         LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader resource upload render backend created successfully");
-        m_creationSuccess.set_value(true);
+        uploadThread.m_creationSuccess.set_value(true);
 
-        while (!isCancelRequested())
-            uploadEffectsOrWait(*resourceUploadRenderBackend);
+        while (!uploadThread.isCancelRequested())
+            uploadEffectsOrWait(uploadThread, *resourceUploadRenderBackend);
 
         LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader will destroy resource upload render backend");
-        m_platform.destroyResourceUploadRenderBackend();
-        LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::run: exiting thread");
+        m_platform.destroyResourceUploadRenderBackend(*resourceUploadRenderBackend);
+        LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::runUploadThread: exiting thread");
     }
 }
-
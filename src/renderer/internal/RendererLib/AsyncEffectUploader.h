@@ -11,8 +11,10 @@
 #include "internal/RendererLib/PlatformBase/GpuResource.h"
 #include "internal/PlatformAbstraction/PlatformThread.h"
 #include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
+#include "internal/Components/ManagedResource.h"
 
 #include <unordered_map>
+#include <deque>
 #include <future>
 #include <mutex>
 #include <condition_variable>
@@ -28,37 +30,67 @@ namespace ramses::internal
     using EffectsGpuResources = std::vector<std::pair<ResourceContentHash, std::unique_ptr<const GPUResource>>>;
     using EffectsRawResources = std::vector<const EffectResource*>;
 
-    class AsyncEffectUploader : private Runnable
+    // Compiles and uploads effects using a pool of threads, each thread has its own resource upload render backend (shared context).
+    // Effects can be prewarmed before they are requested for upload (e.g. for scene which is not mapped yet),
+    // when such effect is requested later its already compiled shader is handed over without compiling it again.
+    class AsyncEffectUploader
     {
     public:
-        AsyncEffectUploader(IPlatform& platform, IRenderBackend& renderBackend, IThreadAliveNotifier& notifier, int logPrefixID);
-        ~AsyncEffectUploader() override;
+        AsyncEffectUploader(IPlatform& platform, IRenderBackend& renderBackend, IThreadAliveNotifier& notifier, int logPrefixID, uint32_t threadCount = 1u);
+        ~AsyncEffectUploader();
 
         bool createResourceUploadRenderBackendAndStartThread();
         void destroyResourceUploadRenderBackendAndStopThread();
 
         void sync(const EffectsRawResources& effectsToUpload, EffectsGpuResources& uploadedResourcesOut);
+        void prewarm(const ManagedResourceVector& effectsToPrewarm);
 
     private:
-        void run() override;
-        void uploadEffectsOrWait(IResourceUploadRenderBackend& resourceUploadRenderBackend);
+        class UploadThread : public Runnable
+        {
+        public:
+            UploadThread(AsyncEffectUploader& uploader, uint32_t index, uint64_t aliveIdentifier);
+            void run() override;
+
+            AsyncEffectUploader& m_uploader;
+            PlatformThread m_thread;
+            std::promise<bool> m_creationSuccess;
+            const uint64_t m_aliveIdentifier;
+        };
+
+        enum class EPrewarmState
+        {
+            Queued,
+            Compiling,
+            CompilingRequested,
+            Compiled
+        };
+
+        struct PrewarmedEffect
+        {
+            EPrewarmState state = EPrewarmState::Queued;
+            std::unique_ptr<const GPUResource> gpuResource;
+        };
+
+        void runUploadThread(UploadThread& uploadThread);
+        void uploadEffectsOrWait(UploadThread& uploadThread, IResourceUploadRenderBackend& resourceUploadRenderBackend);
+        void requestEffect(const EffectResource& effect);
+        void stopThreads();
 
         IPlatform& m_platform;
         IRenderBackend& m_renderBackend;
-        PlatformThread m_thread;
+        std::vector<std::unique_ptr<UploadThread>> m_threads;
 
         mutable std::mutex m_mutex;
         std::condition_variable m_sleepConditionVar;
 
-        EffectsRawResources m_effectsToUpload;
+        // effects requested via sync take precedence over prewarming
+        std::deque<const EffectResource*> m_effectsToUpload;
+        std::deque<ManagedResource> m_effectsToPrewarm;
         EffectsGpuResources m_effectsUploaded;
-
-        EffectsGpuResources m_effectsUploadedCache; //to avoid acquiring mutex twice in resource upload thread
-
-        std::promise<bool> m_creationSuccess;
+        std::unordered_map<ResourceContentHash, PrewarmedEffect> m_prewarmedEffects;
 
         IThreadAliveNotifier& m_notifier;
-        const uint64_t        m_aliveIdentifier;
 
         const int m_logPrefixID;
     };
@@ -43,73 +43,73 @@ namespace ramses::internal
     void DataReferenceLinkCachedScene::setDataFloatArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const float* data)
     {
         TransformationLinkCachedScene::setDataFloatArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        handleDataValueSet(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector2fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::vec2* data)
     {
         TransformationLinkCachedScene::setDataVector2fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        handleDataValueSet(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector3fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::vec3* data)
     {
         TransformationLinkCachedScene::setDataVector3fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        handleDataValueSet(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector4fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::vec4* data)
     {
         TransformationLinkCachedScene::setDataVector4fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        handleDataValueSet(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataBooleanArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const bool* data)
     {
         TransformationLinkCachedScene::setDataBooleanArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        handleDataValueSet(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataIntegerArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const int32_t* data)
     {
         TransformationLinkCachedScene::setDataIntegerArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        handleDataValueSet(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector2iArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::ivec2* data)
     {
         TransformationLinkCachedScene::setDataVector2iArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        handleDataValueSet(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector3iArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::ivec3* data)
     {
         TransformationLinkCachedScene::setDataVector3iArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        handleDataValueSet(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector4iArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::ivec4* data)
     {
         TransformationLinkCachedScene::setDataVector4iArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        handleDataValueSet(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataMatrix22fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::mat2* data)
     {
         TransformationLinkCachedScene::setDataMatrix22fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        handleDataValueSet(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataMatrix33fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::mat3* data)
     {
         TransformationLinkCachedScene::setDataMatrix33fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        handleDataValueSet(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataMatrix44fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::mat4* data)
     {
         TransformationLinkCachedScene::setDataMatrix44fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        handleDataValueSet(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::restoreFallbackValue(DataInstanceHandle containerHandle, DataFieldHandle field)
@@ -130,9 +130,20 @@ namespace ramses::internal
         *m_fallbackValues.getMemory(containerHandle) = fallbackValue;
     }
 
+    uint64_t DataReferenceLinkCachedScene::getDataInstanceVersion(DataInstanceHandle containerHandle) const
+    {
+        const auto index = containerHandle.asMemoryHandle();
+        return index < m_dataInstanceVersions.size() ? m_dataInstanceVersions[index] : 0u;
+    }
+
     template <typename T>
-    void DataReferenceLinkCachedScene::updateFallbackValue(DataInstanceHandle containerHandle, const T* data)
+    void DataReferenceLinkCachedScene::handleDataValueSet(DataInstanceHandle containerHandle, const T* data)
     {
+        const auto index = containerHandle.asMemoryHandle();
+        if (index >= m_dataInstanceVersions.size())
+            m_dataInstanceVersions.resize(index + 1u, 0u);
+        m_dataInstanceVersions[index] = ++m_lastDataInstanceVersion;
+
         if (m_fallbackValues.isAllocated(containerHandle))
         {
             *m_fallbackValues.getMemory(containerHandle) = data[0];
@@ -11,6 +11,8 @@
 #include "internal/RendererLib/TransformationLinkCachedScene.h"
 #include "internal/SceneGraph/SceneUtils/DataInstanceHelper.h"
 
+#include <vector>
+
 namespace ramses::internal
 {
     class DataReferenceLinkCachedScene : public TransformationLinkCachedScene
@@ -39,11 +41,18 @@ namespace ramses::internal
         void restoreFallbackValue(DataInstanceHandle containerHandle, DataFieldHandle field);
         void setValueWithoutUpdatingFallbackValue(DataInstanceHandle containerHandle, DataFieldHandle field, const DataInstanceValueVariant& value);
 
+        // Version changes whenever value of data instance is set, 0 if it was never set.
+        // Used by data link resolving to propagate only values which changed since last time.
+        [[nodiscard]] uint64_t getDataInstanceVersion(DataInstanceHandle containerHandle) const;
+
     private:
         template <typename T>
-        void updateFallbackValue(DataInstanceHandle containerHandle, const T* data);
+        void handleDataValueSet(DataInstanceHandle containerHandle, const T* data);
 
         using FallbackValuePool = MemoryPool<DataInstanceValueVariant, DataInstanceHandle>;
         FallbackValuePool m_fallbackValues;
+
+        std::vector<uint64_t> m_dataInstanceVersions;
+        uint64_t m_lastDataInstanceVersion = 0u;
     };
 }
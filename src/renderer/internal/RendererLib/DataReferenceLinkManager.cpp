@@ -12,6 +12,8 @@
 #include "internal/SceneGraph/SceneUtils/DataInstanceHelper.h"
 #include "internal/Core/Utils/ThreadLocalLogForced.h"
 
+#include <limits>
+
 namespace ramses::internal
 {
     DataReferenceLinkManager::DataReferenceLinkManager(RendererScenes& rendererScenes)
@@ -30,6 +32,7 @@ namespace ramses::internal
         }
 
         LinkManagerBase::removeSceneLinks(sceneId);
+        m_resolvedLinksCache.remove(sceneId);
     }
 
     bool DataReferenceLinkManager::createDataLink(SceneId providerSceneId, DataSlotHandle providerSlotHandle, SceneId consumerSceneId, DataSlotHandle consumerSlotHandle)
@@ -45,7 +48,13 @@ namespace ramses::internal
             return false;
         }
 
-        return LinkManagerBase::createDataLink(providerSceneId, providerSlotHandle, consumerSceneId, consumerSlotHandle);
+        if (!LinkManagerBase::createDataLink(providerSceneId, providerSlotHandle, consumerSceneId, consumerSlotHandle))
+        {
+            return false;
+        }
+
+        m_resolvedLinksCache.remove(consumerSceneId);
+        return true;
     }
 
     bool DataReferenceLinkManager::removeDataLink(SceneId consumerSceneId, DataSlotHandle consumerSlotHandle, SceneId* providerSceneIdOut)
@@ -63,27 +72,58 @@ namespace ramses::internal
         DataReferenceLinkCachedScene& consumerScene = m_scenes.getScene(consumerSceneId);
         const DataInstanceHandle dataRef = consumerScene.getDataSlot(consumerSlotHandle).attachedDataReference;
         consumerScene.restoreFallbackValue(dataRef, DataFieldHandle(0u));
+        m_resolvedLinksCache.remove(consumerSceneId);
 
         return true;
     }
 
-    void DataReferenceLinkManager::resolveLinksForConsumerScene(DataReferenceLinkCachedScene& consumerScene) const
+    bool DataReferenceLinkManager::resolveLinksForConsumerScene(DataReferenceLinkCachedScene& consumerScene) const
+    {
+        bool consumerModified = false;
+        for (auto& link : getResolvedLinks(consumerScene))
+        {
+            // consumer value has to be overwritten also if consumer scene itself changed it
+            const uint64_t providerVersion = link.providerScene->getDataInstanceVersion(link.providerDataRef);
+            if (providerVersion == link.providerVersion && consumerScene.getDataInstanceVersion(link.consumerDataRef) == link.consumerVersion)
+                continue;
+
+            DataInstanceValueVariant value;
+            DataInstanceHelper::GetInstanceFieldData(*link.providerScene, link.providerDataRef, DataFieldHandle(0u), value);
+            consumerScene.setValueWithoutUpdatingFallbackValue(link.consumerDataRef, DataFieldHandle(0u), value);
+
+            link.providerVersion = providerVersion;
+            link.consumerVersion = consumerScene.getDataInstanceVersion(link.consumerDataRef);
+            consumerModified = true;
+        }
+
+        return consumerModified;
+    }
+
+    DataReferenceLinkManager::ResolvedLinks& DataReferenceLinkManager::getResolvedLinks(const DataReferenceLinkCachedScene& consumerScene) const
     {
         const SceneId consumerSceneId = consumerScene.getSceneId();
+        if (auto* cachedLinks = m_resolvedLinksCache.get(consumerSceneId))
+            return *cachedLinks;
+
         SceneLinkVector links;
         getSceneLinks().getLinkedProviders(consumerSceneId, links);
 
+        ResolvedLinks resolvedLinks;
+        resolvedLinks.reserve(links.size());
         for(const auto& link : links)
         {
             assert(link.consumerSceneId == consumerSceneId);
-            const DataInstanceHandle consumerDataRef = consumerScene.getDataSlot(link.consumerSlot).attachedDataReference;
-
-            const IScene& providerScene = m_scenes.getScene(link.providerSceneId);
-            const DataInstanceHandle providerDataRef = providerScene.getDataSlot(link.providerSlot).attachedDataReference;
-
-            DataInstanceValueVariant value;
-            DataInstanceHelper::GetInstanceFieldData(providerScene, providerDataRef, DataFieldHandle(0u), value);
-            consumerScene.setValueWithoutUpdatingFallbackValue(consumerDataRef, DataFieldHandle(0u), value);
+            const DataReferenceLinkCachedScene& providerScene = m_scenes.getScene(link.providerSceneId);
+
+            ResolvedLink resolvedLink;
+            resolvedLink.consumerDataRef = consumerScene.getDataSlot(link.consumerSlot).attachedDataReference;
+            resolvedLink.providerScene = &providerScene;
+            resolvedLink.providerDataRef = providerScene.getDataSlot(link.providerSlot).attachedDataReference;
+            // never propagated, forces initial copy of provider value
+            resolvedLink.providerVersion = std::numeric_limits<uint64_t>::max();
+            resolvedLinks.push_back(resolvedLink);
         }
+
+        return m_resolvedLinksCache.put(consumerSceneId, resolvedLinks)->value;
     }
 }
@@ -9,6 +9,9 @@
 #pragma once
 
 #include "internal/RendererLib/LinkManagerBase.h"
+#include "internal/PlatformAbstraction/Collections/HashMap.h"
+
+#include <vector>
 
 namespace ramses::internal
 {
@@ -25,10 +28,28 @@ namespace ramses::internal
         bool createDataLink(SceneId providerSceneId, DataSlotHandle providerSlotHandle, SceneId consumerSceneId, DataSlotHandle consumerSlotHandle);
         bool removeDataLink(SceneId consumerSceneId, DataSlotHandle consumerSlotHandle, SceneId* providerSceneIdOut = nullptr);
 
-        void resolveLinksForConsumerScene(DataReferenceLinkCachedScene& consumerScene) const;
+        // Copies values of providers which changed since last resolve to their linked consumers,
+        // returns true if any consumer value was modified.
+        bool resolveLinksForConsumerScene(DataReferenceLinkCachedScene& consumerScene) const;
         void updateFallbackValue(SceneId consumerSceneId, DataInstanceHandle dataInstance) const;
 
         using LinkManagerBase::getDependencyChecker;
         using LinkManagerBase::getSceneLinks;
+
+    private:
+        struct ResolvedLink
+        {
+            DataInstanceHandle consumerDataRef;
+            const DataReferenceLinkCachedScene* providerScene = nullptr;
+            DataInstanceHandle providerDataRef;
+            uint64_t providerVersion = 0u;
+            uint64_t consumerVersion = 0u;
+        };
+        using ResolvedLinks = std::vector<ResolvedLink>;
+
+        ResolvedLinks& getResolvedLinks(const DataReferenceLinkCachedScene& consumerScene) const;
+
+        // links per consumer scene with versions of last propagated values, invalidated whenever links of consumer change
+        mutable HashMap<SceneId, ResolvedLinks> m_resolvedLinksCache;
     };
 }
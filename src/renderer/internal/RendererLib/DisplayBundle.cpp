@@ -12,6 +12,7 @@
 #include "internal/RendererLib/PlatformInterface/IDisplayController.h"
 #include "internal/RendererLib/PlatformInterface/IDevice.h"
 #include "internal/Watchdog/IThreadAliveNotifier.h"
+#include "internal/Core/Utils/MetricsRegistry.h"
 
 namespace ramses::internal
 {
@@ -20,7 +21,8 @@ namespace ramses::internal
         IRendererSceneEventSender& rendererSceneSender,
         IPlatform& platform,
         IThreadAliveNotifier& notifier,
-        std::chrono::milliseconds timingReportingPeriod)
+        std::chrono::milliseconds timingReportingPeriod,
+        MetricsRegistry* metricsRegistry)
         : m_display(display)
         , m_rendererScenes(m_rendererEventCollector)
         , m_expirationMonitor(m_rendererScenes, m_rendererEventCollector, m_rendererStatistics)
@@ -31,8 +33,22 @@ namespace ramses::internal
         , m_rendererCommandExecutor(m_renderer, m_pendingCommands, m_rendererSceneUpdater, m_sceneControlLogic, m_rendererEventCollector, m_frameTimer)
         , m_sceneReferenceLogic(m_rendererScenes, m_sceneControlLogic, m_rendererSceneUpdater, rendererSceneSender, m_sceneReferenceOwnership)
         , m_timingReportingPeriod{ timingReportingPeriod }
+        , m_metricsRegistry{ metricsRegistry }
     {
         m_rendererSceneUpdater.setSceneReferenceLogicHandler(m_sceneReferenceLogic);
+        if (m_metricsRegistry)
+            m_metricsRegistry->registerMetricsSource(this);
+    }
+
+    DisplayBundle::~DisplayBundle()
+    {
+        if (m_metricsRegistry)
+            m_metricsRegistry->removeMetricsSource(this);
+    }
+
+    void DisplayBundle::writeMetrics(MetricsWriter& writer) const
+    {
+        m_rendererStatistics.getMetrics().writeMetrics(writer, { { "display", std::to_string(m_display.asMemoryHandle()) } });
     }
 
     void DisplayBundle::doOneLoop(ELoopMode loopMode, std::chrono::microseconds prevFrameSleepTime)
@@ -95,7 +111,12 @@ namespace ramses::internal
     {
         uint32_t drawCalls = 0u;
         if (m_renderer.hasDisplayController())
-            drawCalls = m_renderer.getDisplayController().getRenderBackend().getDevice().getAndResetDrawCallCount();
+        {
+            auto& device = m_renderer.getDisplayController().getRenderBackend().getDevice();
+            drawCalls = device.getAndResetDrawCallCount();
+            const auto stateChanges = device.getAndResetStateChangeCounts();
+            m_renderer.getStatistics().deviceStateChanges(stateChanges.issued, stateChanges.skipped);
+        }
 
         m_renderer.getStatistics().frameFinished(drawCalls);
         m_renderer.getProfilerStatistics().markFrameFinished(prevFrameSleepTime);
@@ -159,6 +180,11 @@ namespace ramses::internal
         return m_renderer.hasSystemCompositorController();
     }
 
+    void DisplayBundle::reportFramePacingJitter(std::chrono::microseconds jitter)
+    {
+        m_renderer.getStatistics().framePacingJitter(jitter);
+    }
+
     void DisplayBundle::updateTiming()
     {
         const auto lastFrameStart = m_frameTimer.getFrameStartTime();
@@ -170,12 +196,21 @@ namespace ramses::internal
             const auto frameTime = std::chrono::duration_cast<std::chrono::microseconds>(now - lastFrameStart);
             m_maxFrameTime = std::max(m_maxFrameTime, frameTime);
             m_sumFrameTimes += frameTime;
+            m_frameTimeHistogram.record(static_cast<uint64_t>(frameTime.count()));
             if (m_sumFrameTimes >= m_timingReportingPeriod && m_loopsWithinMeasurePeriod > 0)
             {
-                m_rendererEventCollector.addFrameTimingReport(m_display, m_maxFrameTime, m_sumFrameTimes / m_loopsWithinMeasurePeriod);
+                const auto percentiles = m_frameTimeHistogram.getPercentiles();
+                FrameTimings frameTimings{};
+                frameTimings.maximumLoopTimeWithinPeriod = m_maxFrameTime;
+                frameTimings.averageLoopTimeWithinPeriod = m_sumFrameTimes / m_loopsWithinMeasurePeriod;
+                frameTimings.percentile50LoopTimeWithinPeriod = std::chrono::microseconds{ static_cast<int64_t>(percentiles.p50) };
+                frameTimings.percentile90LoopTimeWithinPeriod = std::chrono::microseconds{ static_cast<int64_t>(percentiles.p90) };
+                frameTimings.percentile99LoopTimeWithinPeriod = std::chrono::microseconds{ static_cast<int64_t>(percentiles.p99) };
+                m_rendererEventCollector.addFrameTimingReport(m_display, frameTimings);
                 m_maxFrameTime = std::chrono::microseconds{ 0 };
                 m_sumFrameTimes = std::chrono::microseconds{ 0 };
                 m_loopsWithinMeasurePeriod = 0u;
+                m_frameTimeHistogram.reset();
             }
             m_loopsWithinMeasurePeriod++;
         }
@@ -20,8 +20,10 @@
 #include "internal/RendererLib/SceneReferenceLogic.h"
 #include "internal/RendererLib/RendererCommandBuffer.h"
 #include "internal/RendererLib/RendererStatistics.h"
+#include "internal/RendererLib/DurationHistogram.h"
 #include "internal/RendererLib/Enums/ELoopMode.h"
 #include "internal/RendererLib/RendererEventCollector.h"
+#include "internal/Core/Utils/IMetricsSource.h"
 
 namespace ramses::internal
 {
@@ -30,6 +32,7 @@ namespace ramses::internal
     class IEmbeddedCompositingManager;
     class IEmbeddedCompositor;
     class IThreadAliveNotifier;
+    class MetricsRegistry;
 
     class IDisplayBundle
     {
@@ -43,13 +46,14 @@ namespace ramses::internal
         virtual IEmbeddedCompositingManager& getECManager() = 0;
         virtual IEmbeddedCompositor& getEC() = 0;
         [[nodiscard]] virtual bool hasSystemCompositorController() const = 0;
+        virtual void reportFramePacingJitter(std::chrono::microseconds jitter) = 0;
 
         virtual std::atomic_int& traceId() = 0;
 
         virtual ~IDisplayBundle() = default;
     };
 
-    class DisplayBundle final : public IDisplayBundle
+    class DisplayBundle final : public IDisplayBundle, public IMetricsSource
     {
     public:
         DisplayBundle(
@@ -57,7 +61,9 @@ namespace ramses::internal
             IRendererSceneEventSender& rendererSceneSender,
             IPlatform& platform,
             IThreadAliveNotifier& notifier,
-            std::chrono::milliseconds timingReportingPeriod);
+            std::chrono::milliseconds timingReportingPeriod,
+            MetricsRegistry* metricsRegistry);
+        ~DisplayBundle() override;
 
         void doOneLoop(ELoopMode loopMode, std::chrono::microseconds sleepTime) override;
 
@@ -75,6 +81,10 @@ namespace ramses::internal
         // needed for Renderer lifecycle tests...
         [[nodiscard]] bool hasSystemCompositorController() const override;
 
+        void reportFramePacingJitter(std::chrono::microseconds jitter) override;
+
+        void writeMetrics(MetricsWriter& writer) const override;
+
         // TODO vaclav remove, debugging only
         std::atomic_int& traceId() override { return m_renderer.m_traceId; }
 
@@ -110,5 +120,8 @@ namespace ramses::internal
         std::chrono::microseconds m_sumFrameTimes{ 0 };
         std::chrono::microseconds m_maxFrameTime{ 0 };
         size_t m_loopsWithinMeasurePeriod{ 0u };
+        DurationHistogram m_frameTimeHistogram;
+
+        MetricsRegistry* m_metricsRegistry = nullptr;
     };
 }
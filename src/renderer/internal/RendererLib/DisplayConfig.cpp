@@ -223,6 +223,26 @@ namespace ramses::internal
     {
         return m_asyncEffectUploadEnabled;
     }
+
+    void DisplayConfig::setAsyncEffectUploadThreadCount(uint32_t threadCount)
+    {
+        m_asyncEffectUploadThreadCount = threadCount;
+    }
+
+    uint32_t DisplayConfig::getAsyncEffectUploadThreadCount() const
+    {
+        return m_asyncEffectUploadThreadCount;
+    }
+
+    void DisplayConfig::setEffectPrewarmingEnabled(bool enabled)
+    {
+        m_effectPrewarmingEnabled = enabled;
+    }
+
+    bool DisplayConfig::isEffectPrewarmingEnabled() const
+    {
+        return m_effectPrewarmingEnabled;
+    }
     void DisplayConfig::setWaylandEmbeddedCompositingSocketName(std::string_view socket)
     {
         m_waylandSocketEmbedded = socket;
@@ -337,6 +357,8 @@ namespace ramses::internal
             m_waylandDisplay             == other.m_waylandDisplay &&
             m_depthStencilBufferType     == other.m_depthStencilBufferType &&
             m_asyncEffectUploadEnabled   == other.m_asyncEffectUploadEnabled &&
+            m_asyncEffectUploadThreadCount == other.m_asyncEffectUploadThreadCount &&
+            m_effectPrewarmingEnabled    == other.m_effectPrewarmingEnabled &&
             m_waylandSocketEmbedded      == other.m_waylandSocketEmbedded &&
             m_waylandSocketEmbeddedGroupName    == other.m_waylandSocketEmbeddedGroupName &&
             m_waylandSocketEmbeddedPermissions  == other.m_waylandSocketEmbeddedPermissions &&
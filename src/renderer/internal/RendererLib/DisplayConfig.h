@@ -88,6 +88,12 @@ namespace ramses::internal
         void setAsyncEffectUploadEnabled(bool enabled);
         [[nodiscard]] bool isAsyncEffectUploadEnabled() const;
 
+        void setAsyncEffectUploadThreadCount(uint32_t threadCount);
+        [[nodiscard]] uint32_t getAsyncEffectUploadThreadCount() const;
+
+        void setEffectPrewarmingEnabled(bool enabled);
+        [[nodiscard]] bool isEffectPrewarmingEnabled() const;
+
         void setWaylandEmbeddedCompositingSocketName(std::string_view socket);
         [[nodiscard]] std::string_view getWaylandSocketEmbedded() const;
 
@@ -165,6 +171,8 @@ namespace ramses::internal
         glm::vec4 m_clearColor{ 0.f, 0.f, 0.f, 1.0f };
         EDepthBufferType m_depthStencilBufferType = EDepthBufferType::DepthStencil;
         bool m_asyncEffectUploadEnabled = true;
+        uint32_t m_asyncEffectUploadThreadCount = 1u;
+        bool m_effectPrewarmingEnabled = false;
 
         std::string m_waylandSocketEmbedded;
         std::string m_waylandSocketEmbeddedGroupName;
@@ -17,10 +17,12 @@ namespace ramses::internal
         std::unique_ptr<IPlatformFactory> platformFactory,
         RendererConfig config,
         IRendererSceneEventSender& rendererSceneSender,
-        IThreadAliveNotifier& notifier)
+        IThreadAliveNotifier& notifier,
+        MetricsRegistry* metricsRegistry)
         : m_platformFactory(std::move(platformFactory))
         , m_rendererConfig{ std::move(config) }
         , m_rendererSceneSender{ rendererSceneSender }
+        , m_metricsRegistry{ metricsRegistry }
         , m_notifier{ notifier }
     {
     }
@@ -185,12 +187,13 @@ namespace ramses::internal
             m_rendererSceneSender,
             *bundle.platform,
             m_notifier,
-            m_rendererConfig.getRenderThreadLoopTimingReportingPeriod())
+            m_rendererConfig.getRenderThreadLoopTimingReportingPeriod(),
+            m_metricsRegistry)
         };
         if (m_threadedDisplays)
         {
             LOG_INFO_P(CONTEXT_RENDERER, "DisplayDispatcher: creating update/render thread for display {}", displayHandle);
-            bundle.displayThread = std::make_unique<DisplayThread>(bundle.displayBundle, displayHandle, m_notifier);
+            bundle.displayThread = std::make_unique<DisplayThread>(bundle.displayBundle, displayHandle, m_notifier, m_rendererConfig.getFramePacingMode());
         }
 
         return bundle;
@@ -225,6 +228,9 @@ namespace ramses::internal
             }
             else
             {
+                if (auto* updateCmd = std::get_if<RendererCommand::UpdateScene>(&cmd))
+                    m_sharedResourcePool.share(updateCmd->updateData.resources);
+
                 // dispatch command to display
                 assert(m_displays.count(*cmdDisplay));
                 m_displays[*cmdDisplay].pendingCommands.push_back(std::move(cmd));
@@ -430,4 +436,9 @@ namespace ramses::internal
     {
         return m_rendererConfig;
     }
+
+    const SharedResourcePool& DisplayDispatcher::getSharedResourcePool() const
+    {
+        return m_sharedResourcePool;
+    }
 }
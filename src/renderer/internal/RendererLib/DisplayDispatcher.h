@@ -12,6 +12,7 @@
 #include "internal/RendererLib/RendererConfig.h"
 #include "internal/RendererLib/SceneDisplayTracker.h"
 #include "internal/RendererLib/DisplayThread.h"
+#include "internal/RendererLib/SharedResourcePool.h"
 #include "internal/RendererLib/Enums/ELoopMode.h"
 #include "internal/RendererLib/PlatformInterface/IPlatformFactory.h"
 #include "internal/Watchdog/IThreadAliveNotifier.h"
@@ -25,6 +26,7 @@ namespace ramses::internal
     class IEmbeddedCompositingManager;
     class IEmbeddedCompositor;
     class DisplayConfig;
+    class MetricsRegistry;
 
     class DisplayDispatcher
     {
@@ -33,7 +35,8 @@ namespace ramses::internal
             std::unique_ptr<IPlatformFactory> platformFactory,
             RendererConfig config,
             IRendererSceneEventSender& rendererSceneSender,
-            IThreadAliveNotifier& notifier);
+            IThreadAliveNotifier& notifier,
+            MetricsRegistry* metricsRegistry);
         virtual ~DisplayDispatcher() = default;
 
         void dispatchCommands(RendererCommandBuffer& cmds);
@@ -53,6 +56,7 @@ namespace ramses::internal
         [[nodiscard]] std::chrono::microseconds getMinFrameDuration(DisplayHandle display) const;
 
         [[nodiscard]] const RendererConfig& getRendererConfig() const;
+        [[nodiscard]] const SharedResourcePool& getSharedResourcePool() const;
 
         // needed for EC tests...
         IEmbeddedCompositingManager& getECManager(DisplayHandle display);
@@ -81,6 +85,10 @@ namespace ramses::internal
         std::unique_ptr<IPlatformFactory> m_platformFactory;
         const RendererConfig m_rendererConfig;
         IRendererSceneEventSender& m_rendererSceneSender;
+        MetricsRegistry* m_metricsRegistry;
+
+        // resources of scene updates are shared across displays so that they are decompressed and kept in memory only once
+        SharedResourcePool m_sharedResourcePool;
 
         SceneDisplayTracker m_sceneDisplayTrackerForCommands;
         SceneDisplayTracker m_sceneDisplayTrackerForEvents;
@@ -12,9 +12,10 @@
 
 namespace ramses::internal
 {
-    DisplayThread::DisplayThread(DisplayBundleShared displayBundle, DisplayHandle displayHandle, IThreadAliveNotifier& notifier)
+    DisplayThread::DisplayThread(DisplayBundleShared displayBundle, DisplayHandle displayHandle, IThreadAliveNotifier& notifier, EFramePacingMode framePacingMode)
         : m_displayHandle{ displayHandle }
         , m_display{ std::move(displayBundle) }
+        , m_framePacer{ framePacingMode }
         , m_thread{ fmt::format("R_DispThrd{}", displayHandle) }
         , m_notifier{ notifier }
         , m_aliveIdentifier{ notifier.registerThread() }
@@ -77,7 +78,7 @@ namespace ramses::internal
     {
         ThreadLocalLog::SetPrefix(static_cast<int>(m_displayHandle.asMemoryHandle()));
 
-        std::chrono::milliseconds lastLoopSleepTime{ 0u };
+        std::chrono::microseconds lastLoopSleepTime{ 0u };
         while (!isCancelRequested())
         {
             bool doUpdate = false;
@@ -111,8 +112,10 @@ namespace ramses::internal
                 const auto loopEndTime = std::chrono::steady_clock::now();
 
                 m_display->traceId() = 10005;
-                const auto currentLoopDuration = std::chrono::duration_cast<std::chrono::microseconds>(loopEndTime - loopStartTime);
-                lastLoopSleepTime = SleepToControlFramerate(currentLoopDuration, minimumFrameDuration);
+                const auto waitResult = m_framePacer.waitForNextFrame(loopStartTime, loopEndTime, minimumFrameDuration);
+                lastLoopSleepTime = waitResult.sleepTime;
+                if (waitResult.jitter)
+                    m_display->reportFramePacingJitter(*waitResult.jitter);
                 m_display->traceId() = 10006;
             }
 
@@ -124,21 +127,6 @@ namespace ramses::internal
         m_display.destroy();
     }
 
-    std::chrono::milliseconds DisplayThread::SleepToControlFramerate(std::chrono::microseconds loopDuration, std::chrono::microseconds minimumFrameDuration)
-    {
-        std::chrono::milliseconds sleepTime{ 0 };
-        if (loopDuration < minimumFrameDuration)
-        {
-            // we use millisecond sleep precision, this will cast microseconds to whole milliseconds (floor)
-            // so that we do not sleep more than necessary
-            sleepTime = std::chrono::duration_cast<std::chrono::milliseconds>(minimumFrameDuration - loopDuration);
-            if (sleepTime.count() > 0)
-                std::this_thread::sleep_for(sleepTime);
-        }
-
-        return sleepTime;
-    }
-
     uint32_t DisplayThread::getFrameCounter() const
     {
         return m_frameCounter;
@@ -10,6 +10,7 @@
 
 #include "internal/RendererLib/Enums/ELoopMode.h"
 #include "internal/RendererLib/DisplayBundle.h"
+#include "internal/RendererLib/FramePacer.h"
 #include "internal/PlatformAbstraction/PlatformThread.h"
 #include "internal/Watchdog/IThreadAliveNotifier.h"
 
@@ -69,7 +70,7 @@ namespace ramses::internal
     class DisplayThread final : public IDisplayThread, private Runnable
     {
     public:
-        DisplayThread(DisplayBundleShared displayBundle, DisplayHandle displayHandle, IThreadAliveNotifier& notifier);
+        DisplayThread(DisplayBundleShared displayBundle, DisplayHandle displayHandle, IThreadAliveNotifier& notifier, EFramePacingMode framePacingMode = EFramePacingMode::Sleep);
         ~DisplayThread() override;
 
         void startUpdating() override;
@@ -82,12 +83,11 @@ namespace ramses::internal
     private:
         void run() override;
 
-        static std::chrono::milliseconds SleepToControlFramerate(std::chrono::microseconds loopDuration, std::chrono::microseconds minimumFrameDuration);
-
         const DisplayHandle m_displayHandle;
         DisplayBundleShared m_display;
         ELoopMode m_loopMode = ELoopMode::UpdateAndRender;
         std::chrono::microseconds m_minFrameDuration{ DefaultMinFrameDuration };
+        FramePacer m_framePacer;
 
         PlatformThread m_thread;
         mutable std::mutex m_lock;
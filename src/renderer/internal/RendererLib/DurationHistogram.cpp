@@ -0,0 +1,88 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/DurationHistogram.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace ramses::internal
+{
+    void DurationHistogram::record(uint64_t value)
+    {
+        m_buckets[GetBucketIndex(value)]++;
+        m_count++;
+        m_max = std::max(m_max, value);
+    }
+
+    void DurationHistogram::reset()
+    {
+        if (m_count == 0u)
+            return;
+        m_buckets.fill(0u);
+        m_count = 0u;
+        m_max = 0u;
+    }
+
+    uint64_t DurationHistogram::getCount() const
+    {
+        return m_count;
+    }
+
+    uint64_t DurationHistogram::getMax() const
+    {
+        return m_max;
+    }
+
+    uint64_t DurationHistogram::getPercentile(double percentile) const
+    {
+        assert(percentile >= 0.0 && percentile <= 100.0);
+        if (m_count == 0u)
+            return 0u;
+
+        // rank of the sample which is reported as percentile, at least the first one
+        const auto rank = std::max<uint64_t>(1u, static_cast<uint64_t>(std::ceil(percentile * static_cast<double>(m_count) / 100.0)));
+        uint64_t cumulativeCount = 0u;
+        for (size_t i = 0u; i < NumberOfBuckets; ++i)
+        {
+            cumulativeCount += m_buckets[i];
+            if (cumulativeCount >= rank)
+                return std::min(GetBucketUpperValue(i), m_max);
+        }
+
+        return m_max;
+    }
+
+    DurationHistogram::Percentiles DurationHistogram::getPercentiles() const
+    {
+        return { m_count, getPercentile(50.0), getPercentile(90.0), getPercentile(99.0), m_max };
+    }
+
+    size_t DurationHistogram::GetBucketIndex(uint64_t value)
+    {
+        value = std::min(value, MaxTrackableValue);
+        // shift value until it fits into [SubBucketCount, 2*SubBucketCount), the shift is the magnitude of the value
+        uint32_t magnitude = 0u;
+        while ((value >> magnitude) >= 2u * SubBucketCount)
+            ++magnitude;
+
+        return static_cast<size_t>(magnitude * SubBucketCount + (value >> magnitude));
+    }
+
+    uint64_t DurationHistogram::GetBucketUpperValue(size_t bucketIndex)
+    {
+        assert(bucketIndex < NumberOfBuckets);
+        if (bucketIndex < 2u * SubBucketCount)
+            return bucketIndex;
+
+        const auto magnitude = bucketIndex / SubBucketCount - 1u;
+        const auto subBucket = bucketIndex - magnitude * SubBucketCount;
+        return ((subBucket + 1u) << magnitude) - 1u;
+    }
+}
@@ -0,0 +1,54 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ramses::internal
+{
+    // Fixed-size histogram with HDR-style bucketing: values below 2*SubBucketCount have exact buckets, every following
+    // power of two range is split into SubBucketCount linear buckets. Percentiles are therefore reported with a relative
+    // error below 1/SubBucketCount while recording is just an index computation and an increment (no allocation).
+    // Values above MaxTrackableValue are counted in the last bucket, the exact maximum is tracked separately.
+    class DurationHistogram
+    {
+    public:
+        struct Percentiles
+        {
+            uint64_t count = 0u;
+            uint64_t p50 = 0u;
+            uint64_t p90 = 0u;
+            uint64_t p99 = 0u;
+            uint64_t max = 0u;
+        };
+
+        void record(uint64_t value);
+        void reset();
+
+        [[nodiscard]] uint64_t getCount() const;
+        [[nodiscard]] uint64_t getMax() const;
+        [[nodiscard]] uint64_t getPercentile(double percentile) const;
+        [[nodiscard]] Percentiles getPercentiles() const;
+
+        [[nodiscard]] static size_t GetBucketIndex(uint64_t value);
+        [[nodiscard]] static uint64_t GetBucketUpperValue(size_t bucketIndex);
+
+        static constexpr uint64_t SubBucketCount = 32u;
+        static constexpr uint32_t MaxMagnitude = 21u;
+        static constexpr uint64_t MaxTrackableValue = ((2u * SubBucketCount) << MaxMagnitude) - 1u;
+        static constexpr size_t NumberOfBuckets = (MaxMagnitude + 2u) * SubBucketCount;
+
+    private:
+        std::array<uint64_t, NumberOfBuckets> m_buckets{};
+        uint64_t m_count = 0u;
+        uint64_t m_max = 0u;
+    };
+}
@@ -113,13 +113,18 @@ namespace ramses::internal
 
         for (const auto streamTextureSourceId : updatedStreamTextureSourceIds)
         {
-            const StreamTextureSourceInfo* streamTextureSourceInfo = m_streamTextureSourceInfoMap.get(streamTextureSourceId);
+            StreamTextureSourceInfo* streamTextureSourceInfo = m_streamTextureSourceInfoMap.get(streamTextureSourceId);
             if (nullptr != streamTextureSourceInfo)
             {
-                const uint32_t bufferUpdateCount = m_embeddedCompositor.uploadCompositingContentForStreamTexture(streamTextureSourceId, streamTextureSourceInfo->compositedTextureHandle, m_textureUploadingAdapter);
-                updatedStreams.push_back({ streamTextureSourceId, bufferUpdateCount });
+                const auto uploadResult = m_embeddedCompositor.uploadCompositingContentForStreamTexture(streamTextureSourceId, streamTextureSourceInfo->compositedTextureHandle, m_textureUploadingAdapter, streamTextureSourceInfo->fullUploadRequired);
+                streamTextureSourceInfo->fullUploadRequired = false;
+                updatedStreams.push_back({ streamTextureSourceId, uploadResult.numCommitedFrames, uploadResult.numBytesUploaded });
             }
         }
+
+        // texture uploading adapter binds textures directly, bypassing device
+        if (!updatedStreams.empty())
+            m_device.invalidateStateCache();
     }
 
     void EmbeddedCompositingManager::notifyClients()
@@ -136,13 +141,15 @@ namespace ramses::internal
         StreamTextureSourceInfo streamTextureSourceInfo;
         streamTextureSourceInfo.compositedTextureHandle = compositedTextureDeviceHandle;
         streamTextureSourceInfo.contentAvailable = false;
-        m_streamTextureSourceInfoMap.put(source, streamTextureSourceInfo);
 
         if (m_embeddedCompositor.isContentAvailableForStreamTexture(source))
         {
             LOG_DEBUG(CONTEXT_RENDERER, "EmbeddedCompositingManager::uploadStreamTexture Content available for stream texture " << source);
-            m_embeddedCompositor.uploadCompositingContentForStreamTexture(source, streamTextureSourceInfo.compositedTextureHandle, m_textureUploadingAdapter);
+            m_embeddedCompositor.uploadCompositingContentForStreamTexture(source, streamTextureSourceInfo.compositedTextureHandle, m_textureUploadingAdapter, true);
+            m_device.invalidateStateCache();
+            streamTextureSourceInfo.fullUploadRequired = false;
         }
+        m_streamTextureSourceInfoMap.put(source, streamTextureSourceInfo);
     }
 
     void EmbeddedCompositingManager::destroyStreamTexture(WaylandIviSurfaceId source)
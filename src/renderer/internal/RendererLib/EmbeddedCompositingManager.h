@@ -39,6 +39,7 @@ namespace ramses::internal
             DeviceResourceHandle compositedTextureHandle;
             int refs = 0;
             bool contentAvailable = false;
+            bool fullUploadRequired = true;
         };
 
         void createStreamTexture(WaylandIviSurfaceId source);
@@ -0,0 +1,124 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/FramePacer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#if defined(__linux__)
+#include <time.h>
+#include <cerrno>
+#endif
+
+namespace ramses::internal
+{
+    FramePacer::FramePacer(EFramePacingMode mode)
+        : m_mode{ mode }
+    {
+    }
+
+    FramePacer::Clock::time_point FramePacer::planNextFrameStart(Clock::time_point loopStart, Clock::time_point loopEnd, std::chrono::microseconds minFrameDuration)
+    {
+        const auto loopDuration = std::chrono::duration_cast<std::chrono::microseconds>(loopEnd - loopStart);
+        if (m_mode == EFramePacingMode::Sleep)
+        {
+            if (loopDuration >= minFrameDuration)
+                return loopEnd;
+            // we use millisecond sleep precision, this will cast microseconds to whole milliseconds (floor)
+            // so that we do not sleep more than necessary
+            return loopEnd + std::chrono::duration_cast<std::chrono::milliseconds>(minFrameDuration - loopDuration);
+        }
+
+        updateFrameDurationEstimate(loopDuration);
+        if (minFrameDuration.count() <= 0)
+        {
+            m_deadline.reset();
+            return loopEnd;
+        }
+
+        // missed deadline (or first frame, or display was not updating for a while) - align grid to the frame just finished
+        if (!m_deadline || loopEnd > *m_deadline)
+            m_deadline = loopEnd;
+        *m_deadline += minFrameDuration;
+
+        const auto estimate = std::min(getFrameDurationEstimate(), minFrameDuration);
+        return std::max(loopEnd, *m_deadline - estimate);
+    }
+
+    FramePacer::WaitResult FramePacer::waitForNextFrame(Clock::time_point loopStart, Clock::time_point loopEnd, std::chrono::microseconds minFrameDuration)
+    {
+        const auto plannedStart = planNextFrameStart(loopStart, loopEnd, minFrameDuration);
+        if (plannedStart <= loopEnd)
+            return {};
+
+        if (m_mode == EFramePacingMode::DeadlineWithSpin)
+        {
+            const auto spinStart = plannedStart - SpinDuration;
+            if (spinStart > loopEnd)
+                SleepUntil(spinStart);
+            while (Clock::now() < plannedStart)
+                std::this_thread::yield();
+        }
+        else
+        {
+            SleepUntil(plannedStart);
+        }
+
+        const auto wakeUpTime = Clock::now();
+        // in Sleep mode precision loss of sleeping whole milliseconds is part of the jitter
+        const auto idealStart = (m_mode == EFramePacingMode::Sleep ? loopStart + minFrameDuration : plannedStart);
+        WaitResult result;
+        result.sleepTime = std::chrono::duration_cast<std::chrono::microseconds>(wakeUpTime - loopEnd);
+        result.jitter = std::chrono::duration_cast<std::chrono::microseconds>(wakeUpTime > idealStart ? wakeUpTime - idealStart : idealStart - wakeUpTime);
+        return result;
+    }
+
+    void FramePacer::updateFrameDurationEstimate(std::chrono::microseconds frameDuration)
+    {
+        const auto duration = static_cast<double>(frameDuration.count());
+        if (!m_hasEstimate)
+        {
+            m_avgFrameDuration = duration;
+            m_frameDurationDeviation = duration / 2.0;
+            m_hasEstimate = true;
+            return;
+        }
+
+        const double error = duration - m_avgFrameDuration;
+        m_avgFrameDuration += error / 8.0;
+        m_frameDurationDeviation += (std::abs(error) - m_frameDurationDeviation) / 4.0;
+    }
+
+    EFramePacingMode FramePacer::getMode() const
+    {
+        return m_mode;
+    }
+
+    std::chrono::microseconds FramePacer::getFrameDurationEstimate() const
+    {
+        return std::chrono::microseconds{ static_cast<int64_t>(m_avgFrameDuration + 4.0 * m_frameDurationDeviation) };
+    }
+
+    void FramePacer::SleepUntil(Clock::time_point wakeUpTime)
+    {
+#if defined(__linux__)
+        // steady_clock is CLOCK_MONOTONIC, absolute timeout avoids drift from time spent computing relative sleep
+        const auto sinceEpoch = std::chrono::duration_cast<std::chrono::nanoseconds>(wakeUpTime.time_since_epoch()).count();
+        timespec ts{};
+        ts.tv_sec = static_cast<time_t>(sinceEpoch / 1000000000);
+        ts.tv_nsec = static_cast<long>(sinceEpoch % 1000000000);
+        while (::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+        {
+        }
+#else
+        std::this_thread::sleep_until(wakeUpTime);
+#endif
+    }
+}
@@ -0,0 +1,60 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/RendererLib/Enums/EFramePacingMode.h"
+
+#include <chrono>
+#include <optional>
+
+namespace ramses::internal
+{
+    // Decides when a display thread starts its next frame to keep the minimum frame duration.
+    // In Sleep mode the remaining time of the frame is slept with millisecond precision (legacy behavior).
+    // In deadline modes frames are aligned to a fixed grid of deadlines (one per min frame duration), each frame is started
+    // as late as possible before its deadline using an estimate of update/render duration. The estimate is a smoothed mean
+    // plus four times the smoothed mean deviation of measured durations (same estimator as TCP retransmission timeout),
+    // so that an occasional slow frame widens the safety margin quickly while a stable workload keeps it small.
+    class FramePacer
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        struct WaitResult
+        {
+            std::chrono::microseconds sleepTime{ 0 };
+            // difference between planned and actual wake-up, not set if no waiting was needed
+            std::optional<std::chrono::microseconds> jitter;
+        };
+
+        explicit FramePacer(EFramePacingMode mode);
+
+        // computes the time the next frame should start at, updates frame duration estimate and deadline
+        Clock::time_point planNextFrameStart(Clock::time_point loopStart, Clock::time_point loopEnd, std::chrono::microseconds minFrameDuration);
+        // plans next frame start and blocks until then
+        WaitResult waitForNextFrame(Clock::time_point loopStart, Clock::time_point loopEnd, std::chrono::microseconds minFrameDuration);
+
+        [[nodiscard]] EFramePacingMode getMode() const;
+        [[nodiscard]] std::chrono::microseconds getFrameDurationEstimate() const;
+
+        static void SleepUntil(Clock::time_point wakeUpTime);
+
+        // DeadlineWithSpin sleeps until this long before planned start and spins for the rest
+        static constexpr std::chrono::microseconds SpinDuration{ 200 };
+
+    private:
+        void updateFrameDurationEstimate(std::chrono::microseconds frameDuration);
+
+        const EFramePacingMode m_mode;
+        std::optional<Clock::time_point> m_deadline;
+        bool m_hasEstimate = false;
+        double m_avgFrameDuration = 0.0;
+        double m_frameDurationDeviation = 0.0;
+    };
+}
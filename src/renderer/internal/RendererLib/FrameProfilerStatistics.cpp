@@ -39,6 +39,7 @@ namespace ramses::internal
 
         const auto totalRegionTime = static_cast<size_t>(PlatformTime::GetMicrosecondsMonotonic() - m_regionStartTimes[regionId]);
         m_frameTimings[m_frameTimings.size() - NumberOfRegions + regionId] = totalRegionTime;
+        m_regionHistograms[regionId].record(totalRegionTime);
     }
 
     void FrameProfilerStatistics::initNextFrameTimings()
@@ -92,18 +93,36 @@ namespace ramses::internal
         {
             str << " no frames tracked";
         }
+
+        str << "\nRegion time(us) p50/p90/p99/max:";
+        for (size_t reg = 0u; reg < NumberOfRegions; ++reg)
+        {
+            const auto percentiles = m_regionHistograms[reg].getPercentiles();
+            if (percentiles.count > 0u)
+                str << " " << EnumToString(ERegion(reg)) << ":" << percentiles.p50 << "/" << percentiles.p90 << "/" << percentiles.p99 << "/" << percentiles.max;
+        }
     }
 
     void FrameProfilerStatistics::resetFrameTimings()
     {
         m_frameTimings.clear();
         initNextFrameTimings();
+        for (auto& histogram : m_regionHistograms)
+            histogram.reset();
+    }
+
+    DurationHistogram::Percentiles FrameProfilerStatistics::getRegionPercentiles(ERegion region) const
+    {
+        return m_regionHistograms[static_cast<size_t>(region)].getPercentiles();
     }
 
     void FrameProfilerStatistics::setSleepTimeForPreviousFrame(std::chrono::microseconds prevFrameSleepTime)
     {
         assert(prevFrameSleepTime.count() >= 0);
         if (m_frameTimings.size() > NumberOfRegions)
+        {
             m_frameTimings[m_frameTimings.size() - NumberOfRegions - 1] = static_cast<size_t>(prevFrameSleepTime.count());
+            m_regionHistograms[static_cast<size_t>(ERegion::MaxFramerateSleep)].record(static_cast<uint64_t>(prevFrameSleepTime.count()));
+        }
     }
 }
@@ -11,6 +11,7 @@
 #include "internal/PlatformAbstraction/PlatformTime.h"
 #include "internal/PlatformAbstraction/Collections/Vector.h"
 #include "internal/Core/Utils/LoggingUtils.h"
+#include "internal/RendererLib/DurationHistogram.h"
 
 namespace ramses::internal
 {
@@ -65,6 +66,8 @@ namespace ramses::internal
         void writeLongestFrameTimingsToStream(StringOutputStream& str) const;
         void resetFrameTimings();
 
+        [[nodiscard]] DurationHistogram::Percentiles getRegionPercentiles(ERegion region) const;
+
     private:
         void initNextFrameTimings();
         void setSleepTimeForPreviousFrame(std::chrono::microseconds prevFrameSleepTime);
@@ -81,6 +84,10 @@ namespace ramses::internal
         static const uint32_t NumberOfRegions = static_cast<uint32_t>(RegionNames.size());
         static_assert(EnumTraits::VerifyElementCountIfSupported<ERegion>(NumberOfRegions));
         static const uint32_t NumberOfFrames = 600u;
+
+        // region time distribution in microseconds for periodic logging, unlike m_frameTimings these are not limited
+        // to a number of frames, reset every period
+        std::array<DurationHistogram, NumberOfRegions> m_regionHistograms;
     };
 
     class ScopedFrameProfilerRegion
@@ -20,6 +20,7 @@ namespace ramses::internal
         ResourcesUpload = 0,
         SceneResourcesUpload,
         OffscreenBufferRender,
+        SceneActionsApply,
 
         COUNT
     };
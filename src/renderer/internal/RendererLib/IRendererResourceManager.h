@@ -38,6 +38,8 @@ namespace ramses::internal
         virtual void             unreferenceResourcesForScene   (SceneId sceneId, const ResourceContentHashVector& resources) = 0;
 
         virtual void             provideResourceData(const ManagedResource& mr) = 0;
+        // compiles effects ahead of their scene being mapped, other resource types are ignored
+        virtual void             prewarmEffects(const ManagedResourceVector& resources) = 0;
         [[nodiscard]] virtual bool             hasResourcesToBeUploaded() const = 0;
         virtual void             uploadAndUnloadPendingResources() = 0;
 
@@ -52,7 +54,8 @@ namespace ramses::internal
 
         virtual void             uploadDataBuffer(DataBufferHandle dataBufferHandle, EDataBufferType dataBufferType, EDataType dataType, uint32_t dataSizeInBytes, SceneId sceneId) = 0;
         virtual void             unloadDataBuffer(DataBufferHandle dataBufferHandle, SceneId sceneId) = 0;
-        virtual void             updateDataBuffer(DataBufferHandle handle, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId) = 0;
+        // data points to the whole buffer content, only the given modified range is uploaded unless the device buffer has no data yet
+        virtual void             updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId) = 0;
 
         virtual void             uploadTextureBuffer(TextureBufferHandle textureBufferHandle, uint32_t width, uint32_t height, EPixelStorageFormat textureFormat, uint32_t mipLevelCount,  SceneId sceneId) = 0;
         virtual void             unloadTextureBuffer(TextureBufferHandle textureBufferHandle, SceneId sceneId) = 0;
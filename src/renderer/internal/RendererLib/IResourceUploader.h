@@ -29,5 +29,6 @@ namespace ramses::internal
         virtual std::optional<DeviceResourceHandle> uploadResource(IRenderBackend& renderBackend, const ResourceDescriptor& resourceObject, uint32_t& outVRAMSize) = 0;
         virtual void                 unloadResource(IRenderBackend& renderBackend, EResourceType type, ResourceContentHash hash, DeviceResourceHandle handle) = 0;
         virtual void                 storeShaderInBinaryShaderCache(IRenderBackend& renderBackend, DeviceResourceHandle deviceHandle, const ResourceContentHash& hash, SceneId sceneid) = 0;
+        virtual bool                 hasShaderInBinaryShaderCache(IRenderBackend& renderBackend, const ResourceContentHash& hash) = 0;
     };
 }
@@ -204,6 +204,11 @@ namespace ramses::internal
         m_logContext << "upload vertex buffer data [device handle: " << handle << " size: " << dataSize << "]" << RendererLogContext::NewLine;
     }
 
+    void LoggingDevice::updateVertexBufferData(DeviceResourceHandle handle, uint32_t offset, const std::byte* /*data*/, uint32_t dataSize)
+    {
+        m_logContext << "update vertex buffer data [device handle: " << handle << " offset: " << offset << " size: " << dataSize << "]" << RendererLogContext::NewLine;
+    }
+
     void LoggingDevice::deleteVertexBuffer(DeviceResourceHandle handle)
     {
         m_logContext << "delete vertex buffer [handle: " << handle << "]" << RendererLogContext::NewLine;
@@ -236,6 +241,11 @@ namespace ramses::internal
         m_logContext << "upload index buffer data [device handle: " << handle << " size: " << dataSize << "]" << RendererLogContext::NewLine;
     }
 
+    void LoggingDevice::updateIndexBufferData(DeviceResourceHandle handle, uint32_t offset, const std::byte* /*data*/, uint32_t dataSize)
+    {
+        m_logContext << "update index buffer data [device handle: " << handle << " offset: " << offset << " size: " << dataSize << "]" << RendererLogContext::NewLine;
+    }
+
     void LoggingDevice::deleteIndexBuffer(DeviceResourceHandle handle)
     {
         m_logContext << "delete index buffer [handle: " << handle << "]" << RendererLogContext::NewLine;
@@ -333,6 +343,11 @@ namespace ramses::internal
         return DeviceResourceHandle::Invalid();
     }
 
+    void LoggingDevice::updateStreamTexture2D(DeviceResourceHandle handle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t stride, EPixelStorageFormat /*format*/, const std::byte* /*data*/)
+    {
+        m_logContext << "update stream texture2d [textureHandle: " << handle << " (x,y,w,h):(" << x << "," << y << "," << width << "," << height << ") stride: " << stride << "]" << RendererLogContext::NewLine;
+    }
+
     void LoggingDevice::deleteTexture(DeviceResourceHandle handle)
     {
         m_logContext << "delete texture [handle: " << handle << "]" << RendererLogContext::NewLine;
@@ -513,6 +528,15 @@ namespace ramses::internal
         return 0;
     }
 
+    DeviceStateChangeCounts LoggingDevice::getAndResetStateChangeCounts()
+    {
+        return {};
+    }
+
+    void LoggingDevice::invalidateStateCache()
+    {
+    }
+
     void LoggingDevice::flush()
     {
     }
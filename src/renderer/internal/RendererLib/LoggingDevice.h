@@ -50,12 +50,14 @@ namespace ramses::internal
 
         DeviceResourceHandle allocateVertexBuffer(uint32_t totalSizeInBytes) override;
         void uploadVertexBufferData(DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) override;
+        void updateVertexBufferData(DeviceResourceHandle handle, uint32_t offset, const std::byte* data, uint32_t dataSize) override;
         void deleteVertexBuffer(DeviceResourceHandle handle) override;
         DeviceResourceHandle allocateVertexArray(const VertexArrayInfo& vertexArrayInfo) override;
         void activateVertexArray(DeviceResourceHandle handle) override;
         void deleteVertexArray(DeviceResourceHandle handle) override;
         DeviceResourceHandle allocateIndexBuffer(EDataType dataType, uint32_t sizeInBytes) override;
         void uploadIndexBufferData(DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) override;
+        void updateIndexBufferData(DeviceResourceHandle handle, uint32_t offset, const std::byte* data, uint32_t dataSize) override;
         void deleteIndexBuffer(DeviceResourceHandle handle) override;
         std::unique_ptr<const GPUResource> uploadShader(const EffectResource& effect) override;
         DeviceResourceHandle registerShader(std::unique_ptr<const GPUResource> shaderResource) override;
@@ -72,6 +74,7 @@ namespace ramses::internal
         void                 generateMipmaps(DeviceResourceHandle handle) override;
         void                 uploadTextureData(DeviceResourceHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t z, uint32_t width, uint32_t height, uint32_t depth, const std::byte* data, uint32_t dataSize, uint32_t stride) override;
         DeviceResourceHandle uploadStreamTexture2D(DeviceResourceHandle handle, uint32_t width, uint32_t height, EPixelStorageFormat format, const std::byte* data, const TextureSwizzleArray& swizzle) override;
+        void updateStreamTexture2D(DeviceResourceHandle handle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t stride, EPixelStorageFormat format, const std::byte* data) override;
         void deleteTexture(DeviceResourceHandle handle) override;
         void activateTexture(DeviceResourceHandle handle, DataFieldHandle field) override;
         DeviceResourceHandle    uploadRenderBuffer(uint32_t width, uint32_t height, EPixelStorageFormat format, ERenderBufferAccessMode accessMode, uint32_t sampleCount) override;
@@ -102,6 +105,8 @@ namespace ramses::internal
 
         [[nodiscard]] uint32_t getTotalGpuMemoryUsageInKB() const override;
         uint32_t getAndResetDrawCallCount() override;
+        DeviceStateChangeCounts getAndResetStateChangeCounts() override;
+        void invalidateStateCache() override;
 
         void clearDepth(float d) override;
         void clearStencil(int32_t s) override;
@@ -115,7 +115,9 @@ namespace ramses::internal
             case ESceneResourceAction_UpdateDataBuffer:
             {
                 const GeometryDataBuffer& dataBuffer = scene.getDataBuffer(DataBufferHandle(handle));
-                resourceManager.updateDataBuffer(DataBufferHandle(handle), static_cast<uint32_t>(dataBuffer.data.size()), dataBuffer.data.data(), scene.getSceneId());
+                const auto& update = scene.getDataBufferUpdate(DataBufferHandle(handle));
+                resourceManager.updateDataBuffer(DataBufferHandle(handle), update.offset, update.size, dataBuffer.data.data(), scene.getSceneId());
+                scene.popDataBufferUpdate(DataBufferHandle(handle));
             }
                 break;
             case ESceneResourceAction_CreateTextureBuffer:
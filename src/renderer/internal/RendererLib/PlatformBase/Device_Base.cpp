@@ -44,4 +44,11 @@ namespace ramses::internal
         m_drawCalls = 0u;
         return dc;
     }
+
+    DeviceStateChangeCounts Device_Base::getAndResetStateChangeCounts()
+    {
+        const auto counts = m_stateChanges;
+        m_stateChanges = {};
+        return counts;
+    }
 }
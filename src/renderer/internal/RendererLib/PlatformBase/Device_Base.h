@@ -23,6 +23,7 @@ namespace ramses::internal
 
         // from IDevice
         uint32_t getAndResetDrawCallCount() override;
+        DeviceStateChangeCounts getAndResetStateChangeCounts() override;
         void     drawIndexedTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount) override;
         void     drawTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount) override;
         [[nodiscard]] uint32_t getGPUHandle(DeviceResourceHandle deviceHandle) const override;
@@ -35,5 +36,6 @@ namespace ramses::internal
 
         RendererLimits m_limits;
         uint32_t m_drawCalls = 0u;
+        DeviceStateChangeCounts m_stateChanges;
     };
 }
@@ -24,10 +24,10 @@ namespace ramses::internal
         LOG_TRACE(CONTEXT_RENDERER, "EmbeddedCompositor_Dummy::endFrame");
     }
 
-    uint32_t EmbeddedCompositor_Dummy::uploadCompositingContentForStreamTexture(WaylandIviSurfaceId streamTextureSourceId, [[maybe_unused]] DeviceResourceHandle textureHandle, [[maybe_unused]] ITextureUploadingAdapter& textureUploadingAdapter)
+    StreamTextureUploadResult EmbeddedCompositor_Dummy::uploadCompositingContentForStreamTexture(WaylandIviSurfaceId streamTextureSourceId, [[maybe_unused]] DeviceResourceHandle textureHandle, [[maybe_unused]] ITextureUploadingAdapter& textureUploadingAdapter, [[maybe_unused]] bool fullUpload)
     {
         LOG_TRACE(CONTEXT_RENDERER, "EmbeddedCompositor_Dummy::uploadCompositingContentForStreamTexture: " << streamTextureSourceId.getValue());
-        return 0;
+        return {};
     }
 
     WaylandIviSurfaceIdSet EmbeddedCompositor_Dummy::dispatchUpdatedStreamTextureSourceIds()
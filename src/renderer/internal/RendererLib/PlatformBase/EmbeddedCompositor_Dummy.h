@@ -23,7 +23,7 @@ namespace ramses::internal
         WaylandIviSurfaceIdSet dispatchNewStreamTextureSourceIds() override;
         WaylandIviSurfaceIdSet dispatchObsoleteStreamTextureSourceIds() override;
         void endFrame(bool notifyClients) override;
-        uint32_t uploadCompositingContentForStreamTexture(WaylandIviSurfaceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter) override;
+        StreamTextureUploadResult uploadCompositingContentForStreamTexture(WaylandIviSurfaceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter, bool fullUpload) override;
 
         [[nodiscard]] bool isContentAvailableForStreamTexture(WaylandIviSurfaceId streamTextureSourceId) const override;
         [[nodiscard]] uint64_t getNumberOfCommitedFramesForWaylandIviSurfaceSinceBeginningOfTime(WaylandIviSurfaceId waylandSurfaceId) const override;
@@ -20,6 +20,7 @@
 #include "internal/RendererLib/PlatformBase/TextureUploadingAdapter_Base.h"
 #include "internal/RendererLib/PlatformBase/EmbeddedCompositor_Dummy.h"
 #include "internal/Core/Utils/ThreadLocalLog.h"
+#include <algorithm>
 
 namespace ramses::internal
 {
@@ -34,7 +35,7 @@ namespace ramses::internal
         assert(!m_embeddedCompositor);
         assert(!m_window);
         assert(!m_renderBackend);
-        assert(!m_resourceUploadRenderBackend);
+        assert(m_resourceUploadRenderBackends.empty());
         assert(!m_textureUploadingAdapter);
     }
 
@@ -141,6 +142,8 @@ namespace ramses::internal
 
     IResourceUploadRenderBackend* Platform_Base::createResourceUploadRenderBackend()
     {
+        std::lock_guard<std::mutex> guard(m_resourceUploadRenderBackendsLock);
+
         assert(!m_contextUploading);
         if (!createContextUploading())
         {
@@ -157,19 +160,24 @@ namespace ramses::internal
             return nullptr;
         }
 
-        assert(!m_resourceUploadRenderBackend);
-        m_resourceUploadRenderBackend = std::make_unique<ResourceUploadRenderBackend>(*m_contextUploading, *m_deviceUploading);
+        auto resourceUploadRenderBackend = std::make_unique<ResourceUploadRenderBackend>(*m_contextUploading, *m_deviceUploading);
+        IResourceUploadRenderBackend* resourceUploadRenderBackendPtr = resourceUploadRenderBackend.get();
+        m_resourceUploadRenderBackends.push_back({ std::move(m_contextUploading), std::move(m_deviceUploading), std::move(resourceUploadRenderBackend) });
 
-        return m_resourceUploadRenderBackend.get();
+        return resourceUploadRenderBackendPtr;
     }
 
-    void Platform_Base::destroyResourceUploadRenderBackend()
+    void Platform_Base::destroyResourceUploadRenderBackend(IResourceUploadRenderBackend& resourceUploadRenderBackend)
     {
-        assert(m_resourceUploadRenderBackend);
-        m_deviceUploading.reset();
-        m_contextUploading->disable();
-        m_contextUploading.reset();
-        m_resourceUploadRenderBackend.reset();
+        std::lock_guard<std::mutex> guard(m_resourceUploadRenderBackendsLock);
+
+        auto it = std::find_if(m_resourceUploadRenderBackends.begin(), m_resourceUploadRenderBackends.end(),
+            [&](const auto& components) { return components.renderBackend.get() == &resourceUploadRenderBackend; });
+        assert(it != m_resourceUploadRenderBackends.end());
+        it->device.reset();
+        it->context->disable();
+        it->context.reset();
+        m_resourceUploadRenderBackends.erase(it);
     }
 
     ISystemCompositorController* Platform_Base::getSystemCompositorController()
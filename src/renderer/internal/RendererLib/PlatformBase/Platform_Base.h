@@ -13,6 +13,7 @@
 #include "internal/PlatformAbstraction/Collections/Vector.h"
 #include <vector>
 #include <memory>
+#include <mutex>
 
 namespace ramses::internal
 {
@@ -30,7 +31,7 @@ namespace ramses::internal
         void            destroyRenderBackend()  final override;
 
         IResourceUploadRenderBackend* createResourceUploadRenderBackend() final override;
-        void                          destroyResourceUploadRenderBackend() final override;
+        void                          destroyResourceUploadRenderBackend(IResourceUploadRenderBackend& resourceUploadRenderBackend) final override;
 
         ISystemCompositorController* getSystemCompositorController() override;
 
@@ -51,9 +52,9 @@ namespace ramses::internal
         RendererConfig m_rendererConfig;
 
         std::unique_ptr<IRenderBackend> m_renderBackend;
-        std::unique_ptr<IResourceUploadRenderBackend> m_resourceUploadRenderBackend;
         std::unique_ptr<IWindow> m_window;
         std::unique_ptr<IContext> m_context;
+        // filled by createContextUploading/createDeviceUploading, ownership is moved to m_resourceUploadRenderBackends once created
         std::unique_ptr<IContext> m_contextUploading;
         std::unique_ptr<IDeviceExtension> m_deviceExtension;
         std::unique_ptr<IDevice> m_device;
@@ -61,5 +62,16 @@ namespace ramses::internal
         std::unique_ptr<ISystemCompositorController> m_systemCompositorController;
         std::unique_ptr<IEmbeddedCompositor> m_embeddedCompositor;
         std::unique_ptr<ITextureUploadingAdapter> m_textureUploadingAdapter;
+
+    private:
+        struct ResourceUploadComponents
+        {
+            std::unique_ptr<IContext> context;
+            std::unique_ptr<IDevice> device;
+            std::unique_ptr<IResourceUploadRenderBackend> renderBackend;
+        };
+        // there can be multiple resource upload render backends (each with own shared context) used from different threads
+        std::vector<ResourceUploadComponents> m_resourceUploadRenderBackends;
+        std::mutex m_resourceUploadRenderBackendsLock;
     };
 }
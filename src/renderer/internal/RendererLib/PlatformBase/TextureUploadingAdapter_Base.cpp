@@ -20,4 +20,9 @@ namespace ramses::internal
     {
         m_device.uploadStreamTexture2D(textureHandle, width, height, format, data, swizzle);
     }
+
+    void TextureUploadingAdapter_Base::updateTexture2D(DeviceResourceHandle textureHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t stride, EPixelStorageFormat format, const std::byte* data)
+    {
+        m_device.updateStreamTexture2D(textureHandle, x, y, width, height, stride, format, data);
+    }
 }
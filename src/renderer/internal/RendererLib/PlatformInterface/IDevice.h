@@ -24,6 +24,12 @@ namespace ramses::internal
     struct PixelRectangle;
     struct TextureSamplerStates;
 
+    struct DeviceStateChangeCounts
+    {
+        uint32_t issued = 0u;
+        uint32_t skipped = 0u;
+    };
+
     class IDevice
     {
     public:
@@ -69,10 +75,12 @@ namespace ramses::internal
         // resources
         virtual DeviceResourceHandle    allocateVertexBuffer        (uint32_t totalSizeInBytes) = 0;
         virtual void                    uploadVertexBufferData      (DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) = 0;
+        virtual void                    updateVertexBufferData      (DeviceResourceHandle handle, uint32_t offset, const std::byte* data, uint32_t dataSize) = 0;
         virtual void                    deleteVertexBuffer          (DeviceResourceHandle handle) = 0;
 
         virtual DeviceResourceHandle    allocateIndexBuffer         (EDataType dataType, uint32_t sizeInBytes) = 0;
         virtual void                    uploadIndexBufferData       (DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) = 0;
+        virtual void                    updateIndexBufferData       (DeviceResourceHandle handle, uint32_t offset, const std::byte* data, uint32_t dataSize) = 0;
         virtual void                    deleteIndexBuffer           (DeviceResourceHandle handle) = 0;
 
         virtual DeviceResourceHandle    allocateVertexArray         (const VertexArrayInfo& vertexArrayInfo) = 0;
@@ -96,6 +104,8 @@ namespace ramses::internal
         virtual void                    generateMipmaps             (DeviceResourceHandle handle) = 0;
         virtual void                    uploadTextureData           (DeviceResourceHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t z, uint32_t width, uint32_t height, uint32_t depth, const std::byte* data, uint32_t dataSize, uint32_t stride) = 0;
         virtual DeviceResourceHandle    uploadStreamTexture2D       (DeviceResourceHandle handle, uint32_t width, uint32_t height, EPixelStorageFormat format, const std::byte* data, const TextureSwizzleArray& swizzle) = 0;
+        // updates region of stream texture previously uploaded with same format, data points to whole image with row length of stride pixels
+        virtual void                    updateStreamTexture2D       (DeviceResourceHandle handle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t stride, EPixelStorageFormat format, const std::byte* data) = 0;
         virtual void                    deleteTexture               (DeviceResourceHandle handle) = 0;
         virtual void                    activateTexture             (DeviceResourceHandle handle, DataFieldHandle field) = 0;
         [[nodiscard]] virtual uint32_t  getTextureAddress           (DeviceResourceHandle handle) const = 0;
@@ -129,6 +139,10 @@ namespace ramses::internal
 
         [[nodiscard]] virtual uint32_t getTotalGpuMemoryUsageInKB() const = 0;
         virtual uint32_t getAndResetDrawCallCount() = 0;
+        // number of state changes passed to driver and skipped because state was already set
+        virtual DeviceStateChangeCounts getAndResetStateChangeCounts() = 0;
+        // to be called when device state was modified by someone else than device itself (e.g. texture uploading adapter)
+        virtual void invalidateStateCache() = 0;
 
         virtual void    validateDeviceStatusHealthy() const = 0;
         [[nodiscard]] virtual bool    isDeviceStatusHealthy() const = 0;
@@ -13,7 +13,13 @@
 
 namespace ramses::internal
 {
-    using StreamSourceUpdates = std::vector< std::pair<WaylandIviSurfaceId, uint32_t> >;
+    struct StreamSourceUpdate
+    {
+        WaylandIviSurfaceId source;
+        uint32_t numCommitedFrames = 0u;
+        uint64_t numBytesUploaded = 0u;
+    };
+    using StreamSourceUpdates = std::vector<StreamSourceUpdate>;
 
     class IEmbeddedCompositingManager
     {
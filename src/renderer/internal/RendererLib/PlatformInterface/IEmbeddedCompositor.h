@@ -16,6 +16,12 @@ namespace ramses::internal
     class ITextureUploadingAdapter;
     class StringOutputStream;
 
+    struct StreamTextureUploadResult
+    {
+        uint32_t numCommitedFrames = 0u;
+        uint64_t numBytesUploaded = 0u;
+    };
+
     class IEmbeddedCompositor
     {
     public:
@@ -27,7 +33,8 @@ namespace ramses::internal
         virtual WaylandIviSurfaceIdSet dispatchNewStreamTextureSourceIds() = 0;
         virtual WaylandIviSurfaceIdSet dispatchObsoleteStreamTextureSourceIds() = 0;
         virtual void endFrame(bool notifyClients) = 0;
-        virtual uint32_t uploadCompositingContentForStreamTexture(WaylandIviSurfaceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter) = 0;
+        // uploads only damaged regions of shared memory buffers unless full upload requested (e.g. for newly created texture)
+        virtual StreamTextureUploadResult uploadCompositingContentForStreamTexture(WaylandIviSurfaceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter, bool fullUpload) = 0;
 
         [[nodiscard]] virtual bool isContentAvailableForStreamTexture(WaylandIviSurfaceId streamTextureSourceId) const = 0;
         [[nodiscard]] virtual uint64_t getNumberOfCommitedFramesForWaylandIviSurfaceSinceBeginningOfTime(WaylandIviSurfaceId waylandSurfaceId) const = 0;
@@ -22,7 +22,7 @@ namespace ramses::internal
         virtual IRenderBackend*               createRenderBackend(const DisplayConfig& displayConfig, IWindowEventHandler& windowEventHandler) = 0;
         virtual void                          destroyRenderBackend() = 0;
         virtual IResourceUploadRenderBackend* createResourceUploadRenderBackend() = 0;
-        virtual void                          destroyResourceUploadRenderBackend() = 0;
+        virtual void                          destroyResourceUploadRenderBackend(IResourceUploadRenderBackend& resourceUploadRenderBackend) = 0;
 
         virtual ISystemCompositorController* getSystemCompositorController() = 0;
 
@@ -21,5 +21,6 @@ namespace ramses::internal
     public:
         virtual ~ITextureUploadingAdapter() = default;
         virtual void uploadTexture2D(DeviceResourceHandle textureHandle, uint32_t width, uint32_t height, EPixelStorageFormat format, const std::byte* data,  const TextureSwizzleArray& swizzle) = 0;
+        virtual void updateTexture2D(DeviceResourceHandle textureHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t stride, EPixelStorageFormat format, const std::byte* data) = 0;
     };
 }
@@ -214,41 +214,28 @@ namespace ramses::internal
     {
         const RendererCachedScene& renderScene = m_state.getScene();
         IDevice& device = m_state.getDevice();
-        const Renderable& renderable = renderScene.getRenderable(m_state.getRenderable());
-        const DataInstanceHandle uniformData = renderable.dataInstances[ERenderableDataSlotType_Uniforms];
-        assert(uniformData.isValid());
+        const DrawPacket& drawPacket = renderScene.getDrawPacket(m_state.getRenderable());
 
         if (m_state.shaderDeviceHandle.hasChanged())
             device.activateShader(m_state.shaderDeviceHandle.getState());
 
         device.activateVertexArray(m_state.vertexArrayDeviceHandle);
 
-        const DataLayoutHandle dataLayoutHandle = renderScene.getLayoutOfDataInstance(uniformData);
-        const DataLayout& dataLayout = renderScene.getDataLayout(dataLayoutHandle);
-        const uint32_t uniformsCount = dataLayout.getFieldCount();
-        for (DataFieldHandle constantField(0u); constantField < uniformsCount; ++constantField)
-        {
-            const DataFieldInfo& field = dataLayout.getField(constantField);
-            if (field.dataType == EDataType::DataReference)
-            {
-                DataInstanceHandle dataRef = renderScene.getDataReference(uniformData, constantField);
-                const DataLayoutHandle dataRefLayout = renderScene.getLayoutOfDataInstance(dataRef);
-                const EDataType dataTypeRef = renderScene.getDataLayout(dataRefLayout).getField(DataFieldHandle(0u)).dataType;
-                executeConstant(dataTypeRef, 1u, dataRef, DataFieldHandle(0u), constantField);
-            }
-            else
-            {
-                executeConstant(field.dataType, field.elementCount, uniformData, constantField, constantField);
-            }
-        }
+        const DrawPacketUniform* uniforms = renderScene.getDrawPacketUniforms(drawPacket);
+        for (uint32_t i = 0u; i < drawPacket.uniformsCount; ++i)
+            executeConstant(uniforms[i]);
     }
 
-    void RenderExecutor::executeConstant(EDataType dataType, uint32_t elementCount, DataInstanceHandle dataInstance, DataFieldHandle dataInstancefield, DataFieldHandle uniformInputField) const
+    void RenderExecutor::executeConstant(const DrawPacketUniform& uniform) const
     {
         IDevice& device = m_state.getDevice();
         const ResourceCachedScene& renderScene = m_state.getScene();
+        const DataInstanceHandle dataInstance = uniform.dataInstance;
+        const DataFieldHandle dataInstancefield = uniform.dataInstanceField;
+        const DataFieldHandle uniformInputField = uniform.uniformInputField;
+        const uint32_t elementCount = uniform.elementCount;
 
-        switch (dataType)
+        switch (uniform.dataType)
         {
         case EDataType::Float:
         {
@@ -343,27 +330,15 @@ namespace ramses::internal
         case EDataType::TextureSamplerCube:
         case EDataType::TextureSamplerExternal:
         {
-            const TextureSamplerHandle samplerHandle = renderScene.getDataTextureSamplerHandle(dataInstance, dataInstancefield);
-            assert(samplerHandle.isValid());
-
-            const DeviceResourceHandle textureDeviceHandle = renderScene.getCachedHandlesForTextureSamplers()[samplerHandle.asMemoryHandle()];
-            assert(textureDeviceHandle.isValid());
-
-            device.activateTexture(textureDeviceHandle, uniformInputField);
-
-            const TextureSamplerStates& samplerStates = renderScene.getTextureSampler(samplerHandle).states;
-            device.activateTextureSamplerObject(samplerStates, dataInstancefield);
+            assert(uniform.textureDeviceHandle.isValid());
+            device.activateTexture(uniform.textureDeviceHandle, uniformInputField);
+            device.activateTextureSamplerObject(uniform.textureSamplerStates, dataInstancefield);
             break;
         }
         case EDataType::TextureSampler2DMS:
         {
-            const TextureSamplerHandle samplerHandle = renderScene.getDataTextureSamplerHandle(dataInstance, dataInstancefield);
-            assert(samplerHandle.isValid());
-
-            const DeviceResourceHandle textureDeviceHandle = renderScene.getCachedHandlesForTextureSamplers()[samplerHandle.asMemoryHandle()];
-            assert(textureDeviceHandle.isValid());
-
-            device.activateTexture(textureDeviceHandle, uniformInputField);
+            assert(uniform.textureDeviceHandle.isValid());
+            device.activateTexture(uniform.textureDeviceHandle, uniformInputField);
             break;
         }
 
@@ -375,16 +350,15 @@ namespace ramses::internal
     void RenderExecutor::executeDrawCall() const
     {
         IDevice& device = m_state.getDevice();
-        const auto& renderScene = m_state.getScene();
-        const Renderable& renderable = renderScene.getRenderable(m_state.getRenderable());
+        const DrawPacket& drawPacket = m_state.getScene().getDrawPacket(m_state.getRenderable());
 
         if (m_state.vertexArrayUsesIndices)
         {
-            device.drawIndexedTriangles(static_cast<int32_t>(renderable.startIndex), static_cast<int32_t>(renderable.indexCount), renderable.instanceCount);
+            device.drawIndexedTriangles(static_cast<int32_t>(drawPacket.startIndex), static_cast<int32_t>(drawPacket.indexCount), drawPacket.instanceCount);
         }
         else
         {
-            device.drawTriangles(static_cast<int32_t>(renderable.startIndex), static_cast<int32_t>(renderable.indexCount), renderable.instanceCount);
+            device.drawTriangles(static_cast<int32_t>(drawPacket.startIndex), static_cast<int32_t>(drawPacket.indexCount), drawPacket.instanceCount);
         }
     }
 
@@ -398,16 +372,13 @@ namespace ramses::internal
         m_state.setRenderable(renderableHandle);
 
         const RendererCachedScene& renderScene = m_state.getScene();
-        const Renderable& renderable = renderScene.getRenderable(renderableHandle);
-
-        const DeviceResourceHandle effectDeviceHandle = renderScene.getRenderableEffectDeviceHandle(renderableHandle);
-        m_state.shaderDeviceHandle.setState(effectDeviceHandle);
+        const DrawPacket& drawPacket = renderScene.getDrawPacket(renderableHandle);
 
-        const auto& vertexArray = renderScene.getCachedHandlesForVertexArrays()[m_state.getRenderable().asMemoryHandle()];
-        m_state.vertexArrayDeviceHandle = vertexArray.deviceHandle;
-        m_state.vertexArrayUsesIndices = vertexArray.usesIndexArray;
+        m_state.shaderDeviceHandle.setState(drawPacket.effectDeviceHandle);
+        m_state.vertexArrayDeviceHandle = drawPacket.vertexArray.deviceHandle;
+        m_state.vertexArrayUsesIndices = drawPacket.vertexArray.usesIndexArray;
 
-        const RenderState& renderState = renderScene.getRenderState(renderable.renderState);
+        const RenderState& renderState = renderScene.getRenderState(drawPacket.renderState);
         ScissorState scissorState;
         scissorState.m_scissorTest = renderState.scissorTest;
         scissorState.m_scissorRegion = renderState.scissorRegion;
@@ -543,18 +514,15 @@ namespace ramses::internal
     void RenderExecutor::setSemanticDataFields() const
     {
         const auto& scene = m_state.getScene();
-        const RenderableHandle renderable = m_state.getRenderable();
-        const DataInstanceHandle dataInstance = scene.getRenderable(renderable).dataInstances[ERenderableDataSlotType_Uniforms];
-        const DataLayoutHandle dataLayoutHandle = scene.getLayoutOfDataInstance(dataInstance);
-        const DataLayout& dataLayout = scene.getDataLayout(dataLayoutHandle);
+        const DrawPacket& drawPacket = scene.getDrawPacket(m_state.getRenderable());
+        const DrawPacketUniform* uniforms = scene.getDrawPacketUniforms(drawPacket);
 
-        const uint32_t fieldCount = dataLayout.getFieldCount();
-        for (DataFieldHandle i(0u); i < fieldCount; ++i)
+        for (uint32_t i = 0u; i < drawPacket.uniformsCount; ++i)
         {
-            const EFixedSemantics semantics = dataLayout.getField(i).semantics;
-            if (semantics != EFixedSemantics::Invalid)
+            const DrawPacketUniform& uniform = uniforms[i];
+            if (uniform.semantics != EFixedSemantics::Invalid)
             {
-                resolveAndSetSemanticDataField(semantics, dataInstance, i);
+                resolveAndSetSemanticDataField(uniform.semantics, uniform.dataInstance, uniform.dataInstanceField);
             }
         }
     }
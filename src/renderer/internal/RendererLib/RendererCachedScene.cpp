@@ -82,6 +82,31 @@ namespace ramses::internal
         m_renderableOrderingDirty = true;
     }
 
+    DataBufferHandle RendererCachedScene::allocateDataBuffer(EDataBufferType dataBufferType, EDataType dataType, uint32_t maximumSizeInBytes, DataBufferHandle handle)
+    {
+        const auto resultHandle = TextureLinkCachedScene::allocateDataBuffer(dataBufferType, dataType, maximumSizeInBytes, handle);
+        m_dataBufferUpdates.resize(getDataBufferCount());
+        m_dataBufferUpdates[resultHandle.asMemoryHandle()] = {};
+        return resultHandle;
+    }
+
+    void RendererCachedScene::updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data)
+    {
+        TextureLinkCachedScene::updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data);
+        assert(handle.asMemoryHandle() < m_dataBufferUpdates.size());
+        auto& update = m_dataBufferUpdates[handle.asMemoryHandle()];
+        if (update.size == 0u)
+        {
+            update = { offsetInBytes, dataSizeInBytes };
+        }
+        else
+        {
+            const uint32_t begin = std::min(update.offset, offsetInBytes);
+            const uint32_t end = std::max(update.offset + update.size, offsetInBytes + dataSizeInBytes);
+            update = { begin, end - begin };
+        }
+    }
+
     TextureBufferHandle RendererCachedScene::allocateTextureBuffer(EPixelStorageFormat textureFormat, const MipMapDimensions& mipMapDimensions, TextureBufferHandle handle)
     {
         auto resultHandle = TextureLinkCachedScene::allocateTextureBuffer(textureFormat, mipMapDimensions, handle);
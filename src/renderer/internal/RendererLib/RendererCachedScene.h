@@ -67,6 +67,9 @@ namespace ramses::internal
         void                        setBlitPassRenderOrder(BlitPassHandle passHandle, int32_t renderOrder) override;
         void                        setBlitPassEnabled(BlitPassHandle passHandle, bool isEnabled) override;
 
+        DataBufferHandle            allocateDataBuffer              (EDataBufferType dataBufferType, EDataType dataType, uint32_t maximumSizeInBytes, DataBufferHandle handle) override;
+        void                        updateDataBuffer                (DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data) override;
+
         TextureBufferHandle         allocateTextureBuffer           (EPixelStorageFormat textureFormat, const MipMapDimensions& mipMapDimensions, TextureBufferHandle handle) override;
         void                        updateTextureBuffer             (TextureBufferHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::byte* data) override;
 
@@ -74,6 +77,25 @@ namespace ramses::internal
         const RenderableVector&             getOrderedRenderablesForPass    (RenderPassHandle pass) const;
         const glm::mat4&                    getRenderableWorldMatrix        (RenderableHandle renderable) const;
 
+        // bounding byte range of data buffer modified since its last upload
+        struct DataBufferUpdate
+        {
+            uint32_t offset = 0u;
+            uint32_t size = 0u;
+        };
+
+        const DataBufferUpdate& getDataBufferUpdate(DataBufferHandle handle) const
+        {
+            assert(handle.asMemoryHandle() < getDataBufferCount());
+            return m_dataBufferUpdates[handle.asMemoryHandle()];
+        }
+
+        void popDataBufferUpdate(DataBufferHandle handle) const
+        {
+            assert(handle.asMemoryHandle() < getDataBufferCount());
+            m_dataBufferUpdates[handle.asMemoryHandle()] = {};
+        }
+
         using TextureBufferUpdate = std::vector<Quad>;
 
         const TextureBufferUpdate& getTextureBufferUpdate(TextureBufferHandle handle) const
@@ -106,6 +128,7 @@ namespace ramses::internal
         using RenderPasses = HashSet<RenderPassHandle>;
         mutable RenderPasses m_renderOncePassesToRender;
 
+        mutable std::vector<DataBufferUpdate> m_dataBufferUpdates;
         mutable std::vector<TextureBufferUpdate> m_textureBufferUpdates;
 
         bool m_hasActiveShaderAnimation = false;
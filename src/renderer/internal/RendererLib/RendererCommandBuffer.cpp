@@ -7,35 +7,156 @@
 //  -------------------------------------------------------------------------
 
 #include "internal/RendererLib/RendererCommandBuffer.h"
+#include <cassert>
+#include <thread>
 
 namespace ramses::internal
 {
+    RendererCommandBuffer::RendererCommandBuffer(size_t capacity)
+        : m_capacity{ capacity }
+        , m_slots{ std::make_unique<Slot[]>(capacity) }
+    {
+        assert(capacity > 0u && (capacity & (capacity - 1u)) == 0u && "capacity must be power of two");
+        // slot is free for position equal to its sequence, ready to be consumed for position + 1
+        for (size_t i = 0u; i < m_capacity; ++i)
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
     void RendererCommandBuffer::addAndConsumeCommandsFrom(RendererCommands& cmds)
     {
-        std::lock_guard<std::mutex> lock(m_lock);
-        m_commands.insert(m_commands.end(), std::make_move_iterator(cmds.begin()), std::make_move_iterator(cmds.end()));
+        push(cmds.data(), cmds.size());
         cmds.clear();
-        m_newCommandsCvar.notify_all();
     }
 
     void RendererCommandBuffer::swapCommands(RendererCommands& cmds)
     {
-        std::lock_guard<std::mutex> lock(m_lock);
-        m_commands.swap(cmds);
+        std::lock_guard<std::mutex> consumerLock{ m_consumerLock };
+        popFromRing(cmds);
+
+        if (m_overflowUsed.load())
+        {
+            std::lock_guard<std::mutex> overflowLock{ m_overflowLock };
+            // producer which used overflow could have commands reserved in ring before that,
+            // these have to be consumed before overflow to keep order of commands of each producer
+            const auto reservedPosition = m_enqueuePosition.load();
+            while (m_dequeuePosition.load(std::memory_order_relaxed) != reservedPosition)
+            {
+                popFromRing(cmds);
+                std::this_thread::yield();
+            }
+            cmds.insert(cmds.end(), std::make_move_iterator(m_overflowCommands.begin()), std::make_move_iterator(m_overflowCommands.end()));
+            m_overflowCommands.clear();
+            m_overflowUsed.store(false);
+        }
     }
 
     void RendererCommandBuffer::blockingSwapCommands(RendererCommands& cmds, std::chrono::milliseconds timeout)
     {
-        std::unique_lock<std::mutex> lock{m_lock};
-        m_newCommandsCvar.wait_for(lock, timeout, [&]() { return !m_commands.empty() || m_interruptBlockingSwapCommands; });
-        m_interruptBlockingSwapCommands = false;
-        m_commands.swap(cmds);
+        {
+            std::unique_lock<std::mutex> lock{ m_wakeupLock };
+            // must be set before checking for pending commands, producers check it after adding commands
+            m_consumerWaiting.store(true);
+            m_newCommandsCvar.wait_for(lock, timeout, [&]() { return m_interruptBlockingSwapCommands || hasPendingCommands(); });
+            m_consumerWaiting.store(false);
+            m_interruptBlockingSwapCommands = false;
+        }
+        swapCommands(cmds);
     }
 
     void RendererCommandBuffer::interruptBlockingSwapCommands()
     {
-        std::unique_lock<std::mutex> lock{m_lock};
+        std::lock_guard<std::mutex> lock{ m_wakeupLock };
         m_interruptBlockingSwapCommands = true;
         m_newCommandsCvar.notify_all();
     }
+
+    void RendererCommandBuffer::push(RendererCommand::Variant* cmds, size_t count)
+    {
+        while (count > 0u)
+        {
+            // once overflow is used all producers have to use it until consumed, otherwise order of commands would break
+            const size_t batchSize = std::min(count, m_capacity);
+            if (m_overflowUsed.load() || !tryPushToRing(cmds, batchSize))
+            {
+                std::lock_guard<std::mutex> lock{ m_overflowLock };
+                m_overflowCommands.insert(m_overflowCommands.end(), std::make_move_iterator(cmds), std::make_move_iterator(cmds + count));
+                m_overflowUsed.store(true);
+                break;
+            }
+            cmds += batchSize;
+            count -= batchSize;
+        }
+
+        notifyConsumerIfWaiting();
+    }
+
+    bool RendererCommandBuffer::tryPushToRing(RendererCommand::Variant* cmds, size_t count)
+    {
+        // consumer frees slots in order, so whole batch is free if its last slot is free
+        uint64_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            const uint64_t lastPosition = position + count - 1u;
+            const auto sequenceDiff = static_cast<int64_t>(getSlot(lastPosition).sequence.load(std::memory_order_acquire) - lastPosition);
+            if (sequenceDiff == 0)
+            {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + count))
+                    break;
+            }
+            else if (sequenceDiff < 0)
+            {
+                // slot still holds command not consumed from previous round
+                return false;
+            }
+            else
+            {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        for (size_t i = 0u; i < count; ++i)
+        {
+            Slot& slot = getSlot(position + i);
+            slot.command = std::move(cmds[i]);
+            slot.sequence.store(position + i + 1u, std::memory_order_release);
+        }
+        return true;
+    }
+
+    void RendererCommandBuffer::popFromRing(RendererCommands& cmds)
+    {
+        uint64_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Slot& slot = getSlot(position);
+            // stop at first slot which is not published yet (reserved by producer but not written)
+            if (slot.sequence.load(std::memory_order_acquire) != position + 1u)
+                break;
+            cmds.push_back(std::move(slot.command));
+            slot.sequence.store(position + m_capacity, std::memory_order_release);
+            ++position;
+        }
+        m_dequeuePosition.store(position, std::memory_order_relaxed);
+    }
+
+    bool RendererCommandBuffer::hasPendingCommands() const
+    {
+        return m_enqueuePosition.load() != m_dequeuePosition.load(std::memory_order_relaxed) || m_overflowUsed.load();
+    }
+
+    void RendererCommandBuffer::notifyConsumerIfWaiting()
+    {
+        // adding commands and reading consumer state are sequentially consistent, as well as consumer setting its state and
+        // checking for commands, so either producer sees waiting consumer or consumer sees new commands
+        if (m_consumerWaiting.load())
+        {
+            std::lock_guard<std::mutex> lock{ m_wakeupLock };
+            m_newCommandsCvar.notify_all();
+        }
+    }
+
+    RendererCommandBuffer::Slot& RendererCommandBuffer::getSlot(uint64_t position)
+    {
+        return m_slots[position & (m_capacity - 1u)];
+    }
 }
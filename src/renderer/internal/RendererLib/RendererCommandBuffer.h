@@ -9,35 +9,70 @@
 #pragma once
 
 #include "internal/RendererLib/RendererCommands.h"
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <condition_variable>
 
 namespace ramses::internal
 {
+    // Command queue with any number of producer threads and a single consumer (display thread or dispatcher thread).
+    // Commands are stored in a bounded lock-free ring buffer (sequence number per slot), a whole batch of commands
+    // is reserved with a single atomic operation. Only if the ring is full, commands go to a mutex protected overflow
+    // container, so that producers never block on consumer. Order of commands of each producer is kept.
+    // Producers notify condition variable only if consumer is actually waiting in blockingSwapCommands.
     class RendererCommandBuffer
     {
     public:
+        explicit RendererCommandBuffer(size_t capacity = DefaultCapacity);
+
         template <typename T>
         void enqueueCommand(T cmd);
         void addAndConsumeCommandsFrom(RendererCommands& cmds);
-        void swapCommands(RendererCommands& cmds);
 
+        // moves all pending commands to end of given container, to be called by consumer only
+        void swapCommands(RendererCommands& cmds);
         void blockingSwapCommands(RendererCommands& cmds, std::chrono::milliseconds timeout);
         void interruptBlockingSwapCommands();
 
+        static constexpr size_t DefaultCapacity = 256u;
+
     private:
-        std::mutex m_lock;
-        RendererCommands m_commands;
+        void push(RendererCommand::Variant* cmds, size_t count);
+        bool tryPushToRing(RendererCommand::Variant* cmds, size_t count);
+        void popFromRing(RendererCommands& cmds);
+        [[nodiscard]] bool hasPendingCommands() const;
+        void notifyConsumerIfWaiting();
+
+        struct Slot
+        {
+            std::atomic<uint64_t> sequence{ 0u };
+            RendererCommand::Variant command;
+        };
+        Slot& getSlot(uint64_t position);
+
+        const size_t m_capacity;
+        std::unique_ptr<Slot[]> m_slots;
+        // producers and consumer positions are kept on separate cache lines to avoid false sharing
+        alignas(64) std::atomic<uint64_t> m_enqueuePosition{ 0u };
+        alignas(64) std::atomic<uint64_t> m_dequeuePosition{ 0u };
+
+        std::mutex m_consumerLock;
+
+        std::mutex m_overflowLock;
+        RendererCommands m_overflowCommands;
+        std::atomic<bool> m_overflowUsed{ false };
 
+        std::mutex m_wakeupLock;
         std::condition_variable m_newCommandsCvar;
+        std::atomic<bool> m_consumerWaiting{ false };
         bool m_interruptBlockingSwapCommands = false;
     };
 
     template <typename T>
     void RendererCommandBuffer::enqueueCommand(T cmd)
     {
-        std::lock_guard<std::mutex> lock(m_lock);
-        m_commands.push_back(std::move(cmd));
-        m_newCommandsCvar.notify_all();
+        RendererCommand::Variant command{ std::move(cmd) };
+        push(&command, 1u);
     }
 }
@@ -290,6 +290,7 @@ namespace ramses::internal
         m_frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::SceneResourcesUpload, cmd.limitForSceneResourcesUploadMicrosec);
         m_frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ResourcesUpload, cmd.limitForResourcesUploadMicrosec);
         m_frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::OffscreenBufferRender, cmd.limitForOffscreenBufferRenderMicrosec);
+        m_frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::SceneActionsApply, cmd.limitForSceneActionsApplyMicrosec);
     }
 
     void RendererCommandExecutor::operator()(const RendererCommand::SetLimits_FlushesForceApply& cmd)
@@ -56,7 +56,7 @@ namespace ramses::internal
         inline std::string ToString(const RendererCommand::SCSetIviLayerVisibility& cmd) { return fmt::format("SCSetIviLayerVisibility (layerId={} visibility={})", cmd.layer, cmd.visibility); }
         inline std::string ToString(const RendererCommand::SCRemoveIviSurfaceFromIviLayer& cmd) { return fmt::format("SCRemoveIviSurfaceFromIviLayer (surfaceId={} layerId={})", cmd.surface, cmd.layer); }
         inline std::string ToString(const RendererCommand::SCDestroyIviSurface& cmd) { return fmt::format("SCDestroyIviSurface (surfaceId={})", cmd.surface); }
-        inline std::string ToString(const RendererCommand::SetLimits_FrameBudgets& cmd) { return fmt::format("SetLimits_FrameBudgets (dynResources={} resources={} obRender={})", cmd.limitForSceneResourcesUploadMicrosec, cmd.limitForResourcesUploadMicrosec, cmd.limitForOffscreenBufferRenderMicrosec); }
+        inline std::string ToString(const RendererCommand::SetLimits_FrameBudgets& cmd) { return fmt::format("SetLimits_FrameBudgets (dynResources={} resources={} obRender={} sceneActions={})", cmd.limitForSceneResourcesUploadMicrosec, cmd.limitForResourcesUploadMicrosec, cmd.limitForOffscreenBufferRenderMicrosec, cmd.limitForSceneActionsApplyMicrosec); }
         inline std::string ToString(const RendererCommand::SetLimits_FlushesForceApply& cmd) { return fmt::format("SetLimits_FlushesForceApply (numFlushes={})", cmd.limitForPendingFlushesForceApply); }
         inline std::string ToString(const RendererCommand::SetLimits_FlushesForceUnsubscribe& cmd) { return fmt::format("SetLimits_FlushesForceUnsubscribe (numFlushes={})", cmd.limitForPendingFlushesForceUnsubscribe); }
         inline std::string ToString(const RendererCommand::ConfirmationEcho& cmd) { return fmt::format("ConfirmationEcho (display={} text={})", cmd.display, cmd.text); }
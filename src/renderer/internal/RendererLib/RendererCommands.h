@@ -19,6 +19,7 @@
 
 #include <vector>
 #include <string>
+#include <limits>
 
 namespace ramses::internal
 {
@@ -284,6 +285,7 @@ namespace ramses::internal
             uint64_t limitForSceneResourcesUploadMicrosec = 0;
             uint64_t limitForResourcesUploadMicrosec = 0;
             uint64_t limitForOffscreenBufferRenderMicrosec = 0;
+            uint64_t limitForSceneActionsApplyMicrosec = std::numeric_limits<uint64_t>::max();
         };
 
         struct SetLimits_FlushesForceApply
@@ -50,4 +50,14 @@ namespace ramses::internal
     {
         return m_renderThreadLoopTimingReportingPeriod;
     }
+
+    void RendererConfig::setFramePacingMode(EFramePacingMode mode)
+    {
+        m_framePacingMode = mode;
+    }
+
+    EFramePacingMode RendererConfig::getFramePacingMode() const
+    {
+        return m_framePacingMode;
+    }
 }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "internal/RendererLib/Types.h"
+#include "internal/RendererLib/Enums/EFramePacingMode.h"
 
 #include <chrono>
 #include <string>
@@ -28,11 +29,14 @@ namespace ramses::internal
         void setFrameCallbackMaxPollTime(std::chrono::microseconds pollTime);
         void setRenderthreadLooptimingReportingPeriod(std::chrono::milliseconds period);
         [[nodiscard]] std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
+        void setFramePacingMode(EFramePacingMode mode);
+        [[nodiscard]] EFramePacingMode getFramePacingMode() const;
 
     private:
         std::string m_waylandDisplayForSystemCompositorController;
         bool m_systemCompositorEnabled = false;
         std::chrono::microseconds m_frameCallbackMaxPollTime{10000u};
         std::chrono::milliseconds m_renderThreadLoopTimingReportingPeriod { 0 }; // zero deactivates reporting
+        EFramePacingMode m_framePacingMode = EFramePacingMode::Sleep;
     };
 }
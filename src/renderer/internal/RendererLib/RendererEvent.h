@@ -180,6 +180,9 @@ namespace ramses::internal
     {
         std::chrono::microseconds maximumLoopTimeWithinPeriod;
         std::chrono::microseconds averageLoopTimeWithinPeriod;
+        std::chrono::microseconds percentile50LoopTimeWithinPeriod;
+        std::chrono::microseconds percentile90LoopTimeWithinPeriod;
+        std::chrono::microseconds percentile99LoopTimeWithinPeriod;
     };
 
     struct RendererEvent
@@ -205,11 +205,10 @@ namespace ramses::internal
         pushToSceneControlEventQueue(std::move(event));
     }
 
-    void RendererEventCollector::addFrameTimingReport(DisplayHandle display, std::chrono::microseconds maxLoopTime, std::chrono::microseconds avgLooptime)
+    void RendererEventCollector::addFrameTimingReport(DisplayHandle display, const FrameTimings& frameTimings)
     {
         RendererEvent event{ ERendererEventType::FrameTimingReport };
-        event.frameTimings.maximumLoopTimeWithinPeriod = maxLoopTime;
-        event.frameTimings.averageLoopTimeWithinPeriod = avgLooptime;
+        event.frameTimings = frameTimings;
         event.displayHandle = display;
         pushToRendererEventQueue(std::move(event));
     }
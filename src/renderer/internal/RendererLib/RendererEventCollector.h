@@ -39,7 +39,7 @@ namespace ramses::internal
         void addWindowEvent(ERendererEventType eventType, DisplayHandle display, WindowMoveEvent moveEvent);
         void addStreamSourceEvent(ERendererEventType eventType, WaylandIviSurfaceId streamSourceId);
         void addPickedEvent(ERendererEventType eventType, const SceneId& sceneId, PickableObjectIds&& pickedObjectIds);
-        void addFrameTimingReport(DisplayHandle display, std::chrono::microseconds maxLoopTime, std::chrono::microseconds avgLooptime);
+        void addFrameTimingReport(DisplayHandle display, const FrameTimings& frameTimings);
 
     private:
         void pushToRendererEventQueue(RendererEvent&& newEvent);
@@ -0,0 +1,88 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/RendererMetrics.h"
+
+namespace ramses::internal
+{
+    RendererMetrics::RendererMetrics()
+        : m_frameDuration({ 1000u, 2000u, 4000u, 8000u, 12000u, 16667u, 20000u, 25000u, 33333u, 50000u, 100000u, 250000u, 1000000u })
+        , m_flushLatency({ 1u, 2u, 5u, 10u, 20u, 50u, 100u, 200u, 500u, 1000u, 2000u, 5000u })
+    {
+    }
+
+    void RendererMetrics::frameFinished(std::chrono::microseconds frameDuration, uint32_t drawCalls)
+    {
+        m_frames.fetch_add(1u, std::memory_order_relaxed);
+        m_drawCalls.fetch_add(drawCalls, std::memory_order_relaxed);
+        m_frameDuration.observe(static_cast<uint64_t>(frameDuration.count()));
+    }
+
+    void RendererMetrics::flushArrived(std::chrono::milliseconds latency)
+    {
+        m_flushesArrived.fetch_add(1u, std::memory_order_relaxed);
+        // latency can be negative if clocks of client and renderer are not synchronized
+        m_flushLatency.observe(latency.count() > 0 ? static_cast<uint64_t>(latency.count()) : 0u);
+    }
+
+    void RendererMetrics::flushApplied()
+    {
+        m_flushesApplied.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    void RendererMetrics::resourceUploaded(size_t byteSize)
+    {
+        m_resourcesUploaded.fetch_add(1u, std::memory_order_relaxed);
+        m_resourcesUploadedBytes.fetch_add(byteSize, std::memory_order_relaxed);
+    }
+
+    void RendererMetrics::sceneResourceUploaded(size_t byteSize)
+    {
+        m_sceneResourcesUploaded.fetch_add(1u, std::memory_order_relaxed);
+        m_sceneResourcesUploadedBytes.fetch_add(byteSize, std::memory_order_relaxed);
+    }
+
+    void RendererMetrics::streamTextureUpdated(size_t numUpdates, uint64_t numBytesUploaded)
+    {
+        m_streamTextureUpdates.fetch_add(numUpdates, std::memory_order_relaxed);
+        m_streamTextureUploadedBytes.fetch_add(numBytesUploaded, std::memory_order_relaxed);
+    }
+
+    void RendererMetrics::shaderCompiled(std::chrono::microseconds duration)
+    {
+        m_shadersCompiled.fetch_add(1u, std::memory_order_relaxed);
+        m_shaderCompilationMicroseconds.fetch_add(static_cast<uint64_t>(duration.count()), std::memory_order_relaxed);
+    }
+
+    void RendererMetrics::setVRAMUsage(uint64_t totalUploaded, uint64_t gpuCacheSize)
+    {
+        m_vramUsage.store(totalUploaded, std::memory_order_relaxed);
+        m_gpuCacheSize.store(gpuCacheSize, std::memory_order_relaxed);
+    }
+
+    void RendererMetrics::writeMetrics(MetricsWriter& writer, const MetricLabels& labels) const
+    {
+        const auto get = [](const std::atomic<uint64_t>& value) { return value.load(std::memory_order_relaxed); };
+        writer.addCounter("ramses_renderer_frames_total", "Frames finished by display", labels, get(m_frames));
+        writer.addCounter("ramses_renderer_draw_calls_total", "Draw calls issued by display", labels, get(m_drawCalls));
+        writer.addHistogram("ramses_renderer_frame_duration_microseconds", "Duration of display frames", labels, m_frameDuration);
+        writer.addCounter("ramses_renderer_flushes_arrived_total", "Scene flushes arrived at display", labels, get(m_flushesArrived));
+        writer.addCounter("ramses_renderer_flushes_applied_total", "Scene flushes applied by display", labels, get(m_flushesApplied));
+        writer.addHistogram("ramses_renderer_flush_latency_milliseconds", "Time from client flush to flush arriving at display", labels, m_flushLatency);
+        writer.addCounter("ramses_renderer_resources_uploaded_total", "Client resources uploaded", labels, get(m_resourcesUploaded));
+        writer.addCounter("ramses_renderer_resources_uploaded_bytes_total", "Size of client resources uploaded", labels, get(m_resourcesUploadedBytes));
+        writer.addCounter("ramses_renderer_scene_resources_uploaded_total", "Scene resources uploaded", labels, get(m_sceneResourcesUploaded));
+        writer.addCounter("ramses_renderer_scene_resources_uploaded_bytes_total", "Size of scene resources uploaded", labels, get(m_sceneResourcesUploadedBytes));
+        writer.addCounter("ramses_renderer_stream_texture_updates_total", "Stream texture updates", labels, get(m_streamTextureUpdates));
+        writer.addCounter("ramses_renderer_stream_texture_uploaded_bytes_total", "Size of stream texture updates uploaded", labels, get(m_streamTextureUploadedBytes));
+        writer.addCounter("ramses_renderer_shaders_compiled_total", "Shaders compiled", labels, get(m_shadersCompiled));
+        writer.addCounter("ramses_renderer_shader_compilation_microseconds_total", "Time spent compiling shaders", labels, get(m_shaderCompilationMicroseconds));
+        writer.addGauge("ramses_renderer_vram_usage_bytes", "Size of client resources uploaded to GPU", labels, static_cast<double>(get(m_vramUsage)));
+        writer.addGauge("ramses_renderer_gpu_cache_size_bytes", "Configured GPU cache size", labels, static_cast<double>(get(m_gpuCacheSize)));
+    }
+}
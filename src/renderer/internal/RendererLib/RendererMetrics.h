@@ -0,0 +1,56 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Core/Utils/MetricHistogram.h"
+#include "internal/Core/Utils/MetricsWriter.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace ramses::internal
+{
+    // Monotonic counterparts of RendererStatistics which are never reset and can be read from metrics endpoint thread
+    // while render thread updates them, all updates are relaxed atomic operations.
+    class RendererMetrics
+    {
+    public:
+        RendererMetrics();
+
+        void frameFinished(std::chrono::microseconds frameDuration, uint32_t drawCalls);
+        void flushArrived(std::chrono::milliseconds latency);
+        void flushApplied();
+        void resourceUploaded(size_t byteSize);
+        void sceneResourceUploaded(size_t byteSize);
+        void streamTextureUpdated(size_t numUpdates, uint64_t numBytesUploaded);
+        void shaderCompiled(std::chrono::microseconds duration);
+        void setVRAMUsage(uint64_t totalUploaded, uint64_t gpuCacheSize);
+
+        void writeMetrics(MetricsWriter& writer, const MetricLabels& labels) const;
+
+    private:
+        std::atomic<uint64_t> m_frames{0u};
+        std::atomic<uint64_t> m_drawCalls{0u};
+        std::atomic<uint64_t> m_flushesArrived{0u};
+        std::atomic<uint64_t> m_flushesApplied{0u};
+        std::atomic<uint64_t> m_resourcesUploaded{0u};
+        std::atomic<uint64_t> m_resourcesUploadedBytes{0u};
+        std::atomic<uint64_t> m_sceneResourcesUploaded{0u};
+        std::atomic<uint64_t> m_sceneResourcesUploadedBytes{0u};
+        std::atomic<uint64_t> m_streamTextureUpdates{0u};
+        std::atomic<uint64_t> m_streamTextureUploadedBytes{0u};
+        std::atomic<uint64_t> m_shadersCompiled{0u};
+        std::atomic<uint64_t> m_shaderCompilationMicroseconds{0u};
+        std::atomic<uint64_t> m_vramUsage{0u};
+        std::atomic<uint64_t> m_gpuCacheSize{0u};
+        MetricHistogram m_frameDuration;
+        MetricHistogram m_flushLatency;
+    };
+}
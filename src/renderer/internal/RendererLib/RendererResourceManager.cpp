@@ -175,6 +175,11 @@ namespace ramses::internal
             m_resourceRegistry.setResourceData(resHash, mr);
     }
 
+    void RendererResourceManager::prewarmEffects(const ManagedResourceVector& resources)
+    {
+        m_resourceUploadingManager.prewarmEffects(resources);
+    }
+
     bool RendererResourceManager::hasResourcesToBeUploaded() const
     {
         return m_resourceUploadingManager.hasAnythingToUpload();
@@ -653,23 +658,38 @@ namespace ramses::internal
         sceneResources.removeDataBuffer(dataBufferHandle);
     }
 
-    void RendererResourceManager::updateDataBuffer(DataBufferHandle handle, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId)
+    void RendererResourceManager::updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId)
     {
         assert(m_sceneResourceRegistryMap.contains(sceneId));
-        const RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
+        RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
 
         const DeviceResourceHandle deviceHandle = sceneResources.getDataBufferDeviceHandle(handle);
         assert(deviceHandle.isValid());
         const EDataBufferType dataBufferType = sceneResources.getDataBufferType(handle);
+        const uint32_t bufferSize = sceneResources.getDataBufferSize(handle);
+        assert(offsetInBytes + dataSizeInBytes <= bufferSize);
+
+        // Whole buffer is uploaded if device has no data for it yet or if large part of it changed,
+        // re-specifying whole buffer lets driver orphan storage still in use by GPU instead of synchronizing with it.
+        if (!sceneResources.isDataBufferDataUploaded(handle) || dataSizeInBytes >= bufferSize / 2u)
+        {
+            offsetInBytes = 0u;
+            dataSizeInBytes = bufferSize;
+            sceneResources.setDataBufferDataUploaded(handle);
+        }
+        else if (dataSizeInBytes == 0u)
+        {
+            return;
+        }
 
         IDevice& device = m_renderBackend.getDevice();
         switch (dataBufferType)
         {
         case EDataBufferType::IndexBuffer:
-            device.uploadIndexBufferData(deviceHandle, data, dataSizeInBytes);
+            device.updateIndexBufferData(deviceHandle, offsetInBytes, data + offsetInBytes, dataSizeInBytes);
             break;
         case EDataBufferType::VertexBuffer:
-            device.uploadVertexBufferData(deviceHandle, data, dataSizeInBytes);
+            device.updateVertexBufferData(deviceHandle, offsetInBytes, data + offsetInBytes, dataSizeInBytes);
             break;
         default:
             LOG_ERROR(CONTEXT_RENDERER, "RendererResourceManager::updateDataBuffer: can not updata data buffer with invalid type!");
@@ -46,6 +46,7 @@ namespace ramses::internal
         void                 unreferenceResourcesForScene   (SceneId sceneId, const ResourceContentHashVector& resources) override;
 
         void                 provideResourceData(const ManagedResource& mr) override;
+        void                 prewarmEffects(const ManagedResourceVector& resources) override;
         [[nodiscard]] bool                 hasResourcesToBeUploaded() const override;
         void                 uploadAndUnloadPendingResources() override;
 
@@ -79,7 +80,7 @@ namespace ramses::internal
 
         void                 uploadDataBuffer(DataBufferHandle dataBufferHandle, EDataBufferType dataBufferType, EDataType dataType, uint32_t dataSizeInBytes, SceneId sceneId) override;
         void                 unloadDataBuffer(DataBufferHandle dataBufferHandle, SceneId sceneId) override;
-        void                 updateDataBuffer(DataBufferHandle handle, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId) override;
+        void                 updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId) override;
         [[nodiscard]] DeviceResourceHandle getDataBufferDeviceHandle(DataBufferHandle dataBufferHandle, SceneId sceneId) const override;
 
         void                 uploadTextureBuffer(TextureBufferHandle textureBufferHandle, uint32_t width, uint32_t height, EPixelStorageFormat textureFormat, uint32_t mipLevelCount, SceneId sceneId) override;
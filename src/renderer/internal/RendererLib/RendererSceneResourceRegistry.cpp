@@ -119,7 +119,7 @@ namespace ramses::internal
     void RendererSceneResourceRegistry::addDataBuffer(DataBufferHandle handle, DeviceResourceHandle deviceHandle, EDataBufferType dataBufferType, uint32_t size)
     {
         assert(!m_dataBuffers.contains(handle));
-        m_dataBuffers.put(handle, { deviceHandle, size, dataBufferType });
+        m_dataBuffers.put(handle, { deviceHandle, size, dataBufferType, false });
     }
 
     void RendererSceneResourceRegistry::removeDataBuffer(DataBufferHandle handle)
@@ -140,6 +140,24 @@ namespace ramses::internal
         return m_dataBuffers.get(handle)->dataBufferType;
     }
 
+    uint32_t RendererSceneResourceRegistry::getDataBufferSize(DataBufferHandle handle) const
+    {
+        assert(m_dataBuffers.contains(handle));
+        return m_dataBuffers.get(handle)->size;
+    }
+
+    bool RendererSceneResourceRegistry::isDataBufferDataUploaded(DataBufferHandle handle) const
+    {
+        assert(m_dataBuffers.contains(handle));
+        return m_dataBuffers.get(handle)->dataUploaded;
+    }
+
+    void RendererSceneResourceRegistry::setDataBufferDataUploaded(DataBufferHandle handle)
+    {
+        assert(m_dataBuffers.contains(handle));
+        m_dataBuffers.get(handle)->dataUploaded = true;
+    }
+
     void RendererSceneResourceRegistry::getAllDataBuffers(DataBufferHandleVector& dataBuffers) const
     {
         assert(dataBuffers.empty());
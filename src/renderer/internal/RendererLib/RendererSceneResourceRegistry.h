@@ -52,6 +52,9 @@ namespace ramses::internal
         void                            removeDataBuffer            (DataBufferHandle handle);
         [[nodiscard]] DeviceResourceHandle            getDataBufferDeviceHandle   (DataBufferHandle handle) const;
         [[nodiscard]] EDataBufferType                 getDataBufferType           (DataBufferHandle handle) const;
+        [[nodiscard]] uint32_t                        getDataBufferSize           (DataBufferHandle handle) const;
+        [[nodiscard]] bool                            isDataBufferDataUploaded    (DataBufferHandle handle) const;
+        void                            setDataBufferDataUploaded   (DataBufferHandle handle);
         void                            getAllDataBuffers           (DataBufferHandleVector& dataBuffers) const;
 
         void                               addTextureBuffer            (TextureBufferHandle handle, DeviceResourceHandle deviceHandle, EPixelStorageFormat format, uint32_t size);
@@ -94,6 +97,7 @@ namespace ramses::internal
             DeviceResourceHandle deviceHandle;
             uint32_t size = 0u;
             EDataBufferType dataBufferType = EDataBufferType::Invalid;
+            bool dataUploaded = false;
         };
 
         using RenderBufferMap        = HashMap<RenderBufferHandle,   RenderBufferEntry>;
@@ -117,7 +117,8 @@ namespace ramses::internal
             IRenderBackend& renderBackend = displayController.getRenderBackend();
             IEmbeddedCompositingManager& embeddedCompositingManager = displayController.getEmbeddedCompositingManager();
 
-            m_asyncEffectUploader = std::make_unique<AsyncEffectUploader>(m_platform, renderBackend, m_notifier, static_cast<int>(m_display.asMemoryHandle()));
+            m_asyncEffectUploader = std::make_unique<AsyncEffectUploader>(m_platform, renderBackend, m_notifier, static_cast<int>(m_display.asMemoryHandle()),
+                displayConfig.getAsyncEffectUploadThreadCount());
             if (!m_asyncEffectUploader->createResourceUploadRenderBackendAndStartThread())
             {
                 m_renderer.destroyDisplayContext();
@@ -129,6 +130,7 @@ namespace ramses::internal
                                                         embeddedCompositingManager,
                                                         displayConfig,
                                                         binaryShaderCache);
+            m_effectPrewarmingEnabled = displayConfig.isAsyncEffectUploadEnabled() && displayConfig.isEffectPrewarmingEnabled();
 
             m_rendererEventCollector.addDisplayEvent(ERendererEventType::DisplayCreated, m_display);
 
@@ -188,6 +190,7 @@ namespace ramses::internal
         m_asyncEffectUploader->destroyResourceUploadRenderBackendAndStopThread();
         m_asyncEffectUploader.reset();
         m_displayResourceManager.reset();
+        m_effectPrewarmingEnabled = false;
 
         m_renderer.resetRenderInterruptState();
         m_renderer.destroyDisplayContext();
@@ -405,6 +408,9 @@ namespace ramses::internal
             }
             // add newly needed resources
             resourcesForMapping.insert(resourcesForMapping.end(), pendingFlush.resourceDataToProvide.cbegin(), pendingFlush.resourceDataToProvide.cend());
+            // start compiling effects of scene already, so that mapping does not have to wait for all of them
+            if (m_effectPrewarmingEnabled && !pendingFlush.resourceDataToProvide.empty())
+                m_displayResourceManager->prewarmEffects(pendingFlush.resourceDataToProvide);
             pendingFlush.resourceDataToProvide.clear();
 
             // assert stored resources are unique (without modifying state!)
@@ -498,8 +504,8 @@ namespace ramses::internal
                 StreamBufferLinkVector links;
                 for (const auto& updatedSource : m_streamUpdates)
                 {
-                    m_renderer.getStatistics().streamTextureUpdated(updatedSource.first, updatedSource.second);
-                    const auto& streamUsage = m_displayResourceManager->getStreamUsage(updatedSource.first);
+                    m_renderer.getStatistics().streamTextureUpdated(updatedSource.source, updatedSource.numCommitedFrames, updatedSource.numBytesUploaded);
+                    const auto& streamUsage = m_displayResourceManager->getStreamUsage(updatedSource.source);
                     // mark all scenes linked as consumer to updated source as modified
                     for (const auto streamBuffer : streamUsage)
                     {
@@ -554,34 +560,72 @@ namespace ramses::internal
 
         if (canApplyFlushes)
         {
-            stagingInfo.pendingData.allPendingFlushesApplied = true;
-            applyPendingFlushes(sceneID, stagingInfo);
+            const bool interruptible = canInterruptFlushApplication(sceneID, stagingInfo);
+            stagingInfo.pendingData.allPendingFlushesApplied = applyPendingFlushes(sceneID, stagingInfo, interruptible);
         }
         else
             m_renderer.getStatistics().flushBlocked(sceneID);
     }
 
-    void RendererSceneUpdater::applyPendingFlushes(SceneId sceneID, StagingInfo& stagingInfo)
+    // number of scene actions applied between time budget checks
+    static constexpr uint32_t SceneActionsApplyBatchSize = 1000u;
+
+    bool RendererSceneUpdater::canInterruptFlushApplication(SceneId sceneID, const StagingInfo& stagingInfo) const
+    {
+        // scene state visible to others must always be result of a fully applied flush,
+        // therefore only scenes that are not shown and not linked to other scenes can be left partially applied
+        if (m_sceneStateExecutor.getSceneState(sceneID) == ESceneState::Rendered)
+            return false;
+
+        // renderer has to catch up, same as when flushes are force applied
+        if (stagingInfo.pendingData.pendingFlushes.size() > m_maximumPendingFlushes)
+            return false;
+
+        const auto& linksManager = m_rendererScenes.getSceneLinksManager();
+        const auto isLinked = [sceneID](const SceneLinks& links) { return links.hasAnyLinksToProvider(sceneID) || links.hasAnyLinksToConsumer(sceneID); };
+        const auto& texLinks = linksManager.getTextureLinkManager();
+        return !isLinked(linksManager.getTransformationLinkManager().getSceneLinks())
+            && !isLinked(linksManager.getDataReferenceLinkManager().getSceneLinks())
+            && !isLinked(texLinks.getSceneLinks())
+            && !texLinks.getOffscreenBufferLinks().hasAnyLinksToProvider(sceneID)
+            && !texLinks.getStreamBufferLinks().hasAnyLinksToProvider(sceneID)
+            && !texLinks.getExternalBufferLinks().hasAnyLinksToProvider(sceneID);
+    }
+
+    bool RendererSceneUpdater::applyPendingFlushes(SceneId sceneID, StagingInfo& stagingInfo, bool interruptible)
     {
         auto& rendererScene = const_cast<RendererCachedScene&>(m_rendererScenes.getScene(sceneID));
         rendererScene.preallocateSceneSize(stagingInfo.sizeInformation);
 
         PendingData& pendingData = stagingInfo.pendingData;
         PendingFlushes& pendingFlushes = pendingData.pendingFlushes;
-        for (auto& pendingFlush : pendingFlushes)
+        bool anyFlushApplied = false;
+        for (; pendingData.numAppliedFlushes < pendingFlushes.size(); ++pendingData.numAppliedFlushes)
         {
+            // at least one flush or batch of scene actions is applied every frame regardless of time budget to guarantee progress
+            if (interruptible && anyFlushApplied && m_frameTimer.isTimeBudgetExceededForSection(EFrameTimerSectionBudget::SceneActionsApply))
+            {
+                m_renderer.getStatistics().flushApplicationInterrupted(sceneID);
+                return false;
+            }
+
+            auto& pendingFlush = pendingFlushes[pendingData.numAppliedFlushes];
             const auto hadActiveShaderAnimation = rendererScene.hasActiveShaderAnimation();
             // re-enable skub optimization
             // skub will be disabled again if a semantic time uniform is applied during first rendering after flush
             rendererScene.setActiveShaderAnimation(false);
-            if (pendingFlush.timeInfo.isEffectTimeSync)
+            if (pendingFlush.timeInfo.isEffectTimeSync && pendingFlush.numAppliedSceneActions == 0u)
             {
                 LOG_INFO_P(CONTEXT_RENDERER, "EffectTimeSync: {} for scene: {}",
                     std::chrono::time_point_cast<std::chrono::milliseconds>(pendingFlush.timeInfo.internalTimestamp).time_since_epoch().count(),
                     rendererScene.getSceneId());
                 rendererScene.setEffectTimeSync(pendingFlush.timeInfo.internalTimestamp);
             }
-            ApplySceneActions(rendererScene, pendingFlush);
+            if (!applySceneActions(rendererScene, pendingFlush, interruptible))
+            {
+                m_renderer.getStatistics().flushApplicationInterrupted(sceneID);
+                return false;
+            }
 
             if (pendingFlush.versionTag.isValid())
             {
@@ -589,9 +633,10 @@ namespace ramses::internal
                     " with sceneVersionTag " << pendingFlush.versionTag);
                 m_rendererEventCollector.addSceneFlushEvent(ERendererEventType::SceneFlushed, sceneID, pendingFlush.versionTag);
             }
+            anyFlushApplied = true;
             stagingInfo.lastAppliedVersionTag = pendingFlush.versionTag;
             m_expirationMonitor.onFlushApplied(sceneID, pendingFlush.timeInfo.expirationTimestamp, pendingFlush.versionTag, pendingFlush.flushIndex);
-            m_renderer.getStatistics().flushApplied(sceneID);
+            m_renderer.getStatistics().flushApplied(sceneID, pendingFlush.timeInfo.internalTimestamp);
 
             // mark scene as modified only if it received scene actions other than flush
             // also mark scene as modified if it had an active shader animation before (to not stop the animation with an empty flush)
@@ -614,6 +659,8 @@ namespace ramses::internal
             assert(m_sceneReferenceLogic);
             m_sceneReferenceLogic->addActions(sceneID, pendingData.sceneReferenceActions);
         }
+
+        return true;
     }
 
     void RendererSceneUpdater::processStagedResourceChangesFromAppliedFlushes()
@@ -781,7 +828,9 @@ namespace ramses::internal
             {
             case ESceneState::MapRequested:
             {
-                assert(m_rendererScenes.getStagingInfo(sceneId).pendingData.pendingFlushes.empty());
+                // flushes of unmapped scene might be applied over multiple frames if interrupted due to time budget
+                if (!m_rendererScenes.getStagingInfo(sceneId).pendingData.pendingFlushes.empty())
+                    break;
                 const IDisplayController& displayController = m_renderer.getDisplayController();
                 m_renderer.assignSceneToDisplayBuffer(sceneId, displayController.getDisplayBuffer(), 0);
                 m_sceneStateExecutor.setMappingAndUploading(sceneId);
@@ -845,7 +894,8 @@ namespace ramses::internal
         for (const auto& rendererScene : m_rendererScenes)
         {
             const SceneId sceneId = rendererScene.key;
-            if (m_sceneStateExecutor.getSceneState(sceneId) == ESceneState::RenderRequested)
+            // partially applied flush must not be shown, scene stays render requested until flush application finished
+            if (m_sceneStateExecutor.getSceneState(sceneId) == ESceneState::RenderRequested && !m_rendererScenes.getStagingInfo(sceneId).pendingData.hasPartiallyAppliedFlushes())
             {
                 m_renderer.resetRenderInterruptState();
                 m_renderer.setSceneShown(sceneId, true);
@@ -919,15 +969,28 @@ namespace ramses::internal
         return false;
     }
 
-    void RendererSceneUpdater::ApplySceneActions(RendererCachedScene& scene, PendingFlush& flushInfo)
+    bool RendererSceneUpdater::applySceneActions(RendererCachedScene& scene, PendingFlush& flushInfo, bool interruptible)
     {
         const SceneActionCollection& actionsForScene = flushInfo.sceneActions;
         const uint32_t numActions = actionsForScene.numberOfActions();
-        LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::applySceneActions start applying scene actions [count:" << numActions << "] for scene with id " << scene.getSceneId());
+        LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::applySceneActions start applying scene actions [count:" << numActions << ", already applied:"
+            << flushInfo.numAppliedSceneActions << "] for scene with id " << scene.getSceneId());
 
-        SceneActionApplier::ApplyActionsOnScene(scene, actionsForScene);
+        while (flushInfo.numAppliedSceneActions < numActions)
+        {
+            const uint32_t numActionsToApply = interruptible ? std::min(SceneActionsApplyBatchSize, numActions - flushInfo.numAppliedSceneActions) : numActions - flushInfo.numAppliedSceneActions;
+            SceneActionApplier::ApplyActionsOnScene(scene, actionsForScene, flushInfo.numAppliedSceneActions, numActionsToApply);
+            flushInfo.numAppliedSceneActions += numActionsToApply;
+
+            if (interruptible && flushInfo.numAppliedSceneActions < numActions && m_frameTimer.isTimeBudgetExceededForSection(EFrameTimerSectionBudget::SceneActionsApply))
+            {
+                LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::applySceneActions interrupted after " << flushInfo.numAppliedSceneActions << " scene actions for scene with id " << scene.getSceneId());
+                return false;
+            }
+        }
 
         LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::applySceneActions finished applying scene actions for scene with id " << scene.getSceneId());
+        return true;
     }
 
     void RendererSceneUpdater::destroyScene(SceneId sceneID)
@@ -1713,26 +1776,29 @@ namespace ramses::internal
 
         resolveDataLinksForConsumerScenes(dataRefLinkManager);
 
-        markScenesDependantOnModifiedConsumersAsModified(dataRefLinkManager, transfLinkManager, texLinkManager);
+        markScenesDependantOnModifiedConsumersAsModified(transfLinkManager, texLinkManager);
         markScenesDependantOnModifiedOffscreenBuffersAsModified(texLinkManager);
     }
 
     void RendererSceneUpdater::resolveDataLinksForConsumerScenes(const DataReferenceLinkManager& dataRefLinkManager)
     {
-        for(const auto& rendererScene : m_rendererScenes)
+        // resolve in dependency order so that values passed through multiple scenes arrive within same frame
+        for(const auto sceneID : dataRefLinkManager.getDependencyChecker().getDependentScenesInOrder())
         {
-            const SceneId sceneID = rendererScene.key;
             if (dataRefLinkManager.getDependencyChecker().hasDependencyAsConsumer(sceneID))
             {
                 if (m_sceneStateExecutor.getSceneState(sceneID) == ESceneState::Rendered)
                 {
                     DataReferenceLinkCachedScene& scene = m_rendererScenes.getScene(sceneID);
-                    dataRefLinkManager.resolveLinksForConsumerScene(scene);
+                    // consumer is only modified if any linked value actually changed
+                    if (dataRefLinkManager.resolveLinksForConsumerScene(scene))
+                        m_modifiedScenesToRerender.put(sceneID);
                 }
             }
         }
     }
-    void RendererSceneUpdater::markScenesDependantOnModifiedConsumersAsModified(const DataReferenceLinkManager& dataRefLinkManager, const TransformationLinkManager& transfLinkManager, const TextureLinkManager& texLinkManager)
+
+    void RendererSceneUpdater::markScenesDependantOnModifiedConsumersAsModified(const TransformationLinkManager& transfLinkManager, const TextureLinkManager& texLinkManager)
     {
         auto findFirstOfModifiedScenes = [this](const SceneIdVector& v)
         {
@@ -1740,15 +1806,12 @@ namespace ramses::internal
         };
 
         const auto& transDependencyOrderedScenes = transfLinkManager.getDependencyChecker().getDependentScenesInOrder();
-        const auto& dataRefDependencyOrderedScenes = dataRefLinkManager.getDependencyChecker().getDependentScenesInOrder();
         const auto& texDependencyOrderedScenes = texLinkManager.getDependencyChecker().getDependentScenesInOrder();
 
         const auto transDepRootIt     = findFirstOfModifiedScenes(transDependencyOrderedScenes);
-        const auto dataRefDepRootIt   = findFirstOfModifiedScenes(dataRefDependencyOrderedScenes);
         const auto texDepRootIt       = findFirstOfModifiedScenes(texDependencyOrderedScenes);
 
         m_modifiedScenesToRerender.insert(transDepRootIt,     transDependencyOrderedScenes.cend());
-        m_modifiedScenesToRerender.insert(dataRefDepRootIt,   dataRefDependencyOrderedScenes.cend());
         m_modifiedScenesToRerender.insert(texDepRootIt,       texDependencyOrderedScenes.cend());
     }
 
@@ -118,8 +118,9 @@ namespace ramses::internal
         bool markClientAndSceneResourcesForReupload(SceneId sceneId);
 
         void updateScenePendingFlushes(SceneId sceneID, StagingInfo& stagingInfo);
-        static void ApplySceneActions(RendererCachedScene& scene, PendingFlush& flushInfo);
-        void applyPendingFlushes(SceneId sceneID, StagingInfo& stagingInfo);
+        bool applySceneActions(RendererCachedScene& scene, PendingFlush& flushInfo, bool interruptible);
+        bool applyPendingFlushes(SceneId sceneID, StagingInfo& stagingInfo, bool interruptible);
+        [[nodiscard]] bool canInterruptFlushApplication(SceneId sceneID, const StagingInfo& stagingInfo) const;
         void processStagedResourceChanges(SceneId sceneID, StagingInfo& stagingInfo);
 
         [[nodiscard]] bool areResourcesFromPendingFlushesUploaded(SceneId sceneId) const;
@@ -140,7 +141,7 @@ namespace ramses::internal
         void updateScenesStates();
 
         void resolveDataLinksForConsumerScenes(const DataReferenceLinkManager& dataRefLinkManager);
-        void markScenesDependantOnModifiedConsumersAsModified(const DataReferenceLinkManager& dataRefLinkManager, const TransformationLinkManager &transfLinkManager, const TextureLinkManager& texLinkManager);
+        void markScenesDependantOnModifiedConsumersAsModified(const TransformationLinkManager &transfLinkManager, const TextureLinkManager& texLinkManager);
         void markScenesDependantOnModifiedOffscreenBuffersAsModified(const TextureLinkManager& texLinkManager);
 
         bool checkIfForceMapNeeded(SceneId sceneId);
@@ -162,6 +163,7 @@ namespace ramses::internal
 
         std::unique_ptr<IRendererResourceManager> m_displayResourceManager;
         std::unique_ptr<AsyncEffectUploader> m_asyncEffectUploader;
+        bool m_effectPrewarmingEnabled = false;
 
         struct SceneMapRequest
         {
@@ -26,9 +26,32 @@ namespace ramses::internal
         return m_frameNumber <= 0 ? 0u : m_drawCalls / m_frameNumber;
     }
 
+    uint32_t RendererStatistics::getStateChangesIssuedPerFrame() const
+    {
+        return m_frameNumber <= 0 ? 0u : static_cast<uint32_t>(m_stateChangesIssued / static_cast<uint64_t>(m_frameNumber));
+    }
+
+    uint32_t RendererStatistics::getStateChangesSkippedPerFrame() const
+    {
+        return m_frameNumber <= 0 ? 0u : static_cast<uint32_t>(m_stateChangesSkipped / static_cast<uint64_t>(m_frameNumber));
+    }
+
     void RendererStatistics::sceneRendered(SceneId sceneId)
     {
-        m_sceneStatistics[sceneId].numRendered++;
+        auto& sceneStats = m_sceneStatistics[sceneId];
+        sceneStats.numRendered++;
+
+        if (!sceneStats.appliedFlushesNotRendered.empty())
+        {
+            const auto now = FlushTime::Clock::now();
+            for (const auto flushTimestamp : sceneStats.appliedFlushesNotRendered)
+            {
+                // latency can be negative if clocks of client and renderer are not synchronized
+                const auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(now - flushTimestamp).count();
+                sceneStats.flushToRenderLatency.record(latency > 0 ? static_cast<uint64_t>(latency) : 0u);
+            }
+            sceneStats.appliedFlushesNotRendered.clear();
+        }
     }
 
     void RendererStatistics::offscreenBufferSwapped(DeviceResourceHandle offscreenBuffer, bool isInterruptible)
@@ -54,6 +77,7 @@ namespace ramses::internal
     {
         m_resourcesUploaded++;
         m_resourcesBytesUploaded += byteSize;
+        m_metrics.resourceUploaded(byteSize);
     }
 
     void RendererStatistics::sceneResourceUploaded(SceneId sceneId, size_t byteSize)
@@ -61,24 +85,28 @@ namespace ramses::internal
         auto& sceneStats = m_sceneStatistics[sceneId];
         sceneStats.sceneResourcesUploaded++;
         sceneStats.sceneResourcesBytesUploaded += byteSize;
+        m_metrics.sceneResourceUploaded(byteSize);
     }
 
-    void RendererStatistics::streamTextureUpdated(WaylandIviSurfaceId iviSurface, size_t numUpdates)
+    void RendererStatistics::streamTextureUpdated(WaylandIviSurfaceId iviSurface, size_t numUpdates, uint64_t numBytesUploaded)
     {
         auto& strTexStat = m_streamTextureStatistics[iviSurface];
         strTexStat.numUpdates += numUpdates;
+        strTexStat.numBytesUploaded += numBytesUploaded;
         if (strTexStat.lastFrameUpdated != m_frameNumber)
         {
             strTexStat.numFramesWhereUpdated++;
             strTexStat.lastFrameUpdated = m_frameNumber;
         }
         strTexStat.maxUpdatesPerFrame = std::max(strTexStat.maxUpdatesPerFrame, numUpdates);
+        m_metrics.streamTextureUpdated(numUpdates, numBytesUploaded);
     }
 
     void RendererStatistics::shaderCompiled(std::chrono::microseconds microsecondsUsed, std::string_view name, SceneId sceneid)
     {
         m_shadersCompiled++;
         m_microsecondsForShaderCompilation += microsecondsUsed.count();
+        m_metrics.shaderCompiled(microsecondsUsed);
         if (microsecondsUsed > m_maximumDurationShaderTime)
         {
             m_maximumDurationShaderTime = microsecondsUsed;
@@ -91,6 +119,7 @@ namespace ramses::internal
     {
         m_totalResourceUploadedSize = totalUploaded;
         m_gpuCacheSize = gpuCacheSize;
+        m_metrics.setVRAMUsage(totalUploaded, gpuCacheSize);
     }
 
     void RendererStatistics::trackArrivedFlush(SceneId sceneId, size_t numSceneActions, size_t numAddedResources, size_t numRemovedResources, size_t numSceneResourceActions, std::chrono::milliseconds latency)
@@ -108,12 +137,17 @@ namespace ramses::internal
         sceneStats.numResourcesRemovedPerFlush.update(numRemovedResources);
         sceneStats.numSceneResourceActionsPerFlush.update(numSceneResourceActions);
         sceneStats.flushLatency.update(static_cast<int64_t>(latency.count()));
+        m_metrics.flushArrived(latency);
     }
 
-    void RendererStatistics::flushApplied(SceneId sceneId)
+    void RendererStatistics::flushApplied(SceneId sceneId, FlushTime::Clock::time_point flushTimestamp)
     {
         auto& sceneStats = m_sceneStatistics[sceneId];
         sceneStats.numFlushesApplied++;
+        // scene might not be rendered for a long time (hidden), only oldest flushes are then relevant for latency
+        if (flushTimestamp != FlushTime::InvalidTimestamp && sceneStats.appliedFlushesNotRendered.size() < MaxTrackedFlushesNotRendered)
+            sceneStats.appliedFlushesNotRendered.push_back(flushTimestamp);
+        m_metrics.flushApplied();
         if (sceneStats.lastFrameFlushApplied != m_frameNumber)
         {
             sceneStats.numFramesWhereFlushApplied++;
@@ -121,6 +155,11 @@ namespace ramses::internal
         }
     }
 
+    void RendererStatistics::flushApplicationInterrupted(SceneId sceneId)
+    {
+        m_sceneStatistics[sceneId].numFlushApplicationsInterrupted++;
+    }
+
     void RendererStatistics::flushBlocked(SceneId sceneId)
     {
         auto& sceneStats = m_sceneStatistics[sceneId];
@@ -183,10 +222,27 @@ namespace ramses::internal
 
         m_frameNumber++;
         m_drawCalls += drawCalls;
+        // first frame has no previous frame to measure duration from
+        if (m_lastFrameTick != 0u)
+        {
+            m_frameDurationHistogram.record(currTick - m_lastFrameTick);
+            m_metrics.frameFinished(std::chrono::microseconds{ static_cast<int64_t>(currTick - m_lastFrameTick) }, drawCalls);
+        }
 
         m_lastFrameTick = currTick;
     }
 
+    void RendererStatistics::deviceStateChanges(uint32_t issued, uint32_t skipped)
+    {
+        m_stateChangesIssued += issued;
+        m_stateChangesSkipped += skipped;
+    }
+
+    void RendererStatistics::framePacingJitter(std::chrono::microseconds jitter)
+    {
+        m_framePacingJitterHistogram.record(static_cast<uint64_t>(std::max<int64_t>(jitter.count(), 0)));
+    }
+
     void RendererStatistics::addExpirationOffset(SceneId sceneId, int64_t expirationOffset)
     {
         m_sceneStatistics[sceneId].expirationOffset.update(expirationOffset);
@@ -200,8 +256,12 @@ namespace ramses::internal
         m_timeBase = PlatformTime::GetMillisecondsMonotonic();
         m_frameNumber = 0;
         m_drawCalls = 0u;
+        m_stateChangesIssued = 0u;
+        m_stateChangesSkipped = 0u;
         m_frameDurationMin = std::numeric_limits<uint32_t>::max();
         m_frameDurationMax = 0u;
+        m_frameDurationHistogram.reset();
+        m_framePacingJitterHistogram.reset();
         m_resourcesUploaded = 0u;
         m_resourcesBytesUploaded = 0u;
         m_shadersCompiled = 0u;
@@ -218,6 +278,7 @@ namespace ramses::internal
             sceneStat.numFramesWhereFlushArrived = 0u;
             sceneStat.numFramesWhereFlushApplied = 0u;
             sceneStat.numFramesWhereFlushBlocked = 0u;
+            sceneStat.numFlushApplicationsInterrupted = 0u;
             sceneStat.maxFramesWithNoFlushApplied = 0u;
             sceneStat.maxConsecutiveFramesBlocked = 0u;
             sceneStat.lastFrameFlushArrived = -1; // treat as if arrived in previous period's last frame (ie. do not measure 'arrive gaps' across periods)
@@ -228,6 +289,7 @@ namespace ramses::internal
             sceneStat.numResourcesRemovedPerFlush.reset();
             sceneStat.numSceneResourceActionsPerFlush.reset();
             sceneStat.flushLatency.reset();
+            sceneStat.flushToRenderLatency.reset();
             sceneStat.expirationOffset.reset();
             sceneStat.numExpirationOffsets = 0u;
             sceneStat.numExpiredOffsets = 0u;
@@ -249,10 +311,37 @@ namespace ramses::internal
             strTexStat.second.numFramesWhereUpdated = 0u;
             strTexStat.second.maxUpdatesPerFrame = 0u;
             strTexStat.second.maxFramesWithNoUpdate = 0u;
+            strTexStat.second.numBytesUploaded = 0u;
             strTexStat.second.lastFrameUpdated = -1;
         }
     }
 
+    const RendererMetrics& RendererStatistics::getMetrics() const
+    {
+        return m_metrics;
+    }
+
+    DurationHistogram::Percentiles RendererStatistics::getFrameDurationPercentiles() const
+    {
+        return m_frameDurationHistogram.getPercentiles();
+    }
+
+    DurationHistogram::Percentiles RendererStatistics::getFlushToRenderLatencyPercentiles(SceneId sceneId) const
+    {
+        const auto it = m_sceneStatistics.find(sceneId);
+        return it != m_sceneStatistics.cend() ? it->second.flushToRenderLatency.getPercentiles() : DurationHistogram::Percentiles{};
+    }
+
+    DurationHistogram::Percentiles RendererStatistics::getFramePacingJitterPercentiles() const
+    {
+        return m_framePacingJitterHistogram.getPercentiles();
+    }
+
+    static void WritePercentilesToStream(StringOutputStream& str, const DurationHistogram::Percentiles& percentiles)
+    {
+        str << percentiles.p50 << "/" << percentiles.p90 << "/" << percentiles.p99 << "/" << percentiles.max;
+    }
+
     void RendererStatistics::writeStatsToStream(StringOutputStream& str) const
     {
         if (m_frameNumber == 0u)
@@ -263,6 +352,20 @@ namespace ramses::internal
             ", maxFrameTime " << m_frameDurationMax << "us]" <<
             ", drawcallsPerFrame " << getDrawCallsPerFrame() <<
             ", numFrames " << m_frameNumber;
+        if (m_stateChangesIssued + m_stateChangesSkipped > 0u)
+            str << ", stateChangesPerFrame issued/skipped " << getStateChangesIssuedPerFrame() << "/" << getStateChangesSkippedPerFrame();
+        if (m_frameDurationHistogram.getCount() > 0u)
+        {
+            str << ", frameTime p50/p90/p99/max (";
+            WritePercentilesToStream(str, m_frameDurationHistogram.getPercentiles());
+            str << " us)";
+        }
+        if (m_framePacingJitterHistogram.getCount() > 0u)
+        {
+            str << ", pacingJitter p50/p90/p99/max (";
+            WritePercentilesToStream(str, m_framePacingJitterHistogram.getPercentiles());
+            str << " us)";
+        }
         if (m_resourcesUploaded > 0u)
             str << ", resUploaded " << m_resourcesUploaded << " (" << m_resourcesBytesUploaded << " B)";
         str << ", RC VRAM usage/cache (" << (m_totalResourceUploadedSize >> 20) << "/" << (m_gpuCacheSize >> 20) << " MB)";
@@ -302,6 +405,8 @@ namespace ramses::internal
             str << ", maxFramesFBlocked " << sceneStats.maxConsecutiveFramesBlocked;
             str << ", FArrived " << sceneStats.numFlushesArrived;
             str << ", FApplied " << sceneStats.numFlushesApplied;
+            if (sceneStats.numFlushApplicationsInterrupted > 0u)
+                str << ", FInterrupted " << sceneStats.numFlushApplicationsInterrupted;
             if (sceneStats.numFlushesArrived > 0u)
             {
                 str << ", actions/F (" << numSceneActionsPerFlush.minValue << "/" << numSceneActionsPerFlush.maxValue << "/" << static_cast<float>(numSceneActionsPerFlush.sum) / static_cast<float>(sceneStats.numFlushesArrived) << ")";
@@ -310,6 +415,12 @@ namespace ramses::internal
                 str << ", RC-/F (" << numResourcesRemovedPerFlush.minValue << "/" << numResourcesRemovedPerFlush.maxValue << "/" << static_cast<float>(numResourcesRemovedPerFlush.sum) / static_cast<float>(sceneStats.numFlushesArrived) << ")";
                 str << ", RS/F (" << numSceneResourceActionsPerFlush.minValue << "/" << numSceneResourceActionsPerFlush.maxValue << "/" << static_cast<float>(numSceneResourceActionsPerFlush.sum) / static_cast<float>(sceneStats.numFlushesArrived) << ")";
             }
+            if (sceneStats.flushToRenderLatency.getCount() > 0u)
+            {
+                str << ", F2R p50/p90/p99/max (";
+                WritePercentilesToStream(str, sceneStats.flushToRenderLatency.getPercentiles());
+                str << " ms)";
+            }
             if (sceneStats.numExpirationOffsets > 0u)
                 str << ", Exp (" << sceneStats.numExpiredOffsets << "/" << sceneStats.numExpirationOffsets << ":" << expirationOffset.minValue << "/" << expirationOffset.maxValue << "/" << static_cast<float>(expirationOffset.sum) / static_cast<float>(sceneStats.numExpirationOffsets) << ")";
 
@@ -325,6 +436,8 @@ namespace ramses::internal
             str << ", framesUpd " << strTexStat.second.numFramesWhereUpdated;
             str << ", maxUpdInFrame " << strTexStat.second.maxUpdatesPerFrame;
             str << ", maxFramesWithNoUpd " << strTexStat.second.maxFramesWithNoUpdate;
+            if (strTexStat.second.numUpdates > 0u)
+                str << ", bytesUpl " << strTexStat.second.numBytesUploaded << " (" << strTexStat.second.numBytesUploaded / strTexStat.second.numUpdates << "/commit)";
             str << "\n";
         }
     }
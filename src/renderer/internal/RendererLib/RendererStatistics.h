@@ -10,6 +10,8 @@
 
 #include "internal/SceneGraph/SceneAPI/SceneId.h"
 #include "internal/RendererLib/Types.h"
+#include "internal/RendererLib/RendererMetrics.h"
+#include "internal/RendererLib/DurationHistogram.h"
 #include "internal/Core/Utils/StatisticCollection.h"
 #include "internal/PlatformAbstraction/PlatformTime.h"
 #include "internal/Components/FlushTimeInformation.h"
@@ -18,6 +20,7 @@
 #include <map>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -28,11 +31,14 @@ namespace ramses::internal
     public:
         [[nodiscard]] float  getFps() const;
         [[nodiscard]] uint32_t getDrawCallsPerFrame() const;
+        [[nodiscard]] uint32_t getStateChangesIssuedPerFrame() const;
+        [[nodiscard]] uint32_t getStateChangesSkippedPerFrame() const;
 
         void sceneRendered(SceneId sceneId);
         void trackArrivedFlush(SceneId sceneId, size_t numSceneActions, size_t numAddedResources, size_t numRemovedResources, size_t numSceneResourceActions, std::chrono::milliseconds latency);
-        void flushApplied(SceneId sceneId);
+        void flushApplied(SceneId sceneId, FlushTime::Clock::time_point flushTimestamp = FlushTime::InvalidTimestamp);
         void flushBlocked(SceneId sceneId);
+        void flushApplicationInterrupted(SceneId sceneId);
 
         void offscreenBufferSwapped(DeviceResourceHandle offscreenBuffer, bool isInterruptible);
         void offscreenBufferInterrupted(DeviceResourceHandle offscreenBuffer);
@@ -40,7 +46,7 @@ namespace ramses::internal
 
         void resourceUploaded(size_t byteSize);
         void sceneResourceUploaded(SceneId sceneId, size_t byteSize);
-        void streamTextureUpdated(WaylandIviSurfaceId iviSurface, size_t numUpdates);
+        void streamTextureUpdated(WaylandIviSurfaceId iviSurface, size_t numUpdates, uint64_t numBytesUploaded);
         void shaderCompiled(std::chrono::microseconds microsecondsUsed, std::string_view name, SceneId sceneid);
         void setVRAMUsage(uint64_t totalUploaded, uint64_t gpuCacheSize);
 
@@ -51,17 +57,33 @@ namespace ramses::internal
         void addExpirationOffset(SceneId sceneId, int64_t expirationOffset);
 
         void frameFinished(uint32_t drawCalls);
+        void deviceStateChanges(uint32_t issued, uint32_t skipped);
+        void framePacingJitter(std::chrono::microseconds jitter);
         void reset();
 
         void writeStatsToStream(StringOutputStream& str) const;
 
+        [[nodiscard]] DurationHistogram::Percentiles getFrameDurationPercentiles() const;
+        [[nodiscard]] DurationHistogram::Percentiles getFlushToRenderLatencyPercentiles(SceneId sceneId) const;
+        [[nodiscard]] DurationHistogram::Percentiles getFramePacingJitterPercentiles() const;
+
+        [[nodiscard]] const RendererMetrics& getMetrics() const;
+
     private:
+        static constexpr size_t MaxTrackedFlushesNotRendered = 64u;
+
+        RendererMetrics m_metrics;
+
         int32_t m_frameNumber = 0;
         uint64_t m_timeBase = PlatformTime::GetMillisecondsMonotonic();
         uint32_t m_drawCalls = 0u;
+        uint64_t m_stateChangesIssued = 0u;
+        uint64_t m_stateChangesSkipped = 0u;
         uint64_t m_lastFrameTick = 0u;
         uint32_t m_frameDurationMin = std::numeric_limits<uint32_t>::max();
         uint32_t m_frameDurationMax = 0u;
+        DurationHistogram m_frameDurationHistogram;
+        DurationHistogram m_framePacingJitterHistogram;
         size_t m_resourcesUploaded = 0u;
         size_t m_resourcesBytesUploaded = 0u;
         size_t m_shadersCompiled = 0u;
@@ -79,6 +101,7 @@ namespace ramses::internal
             size_t numFramesWhereFlushArrived = 0u;
             size_t numFramesWhereFlushApplied = 0u;
             size_t numFramesWhereFlushBlocked = 0u;
+            size_t numFlushApplicationsInterrupted = 0u;
             size_t maxFramesWithNoFlushApplied = 0u;
             size_t maxConsecutiveFramesBlocked = 0u;
             size_t currentConsecutiveFramesBlocked = 0u;
@@ -92,6 +115,10 @@ namespace ramses::internal
             SummaryEntry<size_t> numSceneResourceActionsPerFlush;
             SummaryEntry<int64_t> flushLatency;
 
+            // time in milliseconds from flush on client side until the scene was rendered with that flush applied
+            DurationHistogram flushToRenderLatency;
+            std::vector<FlushTime::Clock::time_point> appliedFlushesNotRendered;
+
             // expiration offset in milliseconds, can be negative and zero (=healthy) or positive (=expired)
             SummaryEntry<int64_t> expirationOffset;
             size_t numExpirationOffsets = 0u;
@@ -122,6 +149,7 @@ namespace ramses::internal
             size_t numFramesWhereUpdated = 0u;
             size_t maxUpdatesPerFrame = 0u;
             size_t maxFramesWithNoUpdate = 0u;
+            uint64_t numBytesUploaded = 0u;
             int32_t lastFrameUpdated = -1;
         };
 
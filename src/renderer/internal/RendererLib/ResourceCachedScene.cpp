@@ -37,6 +37,7 @@ namespace ramses::internal
         resizeContainerIfSmaller(m_effectDeviceHandleCache, sizeInfo.renderableCount);
         resizeContainerIfSmaller(m_renderableVertexArrayDirty, sizeInfo.renderableCount);
         resizeContainerIfSmaller(m_vertexArrayCache, sizeInfo.renderableCount);
+        resizeContainerIfSmaller(m_drawPackets, sizeInfo.renderableCount);
         resizeContainerIfSmaller(m_deviceHandleCacheForTextures, sizeInfo.textureSamplerCount);
         resizeContainerIfSmaller(m_renderTargetCache, sizeInfo.renderTargetCount);
         resizeContainerIfSmaller(m_blitPassCache, sizeInfo.blitPassCount * 2u);
@@ -58,6 +59,7 @@ namespace ramses::internal
     {
         TextureLinkCachedScene::releaseRenderable(renderableHandle);
         setRenderableResourcesDirtyFlag(renderableHandle, false);
+        releaseDrawPacketUniforms(m_drawPackets[renderableHandle.asMemoryHandle()]);
         setRenderableVertexArrayDirtyFlag(renderableHandle, true);
     }
 
@@ -78,6 +80,30 @@ namespace ramses::internal
         setRenderableVertexArrayDirtyFlag(renderableHandle, true);
     }
 
+    void ResourceCachedScene::setRenderableStartIndex(RenderableHandle renderableHandle, uint32_t startIndex)
+    {
+        TextureLinkCachedScene::setRenderableStartIndex(renderableHandle, startIndex);
+        m_drawPackets[renderableHandle.asMemoryHandle()].startIndex = startIndex;
+    }
+
+    void ResourceCachedScene::setRenderableIndexCount(RenderableHandle renderableHandle, uint32_t indexCount)
+    {
+        TextureLinkCachedScene::setRenderableIndexCount(renderableHandle, indexCount);
+        m_drawPackets[renderableHandle.asMemoryHandle()].indexCount = indexCount;
+    }
+
+    void ResourceCachedScene::setRenderableInstanceCount(RenderableHandle renderableHandle, uint32_t instanceCount)
+    {
+        TextureLinkCachedScene::setRenderableInstanceCount(renderableHandle, instanceCount);
+        m_drawPackets[renderableHandle.asMemoryHandle()].instanceCount = instanceCount;
+    }
+
+    void ResourceCachedScene::setRenderableRenderState(RenderableHandle renderableHandle, RenderStateHandle stateHandle)
+    {
+        TextureLinkCachedScene::setRenderableRenderState(renderableHandle, stateHandle);
+        m_drawPackets[renderableHandle.asMemoryHandle()].renderState = stateHandle;
+    }
+
     DataInstanceHandle ResourceCachedScene::allocateDataInstance(DataLayoutHandle handle, DataInstanceHandle instanceHandle)
     {
         const DataInstanceHandle dataInstance = TextureLinkCachedScene::allocateDataInstance(handle, instanceHandle);
@@ -134,6 +160,13 @@ namespace ramses::internal
         setDataInstanceDirtyFlag(dataInstanceHandle, true);
     }
 
+    void ResourceCachedScene::setDataReference(DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef)
+    {
+        TextureLinkCachedScene::setDataReference(containerHandle, field, dataRef);
+        // draw packets of renderables using this data instance have the reference resolved
+        setDataInstanceDirtyFlag(containerHandle, true);
+    }
+
     RenderTargetHandle ResourceCachedScene::allocateRenderTarget(RenderTargetHandle targetHandle)
     {
         const RenderTargetHandle rtHandle = TextureLinkCachedScene::allocateRenderTarget(targetHandle);
@@ -208,6 +241,19 @@ namespace ramses::internal
         return m_renderableVertexArrayDirty;
     }
 
+    const DrawPacket& ResourceCachedScene::getDrawPacket(RenderableHandle renderable) const
+    {
+        assert(renderable.asMemoryHandle() < m_drawPackets.size());
+        assert(!renderableResourcesDirty(renderable));
+        return m_drawPackets[renderable.asMemoryHandle()];
+    }
+
+    const DrawPacketUniform* ResourceCachedScene::getDrawPacketUniforms(const DrawPacket& drawPacket) const
+    {
+        assert(drawPacket.uniformsOffset + drawPacket.uniformsCount <= m_drawPacketUniforms.size());
+        return m_drawPacketUniforms.data() + drawPacket.uniformsOffset;
+    }
+
     bool ResourceCachedScene::CheckAndUpdateDeviceHandle(const IResourceDeviceHandleAccessor& resourceAccessor, DeviceResourceHandle& deviceHandleInOut, const ResourceContentHash& resourceHash)
     {
         deviceHandleInOut = DeviceResourceHandle::Invalid();
@@ -462,10 +508,15 @@ namespace ramses::internal
                     checkGeometryResources(resourceAccessor, renderable))
                 {
                     setRenderableResourcesDirtyFlag(renderable, false);
+                    compileDrawPacket(renderable);
                 }
             }
         }
 
+        // ranges of recompiled packets which did not fit into their previous range are left unused
+        if (m_drawPacketUniforms.size() > 2u * m_drawPacketUniformsInUse + 1024u)
+            compactDrawPacketUniforms();
+
         checkAndUpdateRenderTargetResources(resourceAccessor);
         checkAndUpdateBlitPassResources(resourceAccessor);
     }
@@ -628,12 +679,98 @@ namespace ramses::internal
 
                 m_vertexArrayCache[renderableAsIndex].usesIndexArray = usesIndices;
                 m_vertexArrayCache[renderableAsIndex].deviceHandle = resourceAccessor.getVertexArrayDeviceHandle(renderableHandle, getSceneId());
+                m_drawPackets[renderableAsIndex].vertexArray = m_vertexArrayCache[renderableAsIndex];
 
                 setRenderableVertexArrayDirtyFlag(renderableHandle, false);
             }
         }
     }
 
+    void ResourceCachedScene::compileDrawPacket(RenderableHandle renderable)
+    {
+        const uint32_t renderableAsIndex = renderable.asMemoryHandle();
+        const Renderable& renderableData = getRenderable(renderable);
+        DrawPacket& drawPacket = m_drawPackets[renderableAsIndex];
+        drawPacket.effectDeviceHandle = m_effectDeviceHandleCache[renderableAsIndex];
+        drawPacket.vertexArray = m_vertexArrayCache[renderableAsIndex];
+        drawPacket.renderState = renderableData.renderState;
+        drawPacket.startIndex = renderableData.startIndex;
+        drawPacket.indexCount = renderableData.indexCount;
+        drawPacket.instanceCount = renderableData.instanceCount;
+
+        const DataInstanceHandle uniformInstance = renderableData.dataInstances[ERenderableDataSlotType_Uniforms];
+        assert(uniformInstance.isValid());
+        const DataLayout& layout = getDataLayout(getLayoutOfDataInstance(uniformInstance));
+        const uint32_t fieldCount = layout.getFieldCount();
+
+        // reuse previous range if it fits, otherwise append new range
+        const uint32_t previousUniformsCount = drawPacket.uniformsCount;
+        releaseDrawPacketUniforms(drawPacket);
+        if (fieldCount > previousUniformsCount)
+        {
+            drawPacket.uniformsOffset = static_cast<uint32_t>(m_drawPacketUniforms.size());
+            m_drawPacketUniforms.resize(m_drawPacketUniforms.size() + fieldCount);
+        }
+        drawPacket.uniformsCount = fieldCount;
+        m_drawPacketUniformsInUse += fieldCount;
+
+        for (DataFieldHandle field(0u); field < fieldCount; ++field)
+        {
+            const DataFieldInfo& fieldInfo = layout.getField(field);
+            DrawPacketUniform& uniform = m_drawPacketUniforms[drawPacket.uniformsOffset + field.asMemoryHandle()];
+            uniform = {};
+            uniform.uniformInputField = field;
+            uniform.semantics = fieldInfo.semantics;
+
+            if (fieldInfo.dataType == EDataType::DataReference)
+            {
+                uniform.dataInstance = getDataReference(uniformInstance, field);
+                uniform.dataInstanceField = DataFieldHandle(0u);
+                uniform.dataType = getDataLayout(getLayoutOfDataInstance(uniform.dataInstance)).getField(DataFieldHandle(0u)).dataType;
+                uniform.elementCount = 1u;
+                assert(uniform.dataType != EDataType::DataReference && "Multiple level data referencing not supported");
+            }
+            else
+            {
+                uniform.dataInstance = uniformInstance;
+                uniform.dataInstanceField = field;
+                uniform.dataType = fieldInfo.dataType;
+                uniform.elementCount = fieldInfo.elementCount;
+            }
+
+            if (IsTextureSamplerType(uniform.dataType))
+            {
+                const TextureSamplerHandle sampler = getDataTextureSamplerHandle(uniform.dataInstance, uniform.dataInstanceField);
+                assert(sampler.isValid());
+                uniform.textureDeviceHandle = m_deviceHandleCacheForTextures[sampler.asMemoryHandle()];
+                uniform.textureSamplerStates = getTextureSampler(sampler).states;
+                assert(uniform.textureDeviceHandle.isValid());
+            }
+        }
+    }
+
+    void ResourceCachedScene::releaseDrawPacketUniforms(DrawPacket& drawPacket)
+    {
+        // keeps range so that it can be reused when packet is compiled again
+        assert(m_drawPacketUniformsInUse >= drawPacket.uniformsCount);
+        m_drawPacketUniformsInUse -= drawPacket.uniformsCount;
+        drawPacket.uniformsCount = 0u;
+    }
+
+    void ResourceCachedScene::compactDrawPacketUniforms()
+    {
+        DrawPacketUniforms compactedUniforms;
+        compactedUniforms.reserve(m_drawPacketUniformsInUse);
+        for (auto& drawPacket : m_drawPackets)
+        {
+            const auto rangeBegin = m_drawPacketUniforms.cbegin() + drawPacket.uniformsOffset;
+            drawPacket.uniformsOffset = static_cast<uint32_t>(compactedUniforms.size());
+            compactedUniforms.insert(compactedUniforms.end(), rangeBegin, rangeBegin + drawPacket.uniformsCount);
+        }
+        assert(compactedUniforms.size() == m_drawPacketUniformsInUse);
+        m_drawPacketUniforms.swap(compactedUniforms);
+    }
+
     void ResourceCachedScene::markVertexArraysClean()
     {
         m_renderableVertexArraysDirty = false;
@@ -9,6 +9,9 @@
 #pragma once
 
 #include "internal/RendererLib/TextureLinkCachedScene.h"
+#include "internal/SceneGraph/SceneAPI/EDataType.h"
+#include "internal/SceneGraph/SceneAPI/EFixedSemantics.h"
+#include "internal/SceneGraph/SceneAPI/TextureSamplerStates.h"
 
 namespace ramses::internal
 {
@@ -21,6 +24,36 @@ namespace ramses::internal
     };
     using VertexArrayCache = std::vector<VertexArrayCacheEntry>;
 
+    // uniform input of a renderable resolved for rendering, data references point directly to the referenced instance
+    struct DrawPacketUniform
+    {
+        EDataType dataType = EDataType::Invalid;
+        uint32_t elementCount = 0u;
+        DataInstanceHandle dataInstance;
+        DataFieldHandle dataInstanceField;
+        DataFieldHandle uniformInputField;
+        EFixedSemantics semantics = EFixedSemantics::Invalid;
+        DeviceResourceHandle textureDeviceHandle;
+        TextureSamplerStates textureSamplerStates;
+    };
+    using DrawPacketUniforms = std::vector<DrawPacketUniform>;
+
+    // everything needed to execute a renderable, compiled once its resources are resolved so that rendering
+    // does not have to look up renderable, data layouts and caches for every draw
+    struct DrawPacket
+    {
+        DeviceResourceHandle effectDeviceHandle;
+        VertexArrayCacheEntry vertexArray;
+        RenderStateHandle renderState;
+        uint32_t startIndex = 0u;
+        uint32_t indexCount = 0u;
+        uint32_t instanceCount = 1u;
+        // range of uniforms in contiguous uniforms storage shared by all draw packets
+        uint32_t uniformsOffset = 0u;
+        uint32_t uniformsCount = 0u;
+    };
+    using DrawPackets = std::vector<DrawPacket>;
+
     class ResourceCachedScene : public TextureLinkCachedScene
     {
     public:
@@ -32,6 +65,10 @@ namespace ramses::internal
         void                        releaseRenderable           (RenderableHandle renderableHandle) override;
         void                        setRenderableVisibility     (RenderableHandle renderableHandle, EVisibilityMode visibility) override;
         void                        setRenderableStartVertex    (RenderableHandle renderableHandle, uint32_t startVertex) override;
+        void                        setRenderableStartIndex     (RenderableHandle renderableHandle, uint32_t startIndex) override;
+        void                        setRenderableIndexCount     (RenderableHandle renderableHandle, uint32_t indexCount) override;
+        void                        setRenderableInstanceCount  (RenderableHandle renderableHandle, uint32_t instanceCount) override;
+        void                        setRenderableRenderState    (RenderableHandle renderableHandle, RenderStateHandle stateHandle) override;
         DataInstanceHandle          allocateDataInstance        (DataLayoutHandle handle, DataInstanceHandle instanceHandle) override;
         void                        releaseDataInstance         (DataInstanceHandle dataInstanceHandle) override;
         TextureSamplerHandle        allocateTextureSampler      (const TextureSampler& sampler, TextureSamplerHandle handle) override;
@@ -41,6 +78,7 @@ namespace ramses::internal
         void                        setRenderableDataInstance   (RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance) override;
         void                        setDataResource             (DataInstanceHandle dataInstanceHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, uint32_t instancingDivisor, uint16_t offsetWithinElementInBytes, uint16_t stride) override;
         void                        setDataTextureSamplerHandle (DataInstanceHandle dataInstanceHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle) override;
+        void                        setDataReference            (DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef) override;
 
         RenderTargetHandle          allocateRenderTarget        (RenderTargetHandle targetHandle) override;
         BlitPassHandle              allocateBlitPass            (RenderBufferHandle sourceRenderBufferHandle, RenderBufferHandle destinationRenderBufferHandle, BlitPassHandle passHandle) override;
@@ -57,6 +95,10 @@ namespace ramses::internal
         const DeviceHandleVector&           getCachedHandlesForBlitPassRenderTargets() const;
         const BoolVector&                   getVertexArraysDirtinessFlags() const;
 
+        // valid only for renderables with resources not dirty
+        const DrawPacket&                   getDrawPacket(RenderableHandle renderable) const;
+        const DrawPacketUniform*            getDrawPacketUniforms(const DrawPacket& drawPacket) const;
+
         void updateRenderableResources(const IResourceDeviceHandleAccessor& resourceAccessor);
         void updateRenderablesResourcesDirtiness();
         void setRenderableResourcesDirtyByTextureSampler(TextureSamplerHandle textureSamplerHandle) const;
@@ -88,6 +130,10 @@ namespace ramses::internal
         void checkAndUpdateRenderTargetResources(const IResourceDeviceHandleAccessor& resourceAccessor);
         void checkAndUpdateBlitPassResources(const IResourceDeviceHandleAccessor& resourceAccessor);
 
+        void compileDrawPacket(RenderableHandle renderable);
+        void releaseDrawPacketUniforms(DrawPacket& drawPacket);
+        void compactDrawPacketUniforms();
+
         bool updateTextureSamplerResource(const IResourceDeviceHandleAccessor& resourceAccessor, TextureSamplerHandle sampler);
         bool updateTextureSamplerResourceAsRenderBuffer(const IResourceDeviceHandleAccessor& resourceAccessor, const RenderBufferHandle bufferHandle, DeviceResourceHandle& deviceHandleOut);
         bool updateTextureSamplerResourceAsTextureBuffer(const IResourceDeviceHandleAccessor& resourceAccessor, const TextureBufferHandle bufferHandle, DeviceResourceHandle& deviceHandleOut);
@@ -98,6 +144,9 @@ namespace ramses::internal
         mutable DeviceHandleVector m_deviceHandleCacheForTextures;
         DeviceHandleVector         m_renderTargetCache;
         DeviceHandleVector         m_blitPassCache;
+        DrawPackets                m_drawPackets;
+        DrawPacketUniforms         m_drawPacketUniforms;
+        uint32_t                   m_drawPacketUniformsInUse = 0u;
 
         mutable bool       m_renderableResourcesDirtinessNeedsUpdate = false;
         mutable bool       m_renderableVertexArraysDirty = false;
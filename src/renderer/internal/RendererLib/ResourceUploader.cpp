@@ -173,11 +173,7 @@ namespace ramses::internal
         if (!m_binaryShaderCache)
             return {};
 
-        std::call_once(m_binaryShaderCache->binaryShaderFormatsReported(), [this, &device]() {
-                std::vector<BinaryShaderFormatID> supportedFormats;
-                device.getSupportedBinaryProgramFormats(supportedFormats);
-                m_binaryShaderCache->deviceSupportsBinaryShaderFormats(supportedFormats);
-            });
+        reportSupportedBinaryShaderFormats(device);
 
         if (m_binaryShaderCache->hasBinaryShader(hash))
         {
@@ -223,6 +219,24 @@ namespace ramses::internal
         }
     }
 
+    bool ResourceUploader::hasShaderInBinaryShaderCache(IRenderBackend& renderBackend, const ResourceContentHash& hash)
+    {
+        if (!m_binaryShaderCache)
+            return false;
+
+        reportSupportedBinaryShaderFormats(renderBackend.getDevice());
+        return m_binaryShaderCache->hasBinaryShader(hash);
+    }
+
+    void ResourceUploader::reportSupportedBinaryShaderFormats(IDevice& device)
+    {
+        std::call_once(m_binaryShaderCache->binaryShaderFormatsReported(), [this, &device]() {
+                std::vector<BinaryShaderFormatID> supportedFormats;
+                device.getSupportedBinaryProgramFormats(supportedFormats);
+                m_binaryShaderCache->deviceSupportsBinaryShaderFormats(supportedFormats);
+            });
+    }
+
     uint32_t ResourceUploader::EstimateGPUAllocatedSizeOfTexture(const TextureResource& texture, uint32_t numMipLevelsToAllocate)
     {
         if (IsFormatCompressed(texture.getTextureFormat()))
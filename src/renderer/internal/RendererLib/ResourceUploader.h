@@ -27,10 +27,12 @@ namespace ramses::internal
         std::optional<DeviceResourceHandle> uploadResource(IRenderBackend& renderBackend, const ResourceDescriptor& rd, uint32_t& outVRAMSize) override;
         void                 unloadResource(IRenderBackend& renderBackend, EResourceType type, ResourceContentHash hash, DeviceResourceHandle handle) override;
         void                         storeShaderInBinaryShaderCache(IRenderBackend& renderBackend, DeviceResourceHandle deviceHandle, const ResourceContentHash& hash, SceneId sceneid) override;
+        bool                         hasShaderInBinaryShaderCache(IRenderBackend& renderBackend, const ResourceContentHash& hash) override;
 
     private:
         static DeviceResourceHandle UploadTexture(IDevice& device, const TextureResource& texture, uint32_t& vramSize);
         DeviceResourceHandle queryBinaryShaderCache(IRenderBackend& renderBackend, const EffectResource& effect, ResourceContentHash hash);
+        void reportSupportedBinaryShaderFormats(IDevice& device);
 
         static uint32_t EstimateGPUAllocatedSizeOfTexture(const TextureResource& texture, uint32_t numMipLevelsToAllocate);
 
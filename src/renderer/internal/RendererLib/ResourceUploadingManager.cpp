@@ -82,6 +82,32 @@ namespace ramses::internal
         m_stats.setVRAMUsage(m_resourceTotalUploadedSize, m_resourceCacheSize);
     }
 
+    void ResourceUploadingManager::prewarmEffects(const ManagedResourceVector& resources)
+    {
+        ManagedResourceVector effectsToPrewarm;
+        for (const auto& mr : resources)
+        {
+            if (mr->getTypeID() != EResourceType::Effect)
+                continue;
+
+            // effect is already used by another scene
+            const auto& hash = mr->getHash();
+            if (m_resources.containsResource(hash) && m_resources.getResourceStatus(hash) > EResourceStatus::Provided)
+                continue;
+
+            // effect will be uploaded from binary shader cache without compiling
+            if (m_uploader->hasShaderInBinaryShaderCache(m_renderBackend, hash))
+                continue;
+
+            // decompress here so that upload threads only read the resource
+            mr->decompress();
+            effectsToPrewarm.push_back(mr);
+        }
+
+        if (!effectsToPrewarm.empty())
+            m_asyncEffectUploader.prewarm(effectsToPrewarm);
+    }
+
     void ResourceUploadingManager::unloadResources(const ResourceContentHashVector& resourcesToUnload)
     {
         for(const auto& resource : resourcesToUnload)
@@ -38,6 +38,7 @@ namespace ramses::internal
 
         [[nodiscard]] bool hasAnythingToUpload() const;
         void uploadAndUnloadPendingResources();
+        void prewarmEffects(const ManagedResourceVector& resources);
 
         [[nodiscard]] uint32_t getResourceUploadBatchSize() const
         {
@@ -0,0 +1,66 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/SharedResourcePool.h"
+#include "internal/SceneGraph/Resource/IResource.h"
+#include <algorithm>
+
+namespace ramses::internal
+{
+    ManagedResource SharedResourcePool::share(const ManagedResource& resource)
+    {
+        if (!resource)
+            return resource;
+
+        std::lock_guard<std::mutex> guard{ m_lock };
+        auto& entry = m_resources[resource->getHash()];
+        if (auto pooledResource = entry.lock())
+        {
+            if (pooledResource != resource)
+                ++m_deduplicatedResources;
+            return pooledResource;
+        }
+
+        entry = resource;
+        // expired entries are removed lazily, amortized over insertions to keep the map bounded by live resources
+        if (++m_insertionsSinceLastCleanup > m_resources.size() / 2u)
+            removeExpiredEntries();
+
+        return resource;
+    }
+
+    void SharedResourcePool::share(ManagedResourceVector& resources)
+    {
+        for (auto& resource : resources)
+            resource = share(resource);
+    }
+
+    size_t SharedResourcePool::getNumberOfSharedResources() const
+    {
+        std::lock_guard<std::mutex> guard{ m_lock };
+        return static_cast<size_t>(std::count_if(m_resources.cbegin(), m_resources.cend(), [](const auto& entry) { return !entry.second.expired(); }));
+    }
+
+    uint64_t SharedResourcePool::getNumberOfDeduplicatedResources() const
+    {
+        std::lock_guard<std::mutex> guard{ m_lock };
+        return m_deduplicatedResources;
+    }
+
+    void SharedResourcePool::removeExpiredEntries()
+    {
+        for (auto it = m_resources.begin(); it != m_resources.end();)
+        {
+            if (it->second.expired())
+                it = m_resources.erase(it);
+            else
+                ++it;
+        }
+        m_insertionsSinceLastCleanup = 0u;
+    }
+}
@@ -0,0 +1,40 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Components/ManagedResource.h"
+#include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+
+namespace ramses::internal
+{
+    // Store of resource data provided to displays, shared between display threads.
+    // Resources with same content hash received for scenes on different displays are replaced by a single instance,
+    // so that resource data is decompressed only once and all displays upload from the same CPU copy.
+    // The pool does not own the resources, data is released as soon as the last display uploaded or dropped it.
+    class SharedResourcePool
+    {
+    public:
+        ManagedResource share(const ManagedResource& resource);
+        void share(ManagedResourceVector& resources);
+
+        [[nodiscard]] size_t getNumberOfSharedResources() const;
+        [[nodiscard]] uint64_t getNumberOfDeduplicatedResources() const;
+
+    private:
+        void removeExpiredEntries();
+
+        mutable std::mutex m_lock;
+        std::unordered_map<ResourceContentHash, std::weak_ptr<const IResource>> m_resources;
+        size_t m_insertionsSinceLastCleanup = 0u;
+        uint64_t m_deduplicatedResources = 0u;
+    };
+}
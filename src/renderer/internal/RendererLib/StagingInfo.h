@@ -30,6 +30,9 @@ namespace ramses::internal
         ManagedResourceVector     resourceDataToProvide;
         ResourceContentHashVector resourcesAdded;
         ResourceContentHashVector resourcesRemoved;
+
+        // number of scene actions already applied if flush application was interrupted due to time budget
+        uint32_t                  numAppliedSceneActions = 0u;
     };
     using PendingFlushes = std::vector<PendingFlush>;
 
@@ -37,16 +40,25 @@ namespace ramses::internal
     {
         bool                      allPendingFlushesApplied = false;
         PendingFlushes            pendingFlushes;
+        // number of pending flushes fully applied to scene, can be less than pendingFlushes if flush application was interrupted
+        size_t                    numAppliedFlushes = 0u;
 
         // scene resource actions to execute after pending flushes are applied
         SceneResourceActionVector sceneResourceActions;
         // scene reference actions to execute after pending flushes are applied
         SceneReferenceActionVector sceneReferenceActions;
 
+        // scene is in a state which is not a result of a flush and must not be shown
+        [[nodiscard]] bool hasPartiallyAppliedFlushes() const
+        {
+            return !allPendingFlushesApplied && (numAppliedFlushes > 0u || (!pendingFlushes.empty() && pendingFlushes.front().numAppliedSceneActions > 0u));
+        }
+
         static void Clear(PendingData& pendingData)
         {
             pendingData.allPendingFlushesApplied = false;
             pendingData.pendingFlushes.clear();
+            pendingData.numAppliedFlushes = 0u;
             pendingData.sceneResourceActions.clear();
             pendingData.sceneReferenceActions.clear();
         }
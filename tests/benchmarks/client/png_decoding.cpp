@@ -0,0 +1,96 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "ramses/client/ramses-client.h"
+#include "ramses/client/ramses-utils.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+namespace ramses
+{
+    class PngDecodingSetUp
+    {
+    public:
+        explicit PngDecodingSetUp(uint32_t imageSize)
+        {
+            // gradient with noise so that compression (and therefore decoding) is not trivial
+            std::vector<uint8_t> rgba(size_t(imageSize) * imageSize * 4u);
+            uint32_t seed = 1u;
+            for (size_t i = 0u; i < rgba.size(); ++i)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                rgba[i] = static_cast<uint8_t>((i / 4u) % imageSize + (seed >> 28u));
+            }
+
+            const std::string fileName = "ramses-benchmark-png-decoding.png";
+            RamsesUtils::SaveImageBufferToPng(fileName, rgba, imageSize, imageSize);
+            std::ifstream file(fileName, std::ios::binary);
+            m_pngData.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            std::remove(fileName.c_str());
+        }
+
+        void destroyTextures(const std::vector<Texture2D*>& textures)
+        {
+            for (auto* texture : textures)
+                m_scene.destroy(*texture);
+        }
+
+        RamsesFramework m_framework{ RamsesFrameworkConfig{EFeatureLevel_Latest} };
+        RamsesClient& m_client{ *m_framework.createClient("benchmarkClient") };
+        Scene& m_scene{ *m_client.createScene(SceneConfig(sceneId_t{ 123u })) };
+        std::vector<uint8_t> m_pngData;
+    };
+
+    static void BM_PngDecoding_Sequential(benchmark::State& state)
+    {
+        PngDecodingSetUp setup(static_cast<uint32_t>(state.range(1)));
+        const auto imageCount = static_cast<size_t>(state.range(0));
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            std::vector<Texture2D*> textures;
+            for (size_t i = 0u; i < imageCount; ++i)
+                textures.push_back(RamsesUtils::CreateTextureResourceFromPngBuffer(setup.m_pngData, setup.m_scene));
+            setup.destroyTextures(textures);
+        }
+    }
+
+    static void BM_PngDecoding_Batch(benchmark::State& state)
+    {
+        PngDecodingSetUp setup(static_cast<uint32_t>(state.range(1)));
+        const std::vector<std::vector<uint8_t>> pngBuffers(static_cast<size_t>(state.range(0)), setup.m_pngData);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            const auto textures = RamsesUtils::CreateTextureResourcesFromPngBuffers(pngBuffers, setup.m_scene);
+            setup.destroyTextures(textures);
+        }
+    }
+
+    static void BM_PngDecoding_BatchWithMipMaps(benchmark::State& state)
+    {
+        PngDecodingSetUp setup(static_cast<uint32_t>(state.range(1)));
+        const std::vector<std::vector<uint8_t>> pngBuffers(static_cast<size_t>(state.range(0)), setup.m_pngData);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            const auto textures = RamsesUtils::CreateTextureResourcesFromPngBuffers(pngBuffers, setup.m_scene, true);
+            setup.destroyTextures(textures);
+        }
+    }
+
+    // Compares decoding png images one by one on the calling thread with decoding a batch on the framework worker threads
+    // ARG 1: number of images
+    // ARG 2: width and height of images
+    BENCHMARK(BM_PngDecoding_Sequential)->Args({ 10, 64 })->Args({ 100, 64 })->Args({ 10, 512 })->Unit(benchmark::kMillisecond);
+    BENCHMARK(BM_PngDecoding_Batch)->Args({ 10, 64 })->Args({ 100, 64 })->Args({ 10, 512 })->Unit(benchmark::kMillisecond);
+    BENCHMARK(BM_PngDecoding_BatchWithMipMaps)->Args({ 10, 64 })->Args({ 100, 64 })->Args({ 10, 512 })->Unit(benchmark::kMillisecond);
+}
@@ -0,0 +1,83 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "ramses/client/ramses-client.h"
+
+#include <array>
+
+namespace ramses
+{
+    class SceneValidationSetUp
+    {
+    public:
+        SceneValidationSetUp(size_t meshCount, bool incrementalValidation)
+            : m_scene(*m_client.createScene(CreateSceneConfig(incrementalValidation)))
+        {
+            EffectDescription effectDesc;
+            effectDesc.setVertexShader("#version 100\nvoid main(void) { gl_Position = vec4(0.0); }");
+            effectDesc.setFragmentShader("#version 100\nvoid main(void) { gl_FragColor = vec4(1.0); }");
+            const Effect* effect = m_scene.createEffect(effectDesc);
+
+            PerspectiveCamera* camera = m_scene.createPerspectiveCamera();
+            camera->setFrustum(45.f, 1.f, 0.1f, 100.f);
+            camera->setViewport(0, 0, 100u, 100u);
+            RenderPass* renderPass = m_scene.createRenderPass();
+            renderPass->setCamera(*camera);
+            RenderGroup* renderGroup = m_scene.createRenderGroup();
+            renderPass->addRenderGroup(*renderGroup);
+
+            const std::array<uint16_t, 3u> indices{ 0u, 1u, 2u };
+            for (size_t i = 0u; i < meshCount; ++i)
+            {
+                ArrayBuffer* indexBuffer = m_scene.createArrayBuffer(EDataType::UInt16, 3u);
+                indexBuffer->updateData(0u, 3u, indices.data());
+                Geometry* geometry = m_scene.createGeometry(*effect);
+                geometry->setIndices(*indexBuffer);
+                MeshNode* mesh = m_scene.createMeshNode();
+                mesh->setAppearance(*m_scene.createAppearance(*effect));
+                mesh->setGeometry(*geometry);
+                renderGroup->addMeshNode(*mesh);
+                m_meshes.push_back(mesh);
+            }
+        }
+
+        static SceneConfig CreateSceneConfig(bool incrementalValidation)
+        {
+            SceneConfig config(sceneId_t{ 123u });
+            config.setIncrementalValidationEnabled(incrementalValidation);
+            return config;
+        }
+
+        RamsesFramework m_framework{ RamsesFrameworkConfig{EFeatureLevel_Latest} };
+        RamsesClient& m_client{ *m_framework.createClient("benchmarkClient") };
+        Scene& m_scene;
+        std::vector<MeshNode*> m_meshes;
+    };
+
+    static void BM_SceneValidation(benchmark::State& state)
+    {
+        SceneValidationSetUp setup(static_cast<size_t>(state.range(0)), state.range(1) != 0);
+
+        size_t meshToModify = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            // modify one mesh in between validations, like an application validating repeatedly while editing the scene
+            setup.m_meshes[meshToModify]->setTranslation({ 1.f, 0.f, 0.f });
+            meshToModify = (meshToModify + 1u) % setup.m_meshes.size();
+
+            ValidationReport report;
+            setup.m_scene.validate(report);
+            benchmark::DoNotOptimize(report.hasError());
+        }
+    }
+
+    // ARG 1: number of meshes, each with own geometry, index buffer and appearance
+    // ARG 2: incremental validation disabled (0) or enabled (1)
+    BENCHMARK(BM_SceneValidation)->Args({ 100, 0 })->Args({ 100, 1 })->Args({ 2000, 0 })->Args({ 2000, 1 })->Unit(benchmark::kMillisecond);
+}
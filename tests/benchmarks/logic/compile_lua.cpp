@@ -47,6 +47,45 @@ namespace ramses
     // Measures compilation times depending on the number of inputs in the interface
     // ARG: number of inputs in script's interface()
     BENCHMARK(BM_CompileLua_Interface)->Arg(1)->Arg(10)->Arg(100);
+
+    static void BM_CompileLua_IdenticalSource(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        auto& logicEngine = setup.m_logicEngine;
+
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Base);
+
+        const bool identicalSource = (state.range(0) != 0);
+
+        const std::string scriptSrc = R"(
+            function init()
+                GLOBAL.count = 0
+            end
+            function interface(IN,OUT)
+                for i = 0,100,1 do
+                    IN["param"..tostring(i)] = Type:Int32()
+                end
+                OUT.count = Type:Int32()
+            end
+            function run(IN,OUT)
+                GLOBAL.count = GLOBAL.count + 1
+                OUT.count = GLOBAL.count
+            end
+        )";
+
+        size_t uniqueCounter = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            // unique source is produced by appending a comment, so that the scripts can not share compilation results
+            const std::string src = (identicalSource ? scriptSrc : fmt::format("{}-- {}", scriptSrc, uniqueCounter++));
+            CompileLua(logicEngine, src, config);
+        }
+    }
+
+    // Measures compilation times of scripts with source identical to a previously created script
+    // ARG: 0 - each script has unique source, 1 - all scripts have identical source
+    BENCHMARK(BM_CompileLua_IdenticalSource)->Arg(0)->Arg(1);
 }
 
 
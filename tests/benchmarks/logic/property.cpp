@@ -48,6 +48,46 @@ namespace ramses
     // Measures time to set the value of a property to script based on how many properties are there in the script's interface()
     // ARG: how many properties are in the script's interface
     BENCHMARK(BM_Property_SetIntValue)->Arg(10)->Arg(100)->Arg(1000);
+
+    static void BM_Property_AccessWideStructFromLua(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        auto& logicEngine = setup.m_logicEngine;
+
+        const int64_t fieldCount = state.range(0);
+
+        // read the last field of the struct, the one which is found last with linear search
+        const std::string scriptSrc = fmt::format(R"(
+            function interface(IN,OUT)
+                for i = 0,{0},1 do
+                    IN["param"..tostring(i)] = Type:Int32()
+                end
+                OUT.result = Type:Int32()
+            end
+            function run(IN,OUT)
+                local sum = 0
+                for i = 1,100,1 do
+                    sum = sum + IN.param{0}
+                end
+                OUT.result = sum
+            end
+        )", fieldCount - 1);
+
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Base);
+        logicEngine.createLuaScript(scriptSrc, config);
+
+        logicEngine.impl().disableTrackingDirtyNodes();
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.update();
+        }
+    }
+
+    // Measures time to access a field of a struct from Lua based on how many fields the struct has
+    // Dirty handling: off
+    // ARG: how many fields are in the struct (script's IN)
+    BENCHMARK(BM_Property_AccessWideStructFromLua)->Arg(5)->Arg(50)->Arg(200);
 }
 
 
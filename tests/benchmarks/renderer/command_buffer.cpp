@@ -0,0 +1,88 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/RendererLib/RendererCommandBuffer.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace ramses::internal
+{
+    // commands are consumed by a separate thread like the dispatcher thread does, so that producers measure
+    // enqueue throughput with concurrent consumption and wake-ups
+    class CommandBufferConsumer
+    {
+    public:
+        CommandBufferConsumer()
+            : m_thread([this]() {
+                RendererCommands cmds;
+                while (!m_stop)
+                {
+                    cmds.clear();
+                    m_buffer.blockingSwapCommands(cmds, std::chrono::milliseconds{ 100 });
+                    m_consumed += cmds.size();
+                }
+            })
+        {
+        }
+
+        ~CommandBufferConsumer()
+        {
+            m_stop = true;
+            m_buffer.interruptBlockingSwapCommands();
+            m_thread.join();
+        }
+
+        RendererCommandBuffer m_buffer;
+        std::atomic<bool> m_stop{ false };
+        std::atomic<size_t> m_consumed{ 0u };
+        std::thread m_thread;
+    };
+
+    // shared by all benchmark threads, created and destroyed by first thread outside of measured loop,
+    // benchmark synchronizes all threads before first and after last iteration
+    static std::unique_ptr<CommandBufferConsumer> gConsumer;
+
+    static void BM_RendererCommandBuffer_EnqueueCommand(benchmark::State& state)
+    {
+        if (state.thread_index() == 0)
+            gConsumer = std::make_unique<CommandBufferConsumer>();
+
+        const SceneId sceneId{ static_cast<uint64_t>(state.thread_index()) };
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+            gConsumer->m_buffer.enqueueCommand(RendererCommand::SetSceneState{ sceneId, RendererSceneState::Rendered });
+        state.SetItemsProcessed(state.iterations());
+
+        if (state.thread_index() == 0)
+            gConsumer.reset();
+    }
+    BENCHMARK(BM_RendererCommandBuffer_EnqueueCommand)->ThreadRange(1, 8)->UseRealTime();
+
+    static void BM_RendererCommandBuffer_AddBatch(benchmark::State& state)
+    {
+        if (state.thread_index() == 0)
+            gConsumer = std::make_unique<CommandBufferConsumer>();
+
+        const SceneId sceneId{ static_cast<uint64_t>(state.thread_index()) };
+        const auto batchSize = static_cast<size_t>(state.range(0));
+        RendererCommands cmds;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (size_t i = 0u; i < batchSize; ++i)
+                cmds.emplace_back(RendererCommand::SetSceneState{ sceneId, RendererSceneState::Rendered });
+            gConsumer->m_buffer.addAndConsumeCommandsFrom(cmds);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+
+        if (state.thread_index() == 0)
+            gConsumer.reset();
+    }
+    BENCHMARK(BM_RendererCommandBuffer_AddBatch)->Arg(16)->Arg(64)->ThreadRange(1, 8)->UseRealTime();
+}
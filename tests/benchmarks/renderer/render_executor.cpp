@@ -0,0 +1,284 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/RendererLib/RenderExecutor.h"
+#include "internal/RendererLib/RendererScenes.h"
+#include "internal/RendererLib/RendererEventCollector.h"
+#include "internal/RendererLib/IResourceDeviceHandleAccessor.h"
+#include "internal/RendererLib/PlatformInterface/IDevice.h"
+#include "internal/SceneGraph/SceneAPI/Camera.h"
+#include "internal/SceneGraph/SceneAPI/TextureSampler.h"
+
+namespace ramses::internal
+{
+    // device which does not talk to any driver, so that only CPU cost of render executor is measured
+    class NullDevice : public IDevice
+    {
+    public:
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const float* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::vec2* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::vec3* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::vec4* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const bool* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const int32_t* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::ivec2* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::ivec3* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::ivec4* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::mat2* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::mat3* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::mat4* /*value*/) override { return true; }
+
+        void clear(ClearFlags /*clearFlags*/) override {}
+        void drawIndexedTriangles(int32_t /*startOffset*/, int32_t /*elementCount*/, uint32_t /*instanceCount*/) override { ++m_drawCalls; }
+        void drawTriangles(int32_t /*startOffset*/, int32_t /*elementCount*/, uint32_t /*instanceCount*/) override { ++m_drawCalls; }
+        void flush() override {}
+
+        void colorMask(bool /*r*/, bool /*g*/, bool /*b*/, bool /*a*/) override {}
+        void clearColor(const glm::vec4& /*clearColor*/) override {}
+        void clearDepth(float /*d*/) override {}
+        void clearStencil(int32_t /*s*/) override {}
+        void blendFactors(EBlendFactor /*sourceColor*/, EBlendFactor /*destinationColor*/, EBlendFactor /*sourceAlpha*/, EBlendFactor /*destinationAlpha*/) override {}
+        void blendOperations(EBlendOperation /*operationColor*/, EBlendOperation /*operationAlpha*/) override {}
+        void blendColor(const glm::vec4& /*color*/) override {}
+        void cullMode(ECullMode /*mode*/) override {}
+        void depthFunc(EDepthFunc /*func*/) override {}
+        void depthWrite(EDepthWrite /*flag*/) override {}
+        void scissorTest(EScissorTest /*flag*/, const RenderState::ScissorRegion& /*region*/) override {}
+        void stencilFunc(EStencilFunc /*func*/, uint8_t /*ref*/, uint8_t /*mask*/) override {}
+        void stencilOp(EStencilOp /*sfail*/, EStencilOp /*dpfail*/, EStencilOp /*dppass*/) override {}
+        void drawMode(EDrawMode /*mode*/) override {}
+        void setViewport(int32_t /*x*/, int32_t /*y*/, uint32_t /*width*/, uint32_t /*height*/) override {}
+
+        DeviceResourceHandle allocateVertexBuffer(uint32_t /*totalSizeInBytes*/) override { return {}; }
+        void uploadVertexBufferData(DeviceResourceHandle /*handle*/, const std::byte* /*data*/, uint32_t /*dataSize*/) override {}
+        void updateVertexBufferData(DeviceResourceHandle /*handle*/, uint32_t /*offset*/, const std::byte* /*data*/, uint32_t /*dataSize*/) override {}
+        void deleteVertexBuffer(DeviceResourceHandle /*handle*/) override {}
+
+        DeviceResourceHandle allocateIndexBuffer(EDataType /*dataType*/, uint32_t /*sizeInBytes*/) override { return {}; }
+        void uploadIndexBufferData(DeviceResourceHandle /*handle*/, const std::byte* /*data*/, uint32_t /*dataSize*/) override {}
+        void updateIndexBufferData(DeviceResourceHandle /*handle*/, uint32_t /*offset*/, const std::byte* /*data*/, uint32_t /*dataSize*/) override {}
+        void deleteIndexBuffer(DeviceResourceHandle /*handle*/) override {}
+
+        DeviceResourceHandle allocateVertexArray(const VertexArrayInfo& /*vertexArrayInfo*/) override { return {}; }
+        void activateVertexArray(DeviceResourceHandle /*handle*/) override {}
+        void deleteVertexArray(DeviceResourceHandle /*handle*/) override {}
+
+        std::unique_ptr<const GPUResource> uploadShader(const EffectResource& /*effect*/) override { return {}; }
+        DeviceResourceHandle registerShader(std::unique_ptr<const GPUResource> /*shaderResource*/) override { return {}; }
+        DeviceResourceHandle uploadBinaryShader(const EffectResource& /*effect*/, const std::byte* /*binaryShaderData*/, uint32_t /*binaryShaderDataSize*/, BinaryShaderFormatID /*binaryShaderFormat*/) override { return {}; }
+        bool getBinaryShader(DeviceResourceHandle /*handle*/, std::vector<std::byte>& /*binaryShader*/, BinaryShaderFormatID& /*binaryShaderFormat*/) override { return false; }
+        void deleteShader(DeviceResourceHandle /*handle*/) override {}
+        void activateShader(DeviceResourceHandle /*handle*/) override {}
+
+        DeviceResourceHandle allocateTexture2D(uint32_t /*width*/, uint32_t /*height*/, EPixelStorageFormat /*textureFormat*/, const TextureSwizzleArray& /*swizzle*/, uint32_t /*mipLevelCount*/, uint32_t /*totalSizeInBytes*/) override { return {}; }
+        DeviceResourceHandle allocateTexture3D(uint32_t /*width*/, uint32_t /*height*/, uint32_t /*depth*/, EPixelStorageFormat /*textureFormat*/, uint32_t /*mipLevelCount*/, uint32_t /*totalSizeInBytes*/) override { return {}; }
+        DeviceResourceHandle allocateTextureCube(uint32_t /*faceSize*/, EPixelStorageFormat /*textureFormat*/, const TextureSwizzleArray& /*swizzle*/, uint32_t /*mipLevelCount*/, uint32_t /*totalSizeInBytes*/) override { return {}; }
+        DeviceResourceHandle allocateExternalTexture() override { return {}; }
+        [[nodiscard]] DeviceResourceHandle getEmptyExternalTexture() const override { return {}; }
+
+        void bindTexture(DeviceResourceHandle /*handle*/) override {}
+        void generateMipmaps(DeviceResourceHandle /*handle*/) override {}
+        void uploadTextureData(DeviceResourceHandle /*handle*/, uint32_t /*mipLevel*/, uint32_t /*x*/, uint32_t /*y*/, uint32_t /*z*/, uint32_t /*width*/, uint32_t /*height*/, uint32_t /*depth*/, const std::byte* /*data*/, uint32_t /*dataSize*/, uint32_t /*stride*/) override {}
+        DeviceResourceHandle uploadStreamTexture2D(DeviceResourceHandle /*handle*/, uint32_t /*width*/, uint32_t /*height*/, EPixelStorageFormat /*format*/, const std::byte* /*data*/, const TextureSwizzleArray& /*swizzle*/) override { return {}; }
+        void updateStreamTexture2D(DeviceResourceHandle /*handle*/, uint32_t /*x*/, uint32_t /*y*/, uint32_t /*width*/, uint32_t /*height*/, uint32_t /*stride*/, EPixelStorageFormat /*format*/, const std::byte* /*data*/) override {}
+        void deleteTexture(DeviceResourceHandle /*handle*/) override {}
+        void activateTexture(DeviceResourceHandle /*handle*/, DataFieldHandle /*field*/) override {}
+        [[nodiscard]] uint32_t getTextureAddress(DeviceResourceHandle /*handle*/) const override { return 0u; }
+
+        DeviceResourceHandle uploadRenderBuffer(uint32_t /*width*/, uint32_t /*height*/, EPixelStorageFormat /*format*/, ERenderBufferAccessMode /*accessMode*/, uint32_t /*sampleCount*/) override { return {}; }
+        void deleteRenderBuffer(DeviceResourceHandle /*handle*/) override {}
+
+        DeviceResourceHandle uploadDmaRenderBuffer(uint32_t /*width*/, uint32_t /*height*/, DmaBufferFourccFormat /*fourccFormat*/, DmaBufferUsageFlags /*usageFlags*/, DmaBufferModifiers /*modifiers*/) override { return {}; }
+        int getDmaRenderBufferFD(DeviceResourceHandle /*handle*/) override { return -1; }
+        uint32_t getDmaRenderBufferStride(DeviceResourceHandle /*handle*/) override { return 0u; }
+        void destroyDmaRenderBuffer(DeviceResourceHandle /*handle*/) override {}
+
+        void activateTextureSamplerObject(const TextureSamplerStates& /*samplerStates*/, DataFieldHandle /*field*/) override {}
+
+        [[nodiscard]] DeviceResourceHandle getFramebufferRenderTarget() const override { return {}; }
+        DeviceResourceHandle uploadRenderTarget(const DeviceHandleVector& /*renderBuffers*/) override { return {}; }
+        void activateRenderTarget(DeviceResourceHandle /*handle*/) override {}
+        void deleteRenderTarget(DeviceResourceHandle /*handle*/) override {}
+        void discardDepthStencil() override {}
+
+        void pairRenderTargetsForDoubleBuffering(const std::array<DeviceResourceHandle, 2>& /*renderTargets*/, const std::array<DeviceResourceHandle, 2>& /*colorBuffers*/) override {}
+        void unpairRenderTargets(DeviceResourceHandle /*renderTarget*/) override {}
+        void swapDoubleBufferedRenderTarget(DeviceResourceHandle /*renderTarget*/) override {}
+
+        void blitRenderTargets(DeviceResourceHandle /*rtSrc*/, DeviceResourceHandle /*rtDst*/, const PixelRectangle& /*srcRect*/, const PixelRectangle& /*dstRect*/, bool /*colorOnly*/) override {}
+
+        void readPixels(uint8_t* /*buffer*/, uint32_t /*x*/, uint32_t /*y*/, uint32_t /*width*/, uint32_t /*height*/) override {}
+
+        [[nodiscard]] uint32_t getTotalGpuMemoryUsageInKB() const override { return 0u; }
+        uint32_t getAndResetDrawCallCount() override { return 0u; }
+        DeviceStateChangeCounts getAndResetStateChangeCounts() override { return {}; }
+        void invalidateStateCache() override {}
+
+        void validateDeviceStatusHealthy() const override {}
+        [[nodiscard]] bool isDeviceStatusHealthy() const override { return true; }
+        void getSupportedBinaryProgramFormats(std::vector<BinaryShaderFormatID>& /*formats*/) const override {}
+        [[nodiscard]] bool isExternalTextureExtensionSupported() const override { return false; }
+
+        [[nodiscard]] uint32_t getGPUHandle(DeviceResourceHandle /*deviceHandle*/) const override { return 0u; }
+
+        [[nodiscard]] uint64_t getDrawCalls() const
+        {
+            return m_drawCalls;
+        }
+
+    private:
+        uint64_t m_drawCalls = 0u;
+    };
+
+    // every resource is uploaded and resolves to some valid device handle
+    class NullResourceAccessor : public IResourceDeviceHandleAccessor
+    {
+    public:
+        [[nodiscard]] DeviceResourceHandle getResourceDeviceHandle(const ResourceContentHash& /*resourceHash*/) const override { return DeviceResourceHandle{ 1u }; }
+        [[nodiscard]] DeviceResourceHandle getRenderTargetDeviceHandle(RenderTargetHandle /*targetHandle*/, SceneId /*sceneId*/) const override { return DeviceResourceHandle{ 2u }; }
+        [[nodiscard]] DeviceResourceHandle getRenderTargetBufferDeviceHandle(RenderBufferHandle /*bufferHandle*/, SceneId /*sceneId*/) const override { return DeviceResourceHandle{ 3u }; }
+        void getBlitPassRenderTargetsDeviceHandle(BlitPassHandle /*blitPassHandle*/, SceneId /*sceneId*/, DeviceResourceHandle& srcRT, DeviceResourceHandle& dstRT) const override
+        {
+            srcRT = DeviceResourceHandle{ 4u };
+            dstRT = DeviceResourceHandle{ 5u };
+        }
+        [[nodiscard]] DeviceResourceHandle getOffscreenBufferDeviceHandle(OffscreenBufferHandle /*bufferHandle*/) const override { return DeviceResourceHandle{ 6u }; }
+        [[nodiscard]] DeviceResourceHandle getOffscreenBufferColorBufferDeviceHandle(OffscreenBufferHandle /*bufferHandle*/) const override { return DeviceResourceHandle{ 7u }; }
+        [[nodiscard]] int getDmaOffscreenBufferFD(OffscreenBufferHandle /*bufferHandle*/) const override { return -1; }
+        [[nodiscard]] uint32_t getDmaOffscreenBufferStride(OffscreenBufferHandle /*bufferHandle*/) const override { return 0u; }
+        [[nodiscard]] OffscreenBufferHandle getOffscreenBufferHandle(DeviceResourceHandle /*bufferDeviceHandle*/) const override { return {}; }
+        [[nodiscard]] DeviceResourceHandle getStreamBufferDeviceHandle(StreamBufferHandle /*bufferHandle*/) const override { return DeviceResourceHandle{ 8u }; }
+        [[nodiscard]] DeviceResourceHandle getExternalBufferDeviceHandle(ExternalBufferHandle /*bufferHandle*/) const override { return DeviceResourceHandle{ 9u }; }
+        [[nodiscard]] DeviceResourceHandle getEmptyExternalBufferDeviceHandle() const override { return DeviceResourceHandle{ 10u }; }
+        [[nodiscard]] uint32_t getExternalBufferGlId(ExternalBufferHandle /*externalTexHandle*/) const override { return 0u; }
+        [[nodiscard]] DeviceResourceHandle getDataBufferDeviceHandle(DataBufferHandle /*dataBufferHandle*/, SceneId /*sceneId*/) const override { return DeviceResourceHandle{ 11u }; }
+        [[nodiscard]] DeviceResourceHandle getTextureBufferDeviceHandle(TextureBufferHandle /*textureBufferHandle*/, SceneId /*sceneId*/) const override { return DeviceResourceHandle{ 12u }; }
+        [[nodiscard]] DeviceResourceHandle getVertexArrayDeviceHandle(RenderableHandle renderableHandle, SceneId /*sceneId*/) const override { return DeviceResourceHandle{ 100u + renderableHandle.asMemoryHandle() }; }
+    };
+
+    // scene with single render pass of renderables with typical uniforms - semantic MVP matrix, color, float provided
+    // through data reference and a texture, alternating between two render states
+    class RenderExecutorScene
+    {
+    public:
+        explicit RenderExecutorScene(uint32_t renderableCount)
+            : m_scenes(m_eventCollector)
+            , m_scene(m_scenes.createScene(SceneInfo{ SceneId{ 1u } }))
+        {
+            const uint32_t dataInstanceCount = 2u * renderableCount + 5u;
+            m_scene.preallocateSceneSize(SceneSizeInformation(renderableCount + 1u, 1u, 1u, renderableCount, 2u, 7u, dataInstanceCount, 1u, 1u, 0u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u));
+
+            const RenderPassHandle pass = m_scene.allocateRenderPass(1u, {});
+            m_scene.setRenderPassCamera(pass, createCamera());
+            const RenderGroupHandle group = m_scene.allocateRenderGroup(renderableCount, 0u, {});
+            m_scene.addRenderGroupToRenderPass(pass, group, 0);
+
+            const RenderStateHandle states[] = { m_scene.allocateRenderState({}), m_scene.allocateRenderState({}) };
+            m_scene.setRenderStateBlendFactors(states[1], EBlendFactor::SrcAlpha, EBlendFactor::OneMinusSrcAlpha, EBlendFactor::One, EBlendFactor::One);
+            m_scene.setRenderStateDepthWrite(states[1], EDepthWrite::Disabled);
+
+            const ResourceContentHash effectHash{ 1u, 0u };
+            const DataLayoutHandle uniformLayout = m_scene.allocateDataLayout({
+                DataFieldInfo{ EDataType::Matrix44F, 1u, EFixedSemantics::ModelViewProjectionMatrix },
+                DataFieldInfo{ EDataType::Vector4F },
+                DataFieldInfo{ EDataType::DataReference },
+                DataFieldInfo{ EDataType::TextureSampler2D } }, effectHash, {});
+            const DataLayoutHandle geometryLayout = m_scene.allocateDataLayout({
+                DataFieldInfo{ EDataType::Indices, 1u, EFixedSemantics::Indices },
+                DataFieldInfo{ EDataType::Vector3Buffer } }, effectHash, {});
+            const DataLayoutHandle floatLayout = m_scene.allocateDataLayout({ DataFieldInfo{ EDataType::Float } }, {}, {});
+            const DataInstanceHandle sharedFloat = m_scene.allocateDataInstance(floatLayout, {});
+            const TextureSamplerHandle sampler = m_scene.allocateTextureSampler({ {}, ResourceContentHash{ 2u, 0u } }, {});
+
+            for (uint32_t i = 0u; i < renderableCount; ++i)
+            {
+                const RenderableHandle renderable = m_scene.allocateRenderable(m_scene.allocateNode(0u, {}), {});
+                const DataInstanceHandle uniforms = m_scene.allocateDataInstance(uniformLayout, {});
+                m_scene.setDataSingleVector4f(uniforms, DataFieldHandle{ 1u }, glm::vec4{ 1.f });
+                m_scene.setDataReference(uniforms, DataFieldHandle{ 2u }, sharedFloat);
+                m_scene.setDataTextureSamplerHandle(uniforms, DataFieldHandle{ 3u }, sampler);
+                const DataInstanceHandle geometry = m_scene.allocateDataInstance(geometryLayout, {});
+                m_scene.setDataResource(geometry, DataFieldHandle{ 0u }, ResourceContentHash{ 3u, 0u }, {}, 0u, 0u, 0u);
+                m_scene.setDataResource(geometry, DataFieldHandle{ 1u }, ResourceContentHash{ 4u, 0u }, {}, 0u, 0u, 0u);
+
+                m_scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, uniforms);
+                m_scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, geometry);
+                m_scene.setRenderableRenderState(renderable, states[i % 2u]);
+                m_scene.setRenderableIndexCount(renderable, 36u);
+                m_scene.addRenderableToRenderGroup(group, renderable, static_cast<int32_t>(i));
+                m_renderables.push_back(renderable);
+            }
+
+            m_scene.updateRenderablesAndResourceCache(m_resourceAccessor);
+            m_scene.updateRenderableVertexArrays(m_resourceAccessor, m_renderables);
+            m_scene.markVertexArraysClean();
+            m_scene.updateRenderableWorldMatrices();
+        }
+
+        [[nodiscard]] const RendererCachedScene& getScene() const
+        {
+            return m_scene;
+        }
+
+    private:
+        CameraHandle createCamera()
+        {
+            const DataLayoutHandle cameraLayout = m_scene.allocateDataLayout({ DataFieldInfo{ EDataType::DataReference }, DataFieldInfo{ EDataType::DataReference },
+                DataFieldInfo{ EDataType::DataReference }, DataFieldInfo{ EDataType::DataReference } }, {}, {});
+            const DataLayoutHandle vec2iLayout = m_scene.allocateDataLayout({ DataFieldInfo{ EDataType::Vector2I } }, {}, {});
+            const DataLayoutHandle vec4fLayout = m_scene.allocateDataLayout({ DataFieldInfo{ EDataType::Vector4F } }, {}, {});
+            const DataLayoutHandle vec2fLayout = m_scene.allocateDataLayout({ DataFieldInfo{ EDataType::Vector2F } }, {}, {});
+
+            const DataInstanceHandle cameraData = m_scene.allocateDataInstance(cameraLayout, {});
+            const DataInstanceHandle viewportOffset = m_scene.allocateDataInstance(vec2iLayout, {});
+            const DataInstanceHandle viewportSize = m_scene.allocateDataInstance(vec2iLayout, {});
+            const DataInstanceHandle frustumPlanes = m_scene.allocateDataInstance(vec4fLayout, {});
+            const DataInstanceHandle frustumNearFar = m_scene.allocateDataInstance(vec2fLayout, {});
+            m_scene.setDataReference(cameraData, Camera::ViewportOffsetField, viewportOffset);
+            m_scene.setDataReference(cameraData, Camera::ViewportSizeField, viewportSize);
+            m_scene.setDataReference(cameraData, Camera::FrustumPlanesField, frustumPlanes);
+            m_scene.setDataReference(cameraData, Camera::FrustumNearFarPlanesField, frustumNearFar);
+            m_scene.setDataSingleVector2i(viewportSize, DataFieldHandle{ 0u }, { 1280, 480 });
+            m_scene.setDataSingleVector4f(frustumPlanes, DataFieldHandle{ 0u }, { -1.f, 1.f, -1.f, 1.f });
+            m_scene.setDataSingleVector2f(frustumNearFar, DataFieldHandle{ 0u }, { 0.1f, 100.f });
+
+            const NodeHandle cameraNode = m_scene.allocateNode(0u, {});
+            m_scene.allocateTransform(cameraNode, {});
+            return m_scene.allocateCamera(ECameraProjectionType::Perspective, cameraNode, cameraData, {});
+        }
+
+        RendererEventCollector m_eventCollector;
+        RendererScenes m_scenes;
+        RendererCachedScene& m_scene;
+        NullResourceAccessor m_resourceAccessor;
+        RenderableVector m_renderables;
+    };
+
+    // CPU cost of executing renderables of already prepared scene, reported per draw
+    static void BM_RenderExecutor_ExecuteScene(benchmark::State& state)
+    {
+        const auto renderableCount = static_cast<uint32_t>(state.range(0));
+        RenderExecutorScene scene(renderableCount);
+        NullDevice device;
+        RenderingContext renderContext;
+        renderContext.viewportWidth = 1280u;
+        renderContext.viewportHeight = 480u;
+
+        for (auto _ : state)
+        {
+            RenderExecutor executor(device, renderContext);
+            benchmark::DoNotOptimize(executor.executeScene(scene.getScene()));
+        }
+
+        if (device.getDrawCalls() != renderableCount * static_cast<uint64_t>(state.iterations()))
+            state.SkipWithError("not all renderables were drawn");
+        state.SetItemsProcessed(state.iterations() * renderableCount);
+    }
+    BENCHMARK(BM_RenderExecutor_ExecuteScene)->Arg(100)->Arg(1000)->Arg(10000);
+}
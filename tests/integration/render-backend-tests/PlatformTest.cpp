@@ -175,7 +175,7 @@ namespace ramses::internal
         ASSERT_NE(nullptr, mainRenderBackend);
         IResourceUploadRenderBackend* resourceUploadRenderBackend = createResourceUploadRenderBackend();
         ASSERT_NE(nullptr, resourceUploadRenderBackend);
-        platform->destroyResourceUploadRenderBackend();
+        platform->destroyResourceUploadRenderBackend(*resourceUploadRenderBackend);
         platform->destroyRenderBackend();
     }
 
@@ -188,7 +188,7 @@ namespace ramses::internal
             IResourceUploadRenderBackend* resourceUploadRenderBackend = createResourceUploadRenderBackend();
             ASSERT_NE(nullptr, resourceUploadRenderBackend);
 
-            platform->destroyResourceUploadRenderBackend();
+            platform->destroyResourceUploadRenderBackend(*resourceUploadRenderBackend);
             platform->destroyRenderBackend();
         }
         {
@@ -198,7 +198,7 @@ namespace ramses::internal
             IResourceUploadRenderBackend* resourceUploadRenderBackend = createResourceUploadRenderBackend();
             ASSERT_NE(nullptr, resourceUploadRenderBackend);
 
-            platform->destroyResourceUploadRenderBackend();
+            platform->destroyResourceUploadRenderBackend(*resourceUploadRenderBackend);
             platform->destroyRenderBackend();
         }
     }
@@ -218,7 +218,7 @@ namespace ramses::internal
         EXPECT_TRUE(renderBackend->getContext().enable());
         EXPECT_TRUE(resourceUploadRenderBackend->getContext().enable());
 
-        platform->destroyResourceUploadRenderBackend();
+        platform->destroyResourceUploadRenderBackend(*resourceUploadRenderBackend);
         platform->destroyRenderBackend();
     }
 
@@ -232,7 +232,7 @@ namespace ramses::internal
 
         EXPECT_TRUE(resourceUploadRenderBackend->getContext().disable());
 
-        platform->destroyResourceUploadRenderBackend();
+        platform->destroyResourceUploadRenderBackend(*resourceUploadRenderBackend);
         platform->destroyRenderBackend();
     }
 
@@ -249,7 +249,7 @@ namespace ramses::internal
         EXPECT_TRUE(resourceUploadRenderBackend->getContext().disable());
         EXPECT_TRUE(resourceUploadRenderBackend->getContext().enable());
 
-        platform->destroyResourceUploadRenderBackend();
+        platform->destroyResourceUploadRenderBackend(*resourceUploadRenderBackend);
         platform->destroyRenderBackend();
     }
 
@@ -273,7 +273,7 @@ namespace ramses::internal
                     return;
                 }
 
-                platform->destroyResourceUploadRenderBackend();
+                platform->destroyResourceUploadRenderBackend(*resourceUploadRenderBackend);
                 success.set_value(true);
             });
 
@@ -310,7 +310,7 @@ namespace ramses::internal
                 //block till main context is enabled, to make sure both got enabled succesfully at the same time
                 //before the resource upload render backend gets destroyed
                 EXPECT_TRUE(successMainThread.get_future().get());
-                platform->destroyResourceUploadRenderBackend();
+                platform->destroyResourceUploadRenderBackend(*resourceUploadRenderBackend);
             });
 
         //block till resource upload render backend is created
@@ -346,7 +346,7 @@ namespace ramses::internal
                 const auto shaderResource = UploadEffectAndExpectSuccess(resourceUploadRenderBackend->getDevice());
                 success.set_value(shaderResource != nullptr);
 
-                platform->destroyResourceUploadRenderBackend();
+                platform->destroyResourceUploadRenderBackend(*resourceUploadRenderBackend);
             });
 
         EXPECT_TRUE(success.get_future().get());
@@ -388,7 +388,7 @@ namespace ramses::internal
                 const auto shaderResource = UploadEffectAndExpectSuccess(resourceUploadRenderBackend->getDevice());
                 successResourceUpload.set_value(shaderResource != nullptr);
 
-                platform->destroyResourceUploadRenderBackend();
+                platform->destroyResourceUploadRenderBackend(*resourceUploadRenderBackend);
             });
 
         //block till resource upload thread create resource upload render backend
@@ -432,7 +432,7 @@ namespace ramses::internal
                 //block till resource is used to make sure behavior is deterministic
                 EXPECT_TRUE(resourceUsedSuccess.get_future().get());
 
-                platform->destroyResourceUploadRenderBackend();
+                platform->destroyResourceUploadRenderBackend(*resourceUploadRenderBackend);
             });
 
 
@@ -475,7 +475,7 @@ namespace ramses::internal
                 auto resource= UploadEffectAndExpectSuccess(resourceUploadRenderBackend->getDevice());
                 shaderResource.set_value(std::move(resource));
 
-                platform->destroyResourceUploadRenderBackend();
+                platform->destroyResourceUploadRenderBackend(*resourceUploadRenderBackend);
             });
 
         resourceUploadThread.join();
@@ -132,6 +132,83 @@ namespace ramses::internal
         EXPECT_TRUE(nullptr == texture);
     }
 
+    // asynchronous and batch decoding
+    TEST_F(ARamsesUtilsTest, decodesPngAsync)
+    {
+        const DecodedImage image = RamsesUtils::DecodePngAsync(client, "res/sampleTexture.png").get();
+        EXPECT_EQ(32u, image.width);
+        EXPECT_EQ(32u, image.height);
+        ASSERT_EQ(1u, image.mipLevels.size());
+        EXPECT_EQ(32u * 32u * 4u, image.mipLevels[0].size());
+
+        Texture2D* texture = RamsesUtils::CreateTextureResourceFromDecodedImage(image, m_scene, {}, "decoded");
+        ASSERT_TRUE(nullptr != texture);
+        EXPECT_EQ("decoded", texture->getName());
+        EXPECT_EQ(32u, texture->getWidth());
+    }
+
+    TEST_F(ARamsesUtilsTest, decodesPngBufferAsyncWithMipMaps)
+    {
+        std::vector<unsigned char> buffer;
+        LoadFileToVector("res/sampleTexture.png", buffer);
+        const DecodedImage image = RamsesUtils::DecodePngBufferAsync(client, buffer, true).get();
+        ASSERT_EQ(6u, image.mipLevels.size());
+        uint32_t expectedLevelSize = 32u;
+        for (const auto& level : image.mipLevels)
+        {
+            EXPECT_EQ(expectedLevelSize * expectedLevelSize * 4u, level.size());
+            expectedLevelSize /= 2u;
+        }
+
+        EXPECT_TRUE(nullptr != RamsesUtils::CreateTextureResourceFromDecodedImage(image, m_scene));
+    }
+
+    TEST_F(ARamsesUtilsTest, generatesSameMipMapsAsGenerateMipMapsTexture2D)
+    {
+        const DecodedImage image = RamsesUtils::DecodePngAsync(client, "res/sampleTexture.png", true).get();
+        ASSERT_FALSE(image.mipLevels.empty());
+
+        std::vector<std::byte> data = image.mipLevels[0];
+        size_t mipMapCount = 0u;
+        MipLevelData* mipLevels = RamsesUtils::GenerateMipMapsTexture2D(32u, 32u, 4u, data.data(), mipMapCount);
+        ASSERT_EQ(image.mipLevels.size(), mipMapCount);
+        for (size_t i = 0u; i < mipMapCount; ++i)
+            EXPECT_EQ(image.mipLevels[i], std::vector<std::byte>(mipLevels[i].m_data, mipLevels[i].m_data + mipLevels[i].m_size));
+        RamsesUtils::DeleteGeneratedMipMaps(mipLevels, mipMapCount);
+    }
+
+    TEST_F(ARamsesUtilsTest, decodePngAsyncReturnsEmptyImageForInvalidFile)
+    {
+        const DecodedImage image = RamsesUtils::DecodePngAsync(client, "res/sampleTexture_invalid.png").get();
+        EXPECT_EQ(0u, image.width);
+        EXPECT_TRUE(image.mipLevels.empty());
+        EXPECT_EQ(nullptr, RamsesUtils::CreateTextureResourceFromDecodedImage(image, m_scene));
+    }
+
+    TEST_F(ARamsesUtilsTest, createsTextureResourcesFromPngsInOrder)
+    {
+        const std::vector<std::string> files{ "res/sampleTexture.png", "res/sampleTexture_invalid.png", "res/rgba8_expectedFlipped.png", "res/sampleTexture.png" };
+        const auto textures = RamsesUtils::CreateTextureResourcesFromPngs(files, m_scene, true);
+        ASSERT_EQ(4u, textures.size());
+        EXPECT_TRUE(nullptr != textures[0]);
+        EXPECT_EQ(nullptr, textures[1]);
+        EXPECT_TRUE(nullptr != textures[2]);
+        EXPECT_TRUE(nullptr != textures[3]);
+        EXPECT_EQ(textures[0]->getWidth(), textures[3]->getWidth());
+    }
+
+    TEST_F(ARamsesUtilsTest, createsTextureResourcesFromPngBuffers)
+    {
+        std::vector<std::vector<unsigned char>> buffers(3u);
+        LoadFileToVector("res/sampleTexture.png", buffers[0]);
+        LoadFileToVector("res/rgba8_expectedFlipped.png", buffers[2]);
+        const auto textures = RamsesUtils::CreateTextureResourcesFromPngBuffers(buffers, m_scene);
+        ASSERT_EQ(3u, textures.size());
+        EXPECT_TRUE(nullptr != textures[0]);
+        EXPECT_EQ(nullptr, textures[1]);
+        EXPECT_TRUE(nullptr != textures[2]);
+    }
+
     TEST_F(ARamsesUtilsTest, canSaveImageBufferToPng)
     {
         const std::string pngPath = "rgba8.png";
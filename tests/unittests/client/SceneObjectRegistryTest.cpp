@@ -109,6 +109,45 @@ namespace ramses::internal
         EXPECT_EQ(nullptr, m_registry.findObjectByName<SceneObject>("name"));
     }
 
+    TEST_F(ASceneObjectRegistry, findsFirstRegisteredObjectIfNamesAreNotUnique)
+    {
+        auto object1 = createAndRegisterDummyObject();
+        auto object2 = createAndRegisterDummyObject();
+        auto object3 = createAndRegisterDummyObject();
+        object3->setName("name");
+        object2->setName("name");
+        object1->setName("name");
+        EXPECT_EQ(object1, m_registry.findObjectByName<Node>("name"));
+
+        m_registry.destroyAndUnregisterObject(*object1);
+        EXPECT_EQ(object2, m_registry.findObjectByName<Node>("name"));
+
+        object2->setName("otherName");
+        EXPECT_EQ(object3, m_registry.findObjectByName<Node>("name"));
+        EXPECT_EQ(object2, m_registry.findObjectByName<Node>("otherName"));
+    }
+
+    TEST_F(ASceneObjectRegistry, keepsObjectsAccessibleWhenOthersAreDestroyed)
+    {
+        std::vector<Node*> objects;
+        for (uint32_t i = 0u; i < 100u; ++i)
+        {
+            objects.push_back(createAndRegisterDummyObject());
+            objects.back()->setName(std::to_string(i));
+        }
+
+        for (uint32_t i = 0u; i < 100u; i += 2u)
+            m_registry.destroyAndUnregisterObject(*objects[i]);
+
+        EXPECT_EQ(50u, m_registry.getNumberOfObjects(ERamsesObjectType::Node));
+        for (uint32_t i = 0u; i < 100u; ++i)
+        {
+            const bool destroyed = (i % 2u == 0u);
+            EXPECT_EQ(destroyed ? nullptr : objects[i], m_registry.findObjectByName<Node>(std::to_string(i)));
+            EXPECT_EQ(destroyed ? nullptr : objects[i], m_registry.findObjectById(sceneObjectId_t{ i + 1u }));
+        }
+    }
+
     TEST_F(ASceneObjectRegistry, cannotRetrieveObjectInfoAfterObjectDeleted)
     {
         auto dummyObject = createAndRegisterDummyObject();
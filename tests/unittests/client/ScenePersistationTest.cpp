@@ -34,6 +34,7 @@
 #include "ramses/client/Effect.h"
 #include "ramses/client/logic/LogicEngine.h"
 #include "ramses/client/logic/TimerNode.h"
+#include "ramses/client/logic/NodeBinding.h"
 #include "ramses/client/ramses-utils.h"
 
 #include "ScenePersistationTest.h"
@@ -303,6 +304,34 @@ namespace ramses::internal
         EXPECT_TRUE(m_sceneLoaded->destroy(*loadedLogic));
     }
 
+    TEST_F(ASceneLoadedFromFile, loadsMultipleLogicEnginesWithBindingsToSceneObjects)
+    {
+        auto* node = this->m_scene.createNode("node");
+        std::vector<std::pair<LogicEngine*, NodeBinding*>> engines;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            auto* logic = this->m_scene.createLogicEngine(fmt::format("logic{}", i));
+            engines.emplace_back(logic, logic->createNodeBinding(*node, ERotationType::Euler_XYZ, fmt::format("binding{}", i)));
+        }
+        const sceneObjectId_t objectIdAfterCreation = this->m_scene.createNode("last")->getSceneObjectId();
+
+        doWriteReadCycle();
+
+        const auto* loadedNode = this->getObjectForTesting<Node>("node");
+        for (size_t i = 0; i < 4; ++i)
+        {
+            auto* loadedLogic = this->getObjectForTesting<LogicEngine>(fmt::format("logic{}", i));
+            ASSERT_NE(nullptr, loadedLogic);
+            const auto* loadedBinding = loadedLogic->findObject<NodeBinding>(fmt::format("binding{}", i));
+            ASSERT_NE(nullptr, loadedBinding);
+            EXPECT_EQ(engines[i].second->getSceneObjectId(), loadedBinding->getSceneObjectId());
+            EXPECT_EQ(loadedNode, &loadedBinding->getRamsesNode());
+        }
+
+        // objects created after loading do not collide with any loaded object
+        EXPECT_GT(m_sceneLoaded->createNode("new")->getSceneObjectId().getValue(), objectIdAfterCreation.getValue());
+    }
+
     TEST_F(ASceneLoadedFromFile, canReadWriteAPerspectiveCamera)
     {
         auto* camera = this->m_scene.createPerspectiveCamera("my cam");
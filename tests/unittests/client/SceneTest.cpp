@@ -22,6 +22,7 @@
 #include "ramses/client/OrthographicCamera.h"
 #include "ramses/client/PerspectiveCamera.h"
 #include "ramses/client/ArrayBuffer.h"
+#include "ramses/client/ArrayResource.h"
 #include "ramses/client/logic/TimerNode.h"
 #include "ramses/client/ramses-utils.h"
 #include "ramses/framework/EDataType.h"
@@ -34,11 +35,16 @@
 #include "impl/TextureSamplerImpl.h"
 #include "impl/Texture2DImpl.h"
 #include "impl/SceneConfigImpl.h"
+#include "impl/SceneObjectRegistryIterator.h"
+#include "impl/ValidationReportImpl.h"
 #include "ClientTestUtils.h"
 #include "SimpleSceneTopology.h"
 #include "internal/Components/FlushTimeInformation.h"
 #include "internal/PlatformAbstraction/PlatformTime.h"
 
+#include <algorithm>
+#include <array>
+
 using namespace testing;
 
 namespace ramses::internal
@@ -120,6 +126,22 @@ namespace ramses::internal
 #endif
     }
 
+    TEST(ASceneConfig, hasShadowCopyEnabledByDefault)
+    {
+        SceneConfig config;
+        EXPECT_TRUE(config.impl().isShadowCopyEnabled());
+        config.setShadowCopyEnabled(false);
+        EXPECT_FALSE(config.impl().isShadowCopyEnabled());
+    }
+
+    TEST(ASceneConfig, hasIncrementalValidationDisabledByDefault)
+    {
+        SceneConfig config;
+        EXPECT_FALSE(config.impl().isIncrementalValidationEnabled());
+        config.setIncrementalValidationEnabled(true);
+        EXPECT_TRUE(config.impl().isIncrementalValidationEnabled());
+    }
+
     class ASceneWithContent : public SimpleSceneTopology
     {
     };
@@ -168,6 +190,18 @@ namespace ramses::internal
         EXPECT_TRUE(distributedScene->publish(EScenePublicationMode::LocalAndRemote));
     }
 
+    TEST(DistributedSceneTest, canPublishRemotelyWithShadowCopyDisabled)
+    {
+        RamsesFramework framework{ LocalTestClient::GetDefaultFrameworkConfig() };
+        RamsesClient& remoteClient(*framework.createClient({}));
+        framework.connect();
+        SceneConfig config(sceneId_t(1u), EScenePublicationMode::LocalAndRemote);
+        config.setShadowCopyEnabled(false);
+        ramses::Scene* distributedScene = remoteClient.createScene(config);
+        EXPECT_TRUE(distributedScene->publish(EScenePublicationMode::LocalAndRemote));
+        EXPECT_TRUE(distributedScene->flush());
+    }
+
     TEST(DistributedSceneTest, cannotPublishRemotelyByDefault)
     {
         RamsesFramework framework{ LocalTestClient::GetDefaultFrameworkConfig() };
@@ -259,6 +293,66 @@ namespace ramses::internal
         m_scene.destroy(*cameraWithoutValidValues);
     }
 
+    // validates every scene object one after another on calling thread
+    static std::vector<Issue> ValidateObjectsSerially(const ramses::Scene& scene)
+    {
+        ValidationReportImpl report;
+        EXPECT_TRUE(report.addVisit(&scene.impl()));
+        for (size_t i = 0u; i < RamsesObjectTypeCount; ++i)
+        {
+            const auto type = static_cast<ERamsesObjectType>(i);
+            if (RamsesObjectTypeUtils::IsTypeMatchingBaseType(type, ERamsesObjectType::SceneObject) && RamsesObjectTypeUtils::IsConcreteType(type))
+            {
+                SceneObjectRegistryIterator iter(scene.impl().getObjectRegistry(), type);
+                while (const auto* obj = iter.getNext())
+                    obj->impl().validate(report);
+            }
+        }
+        return report.getIssues();
+    }
+
+    TEST_F(AScene, reportsIssuesOfObjectsInSameOrderAsSerialValidation)
+    {
+        for (int i = 0; i < 200; ++i)
+        {
+            ramses::RenderPass* pass = m_scene.createRenderPass();
+            ramses::RenderGroup* group = m_scene.createRenderGroup();
+            MeshNode* mesh = m_scene.createMeshNode();
+            if (i % 2 == 0)
+                pass->addRenderGroup(*group);
+            if (i % 3 == 0)
+                group->addMeshNode(*mesh);
+        }
+
+        const std::vector<Issue> expectedIssues = ValidateObjectsSerially(m_scene);
+        ASSERT_FALSE(expectedIssues.empty());
+        for (int i = 0; i < 3; ++i)
+        {
+            ValidationReport report;
+            m_scene.validate(report);
+            EXPECT_EQ(expectedIssues, report.getIssues());
+        }
+    }
+
+    TEST_F(AScene, reportsShaderWarningsOfEffectsInSameOrderAsSerialValidation)
+    {
+        for (int i = 0; i < 20; ++i)
+        {
+            EffectDescription effectDesc;
+            effectDesc.setVertexShader("#version 100\nuniform highp float unused" + std::to_string(i) + ";\nvoid main(void) { gl_Position = vec4(0.0); }");
+            effectDesc.setFragmentShader("#version 100\nvoid main(void) { gl_FragColor = vec4(1.0); }");
+            ASSERT_NE(nullptr, m_scene.createEffect(effectDesc));
+        }
+
+        // shaders are parsed in parallel when validating the scene for the first time
+        ValidationReport report;
+        m_scene.validate(report);
+        const std::vector<Issue> expectedIssues = ValidateObjectsSerially(m_scene);
+        ASSERT_FALSE(expectedIssues.empty());
+        EXPECT_EQ(expectedIssues, report.getIssues());
+        EXPECT_NE(std::string::npos, report.impl().toString().find("unused19"));
+    }
+
     TEST_F(AScene, doesNotDestroyCameraWhileItIsStillUsedByARenderPass)
     {
         ramses::RenderPass* pass = m_scene.createRenderPass();
@@ -284,6 +378,61 @@ namespace ramses::internal
         EXPECT_TRUE(group2->impl().getAllMeshes().empty());
     }
 
+    TEST_F(AScene, destroysNodeWithAllDescendants)
+    {
+        Node* parent = m_scene.createNode("parent");
+        Node* root = m_scene.createNode("root");
+        Node* child = m_scene.createNode("child");
+        MeshNode* grandChild1 = m_scene.createMeshNode("grandChild1");
+        Node* grandChild2 = m_scene.createNode("grandChild2");
+        Node* sibling = m_scene.createNode("sibling");
+        parent->addChild(*root);
+        parent->addChild(*sibling);
+        root->addChild(*child);
+        child->addChild(*grandChild1);
+        child->addChild(*grandChild2);
+
+        ramses::RenderGroup* group = m_scene.createRenderGroup();
+        group->addMeshNode(*grandChild1);
+        m_scene.createTransformationDataProvider(*grandChild2, dataProviderId_t(1u));
+        m_scene.createTransformationDataProvider(*sibling, dataProviderId_t(2u));
+
+        EXPECT_TRUE(m_scene.destroySubtree(*root));
+
+        EXPECT_EQ(nullptr, m_scene.findObject<Node>("root"));
+        EXPECT_EQ(nullptr, m_scene.findObject<Node>("child"));
+        EXPECT_EQ(nullptr, m_scene.findObject<MeshNode>("grandChild1"));
+        EXPECT_EQ(nullptr, m_scene.findObject<Node>("grandChild2"));
+        EXPECT_EQ(sibling, m_scene.findObject<Node>("sibling"));
+        ASSERT_EQ(1u, parent->getChildCount());
+        EXPECT_EQ(sibling, parent->getChild(0u));
+        EXPECT_TRUE(group->impl().getAllMeshes().empty());
+        EXPECT_FALSE(m_scene.impl().getIScene().isDataSlotAllocated(ramses::internal::DataSlotHandle(0u)));
+        EXPECT_TRUE(m_scene.impl().getIScene().isDataSlotAllocated(ramses::internal::DataSlotHandle(1u)));
+    }
+
+    TEST_F(AScene, doesNotDestroySubtreeWithCameraStillUsedByARenderPass)
+    {
+        Node* root = m_scene.createNode("root");
+        PerspectiveCamera* camera = m_scene.createPerspectiveCamera("camera");
+        camera->setFrustum(0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f);
+        camera->setViewport(0, 0, 100, 200);
+        root->addChild(*camera);
+        m_scene.createRenderPass()->setCamera(*camera);
+
+        EXPECT_FALSE(m_scene.destroySubtree(*root));
+        EXPECT_EQ(root, m_scene.findObject<Node>("root"));
+        EXPECT_EQ(camera, m_scene.findObject<PerspectiveCamera>("camera"));
+        EXPECT_EQ(root, camera->getParent());
+    }
+
+    TEST_F(AScene, failsToDestroySubtreeOfNodeFromAnotherScene)
+    {
+        ramses::Scene& anotherScene(*client.createScene(SceneConfig(sceneId_t{ 0xf00 })));
+        Node* node = anotherScene.createNode();
+        EXPECT_FALSE(m_scene.destroySubtree(*node));
+    }
+
     TEST_F(AScene, failsToCreateAppearanceWhenEffectIsFromAnotherScene)
     {
         ramses::Scene& anotherScene(*client.createScene(SceneConfig(sceneId_t{ 0xf00 })));
@@ -1723,4 +1872,124 @@ namespace ramses::internal
         // only one remaining scene object with test name
         EXPECT_EQ(logicObject, m_scene.findObject<ramses::SceneObject>("test"));
     }
+
+    class ASceneWithIncrementalValidation : public LocalTestClient, public ::testing::Test
+    {
+    public:
+        ASceneWithIncrementalValidation()
+            : m_scene(CreateScene(client))
+        {
+        }
+
+        ~ASceneWithIncrementalValidation() override
+        {
+            client.destroy(m_scene);
+        }
+
+        static ramses::Scene& CreateScene(RamsesClient& client)
+        {
+            SceneConfig config{ sceneId_t(123u) };
+            config.setIncrementalValidationEnabled(true);
+            return *client.createScene(config);
+        }
+
+        void validate()
+        {
+            m_report.clear();
+            m_scene.validate(m_report);
+            EXPECT_EQ(ValidateObjectsSerially(m_scene), m_report.getIssues());
+        }
+
+        [[nodiscard]] size_t getNumberOfObjectsChecked() const
+        {
+            return m_scene.impl().getSceneValidator().getNumberOfObjectsCheckedInLastValidation();
+        }
+
+        [[nodiscard]] bool reportContains(std::string_view message) const
+        {
+            return std::any_of(m_report.getIssues().cbegin(), m_report.getIssues().cend(), [&](const Issue& issue) { return issue.message == message; });
+        }
+
+    protected:
+        ramses::Scene& m_scene;
+        ValidationReport m_report;
+    };
+
+    TEST_F(ASceneWithIncrementalValidation, reusesResultsOfObjectsNotModifiedSinceLastValidation)
+    {
+        m_scene.createRenderPass();
+        m_scene.createRenderGroup();
+
+        validate();
+        EXPECT_EQ(2u, getNumberOfObjectsChecked());
+        const std::vector<Issue> issues = m_report.getIssues();
+        EXPECT_FALSE(issues.empty());
+
+        validate();
+        EXPECT_EQ(0u, getNumberOfObjectsChecked());
+        EXPECT_EQ(issues, m_report.getIssues());
+    }
+
+    TEST_F(ASceneWithIncrementalValidation, checksObjectsWithNonCacheableResultsEveryTime)
+    {
+        m_scene.createPerspectiveCamera();
+
+        validate();
+        EXPECT_EQ(1u, getNumberOfObjectsChecked());
+        EXPECT_TRUE(m_report.hasError());
+
+        validate();
+        EXPECT_EQ(1u, getNumberOfObjectsChecked());
+        EXPECT_TRUE(m_report.hasError());
+    }
+
+    TEST_F(ASceneWithIncrementalValidation, checksModifiedObjectAgain)
+    {
+        ramses::RenderPass* pass = m_scene.createRenderPass();
+        ramses::RenderGroup* group = m_scene.createRenderGroup();
+        m_scene.createRenderGroup();
+
+        validate();
+        EXPECT_TRUE(reportContains("renderpass does not contain any rendergroups"));
+
+        ASSERT_TRUE(pass->addRenderGroup(*group));
+        validate();
+        EXPECT_LT(getNumberOfObjectsChecked(), 3u);
+        EXPECT_FALSE(reportContains("renderpass does not contain any rendergroups"));
+    }
+
+    TEST_F(ASceneWithIncrementalValidation, checksObjectsDependingOnModifiedObjectAgain)
+    {
+        const std::array<uint16_t, 6u> indices{ 0u, 1u, 2u, 0u, 1u, 2u };
+        const ramses::ArrayResource* threeIndices = m_scene.createArrayResource(3u, indices.data());
+        const ramses::ArrayResource* sixIndices = m_scene.createArrayResource(6u, indices.data());
+        Geometry* geometry = m_scene.createGeometry(*TestEffects::CreateTestEffect(m_scene));
+        ASSERT_TRUE(geometry->setIndices(*threeIndices));
+        MeshNode* mesh = m_scene.createMeshNode();
+        ASSERT_TRUE(mesh->setGeometry(*geometry));
+        ASSERT_TRUE(mesh->setIndexCount(6u));
+
+        validate();
+        EXPECT_TRUE(reportContains("startIndex + indexCount exceeds indices of indexarray"));
+        validate();
+        EXPECT_EQ(0u, getNumberOfObjectsChecked());
+
+        // mesh itself is not modified, only the geometry it depends on
+        ASSERT_TRUE(geometry->setIndices(*sixIndices));
+        validate();
+        EXPECT_FALSE(reportContains("startIndex + indexCount exceeds indices of indexarray"));
+    }
+
+    TEST_F(ASceneWithIncrementalValidation, checksAllObjectsAgainAfterObjectIsDestroyed)
+    {
+        ramses::RenderPass* pass = m_scene.createRenderPass();
+        ramses::RenderGroup* group = m_scene.createRenderGroup();
+        ASSERT_TRUE(pass->addRenderGroup(*group));
+        validate();
+
+        ASSERT_TRUE(m_scene.destroy(*group));
+        validate();
+        EXPECT_EQ(1u, getNumberOfObjectsChecked());
+        EXPECT_TRUE(reportContains("renderpass does not contain any rendergroups"));
+    }
 }
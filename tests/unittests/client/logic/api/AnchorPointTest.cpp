@@ -268,6 +268,19 @@ namespace ramses::internal
         EXPECT_FLOAT_EQ(0.019886762f, *anchorPoint.getOutputs()->getChild(1u)->get<float>());
     }
 
+    TEST_F(AnAnchorPoint_Math, CalculatesCoordsWithNodeBindingValuesSetInSameUpdate)
+    {
+        const auto& anchorPoint = *m_logicEngine->createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor");
+        // binding changes are written in batch, they have to be written before anchor point reads the node
+        m_node->setTranslation({0.f, 0.f, 0.f});
+        m_nodeBinding.getInputs()->getChild("translation")->set(vec3f{ 1.f, 2.f, 3.f });
+        EXPECT_TRUE(m_logicEngine->update());
+        const auto coords = *anchorPoint.getOutputs()->getChild(0u)->get<vec2f>();
+        EXPECT_FLOAT_EQ(17.560308f, coords[0]);
+        EXPECT_FLOAT_EQ(19.317562f, coords[1]);
+        EXPECT_FLOAT_EQ(0.99509573f, *anchorPoint.getOutputs()->getChild(1u)->get<float>());
+    }
+
     class AnAnchorPoint_Dirtiness : public AnAnchorPoint_Math
     {
     protected:
@@ -102,6 +102,36 @@ namespace ramses::internal
         EXPECT_EQ(42, *script->getOutputs()->getChild("getGlobal")->get<int32_t>());
     }
 
+    TEST_F(ALuaScript_Init, ScriptsWithIdenticalSourceHaveIndependentGlobals)
+    {
+        const std::string_view scriptSrc = R"(
+            function init()
+                GLOBAL.number = 5
+            end
+
+            function interface(IN,OUT)
+                IN.setGlobal = Type:Int32()
+                OUT.getGlobal = Type:Int32()
+            end
+
+            function run(IN,OUT)
+                if IN.setGlobal ~= 0 then
+                    GLOBAL.number = IN.setGlobal
+                end
+                OUT.getGlobal = GLOBAL.number
+            end
+        )";
+        auto* script1 = m_logicEngine->createLuaScript(scriptSrc);
+        auto* script2 = m_logicEngine->createLuaScript(scriptSrc);
+        ASSERT_NE(nullptr, script1);
+        ASSERT_NE(nullptr, script2);
+
+        EXPECT_TRUE(script1->getInputs()->getChild("setGlobal")->set<int32_t>(42));
+        ASSERT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(42, *script1->getOutputs()->getChild("getGlobal")->get<int32_t>());
+        EXPECT_EQ(5, *script2->getOutputs()->getChild("getGlobal")->get<int32_t>());
+    }
+
     TEST_F(ALuaScript_Init, CanDeclareFunctions)
     {
         auto* script = m_logicEngine->createLuaScript(R"(
@@ -173,6 +173,41 @@ namespace ramses::internal
         EXPECT_EQ(33, *script->getOutputs()->getChild("v")->get<int32_t>());
     }
 
+    TEST_F(ALuaScriptWithModule, ScriptsWithIdenticalSourceUseInterfaceOfTheirOwnModule)
+    {
+        const std::string_view scriptSrc = R"(
+            modules("types")
+
+            function interface(IN,OUT)
+                OUT.v = types.valueType()
+            end
+
+            function run(IN,OUT)
+            end
+        )";
+
+        const auto script1 = m_logicEngine->createLuaScript(scriptSrc, createDeps({ { "types", R"(
+            local types = {}
+            function types.valueType()
+                return Type:Int32()
+            end
+            return types
+        )" } }));
+        ASSERT_NE(nullptr, script1);
+
+        const auto script2 = m_logicEngine->createLuaScript(scriptSrc, createDeps({ { "types", R"(
+            local types = {}
+            function types.valueType()
+                return Type:Float()
+            end
+            return types
+        )" } }));
+        ASSERT_NE(nullptr, script2);
+
+        EXPECT_EQ(EPropertyType::Int32, script1->getOutputs()->getChild("v")->getType());
+        EXPECT_EQ(EPropertyType::Float, script2->getOutputs()->getChild("v")->getType());
+    }
+
     TEST_F(ALuaScriptWithModule, TwoScriptsUseSameModule)
     {
         const auto module = m_logicEngine->createLuaModule(m_moduleSourceCode, {}, "mymathmodule");
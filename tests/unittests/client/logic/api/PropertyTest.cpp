@@ -577,6 +577,29 @@ namespace ramses::internal
         EXPECT_EQ(nullptr, child);
     }
 
+    TEST_F(AProperty, CanCheckIfWideStructHasChild)
+    {
+        std::vector<TypeData> fields;
+        for (int i = 0; i < 50; ++i)
+            fields.emplace_back(fmt::format("field{}", i), EPropertyType::Int32);
+        HierarchicalTypeData arrayOfStructs(TypeData("", EPropertyType::Array), { MakeStruct("", fields), MakeStruct("", fields) });
+        const auto root(CreateProperty(arrayOfStructs, EPropertySemantics::ScriptInput, false));
+
+        for (size_t element = 0u; element < 2u; ++element)
+        {
+            const Property* wideStruct = root->getChild(element);
+            ASSERT_EQ(50u, wideStruct->getChildCount());
+            for (size_t i = 0u; i < 50u; ++i)
+            {
+                const std::string fieldName = fmt::format("field{}", i);
+                EXPECT_TRUE(wideStruct->hasChild(fieldName));
+                EXPECT_EQ(wideStruct->getChild(i), wideStruct->getChild(fieldName));
+            }
+            EXPECT_FALSE(wideStruct->hasChild("field50"));
+            EXPECT_EQ(nullptr, wideStruct->getChild("field50"));
+        }
+    }
+
     TEST_F(AProperty, CanHaveNestedProperties)
     {
         auto root(CreateProperty(MakeStruct("", {{"child1", EPropertyType::Int32}, {"child2", EPropertyType::Float}}), EPropertySemantics::ScriptInput, false));
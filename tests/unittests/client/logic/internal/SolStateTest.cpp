@@ -11,6 +11,7 @@
 #include "internal/logic/SolState.h"
 #include "internal/logic/SolWrapper.h"
 #include "internal/logic/LuaCompilationUtils.h"
+#include "impl/logic/PropertyImpl.h"
 #include "impl/ErrorReporting.h"
 
 namespace ramses::internal
@@ -92,6 +93,34 @@ namespace ramses::internal
         EXPECT_TRUE(env["rl_logError"].valid());
     }
 
+    TEST_F(ASolState, SharesCompilationResultsOfIdenticalScripts)
+    {
+        ErrorReporting errors;
+        const auto script1 = LuaCompilationUtils::CompileScriptOrImportPrecompiled(m_solState, {}, {}, std::string{ m_valid_empty_script }, "script1", errors, {}, {}, {}, false);
+        ASSERT_TRUE(script1);
+        EXPECT_EQ(1u, m_solState.getNumCachedCompilations());
+
+        const auto script2 = LuaCompilationUtils::CompileScriptOrImportPrecompiled(m_solState, {}, {}, std::string{ m_valid_empty_script }, "script2", errors, {}, {}, {}, false);
+        ASSERT_TRUE(script2);
+        EXPECT_EQ(1u, m_solState.getNumCachedCompilations());
+        EXPECT_EQ(script1->source.byteCode.as_string_view(), script2->source.byteCode.as_string_view());
+        EXPECT_NE(script1->rootInput.get(), script2->rootInput.get());
+
+        // different configuration is compiled separately
+        const auto script3 = LuaCompilationUtils::CompileScriptOrImportPrecompiled(m_solState, {}, {}, std::string{ m_valid_empty_script }, "script3", errors, {}, {}, {}, true);
+        ASSERT_TRUE(script3);
+        EXPECT_EQ(2u, m_solState.getNumCachedCompilations());
+        EXPECT_FALSE(errors.getError().has_value());
+    }
+
+    TEST_F(ASolState, DoesNotCacheFailedCompilations)
+    {
+        ErrorReporting errors;
+        EXPECT_FALSE(LuaCompilationUtils::CompileScriptOrImportPrecompiled(m_solState, {}, {}, "function run(IN,OUT) end", "script", errors, {}, {}, {}, false));
+        EXPECT_TRUE(errors.getError().has_value());
+        EXPECT_EQ(0u, m_solState.getNumCachedCompilations());
+    }
+
     class ASolState_Environment : public ASolState
     {
     protected:
@@ -0,0 +1,99 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+
+#include "internal/logic/StructFieldIndex.h"
+#include "fmt/format.h"
+
+namespace ramses::internal
+{
+    TEST(AStructFieldIndex, findsIndexOfEachField)
+    {
+        std::vector<std::string> fieldNames;
+        for (size_t i = 0u; i < 100u; ++i)
+            fieldNames.push_back(fmt::format("field{}", i));
+
+        const StructFieldIndex index(fieldNames);
+        for (size_t i = 0u; i < fieldNames.size(); ++i)
+        {
+            const std::optional<size_t> fieldIndex = index.find(fieldNames[i]);
+            ASSERT_TRUE(fieldIndex.has_value());
+            EXPECT_EQ(i, *fieldIndex);
+        }
+    }
+
+    TEST(AStructFieldIndex, doesNotFindUnknownFields)
+    {
+        const StructFieldIndex index({ "a", "b", "c" });
+        EXPECT_FALSE(index.find("").has_value());
+        EXPECT_FALSE(index.find("d").has_value());
+        EXPECT_FALSE(index.find("ab").has_value());
+    }
+
+    TEST(AStructFieldIndex, findsFirstOfDuplicateFields)
+    {
+        const StructFieldIndex index({ "a", "b", "a" });
+        EXPECT_EQ(0u, *index.find("a"));
+        EXPECT_EQ(1u, *index.find("b"));
+    }
+
+    TEST(AStructFieldIndex, findsNothingIfEmpty)
+    {
+        const StructFieldIndex index(std::vector<std::string>{});
+        EXPECT_FALSE(index.find("a").has_value());
+    }
+
+    TEST(AStructFieldIndexCache, createsNoIndexForFewFields)
+    {
+        StructFieldIndexCache cache;
+        EXPECT_EQ(nullptr, cache.get({ "a", "b", "c" }));
+    }
+
+    TEST(AStructFieldIndexCache, returnsSameIndexForSameFieldNames)
+    {
+        std::vector<std::string> fieldNames;
+        for (size_t i = 0u; i < StructFieldIndex::MinFieldCount; ++i)
+            fieldNames.push_back(fmt::format("field{}", i));
+
+        StructFieldIndexCache cache;
+        const auto index = cache.get(fieldNames);
+        ASSERT_NE(nullptr, index);
+        EXPECT_EQ(index, cache.get(fieldNames));
+
+        fieldNames.back() = "otherField";
+        const auto otherIndex = cache.get(fieldNames);
+        ASSERT_NE(nullptr, otherIndex);
+        EXPECT_NE(index, otherIndex);
+    }
+
+    TEST(AStructFieldIndexCache, attachesSameIndexToWideStructsOfSameTypeOnly)
+    {
+        std::vector<TypeData> fields;
+        for (size_t i = 0u; i < StructFieldIndex::MinFieldCount; ++i)
+            fields.emplace_back(fmt::format("field{}", i), EPropertyType::Int32);
+
+        HierarchicalTypeData wideStruct = MakeStruct("", fields);
+        HierarchicalTypeData type(TypeData("", EPropertyType::Struct), {
+            HierarchicalTypeData(TypeData("array", EPropertyType::Array), { wideStruct, wideStruct }),
+            MakeStruct("nested", fields),
+            MakeStruct("narrow", { TypeData("a", EPropertyType::Int32) }) });
+
+        StructFieldIndexCache cache;
+        cache.attachTo(type);
+
+        const auto& arrayType = type.children[0];
+        ASSERT_NE(nullptr, arrayType.children[0].structFieldIndex);
+        EXPECT_EQ(arrayType.children[0].structFieldIndex, arrayType.children[1].structFieldIndex);
+        EXPECT_EQ(arrayType.children[0].structFieldIndex, type.children[1].structFieldIndex);
+        EXPECT_EQ(nullptr, arrayType.structFieldIndex);
+        EXPECT_EQ(nullptr, type.children[2].structFieldIndex);
+        EXPECT_EQ(nullptr, type.structFieldIndex);
+        EXPECT_EQ(2u, *type.children[1].structFieldIndex->find("field2"));
+    }
+}
@@ -242,6 +242,42 @@ namespace ramses::internal
         }
     }
 
+    TEST_F(AGlyphTexturePage, MergesPendingGlyphUpdatesAndKeepsDataOfOtherGlyphs)
+    {
+        // existing glyph between the two pending glyphs must be preserved by merged update
+        const Quad existingQuad(QuadOffset(3, 0), QuadSize(3, 3));
+        const Quad pendingQuad1(QuadOffset(0, 0), QuadSize(3, 3));
+        const Quad pendingQuad2(QuadOffset(6, 0), QuadSize(4, 3));
+        const GlyphTexturePage::GlyphPageData existingData{ 7 };
+        const GlyphTexturePage::GlyphPageData pendingData1{ 1 };
+        const GlyphTexturePage::GlyphPageData pendingData2{ 2, 3 };
+
+        GlyphTexturePage::GlyphPageData tempCache;
+        m_glyphPage->updateDataWithPadding(existingQuad, existingData.data(), tempCache);
+        m_glyphPage->addPendingDataWithPadding(pendingQuad2, pendingData2.data());
+        m_glyphPage->addPendingDataWithPadding(pendingQuad1, pendingData1.data());
+        m_glyphPage->flushPendingData(tempCache);
+
+        uint8_t databuffer[PageWidth * PageHeight];
+        m_glyphPage->getTextureBuffer().getMipLevelData(0, databuffer, PageWidth * PageHeight);
+        for (uint32_t row = 0; row < PageHeight; row++)
+        {
+            for (uint32_t col = 0; col < PageWidth; col++)
+            {
+                uint8_t expectedTexel = 0u;
+                if (row == 1 && col == 1)
+                    expectedTexel = 1u;
+                else if (row == 1 && col == 4)
+                    expectedTexel = 7u;
+                else if (row == 1 && col == 7)
+                    expectedTexel = 2u;
+                else if (row == 1 && col == 8)
+                    expectedTexel = 3u;
+                EXPECT_EQ(expectedTexel, databuffer[row * PageWidth + col]) << "row " << row << " col " << col;
+            }
+        }
+    }
+
     TEST_F(AGlyphTexturePage, NewGlyphPageHasOneFreeAreaWithWidthTimesHeightArea)
     {
         uint32_t fullArea = PageWidth * PageHeight;
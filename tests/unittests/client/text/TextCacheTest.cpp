@@ -355,6 +355,31 @@ namespace ramses::internal
         EXPECT_EQ(5, positionedGlyphs[10].advance);
     }
 
+    TEST_F(ATextCache, getsSamePositionedGlyphsForRepeatedRequests)
+    {
+        const std::u32string str = U"repeated";
+        const FontInstanceOffsets fontOffsets{ { LatinFontInstance12, 0u }, { LatinFontInstance20, 3u } };
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(str, fontOffsets);
+        ASSERT_EQ(8u, positionedGlyphs.size());
+        EXPECT_EQ(positionedGlyphs, m_textCache.getPositionedGlyphs(str, fontOffsets));
+
+        // different font offsets for same string must not be mixed up
+        const auto positionedGlyphsOtherOffsets = m_textCache.getPositionedGlyphs(str, { { LatinFontInstance12, 0u }, { LatinFontInstance20, 4u } });
+        EXPECT_NE(positionedGlyphs, positionedGlyphsOtherOffsets);
+        EXPECT_EQ(LatinFontInstance12, positionedGlyphsOtherOffsets[3].key.fontInstanceId);
+        EXPECT_EQ(positionedGlyphs, m_textCache.getPositionedGlyphs(str, fontOffsets));
+    }
+
+    TEST_F(ATextCache, doesNotReturnPositionedGlyphsOfDeletedFontInstance)
+    {
+        const FontInstanceId fontInstance = FRegistry->createFreetype2FontInstance(LatinFont, 16);
+        const std::u32string str = U"test";
+        EXPECT_EQ(4u, m_textCache.getPositionedGlyphs(str, fontInstance).size());
+
+        ASSERT_TRUE(FRegistry->deleteFontInstance(fontInstance));
+        EXPECT_TRUE(m_textCache.getPositionedGlyphs(str, fontInstance).empty());
+    }
+
     TEST_F(ATextCache, getsNullTextLineForNonExistingTextLineId)
     {
         EXPECT_EQ(nullptr, m_textCache.getTextLine(TextLineId::Invalid()));
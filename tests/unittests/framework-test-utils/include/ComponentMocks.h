@@ -52,7 +52,7 @@ namespace ramses::internal
         SceneGraphProviderComponentMock();
         ~SceneGraphProviderComponentMock() override;
 
-        MOCK_METHOD(void, handleCreateScene, (ClientScene& scene, bool enableLocalOnlyOptimization, ISceneProviderEventConsumer& consumer), (override));
+        MOCK_METHOD(void, handleCreateScene, (ClientScene& scene, bool useDirectSceneLogic, ISceneProviderEventConsumer& consumer), (override));
         MOCK_METHOD(void, handlePublishScene, (SceneId sceneId, EScenePublicationMode publicationMode), (override));
         MOCK_METHOD(void, handleUnpublishScene, (SceneId sceneId), (override));
         MOCK_METHOD(bool, handleFlush, (SceneId sceneId, const FlushTimeInformation&, SceneVersionTag), (override));
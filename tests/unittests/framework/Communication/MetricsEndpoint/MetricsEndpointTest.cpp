@@ -0,0 +1,172 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Communication/MetricsEndpoint/MetricsEndpoint.h"
+#include "internal/Core/Utils/MetricsRegistry.h"
+#include "internal/Core/Utils/StatisticCollection.h"
+#include "gmock/gmock.h"
+#include "fmt/format.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <cstring>
+#include <fstream>
+
+namespace ramses::internal
+{
+    using namespace testing;
+
+    class AMetricsEndpoint : public ::testing::Test
+    {
+    public:
+        static std::string Request(int socket, std::string_view request)
+        {
+            EXPECT_EQ(static_cast<ssize_t>(request.size()), ::send(socket, request.data(), request.size(), MSG_NOSIGNAL));
+            std::string response;
+            char buffer[1024];
+            ssize_t readBytes = 0;
+            while ((readBytes = ::recv(socket, buffer, sizeof(buffer), 0)) > 0)
+                response.append(buffer, static_cast<size_t>(readBytes));
+            ::close(socket);
+            return response;
+        }
+
+        static int ConnectTcp(uint16_t port)
+        {
+            const int sock = ::socket(AF_INET, SOCK_STREAM, 0);
+            sockaddr_in address = {};
+            address.sin_family = AF_INET;
+            address.sin_port = htons(port);
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            EXPECT_EQ(0, ::connect(sock, reinterpret_cast<const sockaddr*>(&address), sizeof(address)));
+            return sock;
+        }
+
+        static int ConnectUnix(const std::string& path)
+        {
+            const int sock = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            sockaddr_un address = {};
+            address.sun_family = AF_UNIX;
+            std::memcpy(address.sun_path, path.c_str(), path.size());
+            EXPECT_EQ(0, ::connect(sock, reinterpret_cast<const sockaddr*>(&address), sizeof(address)));
+            return sock;
+        }
+
+        StatisticCollectionFramework statistics;
+        MetricsRegistry registry{ statistics };
+    };
+
+    TEST_F(AMetricsEndpoint, parsesValidAddresses)
+    {
+        const auto unixAddress = MetricsEndpoint::ParseAddress("unix:/tmp/metrics.sock");
+        ASSERT_TRUE(unixAddress);
+        EXPECT_EQ("/tmp/metrics.sock", unixAddress->unixSocketPath);
+
+        const auto tcpAddress = MetricsEndpoint::ParseAddress("tcp:9100");
+        ASSERT_TRUE(tcpAddress);
+        EXPECT_TRUE(tcpAddress->unixSocketPath.empty());
+        EXPECT_EQ(9100u, tcpAddress->port);
+    }
+
+    TEST_F(AMetricsEndpoint, rejectsInvalidAddresses)
+    {
+        EXPECT_FALSE(MetricsEndpoint::ParseAddress(""));
+        EXPECT_FALSE(MetricsEndpoint::ParseAddress("/tmp/metrics.sock"));
+        EXPECT_FALSE(MetricsEndpoint::ParseAddress("unix:"));
+        EXPECT_FALSE(MetricsEndpoint::ParseAddress("unix:relative.sock"));
+        EXPECT_FALSE(MetricsEndpoint::ParseAddress("tcp:"));
+        EXPECT_FALSE(MetricsEndpoint::ParseAddress("tcp:99999"));
+        EXPECT_FALSE(MetricsEndpoint::ParseAddress("tcp:91a"));
+    }
+
+    TEST_F(AMetricsEndpoint, servesMetricsOverTcp)
+    {
+        statistics.statMessagesReceived.incCounter(7u);
+
+        MetricsEndpoint endpoint(registry, MetricsEndpointAddress{ {}, 0u });
+        ASSERT_TRUE(endpoint.start());
+        ASSERT_NE(0u, endpoint.getPort());
+
+        const std::string response = Request(ConnectTcp(endpoint.getPort()), "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+        EXPECT_THAT(response, StartsWith("HTTP/1.1 200 OK\r\n"));
+        EXPECT_THAT(response, HasSubstr("\nramses_framework_messages_received_total 7\n"));
+    }
+
+    TEST_F(AMetricsEndpoint, servesMetricsOverUnixSocket)
+    {
+        const std::string path = fmt::format("/tmp/ramses-metrics-unittest-{}.sock", ::getpid());
+        MetricsEndpoint endpoint(registry, MetricsEndpointAddress{ path, 0u });
+        ASSERT_TRUE(endpoint.start());
+
+        const std::string response = Request(ConnectUnix(path), "GET /metrics HTTP/1.0\r\n\r\n");
+        EXPECT_THAT(response, StartsWith("HTTP/1.1 200 OK\r\n"));
+        EXPECT_THAT(response, HasSubstr("# TYPE ramses_framework_messages_sent_total counter\n"));
+
+        endpoint.stop();
+        EXPECT_NE(0, ::access(path.c_str(), F_OK));
+    }
+
+    TEST_F(AMetricsEndpoint, replacesStaleUnixSocketOfPreviousRun)
+    {
+        const std::string path = fmt::format("/tmp/ramses-metrics-unittest-stale-{}.sock", ::getpid());
+        // socket file which nobody listens on anymore
+        const int staleSocket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, path.c_str(), path.size());
+        ASSERT_EQ(0, ::bind(staleSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)));
+        ::close(staleSocket);
+
+        MetricsEndpoint endpoint(registry, MetricsEndpointAddress{ path, 0u });
+        ASSERT_TRUE(endpoint.start());
+        EXPECT_THAT(Request(ConnectUnix(path), "GET /metrics HTTP/1.0\r\n\r\n"), StartsWith("HTTP/1.1 200 OK\r\n"));
+        endpoint.stop();
+        EXPECT_NE(0, ::access(path.c_str(), F_OK));
+    }
+
+    TEST_F(AMetricsEndpoint, doesNotReplaceFileWhichIsNotASocket)
+    {
+        const std::string path = fmt::format("/tmp/ramses-metrics-unittest-file-{}.sock", ::getpid());
+        std::ofstream(path) << "data";
+
+        MetricsEndpoint endpoint(registry, MetricsEndpointAddress{ path, 0u });
+        EXPECT_FALSE(endpoint.start());
+        endpoint.stop();
+
+        std::string content;
+        std::ifstream(path) >> content;
+        EXPECT_EQ("data", content);
+        ::unlink(path.c_str());
+    }
+
+    TEST_F(AMetricsEndpoint, doesNotTakeOverUnixSocketOfRunningEndpoint)
+    {
+        const std::string path = fmt::format("/tmp/ramses-metrics-unittest-used-{}.sock", ::getpid());
+        MetricsEndpoint runningEndpoint(registry, MetricsEndpointAddress{ path, 0u });
+        ASSERT_TRUE(runningEndpoint.start());
+
+        MetricsEndpoint otherEndpoint(registry, MetricsEndpointAddress{ path, 0u });
+        EXPECT_FALSE(otherEndpoint.start());
+        otherEndpoint.stop();
+
+        // socket of running endpoint is untouched
+        EXPECT_THAT(Request(ConnectUnix(path), "GET /metrics HTTP/1.0\r\n\r\n"), StartsWith("HTTP/1.1 200 OK\r\n"));
+    }
+
+    TEST_F(AMetricsEndpoint, answersUnknownPathWithNotFound)
+    {
+        MetricsEndpoint endpoint(registry, MetricsEndpointAddress{ {}, 0u });
+        ASSERT_TRUE(endpoint.start());
+
+        const std::string response = Request(ConnectTcp(endpoint.getPort()), "GET /other HTTP/1.1\r\n\r\n");
+        EXPECT_THAT(response, StartsWith("HTTP/1.1 404 Not Found\r\n"));
+    }
+}
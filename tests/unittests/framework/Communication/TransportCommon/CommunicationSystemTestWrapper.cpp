@@ -14,6 +14,10 @@
 #include "impl/RamsesFrameworkConfigImpl.h"
 #include <array>
 
+#if defined(HAS_SHM_COMM)
+#include <unistd.h>
+#endif
+
 namespace ramses::internal
 {
     using namespace testing;
@@ -25,6 +29,9 @@ namespace ramses::internal
         case ECommunicationSystemType::Tcp:
             *os << "ECommunicationSystemType::Tcp";
             return;
+        case ECommunicationSystemType::SharedMemory:
+            *os << "ECommunicationSystemType::SharedMemory";
+            return;
         };
         *os << static_cast<int>(type) << " (INVALID ECommunicationSystemType)";
     }
@@ -99,6 +106,9 @@ namespace ramses::internal
         std::vector<ECommunicationSystemType> ret;
 #if defined(HAS_TCP_COMM)
         ret.push_back(ECommunicationSystemType::Tcp);
+#endif
+#if defined(HAS_SHM_COMM)
+        ret.push_back(ECommunicationSystemType::SharedMemory);
 #endif
         return ret;
     }
@@ -108,6 +118,14 @@ namespace ramses::internal
         , state(state_)
     {
         RamsesFrameworkConfigImpl config(EFeatureLevel_Latest);
+#if defined(HAS_SHM_COMM)
+        if (state.communicationSystemType == ECommunicationSystemType::SharedMemory)
+        {
+            EXPECT_TRUE(config.setConnectionSystem(EConnectionSystem::SharedMemory));
+            // separate directory per test process to not connect to participants of other tests
+            config.m_shmConfig.setSocketDirectory(fmt::format("/tmp/ramses-shm-test-{}", ::getpid()));
+        }
+#endif
 
         commSystem = CommunicationSystemFactory::ConstructCommunicationSystem(config, ParticipantIdentifier(id, name), frameworkLock, statisticCollection);
         state.knownCommunicationSystems.push_back(this);
@@ -23,6 +23,7 @@ namespace ramses::internal
     enum class ECommunicationSystemType
     {
         Tcp,
+        SharedMemory,
     };
 
     enum class EServiceType
@@ -24,7 +24,7 @@ namespace ramses::internal
     class ASceneUpdateSerialization : public ::testing::Test
     {
     public:
-        bool serialize(size_t pktSize)
+        bool serialize(size_t pktSize, uint32_t actionCompressionThreshold = 0u)
         {
             SceneUpdateSerializer sus(update, sceneStatistics);
             std::vector<std::byte> vec(pktSize);
@@ -32,7 +32,7 @@ namespace ramses::internal
                 data.push_back(vec);
                 data.back().resize(s);
                 return true;
-            });
+            }, actionCompressionThreshold);
         }
 
         void addTestActions()
@@ -134,6 +134,58 @@ namespace ramses::internal
         expectDeserializeToSame();
     }
 
+    TEST_F(ASceneUpdateSerialization, canSerializeDeserializeCompressedSceneActions)
+    {
+        for (size_t i = 0; i < 100; ++i)
+            addTestActions();
+        EXPECT_TRUE(serialize(100, 1u));
+        EXPECT_GT(data.size(), 1u);
+        expectDeserializeToSame();
+    }
+
+    TEST_F(ASceneUpdateSerialization, compressedSceneActionsUseLessPackets)
+    {
+        for (size_t i = 0; i < 100; ++i)
+            addTestActions();
+        EXPECT_TRUE(serialize(100));
+        const auto numUncompressedPackets = data.size();
+        data.clear();
+
+        EXPECT_TRUE(serialize(100, 1u));
+        EXPECT_LT(data.size(), numUncompressedPackets);
+        expectDeserializeToSame();
+    }
+
+    TEST_F(ASceneUpdateSerialization, doesNotCompressSceneActionsBelowThreshold)
+    {
+        addTestActions();
+        EXPECT_TRUE(serialize(100, 100000u));
+        expectDeserializeToSame();
+        EXPECT_EQ(0u, sceneStatistics.statSceneActionsCompressedInputSize.getCounterValue());
+        EXPECT_EQ(0u, sceneStatistics.statSceneActionsCompressedOutputSize.getCounterValue());
+    }
+
+    TEST_F(ASceneUpdateSerialization, canSerializeDeserializeCompressedSceneActionsTogetherWithResourcesAndFlushInfos)
+    {
+        for (size_t i = 0; i < 100; ++i)
+            addTestActions();
+        update.resources.push_back(CreateTestResource(1000));
+        addFlushInformation();
+        EXPECT_TRUE(serialize(400, 1u));
+        expectDeserializeToSame();
+    }
+
+    TEST_F(ASceneUpdateSerialization, updatesCompressionStatistics)
+    {
+        for (size_t i = 0; i < 100; ++i)
+            addTestActions();
+        EXPECT_TRUE(serialize(100, 1u));
+        const auto uncompressedSize = update.actions.collectionData().size() + update.actions.numberOfActions() * 2 * sizeof(uint32_t) + sizeof(uint32_t);
+        EXPECT_EQ(uncompressedSize, sceneStatistics.statSceneActionsCompressedInputSize.getCounterValue());
+        EXPECT_GT(sceneStatistics.statSceneActionsCompressedOutputSize.getCounterValue(), 0u);
+        EXPECT_LT(sceneStatistics.statSceneActionsCompressedOutputSize.getCounterValue(), uncompressedSize);
+    }
+
     TEST_F(ASceneUpdateSerialization, failsSerializeWhenPacketTooSmall)
     {
         EXPECT_FALSE(serialize(49));
@@ -209,7 +261,7 @@ namespace ramses::internal
         std::vector<std::byte> vec(60);
         EXPECT_FALSE(sus.writeToPackets({vec.data(), vec.size()}, [&](size_t) {
             return false;
-        }));
+        }, 0u));
     }
 
     TEST_F(ASceneUpdateSerialization, failsSerializeWhenWriteFunctionFailsOnLaterPacketInResource)
@@ -222,7 +274,7 @@ namespace ramses::internal
             if (++cnt == 10)
                 return false;
             return true;
-        }));
+        }, 0u));
     }
 
     TEST_F(ASceneUpdateSerialization, failsSerializeWhenWriteFunctionFailsOnLaterPacketInSceneActions)
@@ -236,7 +288,7 @@ namespace ramses::internal
             if (++cnt == 5)
                 return false;
             return true;
-        }));
+        }, 0u));
     }
 
     TEST_F(ASceneUpdateSerialization, canSerializeDeserializeSceneActionsWithoutData)
@@ -17,7 +17,7 @@ namespace ramses::internal
     class SceneUpdateSerializerMock : public ISceneUpdateSerializer
     {
     public:
-        MOCK_METHOD(bool, writeToPackets, (absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc), (const, override));
+        MOCK_METHOD(bool, writeToPackets, (absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, uint32_t actionCompressionThreshold), (const, override));
     };
 
 
@@ -30,7 +30,7 @@ namespace ramses::internal
         {
         }
 
-        bool writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) const override
+        bool writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, [[maybe_unused]] uint32_t actionCompressionThreshold) const override
         {
             EXPECT_EQ(expectedSize, packetMem.size());
             for (const auto& d : data)
@@ -56,7 +56,7 @@ namespace ramses::internal
             result.push_back(pkt);
             result.back().resize(size);
             return true;
-        });
+        }, 0u);
         assert(ok);
         (void)ok;
         assert(!result.empty());
@@ -0,0 +1,168 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Communication/TransportSHM/SHMConnectionSystem.h"
+#include "internal/Core/Utils/StatisticCollection.h"
+#include "MockConnectionStatusListener.h"
+#include "ConnectionSystemTestHelper.h"
+#include "SceneUpdateSerializerTestHelper.h"
+#include "ServiceHandlerMocks.h"
+#include "gmock/gmock.h"
+#include <unistd.h>
+
+namespace ramses::internal
+{
+    using namespace testing;
+
+    class ASHMConnectionSystem : public ::testing::Test
+    {
+    public:
+        ASHMConnectionSystem()
+            : directory(fmt::format("/tmp/ramses-shm-unittest-{}", ::getpid()))
+            , sender(createConnectionSystem(senderId, senderLock, senderStatistics))
+            , receiver(createConnectionSystem(receiverId, receiverLock, receiverStatistics))
+        {
+            ON_CALL(senderListener, newParticipantHasConnected(_)).WillByDefault(InvokeWithoutArgs([&]() { events.signal(); }));
+            ON_CALL(receiverListener, newParticipantHasConnected(_)).WillByDefault(InvokeWithoutArgs([&]() { events.signal(); }));
+            sender->getRamsesConnectionStatusUpdateNotifier().registerForConnectionUpdates(&senderListener);
+            receiver->getRamsesConnectionStatusUpdateNotifier().registerForConnectionUpdates(&receiverListener);
+            receiver->setSceneRendererServiceHandler(&rendererHandler);
+        }
+
+        ~ASHMConnectionSystem() override
+        {
+            sender->disconnectServices();
+            receiver->disconnectServices();
+            sender->getRamsesConnectionStatusUpdateNotifier().unregisterForConnectionUpdates(&senderListener);
+            receiver->getRamsesConnectionStatusUpdateNotifier().unregisterForConnectionUpdates(&receiverListener);
+            ::rmdir(directory.c_str());
+        }
+
+        std::unique_ptr<SHMConnectionSystem> createConnectionSystem(const Guid& id, PlatformLock& lock, StatisticCollectionFramework& statistics, uint32_t ringBufferSize = 1024u * 1024u)
+        {
+            return std::make_unique<SHMConnectionSystem>(ParticipantIdentifier(id, "shm"), 1u, directory, ringBufferSize, lock, statistics,
+                                                         std::chrono::milliseconds{100}, std::chrono::milliseconds{10000});
+        }
+
+        void connectBoth()
+        {
+            ASSERT_TRUE(sender->connectServices());
+            ASSERT_TRUE(receiver->connectServices());
+            ASSERT_TRUE(events.waitForEvents(2));
+        }
+
+        void expectSceneUpdatesReceived(const std::vector<std::vector<std::byte>>& packets)
+        {
+            InSequence seq;
+            for (const auto& packet : packets)
+            {
+                EXPECT_CALL(rendererHandler, handleSceneUpdate(SceneId(123), _, senderId)).WillOnce(Invoke([&, packet](const auto&, absl::Span<const std::byte> data, const auto&) {
+                    EXPECT_EQ(packet, std::vector<std::byte>(data.begin(), data.end()));
+                    events.signal();
+                }));
+            }
+        }
+
+        static std::vector<std::byte> MakePacket(size_t size, uint8_t value)
+        {
+            return std::vector<std::byte>(size, std::byte{value});
+        }
+
+        const Guid senderId{222};
+        const Guid receiverId{111};
+        const std::string directory;
+        PlatformLock senderLock;
+        PlatformLock receiverLock;
+        StatisticCollectionFramework senderStatistics;
+        StatisticCollectionFramework receiverStatistics;
+        AsyncEventCounter events;
+        NiceMock<MockConnectionStatusListener> senderListener;
+        NiceMock<MockConnectionStatusListener> receiverListener;
+        StrictMock<SceneRendererServiceHandlerMock> rendererHandler;
+        std::unique_ptr<SHMConnectionSystem> sender;
+        std::unique_ptr<SHMConnectionSystem> receiver;
+    };
+
+    TEST_F(ASHMConnectionSystem, connectsToParticipantInSameDirectory)
+    {
+        connectBoth();
+    }
+
+    TEST_F(ASHMConnectionSystem, failsToConnectWithInvalidDirectory)
+    {
+        PlatformLock lock;
+        StatisticCollectionFramework statistics;
+        SHMConnectionSystem connsys(ParticipantIdentifier(Guid(333), "shm"), 1u, "/proc/ramses/not/existing", 1024u * 1024u, lock, statistics,
+                                    std::chrono::milliseconds{100}, std::chrono::milliseconds{10000});
+        EXPECT_FALSE(connsys.connectServices());
+        EXPECT_FALSE(connsys.disconnectServices());
+    }
+
+    TEST_F(ASHMConnectionSystem, sendsSceneUpdateThroughSharedMemory)
+    {
+        connectBoth();
+
+        const std::vector<std::vector<std::byte>> packets{MakePacket(1000u, 1u), MakePacket(500000u, 2u), MakePacket(10u, 3u)};
+        expectSceneUpdatesReceived(packets);
+        {
+            PlatformGuard guard(senderLock);
+            EXPECT_TRUE(sender->sendSceneUpdate(receiverId, SceneId(123), FakseSceneUpdateSerializer(packets, 1024u * 1024u)));
+        }
+        EXPECT_TRUE(events.waitForEvents(3));
+    }
+
+    TEST_F(ASHMConnectionSystem, sendsSceneUpdateThroughSocketWhenNotFittingIntoSharedMemory)
+    {
+        sender = createConnectionSystem(senderId, senderLock, senderStatistics, 64u * 1024u);
+        sender->getRamsesConnectionStatusUpdateNotifier().registerForConnectionUpdates(&senderListener);
+        connectBoth();
+
+        const std::vector<std::vector<std::byte>> packets{MakePacket(60000u, 1u), MakePacket(100000u, 2u), MakePacket(60000u, 3u)};
+        expectSceneUpdatesReceived(packets);
+        {
+            PlatformGuard guard(senderLock);
+            EXPECT_TRUE(sender->sendSceneUpdate(receiverId, SceneId(123), FakseSceneUpdateSerializer(packets, 1024u * 1024u)));
+        }
+        EXPECT_TRUE(events.waitForEvents(3));
+    }
+
+    TEST_F(ASHMConnectionSystem, receivesOtherMessagesThroughSocket)
+    {
+        connectBoth();
+
+        StrictMock<SceneProviderServiceHandlerMock> providerHandler;
+        sender->setSceneProviderServiceHandler(&providerHandler);
+
+        EXPECT_CALL(providerHandler, handleSubscribeScene(SceneId(123), receiverId)).WillOnce(InvokeWithoutArgs([&]() { events.signal(); }));
+        {
+            PlatformGuard guard(receiverLock);
+            EXPECT_TRUE(receiver->sendSubscribeScene(senderId, SceneId(123)));
+        }
+        EXPECT_TRUE(events.waitForEvents(1));
+
+        const std::vector<std::byte> eventData{std::byte{1}, std::byte{2}, std::byte{3}};
+        EXPECT_CALL(providerHandler, handleRendererEvent(SceneId(123), eventData, receiverId)).WillOnce(InvokeWithoutArgs([&]() { events.signal(); }));
+        {
+            PlatformGuard guard(receiverLock);
+            EXPECT_TRUE(receiver->sendRendererEvent(senderId, SceneId(123), eventData));
+        }
+        EXPECT_TRUE(events.waitForEvents(1));
+
+        sender->disconnectServices();
+        sender->setSceneProviderServiceHandler(nullptr);
+    }
+
+    TEST_F(ASHMConnectionSystem, notifiesDisconnectWhenOtherParticipantDisconnects)
+    {
+        connectBoth();
+
+        EXPECT_CALL(receiverListener, participantHasDisconnected(senderId)).WillOnce(InvokeWithoutArgs([&]() { events.signal(); }));
+        sender->disconnectServices();
+        EXPECT_TRUE(events.waitForEvents(1));
+    }
+}
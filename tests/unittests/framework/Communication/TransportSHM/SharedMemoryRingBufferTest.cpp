@@ -0,0 +1,121 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Communication/TransportSHM/SharedMemoryRingBuffer.h"
+#include "gtest/gtest.h"
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace ramses::internal
+{
+    class ASharedMemoryRingBuffer : public ::testing::Test
+    {
+    public:
+        ASharedMemoryRingBuffer()
+            : producer(SharedMemoryRingBuffer::Create("ringbuffer-test", 1000u))
+            , consumer(SharedMemoryRingBuffer::Open(::dup(producer->getFileDescriptor())))
+        {
+        }
+
+        static std::vector<std::byte> MakeData(size_t size, uint8_t start)
+        {
+            std::vector<std::byte> data(size);
+            for (size_t i = 0; i < size; ++i)
+                data[i] = std::byte(static_cast<uint8_t>(start + i));
+            return data;
+        }
+
+        void writeAndExpectRead(const std::vector<std::byte>& data)
+        {
+            const auto position = producer->write(data);
+            ASSERT_TRUE(position.has_value());
+            const auto readData = consumer->read(*position, static_cast<uint32_t>(data.size()), wrapBuffer);
+            EXPECT_EQ(data, std::vector<std::byte>(readData.begin(), readData.end()));
+            consumer->release(*position, static_cast<uint32_t>(data.size()));
+        }
+
+        std::unique_ptr<SharedMemoryRingBuffer> producer;
+        std::unique_ptr<SharedMemoryRingBuffer> consumer;
+        std::vector<std::byte> wrapBuffer;
+    };
+
+    TEST_F(ASharedMemoryRingBuffer, canBeOpenedFromFileDescriptor)
+    {
+        ASSERT_TRUE(producer);
+        ASSERT_TRUE(consumer);
+        EXPECT_EQ(1000u, producer->getCapacity());
+        EXPECT_EQ(1000u, consumer->getCapacity());
+        EXPECT_EQ(0u, consumer->getUsedSize());
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, transfersDataToConsumer)
+    {
+        writeAndExpectRead(MakeData(100u, 1u));
+        writeAndExpectRead(MakeData(300u, 2u));
+        EXPECT_EQ(0u, producer->getUsedSize());
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, transfersDataWrappingAroundEnd)
+    {
+        writeAndExpectRead(MakeData(700u, 1u));
+        EXPECT_TRUE(wrapBuffer.empty());
+        writeAndExpectRead(MakeData(600u, 2u));
+        EXPECT_EQ(600u, wrapBuffer.size());
+        writeAndExpectRead(MakeData(1000u, 3u));
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, failsToWriteWhenConsumerDidNotReleaseEnough)
+    {
+        const auto pos1 = producer->write(MakeData(600u, 1u));
+        ASSERT_TRUE(pos1.has_value());
+        EXPECT_FALSE(producer->write(MakeData(401u, 2u)).has_value());
+        EXPECT_EQ(600u, consumer->getUsedSize());
+
+        const auto pos2 = producer->write(MakeData(400u, 2u));
+        ASSERT_TRUE(pos2.has_value());
+        EXPECT_FALSE(producer->write(MakeData(1u, 3u)).has_value());
+
+        EXPECT_FALSE(consumer->read(*pos1, 600u, wrapBuffer).empty());
+        consumer->release(*pos1, 600u);
+        EXPECT_TRUE(producer->write(MakeData(600u, 3u)).has_value());
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, rejectsReadOfUnexpectedBlock)
+    {
+        const auto pos1 = producer->write(MakeData(100u, 1u));
+        const auto pos2 = producer->write(MakeData(100u, 2u));
+        ASSERT_TRUE(pos1.has_value());
+        ASSERT_TRUE(pos2.has_value());
+
+        // out of order, beyond written data, empty or larger than capacity
+        EXPECT_TRUE(consumer->read(*pos2, 100u, wrapBuffer).empty());
+        EXPECT_TRUE(consumer->read(*pos1, 201u, wrapBuffer).empty());
+        EXPECT_TRUE(consumer->read(*pos1, 0u, wrapBuffer).empty());
+        EXPECT_TRUE(consumer->read(*pos1, 2000u, wrapBuffer).empty());
+
+        EXPECT_FALSE(consumer->read(*pos1, 100u, wrapBuffer).empty());
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, failsToCreateWithZeroCapacity)
+    {
+        EXPECT_FALSE(SharedMemoryRingBuffer::Create("ringbuffer-test", 0u));
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, failsToOpenUnsealedMemory)
+    {
+        const int fd = ::memfd_create("ringbuffer-test-unsealed", MFD_CLOEXEC);
+        ASSERT_GE(fd, 0);
+        ASSERT_EQ(0, ::ftruncate(fd, 4096));
+        EXPECT_FALSE(SharedMemoryRingBuffer::Open(fd));
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, failsToOpenInvalidFileDescriptor)
+    {
+        EXPECT_FALSE(SharedMemoryRingBuffer::Open(-1));
+    }
+}
@@ -7,11 +7,16 @@
 //  -------------------------------------------------------------------------
 
 #include "internal/Communication/TransportTCP/TCPConnectionSystem.h"
+#include "internal/Communication/TransportCommon/ISceneUpdateSerializer.h"
 #include "internal/Core/Utils/StatisticCollection.h"
 #include "internal/Core/Utils/ThreadBarrier.h"
 #include "ScopedConsoleLogDisable.h"
+#include "ServiceHandlerMocks.h"
 #include "CommunicationSystemTest.h"
 #include "gtest/gtest.h"
+#include <algorithm>
+#include <numeric>
+#include <string>
 #include <thread>
 
 namespace ramses::internal
@@ -103,6 +108,33 @@ namespace ramses::internal
     {
     };
 
+    // writes packets of given sizes, each filled with its index
+    class PacketSequenceSerializer : public ISceneUpdateSerializer
+    {
+    public:
+        PacketSequenceSerializer(std::vector<size_t> packetSizes, uint8_t firstIndex)
+            : m_packetSizes(std::move(packetSizes))
+            , m_firstIndex(firstIndex)
+        {
+        }
+
+        bool writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, uint32_t /*actionCompressionThreshold*/) const override
+        {
+            auto index = m_firstIndex;
+            for (const auto size : m_packetSizes)
+            {
+                std::fill_n(packetMem.begin(), size, std::byte{ index++ });
+                if (!writeDoneFunc(size))
+                    return false;
+            }
+            return true;
+        }
+
+    private:
+        std::vector<size_t> m_packetSizes;
+        uint8_t m_firstIndex;
+    };
+
     INSTANTIATE_TEST_SUITE_P(TypedCommunicationTest, ACommunicationSystemWithDaemon_TCP, ::testing::Combine(::testing::Values(ECommunicationSystemType::Tcp), ::testing::Values(EServiceType::Ramses)));
 
     TEST_P(ACommunicationSystemWithDaemon_TCP, canEstablishConnectionToNewParticipantWithSameGuid)
@@ -171,4 +203,132 @@ namespace ramses::internal
         csw2->commSystem->disconnectServices();
         ASSERT_TRUE(state->event.waitForEvents(2));
     }
+
+    TEST_P(ACommunicationSystemWithDaemon_TCP, keepsOrderOfSceneUpdatesOfSameSceneSentInBulkAndSceneLane)
+    {
+        auto sender = std::make_unique<CommunicationSystemTestWrapper>(*state, "sender");
+        auto receiver = std::make_unique<CommunicationSystemTestWrapper>(*state, "receiver");
+        state->connectAll();
+        ASSERT_TRUE(state->blockOnAllConnected());
+
+        StrictMock<SceneRendererServiceHandlerMock> handler;
+        receiver->commSystem->setSceneRendererServiceHandler(&handler);
+
+        const SceneId sceneId{ 12u };
+        std::vector<uint8_t> receivedPackets;
+        {
+            PlatformGuard g(receiver->frameworkLock);
+            EXPECT_CALL(handler, handleSceneUpdate(sceneId, _, sender->id)).Times(4).WillRepeatedly(Invoke([&](const auto& /*sceneId*/, absl::Span<const std::byte> data, const auto& /*providerID*/) {
+                receivedPackets.push_back(static_cast<uint8_t>(data.front()));
+                state->sendEvent();
+            }));
+        }
+
+        // large update is sent in bulk lane, following small update of same scene must not overtake it
+        EXPECT_TRUE(sender->commSystem->sendSceneUpdate(receiver->id, sceneId, PacketSequenceSerializer({ 200000u, 200000u, 10u }, 0u)));
+        EXPECT_TRUE(sender->commSystem->sendSceneUpdate(receiver->id, sceneId, PacketSequenceSerializer({ 10u }, 3u)));
+        ASSERT_TRUE(state->event.waitForEvents(4));
+
+        {
+            PlatformGuard g(receiver->frameworkLock);
+            EXPECT_EQ((std::vector<uint8_t>{ 0u, 1u, 2u, 3u }), receivedPackets);
+        }
+        EXPECT_LT(0u, sender->statisticCollection.statSendQueueMaxDepth[ESendLaneStatisticIndex_Bulk].getCounterValue());
+
+        state->disconnectAll();
+    }
+
+    TEST_P(ACommunicationSystemWithDaemon_TCP, deliversSmallSceneUpdateOfOtherSceneWhileBulkPacketsOfLargeSceneUpdateAreQueued)
+    {
+        auto sender = std::make_unique<CommunicationSystemTestWrapper>(*state, "sender");
+        auto receiver = std::make_unique<CommunicationSystemTestWrapper>(*state, "receiver");
+        state->connectAll();
+        ASSERT_TRUE(state->blockOnAllConnected());
+
+        StrictMock<SceneRendererServiceHandlerMock> handler;
+        receiver->commSystem->setSceneRendererServiceHandler(&handler);
+
+        const SceneId largeSceneId{ 12u };
+        const SceneId smallSceneId{ 13u };
+        constexpr uint8_t numLargePackets = 8u;
+        std::vector<uint8_t> receivedPackets;
+        {
+            PlatformGuard g(receiver->frameworkLock);
+            const auto recordPacket = [&](const auto& /*sceneId*/, absl::Span<const std::byte> data, const auto& /*providerID*/) {
+                receivedPackets.push_back(static_cast<uint8_t>(data.front()));
+                state->sendEvent();
+            };
+            EXPECT_CALL(handler, handleSceneUpdate(largeSceneId, _, sender->id)).Times(numLargePackets).WillRepeatedly(Invoke(recordPacket));
+            EXPECT_CALL(handler, handleSceneUpdate(smallSceneId, _, sender->id)).WillOnce(Invoke(recordPacket));
+        }
+
+        // large update is queued in bulk lane, small update of other scene in scene lane. Whether it overtakes the bulk packets
+        // depends on how fast they are sent, lane selection is tested in TCPSendLanesTest
+        EXPECT_TRUE(sender->commSystem->sendSceneUpdate(receiver->id, largeSceneId, PacketSequenceSerializer(std::vector<size_t>(numLargePackets, 200000u), 0u)));
+        EXPECT_TRUE(sender->commSystem->sendSceneUpdate(receiver->id, smallSceneId, PacketSequenceSerializer({ 10u }, 100u)));
+        ASSERT_TRUE(state->event.waitForEvents(numLargePackets + 1u));
+
+        {
+            PlatformGuard g(receiver->frameworkLock);
+            const auto smallUpdateIt = std::find(receivedPackets.cbegin(), receivedPackets.cend(), 100u);
+            ASSERT_NE(receivedPackets.cend(), smallUpdateIt);
+
+            // packets of large update keep their order
+            receivedPackets.erase(smallUpdateIt);
+            std::vector<uint8_t> expectedLargePackets(numLargePackets);
+            std::iota(expectedLargePackets.begin(), expectedLargePackets.end(), uint8_t{ 0u });
+            EXPECT_EQ(expectedLargePackets, receivedPackets);
+        }
+
+        state->disconnectAll();
+    }
+
+    TEST_P(ACommunicationSystemWithDaemon_TCP, doesNotSendPublishAndUnpublishBeforeQueuedBulkPackets)
+    {
+        auto sender = std::make_unique<CommunicationSystemTestWrapper>(*state, "sender");
+        auto receiver = std::make_unique<CommunicationSystemTestWrapper>(*state, "receiver");
+        state->connectAll();
+        ASSERT_TRUE(state->blockOnAllConnected());
+
+        StrictMock<SceneRendererServiceHandlerMock> handler;
+        receiver->commSystem->setSceneRendererServiceHandler(&handler);
+
+        const SceneId sceneId{ 12u };
+        const SceneInfoVector otherScene{ SceneInfo(SceneId{ 13u }, "other") };
+        constexpr uint8_t numPackets = 8u;
+        std::vector<std::string> receivedMessages;
+        {
+            PlatformGuard g(receiver->frameworkLock);
+            EXPECT_CALL(handler, handleSceneUpdate(sceneId, _, sender->id)).Times(numPackets).WillRepeatedly(Invoke([&](const auto& /*sceneId*/, absl::Span<const std::byte> data, const auto& /*providerID*/) {
+                receivedMessages.push_back("update" + std::to_string(static_cast<int>(data.front())));
+                state->sendEvent();
+            }));
+            EXPECT_CALL(handler, handleNewScenesAvailable(otherScene, sender->id, _)).WillOnce(Invoke([&](const auto& /*scenes*/, const auto& /*providerID*/, auto /*featureLevel*/) {
+                receivedMessages.emplace_back("publish");
+                state->sendEvent();
+            }));
+            EXPECT_CALL(handler, handleScenesBecameUnavailable(otherScene, sender->id)).WillOnce(Invoke([&](const auto& /*scenes*/, const auto& /*providerID*/) {
+                receivedMessages.emplace_back("unpublish");
+                state->sendEvent();
+            }));
+        }
+
+        // publish and unpublish may refer to scenes whose messages are in bulk lane, they are queued there while it is not empty
+        EXPECT_TRUE(sender->commSystem->sendSceneUpdate(receiver->id, sceneId, PacketSequenceSerializer(std::vector<size_t>(numPackets, 200000u), 0u)));
+        EXPECT_TRUE(sender->commSystem->broadcastNewScenesAvailable(otherScene, EFeatureLevel_Latest));
+        EXPECT_TRUE(sender->commSystem->broadcastScenesBecameUnavailable(otherScene));
+        ASSERT_TRUE(state->event.waitForEvents(numPackets + 2u));
+
+        {
+            PlatformGuard g(receiver->frameworkLock);
+            std::vector<std::string> expectedMessages;
+            for (int i = 0; i < numPackets; ++i)
+                expectedMessages.push_back("update" + std::to_string(i));
+            expectedMessages.emplace_back("publish");
+            expectedMessages.emplace_back("unpublish");
+            EXPECT_EQ(expectedMessages, receivedMessages);
+        }
+
+        state->disconnectAll();
+    }
 }
@@ -0,0 +1,114 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Communication/TransportTCP/TCPSendLanes.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace ramses::internal
+{
+    class ATCPSendLanes : public ::testing::Test
+    {
+    public:
+        struct TestMessage
+        {
+            EMessageId messageType;
+            SceneId sceneId;
+            bool isBulkData = false;
+            uint32_t index = 0u;
+        };
+
+    protected:
+        ESendLaneStatisticIndex push(EMessageId messageType, SceneId sceneId, bool isBulkData, uint32_t index)
+        {
+            return lanes.push({ messageType, sceneId, isBulkData, index });
+        }
+
+        // indices of messages in the order they are sent
+        std::vector<uint32_t> popAll()
+        {
+            std::vector<uint32_t> sentIndices;
+            while (const auto lane = lanes.getNextLane())
+                sentIndices.push_back(lanes.pop(*lane).msg.index);
+            EXPECT_TRUE(lanes.empty());
+            return sentIndices;
+        }
+
+        TCPSendLanes<TestMessage> lanes;
+        const SceneId largeScene{ 12u };
+        const SceneId smallScene{ 13u };
+    };
+
+    TEST_F(ATCPSendLanes, isEmptyInitially)
+    {
+        EXPECT_TRUE(lanes.empty());
+        EXPECT_FALSE(lanes.getNextLane().has_value());
+    }
+
+    TEST_F(ATCPSendLanes, queuesMessagesNotBelongingToScenesInControlLane)
+    {
+        EXPECT_EQ(ESendLaneStatisticIndex_Control, push(EMessageId::Alive, {}, false, 0u));
+        EXPECT_EQ(ESendLaneStatisticIndex_Control, push(EMessageId::SubscribeScene, largeScene, false, 1u));
+        EXPECT_EQ(ESendLaneStatisticIndex_Control, push(EMessageId::RendererEvent, largeScene, false, 2u));
+        EXPECT_EQ(3u, lanes.size(ESendLaneStatisticIndex_Control));
+    }
+
+    TEST_F(ATCPSendLanes, queuesBulkPacketsInBulkLaneAndSmallSceneUpdatesInSceneLane)
+    {
+        EXPECT_EQ(ESendLaneStatisticIndex_Bulk, push(EMessageId::SendSceneUpdate, largeScene, true, 0u));
+        EXPECT_EQ(ESendLaneStatisticIndex_Scene, push(EMessageId::CreateScene, smallScene, false, 1u));
+        EXPECT_EQ(ESendLaneStatisticIndex_Scene, push(EMessageId::SendSceneUpdate, smallScene, false, 2u));
+    }
+
+    TEST_F(ATCPSendLanes, sendsSmallSceneUpdateOfOtherSceneBeforeQueuedBulkPacketsOfLargeSceneUpdate)
+    {
+        for (uint32_t i = 0u; i < 8u; ++i)
+            EXPECT_EQ(ESendLaneStatisticIndex_Bulk, push(EMessageId::SendSceneUpdate, largeScene, true, i));
+        EXPECT_EQ(ESendLaneStatisticIndex_Scene, push(EMessageId::SendSceneUpdate, smallScene, false, 100u));
+        EXPECT_EQ(ESendLaneStatisticIndex_Control, push(EMessageId::Alive, {}, false, 200u));
+
+        EXPECT_EQ((std::vector<uint32_t>{ 200u, 100u, 0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u }), popAll());
+    }
+
+    TEST_F(ATCPSendLanes, queuesMessagesOfSceneWithQueuedBulkPacketsBehindThem)
+    {
+        push(EMessageId::SendSceneUpdate, largeScene, true, 0u);
+        push(EMessageId::SendSceneUpdate, largeScene, true, 1u);
+        EXPECT_EQ(ESendLaneStatisticIndex_Bulk, push(EMessageId::SendSceneUpdate, largeScene, false, 2u));
+        EXPECT_EQ(ESendLaneStatisticIndex_Bulk, push(EMessageId::CreateScene, largeScene, false, 3u));
+        EXPECT_EQ(ESendLaneStatisticIndex_Scene, push(EMessageId::SendSceneUpdate, smallScene, false, 4u));
+
+        EXPECT_EQ((std::vector<uint32_t>{ 4u, 0u, 1u, 2u, 3u }), popAll());
+    }
+
+    TEST_F(ATCPSendLanes, queuesSmallSceneUpdateInSceneLaneAgainOnceBulkPacketsOfSceneAreSent)
+    {
+        push(EMessageId::SendSceneUpdate, largeScene, true, 0u);
+        push(EMessageId::SendSceneUpdate, largeScene, false, 1u);
+        EXPECT_EQ(2u, lanes.size(ESendLaneStatisticIndex_Bulk));
+
+        EXPECT_EQ(0u, lanes.pop(ESendLaneStatisticIndex_Bulk).msg.index);
+        EXPECT_EQ(ESendLaneStatisticIndex_Bulk, push(EMessageId::SendSceneUpdate, largeScene, false, 2u));
+
+        EXPECT_EQ(1u, lanes.pop(ESendLaneStatisticIndex_Bulk).msg.index);
+        EXPECT_EQ(2u, lanes.pop(ESendLaneStatisticIndex_Bulk).msg.index);
+        EXPECT_EQ(ESendLaneStatisticIndex_Scene, push(EMessageId::SendSceneUpdate, largeScene, false, 3u));
+    }
+
+    TEST_F(ATCPSendLanes, queuesPublishAndUnpublishBehindQueuedBulkPackets)
+    {
+        EXPECT_EQ(ESendLaneStatisticIndex_Scene, push(EMessageId::PublishScene, {}, false, 0u));
+
+        push(EMessageId::SendSceneUpdate, largeScene, true, 1u);
+        EXPECT_EQ(ESendLaneStatisticIndex_Bulk, push(EMessageId::PublishScene, {}, false, 2u));
+        EXPECT_EQ(ESendLaneStatisticIndex_Bulk, push(EMessageId::UnpublishScene, {}, false, 3u));
+
+        EXPECT_EQ((std::vector<uint32_t>{ 0u, 1u, 2u, 3u }), popAll());
+    }
+}
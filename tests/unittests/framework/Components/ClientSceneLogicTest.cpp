@@ -257,6 +257,26 @@ public:
     AClientSceneLogic_Direct() = default;
 };
 
+class AClientSceneLogic_DirectRemote : public AClientSceneLogic_Direct
+{
+public:
+    AClientSceneLogic_DirectRemote() = default;
+
+protected:
+    void expectSceneSendTo(const std::vector<Guid>& subscribers, SceneWithExplicitMemory& sceneOfSubscribers)
+    {
+        for (const auto& subscriber : subscribers)
+            EXPECT_CALL(m_sceneGraphProviderComponent, sendCreateScene(subscriber, m_sceneId, EScenePublicationMode::LocalAndRemote));
+        EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneUpdate_rvr(subscribers, _, m_sceneId, EScenePublicationMode::LocalAndRemote, _))
+            .WillOnce([&sceneOfSubscribers](const auto& /*unused*/, const SceneUpdate& update, auto /*unused*/, auto /*unused*/, auto& /*unused*/)
+            {
+                EXPECT_TRUE(update.flushInfos.hasSizeInfo);
+                sceneOfSubscribers.preallocateSceneSize(update.flushInfos.sizeInfo);
+                SceneActionApplier::ApplyActionsOnScene(sceneOfSubscribers, update.actions);
+            });
+    }
+};
+
 using ClientSceneLogicTypes = ::testing::Types<ClientSceneLogicShadowCopy, ClientSceneLogicDirect>;
 TYPED_TEST_SUITE(AClientSceneLogic_All, ClientSceneLogicTypes);
 
@@ -1601,6 +1621,67 @@ TEST_F(AClientSceneLogic_Direct, doesSendSceneAfterFlushToLateSubscribers)
     this->unpublish();
 }
 
+TEST_F(AClientSceneLogic_DirectRemote, keepsNoSnapshotWhileNoSubscriberIsWaiting)
+{
+    publish();
+
+    m_scene.allocateNode(0, NodeHandle(0u));
+    flush();
+    m_scene.allocateNode(0, NodeHandle(1u));
+    flush();
+
+    // nothing was recorded at the flushes, so a new subscriber can't be sent anything before the next flush
+    addSubscriber();
+    Mock::VerifyAndClearExpectations(&m_sceneGraphProviderComponent);
+
+    m_scene.allocateNode(0, NodeHandle(2u));
+    SceneWithExplicitMemory sceneOfSubscriber{ SceneInfo(m_sceneId) };
+    expectSceneSendTo({ m_rendererID }, sceneOfSubscriber);
+    flush();
+    Mock::VerifyAndClearExpectations(&m_sceneGraphProviderComponent);
+
+    // scene as of the flush the subscriber waited for
+    EXPECT_TRUE(sceneOfSubscriber.isNodeAllocated(NodeHandle(0u)));
+    EXPECT_TRUE(sceneOfSubscriber.isNodeAllocated(NodeHandle(1u)));
+    EXPECT_TRUE(sceneOfSubscriber.isNodeAllocated(NodeHandle(2u)));
+
+    // no subscriber waiting anymore, following flushes only send their own changes
+    m_scene.allocateNode(0, NodeHandle(3u));
+    EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ m_rendererID }, _, m_sceneId, _, _))
+        .WillOnce([&sceneOfSubscriber](const auto& /*unused*/, const SceneUpdate& update, auto /*unused*/, auto /*unused*/, auto& /*unused*/)
+        {
+            SceneActionApplier::ApplyActionsOnScene(sceneOfSubscriber, update.actions);
+        });
+    flush();
+    Mock::VerifyAndClearExpectations(&m_sceneGraphProviderComponent);
+    EXPECT_TRUE(sceneOfSubscriber.isNodeAllocated(NodeHandle(3u)));
+
+    unpublish();
+}
+
+TEST_F(AClientSceneLogic_DirectRemote, describesSceneOnceForAllSubscribersWaitingAtFlush)
+{
+    publish();
+    m_scene.allocateNode(0, NodeHandle(0u));
+    flush();
+
+    const Guid otherRendererID(1338);
+    addSubscriber();
+    m_sceneLogic.addSubscriber(otherRendererID);
+    Mock::VerifyAndClearExpectations(&m_sceneGraphProviderComponent);
+
+    SceneWithExplicitMemory sceneOfSubscribers{ SceneInfo(m_sceneId) };
+    expectSceneSendTo({ m_rendererID, otherRendererID }, sceneOfSubscribers);
+    flush();
+    Mock::VerifyAndClearExpectations(&m_sceneGraphProviderComponent);
+    EXPECT_TRUE(sceneOfSubscribers.isNodeAllocated(NodeHandle(0u)));
+
+    // nothing is sent while no changes are flushed and no subscriber is waiting
+    flush();
+
+    unpublish();
+}
+
 TEST_F(AClientSceneLogic_ShadowCopy, sceneActionsAreNotModifiedWhenLastRendererUnsubscribed)
 {
     this->publishAndAddSubscriberWithoutPendingActions();
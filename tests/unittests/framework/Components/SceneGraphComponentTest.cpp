@@ -1267,6 +1267,40 @@ TEST_F(ASceneGraphComponent, returnsFalseForFlushOnWrongResolvedResourceNumber_D
     EXPECT_FALSE(sceneGraphComponent.handleFlush(sceneId, {}, {}));
 }
 
+TEST_F(ASceneGraphComponent, sendsSceneToLateRemoteSubscriberWithNextFlush_Direct)
+{
+    SceneInfo sceneInfo(SceneInfo(SceneId(1), "foo"));
+    ClientScene scene(sceneInfo);
+
+    sceneGraphComponent.setSceneRendererHandler(&consumer);
+    sceneGraphComponent.handleCreateScene(scene, true, eventConsumer);
+
+    EXPECT_CALL(consumer, handleNewSceneAvailable(sceneInfo, _));
+    EXPECT_CALL(communicationSystem, broadcastNewScenesAvailable(SceneInfoVector{ sceneInfo }, ramses::EFeatureLevel_Latest));
+    sceneGraphComponent.handlePublishScene(SceneId(1), EScenePublicationMode::LocalAndRemote);
+
+    scene.allocateNode(0, {});
+    EXPECT_TRUE(sceneGraphComponent.handleFlush(SceneId(1), {}, {}));
+
+    EXPECT_CALL(communicationSystem, sendScenesAvailable(remoteParticipantID, SceneInfoVector{ sceneInfo }, ramses::EFeatureLevel_Latest));
+    sceneGraphComponent.newParticipantHasConnected(remoteParticipantID);
+
+    // no copy of the scene is kept, subscriber waits for next flush
+    sceneGraphComponent.handleSubscribeScene(SceneId(1), remoteParticipantID);
+    Mock::VerifyAndClearExpectations(&communicationSystem);
+
+    scene.allocateNode(0, {});
+    EXPECT_CALL(communicationSystem, sendInitializeScene(remoteParticipantID, SceneId(1)));
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, SceneId(1), _));
+    EXPECT_TRUE(sceneGraphComponent.handleFlush(SceneId(1), {}, {}));
+    Mock::VerifyAndClearExpectations(&communicationSystem);
+
+    // cleanup
+    EXPECT_CALL(communicationSystem, broadcastScenesBecameUnavailable(SceneInfoVector{ sceneInfo }));
+    EXPECT_CALL(consumer, handleSceneBecameUnavailable(sceneInfo.sceneID, _));
+    sceneGraphComponent.handleRemoveScene(SceneId(1));
+}
+
 TEST_F(ASceneGraphComponent, sendSceneUpdatePassesSceneStatisticsToSerializer)
 {
     SceneId sceneId;
@@ -0,0 +1,77 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/TaskFramework/ParallelTaskGroup.h"
+#include "internal/Core/TaskFramework/ThreadedTaskExecutor.h"
+#include "gtest/gtest.h"
+#include <atomic>
+
+namespace ramses::internal
+{
+    class AParallelTaskGroup : public ::testing::Test
+    {
+    protected:
+        static void AddJobs(ParallelTaskGroup& group, std::vector<uint32_t>& results)
+        {
+            for (size_t i = 0u; i < results.size(); ++i)
+                group.add([&results, i]() { results[i] = static_cast<uint32_t>(i) * 2u; });
+        }
+
+        static void ExpectResults(const std::vector<uint32_t>& results)
+        {
+            for (size_t i = 0u; i < results.size(); ++i)
+                EXPECT_EQ(static_cast<uint32_t>(i) * 2u, results[i]);
+        }
+    };
+
+    TEST_F(AParallelTaskGroup, executesAllJobsOnCallingThreadWithoutQueue)
+    {
+        std::vector<uint32_t> results(10u, 0u);
+        ParallelTaskGroup group(nullptr);
+        AddJobs(group, results);
+        group.execute();
+        ExpectResults(results);
+    }
+
+    TEST_F(AParallelTaskGroup, executesAllJobsUsingThreadPool)
+    {
+        ThreadedTaskExecutor executor(3u);
+        std::vector<uint32_t> results(100u, 0u);
+        ParallelTaskGroup group(&executor);
+        AddJobs(group, results);
+        group.execute();
+        ExpectResults(results);
+    }
+
+    TEST_F(AParallelTaskGroup, canBeExecutedWithoutJobs)
+    {
+        ThreadedTaskExecutor executor(1u);
+        ParallelTaskGroup group(&executor);
+        group.execute();
+    }
+
+    TEST_F(AParallelTaskGroup, doesNotBlockWhenWaitingFromWithinTaskOfSameSingleThreadedQueue)
+    {
+        ThreadedTaskExecutor executor(1u);
+        std::atomic<uint32_t> innerJobsExecuted{0u};
+        std::vector<uint32_t> results(4u, 0u);
+
+        ParallelTaskGroup outerGroup(&executor);
+        outerGroup.add([&]() {
+            ParallelTaskGroup innerGroup(&executor);
+            for (uint32_t i = 0u; i < 5u; ++i)
+                innerGroup.add([&]() { ++innerJobsExecuted; });
+            innerGroup.execute();
+        });
+        AddJobs(outerGroup, results);
+        outerGroup.execute();
+
+        EXPECT_EQ(5u, innerJobsExecuted);
+        ExpectResults(results);
+    }
+}
@@ -0,0 +1,130 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+#include "internal/Core/Utils/MetricsRegistry.h"
+#include "internal/Core/Utils/MetricsWriter.h"
+#include "internal/Core/Utils/MetricHistogram.h"
+#include "internal/Core/Utils/StatisticCollection.h"
+
+using namespace testing;
+
+namespace ramses::internal
+{
+    class TestMetricsSource : public IMetricsSource
+    {
+    public:
+        void writeMetrics(MetricsWriter& writer) const override
+        {
+            writer.addGauge("test_gauge", "A test gauge", { { "source", "test" } }, 1.5);
+        }
+    };
+
+    class AMetricsRegistry : public testing::Test
+    {
+    protected:
+        StatisticCollectionFramework frameworkStatistics;
+        MetricsRegistry registry{ frameworkStatistics };
+    };
+
+    TEST(AMetricHistogram, sortsValuesIntoBucketsByUpperBound)
+    {
+        MetricHistogram histogram({ 10u, 20u });
+        histogram.observe(0u);
+        histogram.observe(10u);
+        histogram.observe(11u);
+        histogram.observe(21u);
+        histogram.observe(1000u);
+
+        ASSERT_EQ(3u, histogram.getNumberOfBuckets());
+        EXPECT_EQ(2u, histogram.getBucketCount(0u));
+        EXPECT_EQ(1u, histogram.getBucketCount(1u));
+        EXPECT_EQ(2u, histogram.getBucketCount(2u));
+        EXPECT_EQ(5u, histogram.getCount());
+        EXPECT_EQ(1042u, histogram.getSum());
+    }
+
+    TEST(AMetricsWriter, writesCountersAndGaugesGroupedByName)
+    {
+        MetricsWriter writer;
+        writer.addCounter("b_total", "Counter b", { { "scene", "1" } }, 5u);
+        writer.addGauge("a", "Gauge a", {}, 0.5);
+        writer.addCounter("b_total", "Counter b", { { "scene", "2" } }, 7u);
+
+        EXPECT_EQ("# HELP a Gauge a\n"
+                  "# TYPE a gauge\n"
+                  "a 0.5\n"
+                  "# HELP b_total Counter b\n"
+                  "# TYPE b_total counter\n"
+                  "b_total{scene=\"1\"} 5\n"
+                  "b_total{scene=\"2\"} 7\n",
+                  writer.toPrometheusText());
+    }
+
+    TEST(AMetricsWriter, writesCumulativeHistogramBuckets)
+    {
+        MetricHistogram histogram({ 10u, 20u });
+        histogram.observe(5u);
+        histogram.observe(15u);
+        histogram.observe(25u);
+
+        MetricsWriter writer;
+        writer.addHistogram("h", "Histogram h", { { "display", "0" } }, histogram);
+
+        EXPECT_EQ("# HELP h Histogram h\n"
+                  "# TYPE h histogram\n"
+                  "h_bucket{display=\"0\",le=\"10\"} 1\n"
+                  "h_bucket{display=\"0\",le=\"20\"} 2\n"
+                  "h_bucket{display=\"0\",le=\"+Inf\"} 3\n"
+                  "h_sum{display=\"0\"} 45\n"
+                  "h_count{display=\"0\"} 3\n",
+                  writer.toPrometheusText());
+    }
+
+    TEST(AMetricsWriter, escapesLabelValues)
+    {
+        MetricsWriter writer;
+        writer.addCounter("c", "Counter", { { "name", "a\"b\\c\nd" } }, 1u);
+        EXPECT_THAT(writer.toPrometheusText(), HasSubstr("c{name=\"a\\\"b\\\\c\\nd\"} 1\n"));
+    }
+
+    TEST_F(AMetricsRegistry, exportsTotalsOfFrameworkStatistics)
+    {
+        frameworkStatistics.statMessagesSent.incCounter(3u);
+        frameworkStatistics.nextTimeInterval();
+        frameworkStatistics.statMessagesSent.incCounter(2u);
+        frameworkStatistics.statResourcesCreated.incCounter(4u);
+        frameworkStatistics.statResourcesDestroyed.incCounter(1u);
+
+        const std::string text = registry.collectPrometheusText();
+        EXPECT_THAT(text, HasSubstr("\nramses_framework_messages_sent_total 5\n"));
+        EXPECT_THAT(text, HasSubstr("\nramses_framework_resources 3\n"));
+    }
+
+    TEST_F(AMetricsRegistry, exportsRegisteredSceneStatisticsUntilRemoved)
+    {
+        StatisticCollectionScene sceneStatistics;
+        sceneStatistics.statFlushesTriggered.incCounter(2u);
+
+        registry.registerStatisticCollectionScene(SceneId{ 12u }, sceneStatistics);
+        EXPECT_THAT(registry.collectPrometheusText(), HasSubstr("\nramses_scene_flushes_total{scene=\"12\"} 2\n"));
+
+        registry.removeStatisticCollectionScene(SceneId{ 12u });
+        EXPECT_THAT(registry.collectPrometheusText(), Not(HasSubstr("ramses_scene_flushes_total")));
+    }
+
+    TEST_F(AMetricsRegistry, exportsRegisteredMetricsSourcesUntilRemoved)
+    {
+        TestMetricsSource source;
+        registry.registerMetricsSource(&source);
+        EXPECT_THAT(registry.collectPrometheusText(), HasSubstr("# TYPE test_gauge gauge\ntest_gauge{source=\"test\"} 1.5\n"));
+
+        registry.removeMetricsSource(&source);
+        EXPECT_THAT(registry.collectPrometheusText(), Not(HasSubstr("test_gauge")));
+    }
+}
@@ -218,4 +218,17 @@ namespace ramses::internal
 
         EXPECT_EQ(array, summary.array);
     }
+
+    TEST_F(StatisticCollectionTest, totalValueKeepsAllIncrementsAcrossTimeIntervalsAndReset)
+    {
+        m_statisticCollection.statMessagesSent.incCounter(3);
+        m_statisticCollection.nextTimeInterval();
+        m_statisticCollection.statMessagesSent.incCounter(2);
+        m_statisticCollection.reset();
+        m_statisticCollection.statMessagesSent.incCounter(1);
+        m_statisticCollection.statMessagesSent.setCounterValue(10);
+
+        EXPECT_EQ(10u, m_statisticCollection.statMessagesSent.getCounterValue());
+        EXPECT_EQ(6u, m_statisticCollection.statMessagesSent.getTotalValue());
+    }
 }
@@ -69,4 +69,40 @@ namespace ramses::internal
         std::generate(big.begin(), big.end(), [](){ static uint8_t i{4}; return std::byte(++i); });
         checkCompressionDecompression(big);
     }
+
+    TEST(LZ4CompressionUtilsTest, TestRawDataCompressionDecompression)
+    {
+        std::vector<std::byte> input(1024 * 16);
+        std::generate(input.begin(), input.end(), [](){ static uint8_t i{4}; return std::byte(++i % 16); });
+
+        for (auto level : { LZ4CompressionUtils::CompressionLevel::Fast,
+                            LZ4CompressionUtils::CompressionLevel::High })
+        {
+            std::vector<std::byte> compressed;
+            ASSERT_TRUE(LZ4CompressionUtils::compress(input, compressed, level));
+            EXPECT_GT(compressed.size(), 0u);
+            EXPECT_LT(compressed.size(), input.size());
+
+            std::vector<std::byte> output(input.size());
+            ASSERT_TRUE(LZ4CompressionUtils::decompress(compressed, absl::MakeSpan(output)));
+            EXPECT_EQ(input, output);
+        }
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestRawDataFailsForEmptyInput)
+    {
+        std::vector<std::byte> compressed;
+        EXPECT_FALSE(LZ4CompressionUtils::compress({}, compressed, LZ4CompressionUtils::CompressionLevel::Fast));
+        std::vector<std::byte> output(10);
+        EXPECT_FALSE(LZ4CompressionUtils::decompress({}, absl::MakeSpan(output)));
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestRawDataDecompressionFailsForWrongSize)
+    {
+        std::vector<std::byte> input(1024, std::byte{7});
+        std::vector<std::byte> compressed;
+        ASSERT_TRUE(LZ4CompressionUtils::compress(input, compressed, LZ4CompressionUtils::CompressionLevel::Fast));
+        std::vector<std::byte> output(input.size() + 1);
+        EXPECT_FALSE(LZ4CompressionUtils::decompress(compressed, absl::MakeSpan(output)));
+    }
 }
@@ -10,6 +10,8 @@
 #include "internal/SceneGraph/Scene/ResourceChangeCollectingScene.h"
 #include "internal/SceneGraph/SceneUtils/ResourceUtils.h"
 
+#include <algorithm>
+
 namespace ramses::internal
 {
     class AResourceChangeCollectingScene : public testing::Test
@@ -74,6 +76,28 @@ namespace ramses::internal
             EXPECT_EQ(expectedSceneResourcesByteSize, fromSceneSceneResourcesByteSize);
         }
 
+        void expectResourcesInUse(ResourceContentHashVector expectedResources, const ResourceContentHashVector& unusedResources = {})
+        {
+            ResourceContentHashVector fromScene;
+            ResourceUtils::GetAllResourcesFromScene(fromScene, scene);
+            std::sort(expectedResources.begin(), expectedResources.end());
+            EXPECT_EQ(expectedResources, fromScene);
+
+            for (const auto& hash : expectedResources)
+                EXPECT_TRUE(scene.isResourceInUse(hash));
+            for (const auto& hash : unusedResources)
+                EXPECT_FALSE(scene.isResourceInUse(hash));
+        }
+
+        void expectResourcesWithChangedUsage(ResourceContentHashVector expectedResources)
+        {
+            ResourceContentHashVector changedResources = scene.getResourcesWithChangedUsage();
+            std::sort(changedResources.begin(), changedResources.end());
+            changedResources.erase(std::unique(changedResources.begin(), changedResources.end()), changedResources.end());
+            std::sort(expectedResources.begin(), expectedResources.end());
+            EXPECT_EQ(expectedResources, changedResources);
+        }
+
         ResourceChangeCollectingScene scene;
         const SceneResourceActionVector& sceneResourceActions;
 
@@ -436,4 +460,77 @@ namespace ramses::internal
         scene.releaseDataSlot(dataSlot);
         EXPECT_FALSE(scene.haveResourcesChanged());
     }
+
+    TEST_F(AResourceChangeCollectingScene, tracksResourcesInUseByVisibleRenderablesAndDataSlots)
+    {
+        const RenderableHandle renderable = createRenderable();
+        const DataInstanceHandle geometryData = createVertexDataInstance(renderable);
+        scene.setDataResource(geometryData, vertAttribField, { 123, 0 }, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        createUniformDataInstanceWithSampler(renderable, { 456, 0 });
+        scene.allocateDataSlot({ EDataSlotType::TextureProvider, DataSlotId(0u), NodeHandle(), DataInstanceHandle(), { 789, 0 }, TextureSamplerHandle() }, {});
+
+        expectResourcesInUse({ { 123, 0 }, { 456, 0 }, { 789, 0 } });
+        expectResourcesWithChangedUsage({ { 123, 0 }, { 456, 0 }, { 789, 0 } });
+        scene.resetResourceChanges();
+        expectResourcesWithChangedUsage({});
+
+        scene.setRenderableVisibility(renderable, EVisibilityMode::Off);
+        expectResourcesInUse({ { 789, 0 } }, { { 123, 0 }, { 456, 0 } });
+        expectResourcesWithChangedUsage({ { 123, 0 }, { 456, 0 } });
+        scene.resetResourceChanges();
+
+        scene.setRenderableVisibility(renderable, EVisibilityMode::Invisible);
+        expectResourcesInUse({ { 123, 0 }, { 456, 0 }, { 789, 0 } });
+        expectResourcesWithChangedUsage({ { 123, 0 }, { 456, 0 } });
+    }
+
+    TEST_F(AResourceChangeCollectingScene, keepsResourceInUseWhileReferencedByAnyRenderable)
+    {
+        const RenderableHandle renderable1 = createRenderable();
+        const RenderableHandle renderable2 = createRenderable();
+        const DataInstanceHandle geometryData1 = createVertexDataInstance(renderable1);
+        const DataInstanceHandle geometryData2 = createVertexDataInstance(renderable2);
+        scene.setDataResource(geometryData1, vertAttribField, { 123, 0 }, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        scene.setDataResource(geometryData2, vertAttribField, { 123, 0 }, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        scene.resetResourceChanges();
+
+        scene.releaseRenderable(renderable1);
+        expectResourcesInUse({ { 123, 0 } });
+        expectResourcesWithChangedUsage({});
+
+        scene.setDataResource(geometryData2, vertAttribField, { 456, 0 }, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        expectResourcesInUse({ { 456, 0 } }, { { 123, 0 } });
+        expectResourcesWithChangedUsage({ { 123, 0 }, { 456, 0 } });
+    }
+
+    TEST_F(AResourceChangeCollectingScene, tracksTextureOfSamplerOnlyWhileSamplerAndDataInstanceAllocated)
+    {
+        const RenderableHandle renderable = createRenderable();
+        const DataInstanceHandle uniformData = createUniformDataInstanceWithSampler(renderable, { 123, 0 });
+        const TextureSamplerHandle sampler = scene.getDataTextureSamplerHandle(uniformData, samplerField);
+        scene.resetResourceChanges();
+
+        scene.releaseTextureSampler(sampler);
+        expectResourcesInUse({}, { { 123, 0 } });
+        scene.allocateTextureSampler({ {}, { 456, 0 } }, sampler);
+        expectResourcesInUse({ { 456, 0 } }, { { 123, 0 } });
+
+        scene.releaseDataInstance(uniformData);
+        expectResourcesInUse({}, { { 456, 0 } });
+        scene.allocateDataInstance(testUniformLayout, uniformData);
+        expectResourcesInUse({}, { { 456, 0 } });
+        scene.setDataTextureSamplerHandle(uniformData, samplerField, sampler);
+        expectResourcesInUse({ { 456, 0 } });
+        expectResourcesWithChangedUsage({ { 123, 0 }, { 456, 0 } });
+    }
+
+    TEST_F(AResourceChangeCollectingScene, tracksTextureOfDataSlot)
+    {
+        const DataSlotHandle dataSlot = scene.allocateDataSlot({ EDataSlotType::TextureProvider, DataSlotId(0u), NodeHandle(), DataInstanceHandle(), { 123, 0 }, TextureSamplerHandle() }, {});
+        scene.setDataSlotTexture(dataSlot, { 456, 0 });
+        expectResourcesInUse({ { 456, 0 } }, { { 123, 0 } });
+
+        scene.releaseDataSlot(dataSlot);
+        expectResourcesInUse({}, { { 456, 0 } });
+    }
 }
@@ -209,4 +209,24 @@ namespace ramses::internal
         EXPECT_EQ(std::chrono::milliseconds(250), frameworkConfig.impl().m_tcpConfig.getAliveInterval());
         EXPECT_EQ(std::chrono::milliseconds(9000), frameworkConfig.impl().m_tcpConfig.getAliveTimeout());
     }
+
+    TEST_F(ARamsesFrameworkConfig, CanSetSceneActionCompressionThreshold)
+    {
+        EXPECT_EQ(0u, frameworkConfig.impl().m_tcpConfig.getSceneActionCompressionThreshold());
+        frameworkConfig.setSceneActionCompressionThresholdForTCPCommunication(65536u);
+        EXPECT_EQ(65536u, frameworkConfig.impl().m_tcpConfig.getSceneActionCompressionThreshold());
+    }
+
+    TEST_F(ARamsesFrameworkConfig, CanSetMetricsEndpoint)
+    {
+        EXPECT_TRUE(frameworkConfig.impl().getMetricsEndpoint().empty());
+        EXPECT_FALSE(frameworkConfig.setMetricsEndpoint("localhost:9100"));
+        EXPECT_TRUE(frameworkConfig.impl().getMetricsEndpoint().empty());
+#if defined(HAS_METRICS_ENDPOINT)
+        EXPECT_TRUE(frameworkConfig.setMetricsEndpoint("tcp:9100"));
+        EXPECT_EQ("tcp:9100", frameworkConfig.impl().getMetricsEndpoint());
+#else
+        EXPECT_FALSE(frameworkConfig.setMetricsEndpoint("tcp:9100"));
+#endif
+    }
 }
@@ -47,5 +47,6 @@ namespace ramses::internal
         MOCK_METHOD(bool, hasIviSurface, (), (const, override));
         MOCK_METHOD(WaylandClientCredentials, getClientCredentials, (), (const, override));
         MOCK_METHOD(bool, dispatchBufferTypeChanged, (), (override));
+        MOCK_METHOD(WaylandSurfaceDamage, dispatchDamage, (), (override));
     };
 }
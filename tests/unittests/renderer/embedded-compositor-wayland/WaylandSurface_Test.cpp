@@ -9,6 +9,7 @@
 #include "internal/Platform/Wayland/EmbeddedCompositor/WaylandSurface.h"
 #include "internal/Platform/Wayland/WaylandEGLExtensionProcs.h"
 #include "gtest/gtest.h"
+#include <limits>
 
 #include "WaylandClientMock.h"
 #include "NativeWaylandResourceMock.h"
@@ -673,4 +674,78 @@ namespace ramses::internal
         EXPECT_CALL(m_waylandBuffer1, release());
         deleteWaylandSurface();
     }
+
+    TEST_F(AWaylandSurface, MarksFullDamage_IfBufferCommittedWithoutDamage)
+    {
+        createWaylandSurface();
+        EXPECT_FALSE(m_waylandSurface->dispatchDamage().fullSurface);
+
+        attachCommitBuffer();
+        EXPECT_TRUE(m_waylandSurface->dispatchDamage().fullSurface);
+        //damage gets reset after dispatch
+        EXPECT_FALSE(m_waylandSurface->dispatchDamage().fullSurface);
+
+        EXPECT_CALL(m_waylandBuffer1, release());
+        deleteWaylandSurface();
+    }
+
+    TEST_F(AWaylandSurface, AccumulatesDamageOfCommitsUntilDispatched)
+    {
+        createWaylandSurface();
+
+        WaylandBufferResourceMock bufferResource;
+        attachBuffer(bufferResource, m_waylandBuffer1, {{m_waylandBuffer1, false}});
+        m_waylandSurface->surfaceDamage(m_client, 10, 20, 30, 40);
+        commitBuffer(m_waylandBuffer1);
+
+        // not committed damage is not dispatched
+        m_waylandSurface->surfaceDamageBuffer(m_client, 1, 2, 3, 4);
+        m_waylandSurface->surfaceDamage(m_client, 5, 6, 7, 8);
+        auto damage = m_waylandSurface->dispatchDamage();
+        EXPECT_FALSE(damage.fullSurface);
+        EXPECT_EQ(std::vector<Quad>({ Quad(10, 20, 30, 40) }), damage.regions);
+
+        m_waylandSurface->surfaceCommit(m_client);
+        damage = m_waylandSurface->dispatchDamage();
+        EXPECT_FALSE(damage.fullSurface);
+        EXPECT_EQ(std::vector<Quad>({ Quad(1, 2, 3, 4), Quad(5, 6, 7, 8) }), damage.regions);
+        EXPECT_TRUE(m_waylandSurface->dispatchDamage().regions.empty());
+
+        EXPECT_CALL(m_waylandBuffer1, release());
+        deleteWaylandSurface();
+    }
+
+    TEST_F(AWaylandSurface, ClipsDamageToPositiveRangeAndIgnoresEmptyDamage)
+    {
+        createWaylandSurface();
+
+        constexpr int32_t maxInt = std::numeric_limits<int32_t>::max();
+        m_waylandSurface->surfaceDamage(m_client, -5, -10, maxInt, maxInt);
+        m_waylandSurface->surfaceDamageBuffer(m_client, 0, 0, maxInt, maxInt);
+        m_waylandSurface->surfaceDamage(m_client, 10, 10, 0, 10);
+        m_waylandSurface->surfaceDamage(m_client, -20, 10, 10, 10);
+        m_waylandSurface->surfaceCommit(m_client);
+
+        const auto damage = m_waylandSurface->dispatchDamage();
+        EXPECT_FALSE(damage.fullSurface);
+        EXPECT_EQ(std::vector<Quad>({ Quad(0, 0, maxInt - 5, maxInt - 10), Quad(0, 0, maxInt, maxInt) }), damage.regions);
+
+        deleteWaylandSurface();
+    }
+
+    TEST_F(AWaylandSurface, MergesDamageToBoundingRegion_IfTooManyRegionsDamaged)
+    {
+        createWaylandSurface();
+
+        for (int32_t i = 0; i < 17; ++i)
+            m_waylandSurface->surfaceDamage(m_client, 10 + i, 20, 1, 1 + i);
+        m_waylandSurface->surfaceCommit(m_client);
+
+        const auto damage = m_waylandSurface->dispatchDamage();
+        EXPECT_FALSE(damage.fullSurface);
+        ASSERT_EQ(1u, damage.regions.size());
+        EXPECT_EQ(Quad(10, 20, 17, 17), damage.regions.front());
+
+        deleteWaylandSurface();
+    }
 }
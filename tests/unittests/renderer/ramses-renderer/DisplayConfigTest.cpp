@@ -368,6 +368,20 @@ namespace ramses::internal
         EXPECT_FALSE(config.impl().getInternalDisplayConfig().isAsyncEffectUploadEnabled());
     }
 
+    TEST_F(ADisplayConfig, canSetAsyncEffectUploadThreadCount)
+    {
+        EXPECT_TRUE(config.setAsyncEffectUploadThreadCount(3u));
+        EXPECT_EQ(3u, config.impl().getInternalDisplayConfig().getAsyncEffectUploadThreadCount());
+        EXPECT_FALSE(config.setAsyncEffectUploadThreadCount(0u));
+        EXPECT_EQ(3u, config.impl().getInternalDisplayConfig().getAsyncEffectUploadThreadCount());
+    }
+
+    TEST_F(ADisplayConfig, setEffectPrewarmingEnabled)
+    {
+        EXPECT_TRUE(config.setEffectPrewarmingEnabled(true));
+        EXPECT_TRUE(config.impl().getInternalDisplayConfig().isEffectPrewarmingEnabled());
+    }
+
     TEST_F(ADisplayConfig, canSetEmbeddedCompositingSocketGroup)
     {
         config.setWaylandEmbeddedCompositingSocketGroup("permissionGroup");
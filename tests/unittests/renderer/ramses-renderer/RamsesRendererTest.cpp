@@ -641,14 +641,21 @@ namespace ramses::internal
             m_timeReports[displayId]++;
         }
 
+        void renderThreadLoopTimingPercentiles(ramses::displayId_t displayId, std::chrono::microseconds percentile50LoopTime, std::chrono::microseconds percentile90LoopTime, std::chrono::microseconds percentile99LoopTime) override
+        {
+            if (percentile50LoopTime <= percentile90LoopTime && percentile90LoopTime <= percentile99LoopTime)
+                m_percentileReports[displayId]++;
+        }
+
         bool displaysReported(std::initializer_list<ramses::displayId_t> displays, size_t minCount = 2u)
         {
             return m_timeReports.size() == displays.size()
-                && std::all_of(displays.begin(), displays.end(), [&](const auto d) { return m_timeReports[d] >= minCount; });
+                && std::all_of(displays.begin(), displays.end(), [&](const auto d) { return m_timeReports[d] >= minCount && m_percentileReports[d] >= minCount; });
         }
 
     private:
         std::unordered_map<ramses::displayId_t, size_t> m_timeReports;
+        std::unordered_map<ramses::displayId_t, size_t> m_percentileReports;
     };
 
     TEST(ARamsesRendererNonThreaded, reportsFrameTimings)
@@ -775,7 +782,11 @@ namespace ramses::internal
     TEST_F(ARamsesRendererWithDisplay, createsCommandForSettingFrameTimerLimits)
     {
         EXPECT_TRUE(renderer.setFrameTimerLimits(10001u, 10002u, 10003u));
-        EXPECT_CALL(cmdVisitor, setLimitsFrameBudgets(10001u, 10002u, 10003u));
+        EXPECT_CALL(cmdVisitor, setLimitsFrameBudgets(10001u, 10002u, 10003u, std::numeric_limits<uint64_t>::max()));
+        cmdVisitor.visit(commandBuffer);
+
+        EXPECT_TRUE(renderer.setFrameTimerLimits(10001u, 10002u, 10003u, 10004u));
+        EXPECT_CALL(cmdVisitor, setLimitsFrameBudgets(10001u, 10002u, 10003u, 10004u));
         cmdVisitor.visit(commandBuffer);
     }
 
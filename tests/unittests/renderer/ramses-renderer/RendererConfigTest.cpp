@@ -24,6 +24,7 @@ namespace ramses::internal
         EXPECT_EQ(defaultConfig.getFrameCallbackMaxPollTime(), internalConfig.getFrameCallbackMaxPollTime());
         EXPECT_EQ(defaultConfig.getRenderThreadLoopTimingReportingPeriod(), internalConfig.getRenderThreadLoopTimingReportingPeriod());
         EXPECT_EQ(defaultConfig.getSystemCompositorControlEnabled(), internalConfig.getSystemCompositorControlEnabled());
+        EXPECT_EQ(defaultConfig.getFramePacingMode(), internalConfig.getFramePacingMode());
     }
 
     TEST(ARendererConfig, canEnableSystemCompositor)
@@ -33,6 +34,15 @@ namespace ramses::internal
         EXPECT_TRUE(config.impl().getInternalRendererConfig().getSystemCompositorControlEnabled());
     }
 
+    TEST(ARendererConfig, canSetFramePacingMode)
+    {
+        ramses::RendererConfig config;
+        EXPECT_EQ(EFramePacingMode::Sleep, config.getFramePacingMode());
+        EXPECT_TRUE(config.setFramePacingMode(EFramePacingMode::DeadlineWithSpin));
+        EXPECT_EQ(EFramePacingMode::DeadlineWithSpin, config.getFramePacingMode());
+        EXPECT_EQ(EFramePacingMode::DeadlineWithSpin, config.impl().getInternalRendererConfig().getFramePacingMode());
+    }
+
     TEST(ARendererConfig, CanBeCopyAndMoveConstructed)
     {
         ramses::RendererConfig config;
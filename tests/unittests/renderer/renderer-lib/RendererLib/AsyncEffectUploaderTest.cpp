@@ -51,7 +51,7 @@ namespace ramses::internal
 
         void destroyResourceUploadingRenderBackend()
         {
-            EXPECT_CALL(platformMock, destroyResourceUploadRenderBackend());
+            EXPECT_CALL(platformMock, destroyResourceUploadRenderBackend(_));
             asyncEffectUploader.destroyResourceUploadRenderBackendAndStopThread();
             Mock::VerifyAndClearExpectations(&notifier);
         }
@@ -99,16 +99,24 @@ namespace ramses::internal
             return result;
         }
 
-        void expectShaderUploadingResult(const EffectsRawResources& effectsToUpload)
+        ManagedResource createUniqueManagedEffect()
+        {
+            const auto randomString = std::to_string(++createdEffectCounter);
+            return ManagedResource{ new EffectResource(randomString, "", "", {}, {}, {}, "") };
+        }
+
+        void expectShaderUploadingResult(const EffectsRawResources& effectsToUpload, EffectsGpuResources resultShaders = {}, AsyncEffectUploader* uploader = nullptr)
         {
             constexpr std::chrono::seconds timeoutTime{ 2u };
             constexpr std::chrono::milliseconds sleepTime {5u};
 
+            // uploaded effects are handed over one by one as they get uploaded, collect until all expected arrived
             const auto startTime = std::chrono::steady_clock::now();
-            EffectsGpuResources resultShaders;
-            while (resultShaders.empty() && timeoutTime > (std::chrono::steady_clock::now() - startTime))
+            while (resultShaders.size() < effectsToUpload.size() && timeoutTime > (std::chrono::steady_clock::now() - startTime))
             {
-                asyncEffectUploader.sync({}, resultShaders);
+                EffectsGpuResources syncedShaders;
+                (uploader ? *uploader : asyncEffectUploader).sync({}, syncedShaders);
+                std::move(syncedShaders.begin(), syncedShaders.end(), std::back_inserter(resultShaders));
                 std::this_thread::sleep_for(sleepTime);
             }
 
@@ -247,12 +255,12 @@ namespace ramses::internal
         submitForUploadAndExpectNoShaderWereUploaded({ effectsToUploadWhileBusy[2], effectsToUploadWhileBusy[3] });
         submitForUploadAndExpectNoShaderWereUploaded({ effectsToUploadWhileBusy[4], effectsToUploadWhileBusy[5] });
 
-        //unblock upload thread for 1st ever effect
+        //unblock upload thread for 1st ever effect and for effects that got submitted while upload thread is busy
         barrierShaderUploadCanBeFinished.set_value();
-        expectShaderUploadingResult(effectToUploadAndBlock);
-        //unblock upload thread for effects that got submitted while upload thread is busy
         barrierRestShadersCanBeUploaded.set_value();
-        expectShaderUploadingResult(effectsToUploadWhileBusy);
+        EffectsRawResources allEffects = effectToUploadAndBlock;
+        allEffects.insert(allEffects.end(), effectsToUploadWhileBusy.cbegin(), effectsToUploadWhileBusy.cend());
+        expectShaderUploadingResult(allEffects);
 
         destroyResourceUploadingRenderBackend();
     }
@@ -318,4 +326,98 @@ namespace ramses::internal
         const auto maxDurationShaderUpload = nonTrivialTime * (effectCount - 1u);
         EXPECT_TRUE(durationDestroyCallBlocked < maxDurationShaderUpload);
     }
+
+    TEST_F(AnAsyncEffectUploader, HandsOverPrewarmedEffectOnlyWhenRequestedWithoutUploadingItAgain)
+    {
+        createResourceUploadingRenderBackend();
+
+        const ManagedResource effect = createUniqueManagedEffect();
+        const auto* effectRes = effect->convertTo<EffectResource>();
+
+        std::promise<void> barrierEffectPrewarmed;
+        EXPECT_CALL(platformMock.resourceUploadRenderBackendMock.deviceMock, uploadShader(Ref(*effectRes))).WillOnce(Invoke([&](const auto& /*unused*/) {
+            barrierEffectPrewarmed.set_value();
+            return std::make_unique<const GPUResource>(1u, 2u);
+            }));
+        expectDeviceFlushOnWindows();
+
+        asyncEffectUploader.prewarm({ effect });
+        barrierEffectPrewarmed.get_future().get();
+        submitForUploadAndExpectNoShaderWereUploaded({});
+
+        EffectsGpuResources uploadedEffects;
+        asyncEffectUploader.sync({ effectRes }, uploadedEffects);
+        expectShaderUploadingResult({ effectRes }, std::move(uploadedEffects));
+
+        destroyResourceUploadingRenderBackend();
+    }
+
+    TEST_F(AnAsyncEffectUploader, HandsOverEffectRequestedWhileBeingPrewarmedOnceUploaded)
+    {
+        createResourceUploadingRenderBackend();
+
+        const ManagedResource effect = createUniqueManagedEffect();
+        const auto* effectRes = effect->convertTo<EffectResource>();
+
+        std::promise<void> barrierPrewarmingStarted;
+        std::promise<void> barrierPrewarmingCanBeFinished;
+        EXPECT_CALL(platformMock.resourceUploadRenderBackendMock.deviceMock, uploadShader(Ref(*effectRes))).WillOnce(Invoke([&](const auto& /*unused*/) {
+            barrierPrewarmingStarted.set_value();
+            barrierPrewarmingCanBeFinished.get_future().get();
+            return std::make_unique<const GPUResource>(1u, 2u);
+            }));
+        expectDeviceFlushOnWindows();
+
+        asyncEffectUploader.prewarm({ effect });
+        barrierPrewarmingStarted.get_future().get();
+
+        submitForUploadAndExpectNoShaderWereUploaded({ effectRes });
+        barrierPrewarmingCanBeFinished.set_value();
+        expectShaderUploadingResult({ effectRes });
+
+        destroyResourceUploadingRenderBackend();
+    }
+
+    TEST_F(AnAsyncEffectUploader, UploadsShadersInParallelWithMultipleThreads)
+    {
+        EXPECT_CALL(notifier, registerThread()).Times(2u).WillRepeatedly(Return(ThreadAliveNotifierMock::dummyThreadId));
+        AsyncEffectUploader parallelUploader(platformMock, platformMock.renderBackendMock, notifier, 1, 2u);
+
+        EXPECT_CALL(platformMock.renderBackendMock.contextMock, disable()).WillOnce(Return(true));
+        EXPECT_CALL(platformMock, createResourceUploadRenderBackend()).Times(2u);
+        EXPECT_CALL(platformMock.renderBackendMock.contextMock, enable()).WillOnce(Return(true));
+        EXPECT_CALL(notifier, notifyAlive(ThreadAliveNotifierMock::dummyThreadId)).Times(AnyNumber());
+        EXPECT_CALL(notifier, calculateTimeout()).Times(AnyNumber()).WillRepeatedly(Return(10ms));
+        ASSERT_TRUE(parallelUploader.createResourceUploadRenderBackendAndStartThread());
+
+        // each upload waits for the other one to start, this succeeds only if both are uploaded at the same time
+        const auto effects = createUniqueEffects(2u);
+        std::promise<void> barrierFirstStarted;
+        std::promise<void> barrierSecondStarted;
+        std::future_status waitForSecond = std::future_status::timeout;
+        std::future_status waitForFirst = std::future_status::timeout;
+        EXPECT_CALL(platformMock.resourceUploadRenderBackendMock.deviceMock, uploadShader(Ref(*effects[0]))).WillOnce(Invoke([&](const auto& /*unused*/) {
+            barrierFirstStarted.set_value();
+            waitForSecond = barrierSecondStarted.get_future().wait_for(2s);
+            return std::make_unique<const GPUResource>(1u, 2u);
+            }));
+        EXPECT_CALL(platformMock.resourceUploadRenderBackendMock.deviceMock, uploadShader(Ref(*effects[1]))).WillOnce(Invoke([&](const auto& /*unused*/) {
+            barrierSecondStarted.set_value();
+            waitForFirst = barrierFirstStarted.get_future().wait_for(2s);
+            return std::make_unique<const GPUResource>(1u, 2u);
+            }));
+        expectDeviceFlushOnWindows();
+        expectDeviceFlushOnWindows();
+
+        EffectsGpuResources uploadedEffects;
+        parallelUploader.sync(effects, uploadedEffects);
+        expectShaderUploadingResult(effects, std::move(uploadedEffects), &parallelUploader);
+        EXPECT_EQ(std::future_status::ready, waitForSecond);
+        EXPECT_EQ(std::future_status::ready, waitForFirst);
+
+        EXPECT_CALL(platformMock, destroyResourceUploadRenderBackend(_)).Times(2u);
+        parallelUploader.destroyResourceUploadRenderBackendAndStopThread();
+        Mock::VerifyAndClearExpectations(&notifier);
+        EXPECT_CALL(notifier, unregisterThread(ThreadAliveNotifierMock::dummyThreadId)).Times(2u);
+    }
 }
@@ -77,4 +77,20 @@ namespace ramses::internal
         scene.restoreFallbackValue(dataRef, DataFieldHandle(0u));
         EXPECT_EQ(13, scene.getDataSingleInteger(dataRef, DataFieldHandle(0u)));
     }
+
+    TEST_F(ADataReferenceLinkCachedScene, changesDataInstanceVersionWheneverValueIsSet)
+    {
+        EXPECT_EQ(0u, scene.getDataInstanceVersion(dataRef));
+
+        scene.setDataSingleInteger(dataRef, DataFieldHandle(0u), 13);
+        const uint64_t version1 = scene.getDataInstanceVersion(dataRef);
+        EXPECT_NE(0u, version1);
+
+        scene.setValueWithoutUpdatingFallbackValue(dataRef, DataFieldHandle(0u), DataInstanceValueVariant(33));
+        const uint64_t version2 = scene.getDataInstanceVersion(dataRef);
+        EXPECT_NE(version1, version2);
+
+        scene.restoreFallbackValue(dataRef, DataFieldHandle(0u));
+        EXPECT_NE(version2, scene.getDataInstanceVersion(dataRef));
+    }
 }
@@ -139,6 +139,61 @@ namespace ramses::internal
         ExpectDataValue(providerDataRef, providerScene, 666.f);
     }
 
+    TEST_F(ADataReferenceLinkManager, modifiesConsumerOnlyIfProviderValueChangedSinceLastResolve)
+    {
+        SetDataValue(providerDataRef, providerScene, 666.f);
+        SetDataValue(consumerDataRef, consumerScene, -1.f);
+
+        sceneLinksManager.createDataLink(providerSceneId, providerId, consumerSceneId, consumerId);
+        expectRendererEvent(ERendererEventType::SceneDataLinked, providerSceneId, providerId, consumerSceneId, consumerId);
+
+        EXPECT_TRUE(dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene));
+        ExpectDataValue(consumerDataRef, consumerScene, 666.f);
+
+        const uint64_t consumerVersion = consumerScene.getDataInstanceVersion(consumerDataRef);
+        EXPECT_FALSE(dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene));
+        EXPECT_EQ(consumerVersion, consumerScene.getDataInstanceVersion(consumerDataRef));
+
+        SetDataValue(providerDataRef, providerScene, 123.f);
+        EXPECT_TRUE(dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene));
+        ExpectDataValue(consumerDataRef, consumerScene, 123.f);
+        EXPECT_FALSE(dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene));
+    }
+
+    TEST_F(ADataReferenceLinkManager, overwritesConsumerValueChangedByConsumerSceneEvenIfProviderUnchanged)
+    {
+        SetDataValue(providerDataRef, providerScene, 666.f);
+
+        sceneLinksManager.createDataLink(providerSceneId, providerId, consumerSceneId, consumerId);
+        expectRendererEvent(ERendererEventType::SceneDataLinked, providerSceneId, providerId, consumerSceneId, consumerId);
+
+        EXPECT_TRUE(dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene));
+        EXPECT_FALSE(dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene));
+
+        SetDataValue(consumerDataRef, consumerScene, -1.f);
+        EXPECT_TRUE(dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene));
+        ExpectDataValue(consumerDataRef, consumerScene, 666.f);
+    }
+
+    TEST_F(ADataReferenceLinkManager, propagatesUnchangedProviderValueAgainAfterRelink)
+    {
+        SetDataValue(providerDataRef, providerScene, 666.f);
+        SetDataValue(consumerDataRef, consumerScene, -1.f);
+
+        sceneLinksManager.createDataLink(providerSceneId, providerId, consumerSceneId, consumerId);
+        expectRendererEvent(ERendererEventType::SceneDataLinked, providerSceneId, providerId, consumerSceneId, consumerId);
+        EXPECT_TRUE(dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene));
+
+        sceneLinksManager.removeDataLink(consumerSceneId, consumerId);
+        expectRendererEvent(ERendererEventType::SceneDataUnlinked, consumerSceneId, consumerId, providerSceneId);
+        ExpectDataValue(consumerDataRef, consumerScene, -1.f);
+
+        sceneLinksManager.createDataLink(providerSceneId, providerId, consumerSceneId, consumerId);
+        expectRendererEvent(ERendererEventType::SceneDataLinked, providerSceneId, providerId, consumerSceneId, consumerId);
+        EXPECT_TRUE(dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene));
+        ExpectDataValue(consumerDataRef, consumerScene, 666.f);
+    }
+
     TEST_F(ADataReferenceLinkManager, canResolveLinkedDataToMultipleConsumers)
     {
         const DataLayoutHandle consumerLayout = consumerSceneAllocator.allocateDataLayout({ DataFieldInfo(EDataType::Float) }, ResourceContentHash::Invalid());
@@ -18,6 +18,7 @@ namespace ramses::internal
         static std::atomic_int dummy;
         ON_CALL(*this, traceId()).WillByDefault(ReturnRef(dummy));
         EXPECT_CALL(*this, traceId()).Times(AnyNumber());
+        EXPECT_CALL(*this, reportFramePacingJitter(_)).Times(AnyNumber());
     }
 
     DisplayBundleMock::~DisplayBundleMock() = default;
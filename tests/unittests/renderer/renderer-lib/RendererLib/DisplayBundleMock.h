@@ -30,6 +30,7 @@ namespace ramses::internal
         MOCK_METHOD(IEmbeddedCompositingManager&, getECManager, (), (override));
         MOCK_METHOD(IEmbeddedCompositor&, getEC, (), (override));
         MOCK_METHOD(bool, hasSystemCompositorController, (), (const, override));
+        MOCK_METHOD(void, reportFramePacingJitter, (std::chrono::microseconds jitter), (override));
         MOCK_METHOD(std::atomic_int&, traceId, (), (override));
     };
 }
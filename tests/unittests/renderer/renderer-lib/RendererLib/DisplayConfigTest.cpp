@@ -34,6 +34,8 @@ namespace ramses::internal
         EXPECT_EQ("", m_config.getWaylandDisplay());
         EXPECT_EQ(ramses::EDepthBufferType::DepthStencil, m_config.getDepthStencilBufferType());
         EXPECT_TRUE(m_config.isAsyncEffectUploadEnabled());
+        EXPECT_EQ(1u, m_config.getAsyncEffectUploadThreadCount());
+        EXPECT_FALSE(m_config.isEffectPrewarmingEnabled());
         EXPECT_EQ(std::string(""), m_config.getWaylandSocketEmbedded());
         EXPECT_EQ(std::string(""), m_config.getWaylandSocketEmbeddedGroup());
         EXPECT_EQ(-1, m_config.getWaylandSocketEmbeddedFD());
@@ -95,6 +97,12 @@ namespace ramses::internal
         m_config.setAsyncEffectUploadEnabled(false);
         EXPECT_FALSE(m_config.isAsyncEffectUploadEnabled());
 
+        m_config.setAsyncEffectUploadThreadCount(4u);
+        EXPECT_EQ(4u, m_config.getAsyncEffectUploadThreadCount());
+
+        m_config.setEffectPrewarmingEnabled(true);
+        EXPECT_TRUE(m_config.isEffectPrewarmingEnabled());
+
         m_config.setWaylandEmbeddedCompositingSocketName("wayland-11");
         EXPECT_EQ(std::string("wayland-11"), m_config.getWaylandSocketEmbedded());
 
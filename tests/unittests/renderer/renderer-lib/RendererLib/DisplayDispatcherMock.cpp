@@ -12,7 +12,7 @@
 namespace ramses::internal
 {
     DisplayDispatcherMock::DisplayDispatcherMock(const RendererConfig& config, IRendererSceneEventSender& rendererSceneSender, IThreadAliveNotifier& notifier)
-        : DisplayDispatcher(std::make_unique<PlatformFactoryNiceMock>(), config, rendererSceneSender, notifier)
+        : DisplayDispatcher(std::make_unique<PlatformFactoryNiceMock>(), config, rendererSceneSender, notifier, nullptr)
     {
     }
     DisplayDispatcherMock::~DisplayDispatcherMock() = default;
@@ -10,6 +10,8 @@
 #include "DisplayDispatcherMock.h"
 #include "RendererSceneEventSenderMock.h"
 #include "internal/Watchdog/ThreadAliveNotifierMock.h"
+#include "internal/SceneGraph/Resource/ArrayResource.h"
+#include <array>
 #include <thread>
 
 using namespace testing;
@@ -198,6 +200,50 @@ namespace ramses::internal
         update();
     }
 
+    TEST_F(ADisplayDispatcher, sharesResourcesWithSameContentBetweenDisplays)
+    {
+        constexpr DisplayHandle display1{ 1u };
+        constexpr DisplayHandle display2{ 2u };
+        constexpr SceneId scene1{ 11u };
+        constexpr SceneId scene2{ 22u };
+
+        createDisplay(display1);
+        createDisplay(display2);
+
+        m_commandBuffer.enqueueCommand(RendererCommand::SetSceneMapping{ scene1, display1 });
+        m_commandBuffer.enqueueCommand(RendererCommand::SetSceneMapping{ scene2, display2 });
+        expectCommandPushed(display1, RendererCommand::SetSceneMapping{});
+        expectCommandPushed(display2, RendererCommand::SetSceneMapping{});
+        update();
+
+        // same content received separately for each scene
+        const std::array<float, 3> data{ 1.f, 2.f, 3.f };
+        const auto createUpdate = [&data]() {
+            SceneUpdate sceneUpdate;
+            sceneUpdate.resources.push_back(std::make_shared<const ArrayResource>(EResourceType::VertexArray, 1u, EDataType::Vector3F, data.data(), "res"));
+            return sceneUpdate;
+        };
+        m_commandBuffer.enqueueCommand(RendererCommand::UpdateScene{ scene1, createUpdate() });
+        m_commandBuffer.enqueueCommand(RendererCommand::UpdateScene{ scene2, createUpdate() });
+
+        ManagedResource resource1;
+        ManagedResource resource2;
+        const auto captureResource = [](ManagedResource& resource) {
+            return Invoke([&resource](auto& cmds) {
+                ASSERT_EQ(1u, cmds.size());
+                resource = std::get<RendererCommand::UpdateScene>(cmds.front()).updateData.resources.front();
+                cmds.clear();
+            });
+        };
+        EXPECT_CALL(*m_displayDispatcher.getDisplayBundleMock(display1), pushAndConsumeCommands(_)).WillOnce(captureResource(resource1));
+        EXPECT_CALL(*m_displayDispatcher.getDisplayBundleMock(display2), pushAndConsumeCommands(_)).WillOnce(captureResource(resource2));
+        update();
+
+        ASSERT_TRUE(resource1);
+        EXPECT_EQ(resource1, resource2);
+        EXPECT_EQ(1u, m_displayDispatcher.getSharedResourcePool().getNumberOfDeduplicatedResources());
+    }
+
     TEST_F(ADisplayDispatcher, willNotCallPushIfNoCommands)
     {
         constexpr DisplayHandle display1{ 1u };
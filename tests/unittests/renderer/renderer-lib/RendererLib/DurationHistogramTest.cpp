@@ -0,0 +1,118 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/DurationHistogram.h"
+#include "gmock/gmock.h"
+
+#include <limits>
+
+using namespace testing;
+
+namespace ramses::internal
+{
+    TEST(ADurationHistogram, hasExactBucketsForSmallValues)
+    {
+        for (uint64_t value = 0u; value < 2u * DurationHistogram::SubBucketCount; ++value)
+        {
+            EXPECT_EQ(value, DurationHistogram::GetBucketIndex(value));
+            EXPECT_EQ(value, DurationHistogram::GetBucketUpperValue(value));
+        }
+    }
+
+    TEST(ADurationHistogram, bucketContainsValueWithBoundedRelativeError)
+    {
+        for (uint64_t value : { 64u, 65u, 100u, 1000u, 16667u, 33333u, 1000000u, 60000000u })
+        {
+            const auto upperValue = DurationHistogram::GetBucketUpperValue(DurationHistogram::GetBucketIndex(value));
+            EXPECT_GE(upperValue, value);
+            EXPECT_LE(static_cast<double>(upperValue - value) / static_cast<double>(value), 1.0 / DurationHistogram::SubBucketCount);
+        }
+    }
+
+    TEST(ADurationHistogram, bucketIndicesAreMonotonicAndCoverAllBuckets)
+    {
+        EXPECT_EQ(DurationHistogram::NumberOfBuckets - 1u, DurationHistogram::GetBucketIndex(DurationHistogram::MaxTrackableValue));
+        EXPECT_EQ(DurationHistogram::MaxTrackableValue, DurationHistogram::GetBucketUpperValue(DurationHistogram::NumberOfBuckets - 1u));
+        EXPECT_EQ(DurationHistogram::NumberOfBuckets - 1u, DurationHistogram::GetBucketIndex(std::numeric_limits<uint64_t>::max()));
+
+        for (size_t i = 1u; i < DurationHistogram::NumberOfBuckets; ++i)
+        {
+            const auto lowerValue = DurationHistogram::GetBucketUpperValue(i - 1u) + 1u;
+            EXPECT_EQ(i, DurationHistogram::GetBucketIndex(lowerValue));
+            EXPECT_EQ(i, DurationHistogram::GetBucketIndex(DurationHistogram::GetBucketUpperValue(i)));
+        }
+    }
+
+    TEST(ADurationHistogram, reportsZeroPercentilesWhenEmpty)
+    {
+        const DurationHistogram histogram;
+        const auto percentiles = histogram.getPercentiles();
+        EXPECT_EQ(0u, percentiles.count);
+        EXPECT_EQ(0u, percentiles.p50);
+        EXPECT_EQ(0u, percentiles.p99);
+        EXPECT_EQ(0u, percentiles.max);
+    }
+
+    TEST(ADurationHistogram, reportsPercentilesOfRecordedValues)
+    {
+        DurationHistogram histogram;
+        for (uint64_t value = 1u; value <= 100u; ++value)
+            histogram.record(value * 1000u);
+
+        const auto percentiles = histogram.getPercentiles();
+        EXPECT_EQ(100u, percentiles.count);
+        EXPECT_NEAR(50000.0, static_cast<double>(percentiles.p50), 50000.0 / DurationHistogram::SubBucketCount);
+        EXPECT_NEAR(90000.0, static_cast<double>(percentiles.p90), 90000.0 / DurationHistogram::SubBucketCount);
+        EXPECT_NEAR(99000.0, static_cast<double>(percentiles.p99), 99000.0 / DurationHistogram::SubBucketCount);
+        EXPECT_EQ(100000u, percentiles.max);
+    }
+
+    TEST(ADurationHistogram, reportsSingleSpikeOnlyInHighPercentiles)
+    {
+        DurationHistogram histogram;
+        for (size_t i = 0u; i < 99u; ++i)
+            histogram.record(16000u);
+        histogram.record(250000u);
+
+        EXPECT_NEAR(16000.0, static_cast<double>(histogram.getPercentile(50.0)), 16000.0 / DurationHistogram::SubBucketCount);
+        EXPECT_NEAR(16000.0, static_cast<double>(histogram.getPercentile(99.0)), 16000.0 / DurationHistogram::SubBucketCount);
+        EXPECT_EQ(250000u, histogram.getPercentile(100.0));
+        EXPECT_EQ(250000u, histogram.getMax());
+    }
+
+    TEST(ADurationHistogram, percentilesDoNotExceedExactMaximum)
+    {
+        DurationHistogram histogram;
+        histogram.record(1000u);
+        EXPECT_EQ(1000u, histogram.getPercentile(50.0));
+        EXPECT_EQ(1000u, histogram.getPercentile(99.0));
+    }
+
+    TEST(ADurationHistogram, clampsValuesAboveTrackableRangeButKeepsExactMaximum)
+    {
+        DurationHistogram histogram;
+        histogram.record(DurationHistogram::MaxTrackableValue * 2u);
+        EXPECT_EQ(1u, histogram.getCount());
+        EXPECT_EQ(DurationHistogram::MaxTrackableValue, histogram.getPercentile(50.0));
+        EXPECT_EQ(DurationHistogram::MaxTrackableValue * 2u, histogram.getMax());
+    }
+
+    TEST(ADurationHistogram, isEmptyAfterReset)
+    {
+        DurationHistogram histogram;
+        histogram.record(10u);
+        histogram.record(20u);
+        histogram.reset();
+        EXPECT_EQ(0u, histogram.getCount());
+        EXPECT_EQ(0u, histogram.getMax());
+        EXPECT_EQ(0u, histogram.getPercentile(99.0));
+
+        histogram.record(5u);
+        EXPECT_EQ(5u, histogram.getPercentile(50.0));
+    }
+}
@@ -128,20 +128,40 @@ namespace ramses::internal
         }
 
         // these expectations don't necessarily come in same order
-        EXPECT_CALL(embeddedCompositorMock, uploadCompositingContentForStreamTexture(streamTextureSourceId, _, _)).WillOnce(Return(13u));
-        EXPECT_CALL(embeddedCompositorMock, uploadCompositingContentForStreamTexture(streamTextureSourceId2, _, _)).WillOnce(Return(6u));
+        EXPECT_CALL(embeddedCompositorMock, uploadCompositingContentForStreamTexture(streamTextureSourceId, _, _, true)).WillOnce(Return(StreamTextureUploadResult{ 13u, 1000u }));
+        EXPECT_CALL(embeddedCompositorMock, uploadCompositingContentForStreamTexture(streamTextureSourceId2, _, _, true)).WillOnce(Return(StreamTextureUploadResult{ 6u, 200u }));
         StreamSourceUpdates updates;
         embeddedCompositingManager.uploadResourcesAndGetUpdates(updates);
         ASSERT_EQ(2u, updates.size());
         int idx1 = 0;
         int idx2 = 1;
         // updates might come in different order
-        if (updates.front().first != streamTextureSourceId)
+        if (updates.front().source != streamTextureSourceId)
             std::swap(idx1, idx2);
-        EXPECT_EQ(streamTextureSourceId, updates[idx1].first);
-        EXPECT_EQ(13u, updates[idx1].second);
-        EXPECT_EQ(streamTextureSourceId2, updates[idx2].first);
-        EXPECT_EQ(6u, updates[idx2].second);
+        EXPECT_EQ(streamTextureSourceId, updates[idx1].source);
+        EXPECT_EQ(13u, updates[idx1].numCommitedFrames);
+        EXPECT_EQ(1000u, updates[idx1].numBytesUploaded);
+        EXPECT_EQ(streamTextureSourceId2, updates[idx2].source);
+        EXPECT_EQ(6u, updates[idx2].numCommitedFrames);
+        EXPECT_EQ(200u, updates[idx2].numBytesUploaded);
+    }
+
+    TEST_F(AnEmbeddedCompositingManager, RequestsFullUploadOnlyForFirstUploadToStreamTexture)
+    {
+        addStreamReference(streamTextureSourceId);
+
+        EXPECT_CALL(embeddedCompositorMock, dispatchUpdatedStreamTextureSourceIds()).Times(2u).WillRepeatedly(Return(WaylandIviSurfaceIdSet{ streamTextureSourceId }));
+        EXPECT_CALL(embeddedCompositorMock, uploadCompositingContentForStreamTexture(streamTextureSourceId, compositedTextureDeviceHandle, _, true)).WillOnce(Return(StreamTextureUploadResult{ 1u, 1000u }));
+        StreamSourceUpdates updates;
+        embeddedCompositingManager.uploadResourcesAndGetUpdates(updates);
+
+        EXPECT_CALL(embeddedCompositorMock, uploadCompositingContentForStreamTexture(streamTextureSourceId, compositedTextureDeviceHandle, _, false)).WillOnce(Return(StreamTextureUploadResult{ 1u, 10u }));
+        updates.clear();
+        embeddedCompositingManager.uploadResourcesAndGetUpdates(updates);
+        ASSERT_EQ(1u, updates.size());
+        EXPECT_EQ(10u, updates.front().numBytesUploaded);
+
+        removeStreamReference(streamTextureSourceId);
     }
 
     TEST_F(AnEmbeddedCompositingManager, CanNotifyClients)
@@ -190,7 +210,7 @@ namespace ramses::internal
     {
         EXPECT_CALL(deviceMock, uploadStreamTexture2D(_, _, _, _, _, _)).WillOnce(Return(compositedTextureDeviceHandle));
         EXPECT_CALL(embeddedCompositorMock, isContentAvailableForStreamTexture(streamTextureSourceId)).WillOnce(Return(true));
-        EXPECT_CALL(embeddedCompositorMock, uploadCompositingContentForStreamTexture(streamTextureSourceId, _, _));
+        EXPECT_CALL(embeddedCompositorMock, uploadCompositingContentForStreamTexture(streamTextureSourceId, _, _, true));
 
         embeddedCompositingManager.refStream(streamTextureSourceId);
 
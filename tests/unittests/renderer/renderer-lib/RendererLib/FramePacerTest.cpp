@@ -0,0 +1,105 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "internal/RendererLib/FramePacer.h"
+
+namespace ramses::internal
+{
+    using namespace std::chrono_literals;
+
+    class AFramePacer : public ::testing::Test
+    {
+    protected:
+        // simulates a display loop with constant frame duration starting each frame at planned time
+        static FramePacer::Clock::time_point SimulateFrames(FramePacer& pacer, FramePacer::Clock::time_point start, std::chrono::microseconds frameDuration, int numFrames)
+        {
+            auto frameStart = start;
+            for (int i = 0; i < numFrames; ++i)
+                frameStart = pacer.planNextFrameStart(frameStart, frameStart + frameDuration, 10ms);
+            return frameStart;
+        }
+
+        const FramePacer::Clock::time_point t0 = FramePacer::Clock::time_point{} + 1s;
+    };
+
+    TEST_F(AFramePacer, sleepModeSleepsRemainingFrameTimeInWholeMilliseconds)
+    {
+        FramePacer pacer{ EFramePacingMode::Sleep };
+        EXPECT_EQ(t0 + 3ms + 6ms, pacer.planNextFrameStart(t0, t0 + 3ms, 9800us));
+        EXPECT_EQ(t0 + 3ms, pacer.planNextFrameStart(t0, t0 + 3ms, 3500us));
+        EXPECT_EQ(t0 + 20ms, pacer.planNextFrameStart(t0, t0 + 20ms, 10ms));
+    }
+
+    TEST_F(AFramePacer, deadlineModeStartsFirstFrameAfterMinFrameDurationMinusEstimate)
+    {
+        FramePacer pacer{ EFramePacingMode::Deadline };
+        // estimate from single sample is duration + 4 * duration/2
+        EXPECT_EQ(t0 + 2ms + 10ms - 6ms, pacer.planNextFrameStart(t0, t0 + 2ms, 10ms));
+        EXPECT_EQ(6ms, pacer.getFrameDurationEstimate());
+    }
+
+    TEST_F(AFramePacer, deadlineModeKeepsFixedFrameGridForStableWorkload)
+    {
+        FramePacer pacer{ EFramePacingMode::Deadline };
+        const auto frameStart = SimulateFrames(pacer, t0, 2ms, 100);
+
+        // estimate converges to frame duration, frames end exactly at grid of 10ms from first frame end
+        EXPECT_EQ(2ms, pacer.getFrameDurationEstimate());
+        EXPECT_EQ(t0 + 2ms + 100 * 10ms - 2ms, frameStart);
+    }
+
+    TEST_F(AFramePacer, deadlineModeWidensEstimateAfterSlowFrame)
+    {
+        FramePacer pacer{ EFramePacingMode::Deadline };
+        const auto frameStart = SimulateFrames(pacer, t0, 2ms, 100);
+        pacer.planNextFrameStart(frameStart, frameStart + 4ms, 10ms);
+        EXPECT_GT(pacer.getFrameDurationEstimate(), 4ms);
+    }
+
+    TEST_F(AFramePacer, deadlineModeRealignsGridWhenDeadlineMissed)
+    {
+        FramePacer pacer{ EFramePacingMode::Deadline };
+        const auto frameStart = SimulateFrames(pacer, t0, 2ms, 100);
+
+        // frame takes longer than whole frame period, next frame starts immediately and its deadline is one period later
+        const auto lateFrameEnd = frameStart + 25ms;
+        EXPECT_EQ(lateFrameEnd, pacer.planNextFrameStart(frameStart, lateFrameEnd, 10ms));
+        const auto nextStart = pacer.planNextFrameStart(lateFrameEnd, lateFrameEnd + 2ms, 10ms);
+        EXPECT_EQ(lateFrameEnd + 20ms - std::min(pacer.getFrameDurationEstimate(), std::chrono::microseconds{ 10ms }), nextStart);
+    }
+
+    TEST_F(AFramePacer, deadlineModeDoesNotWaitWithoutFramerateLimit)
+    {
+        FramePacer pacer{ EFramePacingMode::Deadline };
+        EXPECT_EQ(t0 + 2ms, pacer.planNextFrameStart(t0, t0 + 2ms, 0us));
+    }
+
+    TEST_F(AFramePacer, waitsUntilPlannedFrameStartAndReportsJitter)
+    {
+        for (const auto mode : { EFramePacingMode::Sleep, EFramePacingMode::Deadline, EFramePacingMode::DeadlineWithSpin })
+        {
+            FramePacer pacer{ mode };
+            const auto loopStart = FramePacer::Clock::now();
+            const auto loopEnd = loopStart + 1ms;
+            const auto result = pacer.waitForNextFrame(loopStart, loopEnd, 5ms);
+            EXPECT_GE(FramePacer::Clock::now(), loopEnd + 1ms);
+            EXPECT_GT(result.sleepTime, 0us);
+            EXPECT_TRUE(result.jitter.has_value());
+        }
+    }
+
+    TEST_F(AFramePacer, doesNotWaitOrReportJitterIfFrameTookLongerThanMinFrameDuration)
+    {
+        FramePacer pacer{ EFramePacingMode::DeadlineWithSpin };
+        const auto loopEnd = FramePacer::Clock::now();
+        const auto result = pacer.waitForNextFrame(loopEnd - 20ms, loopEnd, 10ms);
+        EXPECT_EQ(0us, result.sleepTime);
+        EXPECT_FALSE(result.jitter.has_value());
+    }
+}
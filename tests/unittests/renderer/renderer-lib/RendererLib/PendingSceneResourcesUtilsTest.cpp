@@ -111,7 +111,7 @@ namespace ramses::internal {
         EXPECT_CALL(resourceManager, uploadRenderTarget(renderTargetHandle, _, sceneID));
         EXPECT_CALL(resourceManager, uploadBlitPassRenderTargets(blitPassHandle, _, _, sceneID));
         EXPECT_CALL(resourceManager, uploadDataBuffer(dataBufferHandle, _, _, _, sceneID));
-        EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, _, _, sceneID));
+        EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, _, _, _, sceneID));
         EXPECT_CALL(resourceManager, uploadTextureBuffer(textureBufferHandle, _, _, _, _, sceneID));
         EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, _, _, _, _, sceneID)).Times(3u); // 3 mips
         PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
@@ -153,7 +153,7 @@ namespace ramses::internal {
         EXPECT_CALL(resourceManager, uploadRenderTarget(renderTargetHandle, _, sceneID));
         EXPECT_CALL(resourceManager, uploadBlitPassRenderTargets(blitPassHandle, RenderBufferHandle(81), RenderBufferHandle(82), sceneID));
         EXPECT_CALL(resourceManager, uploadDataBuffer(dataBufferHandle, _, _, _, sceneID));
-        EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, _, _, sceneID));
+        EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, _, _, _, sceneID));
 
         EXPECT_CALL(resourceManager, uploadTextureBuffer(textureBufferHandle, _, _, _, _, sceneID));
         EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 0u, Quad{0u, 0u, 32, 32}, 32, _, sceneID));
@@ -74,12 +74,12 @@ namespace ramses::internal
             VerifyAndClearExpectationsOnRenderBackendMockObjects(platform);
         }
 
-        static void DestroyResourceUploadRenderBackend(Platform_BaseMock& platform)
+        static void DestroyResourceUploadRenderBackend(Platform_BaseMock& platform, IResourceUploadRenderBackend& resourceUploadRenderBackend)
         {
             InSequence s;
             EXPECT_CALL(*platform.contextUploading, disable());
 
-            platform.destroyResourceUploadRenderBackend();
+            platform.destroyResourceUploadRenderBackend(resourceUploadRenderBackend);
 
             VerifyAndClearExpectationsOnRenderBackendMockObjects(platform);
         }
@@ -107,7 +107,7 @@ namespace ramses::internal
         IResourceUploadRenderBackend* renderBackend = CreateResourceUploadRenderBackend(platform);
         ASSERT_TRUE(nullptr != renderBackend);
 
-        DestroyResourceUploadRenderBackend(platform);
+        DestroyResourceUploadRenderBackend(platform, *renderBackend);
         DestroyRenderBackend(platform);
     }
 
@@ -10,6 +10,7 @@
 #include "internal/RendererLib/RendererCachedScene.h"
 #include "internal/RendererLib/RendererScenes.h"
 #include "internal/RendererLib/RendererEventCollector.h"
+#include <array>
 
 namespace ramses::internal
 {
@@ -1434,4 +1435,27 @@ namespace ramses::internal
         scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
         EXPECT_TRUE(orderedPasses.empty());
     }
+
+    TEST_F(ARendererCachedScene, tracksBoundingRangeOfDataBufferUpdatesUntilPopped)
+    {
+        const DataBufferHandle dataBuffer = sceneAllocator.allocateDataBuffer(EDataBufferType::VertexBuffer, EDataType::Float, 100u);
+        EXPECT_EQ(0u, scene.getDataBufferUpdate(dataBuffer).size);
+
+        const std::array<std::byte, 10u> data{};
+        scene.updateDataBuffer(dataBuffer, 20u, 10u, data.data());
+        EXPECT_EQ(20u, scene.getDataBufferUpdate(dataBuffer).offset);
+        EXPECT_EQ(10u, scene.getDataBufferUpdate(dataBuffer).size);
+
+        scene.updateDataBuffer(dataBuffer, 50u, 5u, data.data());
+        scene.updateDataBuffer(dataBuffer, 10u, 5u, data.data());
+        EXPECT_EQ(10u, scene.getDataBufferUpdate(dataBuffer).offset);
+        EXPECT_EQ(45u, scene.getDataBufferUpdate(dataBuffer).size);
+
+        scene.popDataBufferUpdate(dataBuffer);
+        EXPECT_EQ(0u, scene.getDataBufferUpdate(dataBuffer).size);
+
+        scene.updateDataBuffer(dataBuffer, 90u, 10u, data.data());
+        EXPECT_EQ(90u, scene.getDataBufferUpdate(dataBuffer).offset);
+        EXPECT_EQ(10u, scene.getDataBufferUpdate(dataBuffer).size);
+    }
 }
@@ -12,6 +12,7 @@
 #include "internal/Core/Utils/ThreadBarrier.h"
 #include <thread>
 #include <future>
+#include <vector>
 
 namespace ramses::internal {
     using namespace testing;
@@ -322,4 +323,92 @@ namespace ramses::internal {
 
         unblocker.join();
     }
+
+    TEST_F(ARendererCommandBuffer, keepsOrderOfCommandsWhenRingIsFull)
+    {
+        RendererCommandBuffer buffer{ 2u };
+        for (int32_t i = 0; i < 5; ++i)
+            buffer.enqueueCommand(RendererCommand::SetSceneDisplayBufferAssignment{ sceneId, obHandle, i });
+
+        RendererCommands cmds;
+        buffer.swapCommands(cmds);
+        ASSERT_EQ(5u, cmds.size());
+        for (int32_t i = 0; i < 5; ++i)
+            EXPECT_EQ(i, std::get<RendererCommand::SetSceneDisplayBufferAssignment>(cmds[i]).renderOrder);
+
+        // ring is used again after overflow was consumed
+        buffer.enqueueCommand(RendererCommand::SetSceneDisplayBufferAssignment{ sceneId, obHandle, 5 });
+        cmds.clear();
+        buffer.swapCommands(cmds);
+        ASSERT_EQ(1u, cmds.size());
+        EXPECT_EQ(5, std::get<RendererCommand::SetSceneDisplayBufferAssignment>(cmds[0]).renderOrder);
+    }
+
+    TEST_F(ARendererCommandBuffer, canAddBatchOfCommandsLargerThanCapacity)
+    {
+        RendererCommandBuffer buffer{ 4u };
+        RendererCommands batch;
+        for (int32_t i = 0; i < 11; ++i)
+            batch.emplace_back(RendererCommand::SetSceneDisplayBufferAssignment{ sceneId, obHandle, i });
+        buffer.addAndConsumeCommandsFrom(batch);
+        EXPECT_TRUE(batch.empty());
+
+        RendererCommands cmds;
+        buffer.swapCommands(cmds);
+        ASSERT_EQ(11u, cmds.size());
+        for (int32_t i = 0; i < 11; ++i)
+            EXPECT_EQ(i, std::get<RendererCommand::SetSceneDisplayBufferAssignment>(cmds[i]).renderOrder);
+    }
+
+    TEST_F(ARendererCommandBuffer, keepsOrderOfCommandsOfEachProducerWithConcurrentProducersAndConsumer)
+    {
+        constexpr int32_t NumProducers = 4;
+        constexpr int32_t NumCommandsPerProducer = 10000;
+        RendererCommandBuffer buffer{ 8u };
+
+        std::vector<std::thread> producers;
+        for (int32_t p = 0; p < NumProducers; ++p)
+        {
+            producers.emplace_back([&buffer, p]() {
+                int32_t i = 0;
+                while (i < NumCommandsPerProducer)
+                {
+                    if (i % 3 == 0)
+                    {
+                        RendererCommands batch;
+                        for (int32_t k = 0; k < 5 && i < NumCommandsPerProducer; ++k, ++i)
+                            batch.emplace_back(RendererCommand::SetSceneDisplayBufferAssignment{ SceneId{ static_cast<uint64_t>(p) }, {}, i });
+                        buffer.addAndConsumeCommandsFrom(batch);
+                    }
+                    else
+                    {
+                        buffer.enqueueCommand(RendererCommand::SetSceneDisplayBufferAssignment{ SceneId{ static_cast<uint64_t>(p) }, {}, i++ });
+                    }
+                }
+            });
+        }
+
+        std::vector<int32_t> nextExpected(NumProducers, 0);
+        int32_t numReceived = 0;
+        RendererCommands cmds;
+        while (numReceived < NumProducers * NumCommandsPerProducer)
+        {
+            cmds.clear();
+            buffer.blockingSwapCommands(cmds, std::chrono::milliseconds{ 1000 });
+            for (const auto& cmd : cmds)
+            {
+                const auto& assignment = std::get<RendererCommand::SetSceneDisplayBufferAssignment>(cmd);
+                auto& expected = nextExpected[assignment.scene.getValue()];
+                ASSERT_EQ(expected, assignment.renderOrder);
+                ++expected;
+                ++numReceived;
+            }
+        }
+
+        for (auto& producer : producers)
+            producer.join();
+        cmds.clear();
+        buffer.swapCommands(cmds);
+        EXPECT_TRUE(cmds.empty());
+    }
 }
@@ -17,6 +17,7 @@ namespace ramses::internal
         EXPECT_FALSE(config.getSystemCompositorControlEnabled());
         EXPECT_EQ(std::chrono::microseconds{10000u}, config.getFrameCallbackMaxPollTime());
         EXPECT_EQ("", config.getWaylandDisplayForSystemCompositorController());
+        EXPECT_EQ(EFramePacingMode::Sleep, config.getFramePacingMode());
     }
 
     TEST(AInternalRendererConfig, canEnableSystemCompositorControl)
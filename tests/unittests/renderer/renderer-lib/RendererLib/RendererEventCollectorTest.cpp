@@ -309,13 +309,19 @@ namespace ramses::internal
     {
         constexpr std::chrono::microseconds maxTime{ 123 };
         constexpr std::chrono::microseconds avgTime{ 321 };
+        constexpr std::chrono::microseconds p99Time{ 111 };
         const DisplayHandle displayHandle(124u);
-        m_rendererEventCollector.addFrameTimingReport(displayHandle, maxTime, avgTime);
+        FrameTimings frameTimings{};
+        frameTimings.maximumLoopTimeWithinPeriod = maxTime;
+        frameTimings.averageLoopTimeWithinPeriod = avgTime;
+        frameTimings.percentile99LoopTimeWithinPeriod = p99Time;
+        m_rendererEventCollector.addFrameTimingReport(displayHandle, frameTimings);
         const RendererEventVector resultEvents = consumeRendererEvents();
         ASSERT_EQ(1u, resultEvents.size());
         EXPECT_EQ(ERendererEventType::FrameTimingReport, resultEvents[0].eventType);
         EXPECT_EQ(maxTime, resultEvents[0].frameTimings.maximumLoopTimeWithinPeriod);
         EXPECT_EQ(avgTime, resultEvents[0].frameTimings.averageLoopTimeWithinPeriod);
+        EXPECT_EQ(p99Time, resultEvents[0].frameTimings.percentile99LoopTimeWithinPeriod);
         EXPECT_EQ(displayHandle, resultEvents[0].displayHandle);
     }
 
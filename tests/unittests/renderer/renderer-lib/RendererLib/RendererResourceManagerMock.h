@@ -43,6 +43,7 @@ namespace ramses::internal{
         MOCK_METHOD(void, unreferenceAllResourcesForScene, (SceneId sceneId), (override));
         MOCK_METHOD(const ResourceContentHashVector*, getResourcesInUseByScene, (SceneId sceneId), (const, override));
         MOCK_METHOD(void, provideResourceData, (const ManagedResource& mr), (override));
+        MOCK_METHOD(void, prewarmEffects, (const ManagedResourceVector& resources), (override));
         MOCK_METHOD(bool, hasResourcesToBeUploaded, (), (const, override));
         MOCK_METHOD(void, uploadAndUnloadPendingResources, (), (override));
         MOCK_METHOD(void, uploadRenderTargetBuffer, (RenderBufferHandle renderBufferHandle, SceneId sceneId, const RenderBuffer& renderBuffer), (override));
@@ -58,7 +59,7 @@ namespace ramses::internal{
         MOCK_METHOD(void, unloadBlitPassRenderTargets, (BlitPassHandle, SceneId), (override));
         MOCK_METHOD(void, uploadDataBuffer, (DataBufferHandle dataBufferHandle, EDataBufferType dataBufferType, EDataType dataType, uint32_t elementCount, SceneId sceneId), (override));
         MOCK_METHOD(void, unloadDataBuffer, (DataBufferHandle dataBufferHandle, SceneId sceneId), (override));
-        MOCK_METHOD(void, updateDataBuffer, (DataBufferHandle handle, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId), (override));
+        MOCK_METHOD(void, updateDataBuffer, (DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId), (override));
 
         MOCK_METHOD(void, uploadTextureBuffer, (TextureBufferHandle textureBufferHandle, uint32_t width, uint32_t height, EPixelStorageFormat textureFormat, uint32_t mipLevelCount, SceneId sceneId), (override));
         MOCK_METHOD(void, unloadTextureBuffer, (TextureBufferHandle textureBufferHandle, SceneId sceneId), (override));
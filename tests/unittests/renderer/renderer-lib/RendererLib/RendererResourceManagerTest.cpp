@@ -20,6 +20,7 @@
 #include "internal/Watchdog/ThreadAliveNotifierMock.h"
 #include "internal/RendererLib/DisplayConfig.h"
 #include "internal/Core/Utils/ThreadLocalLog.h"
+#include <array>
 
 namespace ramses::internal {
     using namespace testing;
@@ -48,7 +49,7 @@ namespace ramses::internal {
             // no actual unload expected but clears internal lists
             resourceManager.unloadAllSceneResourcesForScene(fakeSceneId);
 
-            EXPECT_CALL(platform, destroyResourceUploadRenderBackend());
+            EXPECT_CALL(platform, destroyResourceUploadRenderBackend(_));
             asyncEffectUploader.destroyResourceUploadRenderBackendAndStopThread();
         }
 
@@ -375,15 +376,27 @@ namespace ramses::internal {
         const DataBufferHandle dataBuffer(1u);
         const EDataBufferType dataBufferType = EDataBufferType::IndexBuffer;
         const EDataType dataType = EDataType::UInt32;
-        const uint32_t sizeInBytes = 1024u;
+        constexpr uint32_t sizeInBytes = 1024u;
         EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateIndexBuffer(dataType, sizeInBytes));
         resourceManager.uploadDataBuffer(dataBuffer, dataBufferType, dataType, sizeInBytes, fakeSceneId);
 
         EXPECT_EQ(DeviceMock::FakeIndexBufferDeviceHandle, resourceManager.getDataBufferDeviceHandle(dataBuffer, fakeSceneId));
 
-        const std::byte dummyData[10] = {};
-        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadIndexBufferData(DeviceMock::FakeIndexBufferDeviceHandle, dummyData, 7u));
-        resourceManager.updateDataBuffer(dataBuffer, 7u, dummyData, fakeSceneId);
+        const std::array<std::byte, sizeInBytes> dummyData{};
+        // first update uploads whole buffer
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, updateIndexBufferData(DeviceMock::FakeIndexBufferDeviceHandle, 0u, dummyData.data(), sizeInBytes));
+        resourceManager.updateDataBuffer(dataBuffer, 10u, 7u, dummyData.data(), fakeSceneId);
+
+        // small update uploads only modified range
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, updateIndexBufferData(DeviceMock::FakeIndexBufferDeviceHandle, 10u, dummyData.data() + 10u, 7u));
+        resourceManager.updateDataBuffer(dataBuffer, 10u, 7u, dummyData.data(), fakeSceneId);
+
+        // large update re-specifies whole buffer
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, updateIndexBufferData(DeviceMock::FakeIndexBufferDeviceHandle, 0u, dummyData.data(), sizeInBytes));
+        resourceManager.updateDataBuffer(dataBuffer, 100u, 600u, dummyData.data(), fakeSceneId);
+
+        // nothing to upload for empty range
+        resourceManager.updateDataBuffer(dataBuffer, 0u, 0u, dummyData.data(), fakeSceneId);
 
         EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteIndexBuffer(DeviceMock::FakeIndexBufferDeviceHandle));
         resourceManager.unloadDataBuffer(dataBuffer, fakeSceneId);
@@ -394,15 +407,27 @@ namespace ramses::internal {
         const DataBufferHandle dataBuffer(1u);
         const EDataBufferType dataBufferType = EDataBufferType::VertexBuffer;
         const EDataType dataType = EDataType::UInt32;
-        const uint32_t sizeInBytes = 1024u;
+        constexpr uint32_t sizeInBytes = 1024u;
         EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateVertexBuffer(sizeInBytes));
         resourceManager.uploadDataBuffer(dataBuffer, dataBufferType, dataType, sizeInBytes, fakeSceneId);
 
         EXPECT_EQ(DeviceMock::FakeVertexBufferDeviceHandle, resourceManager.getDataBufferDeviceHandle(dataBuffer, fakeSceneId));
 
-        const std::byte dummyData[10] = {};
-        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadVertexBufferData(DeviceMock::FakeVertexBufferDeviceHandle, dummyData, 7u));
-        resourceManager.updateDataBuffer(dataBuffer, 7u, dummyData, fakeSceneId);
+        const std::array<std::byte, sizeInBytes> dummyData{};
+        // first update uploads whole buffer
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, updateVertexBufferData(DeviceMock::FakeVertexBufferDeviceHandle, 0u, dummyData.data(), sizeInBytes));
+        resourceManager.updateDataBuffer(dataBuffer, 10u, 7u, dummyData.data(), fakeSceneId);
+
+        // small update uploads only modified range
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, updateVertexBufferData(DeviceMock::FakeVertexBufferDeviceHandle, 10u, dummyData.data() + 10u, 7u));
+        resourceManager.updateDataBuffer(dataBuffer, 10u, 7u, dummyData.data(), fakeSceneId);
+
+        // large update re-specifies whole buffer
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, updateVertexBufferData(DeviceMock::FakeVertexBufferDeviceHandle, 0u, dummyData.data(), sizeInBytes));
+        resourceManager.updateDataBuffer(dataBuffer, 100u, 600u, dummyData.data(), fakeSceneId);
+
+        // nothing to upload for empty range
+        resourceManager.updateDataBuffer(dataBuffer, 0u, 0u, dummyData.data(), fakeSceneId);
 
         EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteVertexBuffer(DeviceMock::FakeVertexBufferDeviceHandle));
         resourceManager.unloadDataBuffer(dataBuffer, fakeSceneId);
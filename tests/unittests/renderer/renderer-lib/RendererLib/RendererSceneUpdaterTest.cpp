@@ -89,6 +89,82 @@ namespace ramses::internal {
         EXPECT_EQ(sizeInfo, rendererScene.getSceneSizeInformation());
     }
 
+    TEST_F(ARendererSceneUpdater, interruptsApplyingFlushToNotShownSceneIfTimeBudgetExceededAndContinuesInNextFrames)
+    {
+        createPublishAndSubscribeScene();
+        update();
+        frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::SceneActionsApply, 0u);
+
+        performFlushWithCreateNodeAction(0u, 2500u);
+        const IScene& rendererScene = rendererScenes.getScene(getSceneId());
+        update();
+        EXPECT_FALSE(lastFlushWasAppliedOnRendererScene());
+        EXPECT_TRUE(rendererScene.isNodeAllocated(NodeHandle{ 0u }));
+        EXPECT_FALSE(rendererScene.isNodeAllocated(NodeHandle{ 2499u }));
+
+        update();
+        EXPECT_FALSE(lastFlushWasAppliedOnRendererScene());
+        EXPECT_FALSE(rendererScene.isNodeAllocated(NodeHandle{ 2499u }));
+
+        update();
+        EXPECT_TRUE(lastFlushWasAppliedOnRendererScene());
+        EXPECT_TRUE(rendererScene.isNodeAllocated(NodeHandle{ 2499u }));
+    }
+
+    TEST_F(ARendererSceneUpdater, appliesAllPendingFlushesToNotShownSceneWithinOneUpdateIfNoTimeBudgetSet)
+    {
+        createPublishAndSubscribeScene();
+        update();
+
+        performFlushWithCreateNodeAction(0u, 2500u);
+        update();
+        EXPECT_TRUE(lastFlushWasAppliedOnRendererScene());
+    }
+
+    TEST_F(ARendererSceneUpdater, doesNotInterruptApplyingFlushToShownScene)
+    {
+        createDisplayAndExpectSuccess();
+        createPublishAndSubscribeScene();
+        mapScene();
+        showScene();
+        update();
+        frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::SceneActionsApply, 0u);
+
+        performFlushWithCreateNodeAction(0u, 2500u);
+        update();
+        EXPECT_TRUE(lastFlushWasAppliedOnRendererScene());
+
+        hideScene();
+        unmapScene();
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, showsSceneOnlyAfterInterruptedFlushFullyApplied)
+    {
+        createDisplayAndExpectSuccess();
+        createPublishAndSubscribeScene();
+        mapScene();
+        update();
+        frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::SceneActionsApply, 0u);
+
+        performFlushWithCreateNodeAction(0u, 2500u);
+        rendererSceneUpdater->handleSceneShowRequest(getSceneId());
+        update();
+        EXPECT_FALSE(lastFlushWasAppliedOnRendererScene());
+        EXPECT_EQ(ESceneState::RenderRequested, sceneStateExecutor.getSceneState(getSceneId()));
+        update();
+        EXPECT_EQ(ESceneState::RenderRequested, sceneStateExecutor.getSceneState(getSceneId()));
+
+        update();
+        EXPECT_TRUE(lastFlushWasAppliedOnRendererScene());
+        EXPECT_EQ(ESceneState::Rendered, sceneStateExecutor.getSceneState(getSceneId()));
+        expectInternalSceneStateEvent(ERendererEventType::SceneShown);
+
+        hideScene();
+        unmapScene();
+        destroyDisplay();
+    }
+
     TEST_F(ARendererSceneUpdater, ignoresSceneActionsForNotSubscribedScene)
     {
         createStagingScene();
@@ -253,7 +329,7 @@ namespace ramses::internal {
         createPublishAndSubscribeScene();
         mapScene();
 
-        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend());
+        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend(_));
         expectUnloadOfSceneResources();
         destroySceneUpdater();
 
@@ -266,7 +342,7 @@ namespace ramses::internal {
         createPublishAndSubscribeScene();
         mapScene();
 
-        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend());
+        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend(_));
         expectUnloadOfSceneResources();
         destroySceneUpdater();
 
@@ -2167,9 +2243,9 @@ namespace ramses::internal {
         destroyDisplay();
     }
 
-    TEST_F(ARendererSceneUpdater, MarkSceneAsModified_DataLinking_IndirectlyDependantConsumersIfProviderUpdated)
+    TEST_F(ARendererSceneUpdater, DoesNotMarkSceneAsModified_DataLinking_IndirectlyDependantConsumersIfNoLinkedValueChanged)
     {
-        // s0 [modified] -> s1 [modified] -> s2 [modified]
+        // s0 [modified] -> s1 [modified] -> s2
         createDisplayAndExpectSuccess();
 
         createPublishAndSubscribeScene();
@@ -2202,7 +2278,7 @@ namespace ramses::internal {
 
         updateProviderDataSlot(0u, providerDataRef, 1.0f);
         performFlush();
-        expectModifiedScenesReportedToRenderer({0u, 1u, 2u});
+        expectModifiedScenesReportedToRenderer({0u, 1u}); // provider of s2 did not change
         update();
 
         expectNoModifiedScenesReportedToRenderer();
@@ -2320,7 +2396,7 @@ namespace ramses::internal {
 
     TEST_F(ARendererSceneUpdater, MarkSceneAsModified_DataLinking_ConfidenceTest)
     {
-        // s0 -> s1 [modified] -> s2 [modified] -> s3 [modified]
+        // s0 -> s1 [modified] -> s2 [modified] -> s3
         createDisplayAndExpectSuccess();
 
         createPublishAndSubscribeScene();
@@ -2361,7 +2437,7 @@ namespace ramses::internal {
 
         updateProviderDataSlot(1u, providerDataRef, 1.0f);
         performFlush(1u);
-        expectModifiedScenesReportedToRenderer({1u, 2u, 3u});
+        expectModifiedScenesReportedToRenderer({1u, 2u});
         update();
 
         expectNoModifiedScenesReportedToRenderer();
@@ -5064,7 +5140,7 @@ namespace ramses::internal {
         performFlush();
 
         EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, uploadDataBuffer(_, _, _, _, _));
-        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, updateDataBuffer(_, _, _, _));
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, updateDataBuffer(_, _, _, _, _));
         update();
 
         EXPECT_CALL(*rendererSceneUpdater, handlePickEvent(_, _));
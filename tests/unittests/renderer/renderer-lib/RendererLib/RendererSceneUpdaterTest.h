@@ -443,7 +443,7 @@ namespace ramses::internal {
             {
                 ASSERT_TRUE(rendererSceneUpdater->m_resourceManagerMock != nullptr);
                 EXPECT_TRUE(rendererSceneUpdater->hasResourceManager());
-                EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend());
+                EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend(_));
                 EXPECT_CALL(renderer.m_platform, destroyRenderBackend());
                 rendererSceneUpdater->m_resourceManagerMock->expectNoResourceReferences();
             }
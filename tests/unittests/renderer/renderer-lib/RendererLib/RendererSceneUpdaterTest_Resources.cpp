@@ -359,7 +359,7 @@ namespace ramses::internal {
         setRenderableResources();
         update();
 
-        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend());
+        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend(_));
         expectUnloadOfSceneResources();
         destroySceneUpdater();
     }
@@ -566,7 +566,7 @@ namespace ramses::internal {
         EXPECT_EQ(version2.getValue(), events[1].sceneVersionTag.getValue());
         EXPECT_EQ(version3.getValue(), events[2].sceneVersionTag.getValue());
 
-        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend());
+        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend(_));
         expectUnloadOfSceneResources();
         destroySceneUpdater();
     }
@@ -667,7 +667,7 @@ namespace ramses::internal {
         EXPECT_EQ(version2.getValue(), events[1].sceneVersionTag.getValue());
         EXPECT_EQ(version3.getValue(), events[2].sceneVersionTag.getValue());
 
-        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend());
+        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend(_));
         expectUnloadOfSceneResources();
         destroySceneUpdater();
     }
@@ -878,7 +878,7 @@ namespace ramses::internal {
         mapScene();
         EXPECT_TRUE(lastFlushWasAppliedOnRendererScene());
 
-        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend());
+        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend(_));
         expectUnloadOfSceneResources();
         destroySceneUpdater();
     }
@@ -906,7 +906,7 @@ namespace ramses::internal {
         mapScene();
         EXPECT_TRUE(lastFlushWasAppliedOnRendererScene());
 
-        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend());
+        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend(_));
         expectUnloadOfSceneResources();
         destroySceneUpdater();
     }
@@ -935,7 +935,7 @@ namespace ramses::internal {
         mapScene();
         EXPECT_TRUE(lastFlushWasAppliedOnRendererScene());
 
-        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend());
+        EXPECT_CALL(renderer.m_platform, destroyResourceUploadRenderBackend(_));
         expectUnloadOfSceneResources();
         destroySceneUpdater();
     }
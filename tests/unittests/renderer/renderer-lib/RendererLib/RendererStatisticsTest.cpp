@@ -49,6 +49,85 @@ namespace ramses::internal
         EXPECT_EQ(3u, stats.getDrawCallsPerFrame());
     }
 
+    TEST_F(ARendererStatistics, tracksDeviceStateChangesPerFrameUntilReset)
+    {
+        stats.deviceStateChanges(10u, 30u);
+        stats.frameFinished(0u);
+        stats.deviceStateChanges(6u, 50u);
+        stats.frameFinished(0u);
+        EXPECT_EQ(8u, stats.getStateChangesIssuedPerFrame());
+        EXPECT_EQ(40u, stats.getStateChangesSkippedPerFrame());
+
+        EXPECT_THAT(logOutput(), HasSubstr(", stateChangesPerFrame issued/skipped 8/40"));
+
+        stats.reset();
+        EXPECT_EQ(0u, stats.getStateChangesIssuedPerFrame());
+        EXPECT_EQ(0u, stats.getStateChangesSkippedPerFrame());
+    }
+
+    TEST_F(ARendererStatistics, tracksFrameDurationPercentilesUntilReset)
+    {
+        stats.frameFinished(0u);
+        EXPECT_EQ(0u, stats.getFrameDurationPercentiles().count);
+        stats.frameFinished(0u);
+        stats.frameFinished(0u);
+
+        const auto percentiles = stats.getFrameDurationPercentiles();
+        EXPECT_EQ(2u, percentiles.count);
+        EXPECT_LE(percentiles.p50, percentiles.p90);
+        EXPECT_LE(percentiles.p90, percentiles.p99);
+        EXPECT_LE(percentiles.p99, percentiles.max);
+        EXPECT_THAT(logOutput(), HasSubstr(", frameTime p50/p90/p99/max ("));
+
+        stats.reset();
+        EXPECT_EQ(0u, stats.getFrameDurationPercentiles().count);
+        EXPECT_THAT(logOutput(), Not(HasSubstr("frameTime p50")));
+    }
+
+    TEST_F(ARendererStatistics, tracksFramePacingJitterUntilReset)
+    {
+        stats.frameFinished(0u);
+        stats.framePacingJitter(std::chrono::microseconds{ 10 });
+        stats.framePacingJitter(std::chrono::microseconds{ 30 });
+        stats.framePacingJitter(std::chrono::microseconds{ 1000 });
+
+        const auto percentiles = stats.getFramePacingJitterPercentiles();
+        EXPECT_EQ(3u, percentiles.count);
+        EXPECT_EQ(30u, percentiles.p50);
+        EXPECT_EQ(1000u, percentiles.max);
+        EXPECT_THAT(logOutput(), HasSubstr(", pacingJitter p50/p90/p99/max (30/"));
+
+        stats.reset();
+        EXPECT_EQ(0u, stats.getFramePacingJitterPercentiles().count);
+        EXPECT_THAT(logOutput(), Not(HasSubstr("pacingJitter")));
+    }
+
+    TEST_F(ARendererStatistics, tracksFlushToRenderLatencyOfAppliedFlushesWhenSceneRendered)
+    {
+        const auto now = FlushTime::Clock::now();
+        stats.flushApplied(sceneId1, now - std::chrono::milliseconds{ 100 });
+        stats.flushApplied(sceneId1, now - std::chrono::milliseconds{ 200 });
+        stats.flushApplied(sceneId1);
+        EXPECT_EQ(0u, stats.getFlushToRenderLatencyPercentiles(sceneId1).count);
+
+        stats.sceneRendered(sceneId1);
+        auto percentiles = stats.getFlushToRenderLatencyPercentiles(sceneId1);
+        EXPECT_EQ(2u, percentiles.count);
+        EXPECT_GE(percentiles.p50, 100u);
+        EXPECT_GE(percentiles.max, 200u);
+
+        // flushes are accounted only once
+        stats.sceneRendered(sceneId1);
+        EXPECT_EQ(2u, stats.getFlushToRenderLatencyPercentiles(sceneId1).count);
+        EXPECT_EQ(0u, stats.getFlushToRenderLatencyPercentiles(sceneId2).count);
+
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), HasSubstr(", F2R p50/p90/p99/max ("));
+
+        stats.reset();
+        EXPECT_EQ(0u, stats.getFlushToRenderLatencyPercentiles(sceneId1).count);
+    }
+
     TEST_F(ARendererStatistics, tracksFrameCount)
     {
         stats.frameFinished(0u);
@@ -148,6 +227,21 @@ namespace ramses::internal
         EXPECT_THAT(logOutput(), HasSubstr("framesFBlocked 2"));
     }
 
+    TEST_F(ARendererStatistics, tracksInterruptedFlushApplications)
+    {
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), Not(HasSubstr("FInterrupted")));
+
+        stats.flushApplicationInterrupted(sceneId1);
+        stats.frameFinished(0u);
+        stats.flushApplicationInterrupted(sceneId1);
+        EXPECT_THAT(logOutput(), HasSubstr("FInterrupted 2"));
+
+        stats.reset();
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), Not(HasSubstr("FInterrupted")));
+    }
+
     TEST_F(ARendererStatistics, tracksMaximumConsecutiveFramesWhereSceneFlushNotApplied)
     {
         stats.flushApplied(sceneId1);
@@ -232,23 +326,23 @@ namespace ramses::internal
     TEST_F(ARendererStatistics, tracksStreamTextureSource)
     {
         const WaylandIviSurfaceId src{ 99u };
-        stats.streamTextureUpdated(src, 2u);
+        stats.streamTextureUpdated(src, 2u, 800u);
         stats.frameFinished(0u);
         stats.frameFinished(0u);
         stats.frameFinished(0u);
-        stats.streamTextureUpdated(src, 9u);
+        stats.streamTextureUpdated(src, 9u, 100u);
         stats.frameFinished(0u);
-        stats.streamTextureUpdated(src, 1u);
+        stats.streamTextureUpdated(src, 1u, 300u);
         stats.frameFinished(0u);
 
         EXPECT_THAT(logOutput(), HasSubstr("numFrames 5"));
-        EXPECT_THAT(logOutput(), HasSubstr("SourceId ivi-surface:99: upd 12, framesUpd 3, maxUpdInFrame 9, maxFramesWithNoUpd 2"));
+        EXPECT_THAT(logOutput(), HasSubstr("SourceId ivi-surface:99: upd 12, framesUpd 3, maxUpdInFrame 9, maxFramesWithNoUpd 2, bytesUpl 1200 (100/commit)"));
 }
 
     TEST_F(ARendererStatistics, logsValidNumbersWhenStreamTextureInactive)
     {
         const WaylandIviSurfaceId src{ 99u };
-        stats.streamTextureUpdated(src, 2u); // will register source
+        stats.streamTextureUpdated(src, 2u, 0u); // will register source
         stats.reset();
         stats.frameFinished(0u);
         stats.frameFinished(0u);
@@ -260,7 +354,7 @@ namespace ramses::internal
     TEST_F(ARendererStatistics, untracksStreamTextureSource)
     {
         const WaylandIviSurfaceId src{ 99u };
-        stats.streamTextureUpdated(src, 2u);
+        stats.streamTextureUpdated(src, 2u, 0u);
         stats.frameFinished(0u);
 
         stats.untrackStreamTexture(src);
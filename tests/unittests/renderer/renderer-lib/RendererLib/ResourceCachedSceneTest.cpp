@@ -1238,4 +1238,65 @@ namespace ramses::internal
         EXPECT_TRUE(scene.hasDirtyVertexArrays());
         EXPECT_TRUE(scene.getVertexArraysDirtinessFlags()[renderable.asMemoryHandle()]);
     }
+
+    TEST_F(AResourceCachedScene, compilesDrawPacketWhenRenderableResourcesGetClean)
+    {
+        const RenderableHandle renderable = sceneHelper.createRenderable();
+        sceneHelper.createAndAssignUniformDataInstance(renderable, sceneHelper.createTextureSamplerWithFakeTexture());
+        sceneHelper.createAndAssignVertexDataInstance(renderable);
+        sceneHelper.setResourcesToRenderable(renderable);
+        scene.setRenderableIndexCount(renderable, 6u);
+        updateRenderableResourcesAndVertexArray({ renderable });
+        expectRenderableResourcesClean(renderable);
+
+        const DrawPacket& drawPacket = scene.getDrawPacket(renderable);
+        EXPECT_EQ(DeviceMock::FakeShaderDeviceHandle, drawPacket.effectDeviceHandle);
+        EXPECT_EQ(vertexArrayDeviceHandle, drawPacket.vertexArray.deviceHandle);
+        EXPECT_TRUE(drawPacket.vertexArray.usesIndexArray);
+        EXPECT_EQ(6u, drawPacket.indexCount);
+
+        ASSERT_EQ(2u, drawPacket.uniformsCount);
+        const DrawPacketUniform* uniforms = scene.getDrawPacketUniforms(drawPacket);
+        EXPECT_EQ(EDataType::Float, uniforms[sceneHelper.dataField.asMemoryHandle()].dataType);
+        EXPECT_EQ(EDataType::TextureSampler2D, uniforms[sceneHelper.samplerField.asMemoryHandle()].dataType);
+        EXPECT_EQ(DeviceMock::FakeTextureDeviceHandle, uniforms[sceneHelper.samplerField.asMemoryHandle()].textureDeviceHandle);
+
+        // draw parameters are updated in place without making renderable dirty
+        scene.setRenderableIndexCount(renderable, 9u);
+        scene.setRenderableInstanceCount(renderable, 2u);
+        expectRenderableResourcesClean(renderable);
+        EXPECT_EQ(9u, scene.getDrawPacket(renderable).indexCount);
+        EXPECT_EQ(2u, scene.getDrawPacket(renderable).instanceCount);
+    }
+
+    TEST_F(AResourceCachedScene, recompilesDrawPacketWithResolvedDataReferenceWhenReferenceChanges)
+    {
+        const DataLayoutHandle uniformLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{ EDataType::DataReference }, DataFieldInfo{ EDataType::TextureSampler2D } }, MockResourceHash::EffectHash);
+        const DataInstanceHandle floatRef = sceneAllocator.allocateDataInstance(sceneAllocator.allocateDataLayout({ DataFieldInfo{ EDataType::Float } }, ResourceContentHash::Invalid()));
+        const DataInstanceHandle vec2Ref = sceneAllocator.allocateDataInstance(sceneAllocator.allocateDataLayout({ DataFieldInfo{ EDataType::Vector2F } }, ResourceContentHash::Invalid()));
+
+        const RenderableHandle renderable = sceneHelper.createRenderable();
+        const DataInstanceHandle uniformData = sceneAllocator.allocateDataInstance(uniformLayout);
+        scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, uniformData);
+        scene.setDataTextureSamplerHandle(uniformData, DataFieldHandle{ 1u }, sceneHelper.createTextureSamplerWithFakeTexture());
+        scene.setDataReference(uniformData, DataFieldHandle{ 0u }, floatRef);
+        sceneHelper.createAndAssignVertexDataInstance(renderable);
+        sceneHelper.setResourcesToRenderable(renderable);
+        updateRenderableResourcesAndVertexArray({ renderable });
+        ASSERT_FALSE(scene.renderableResourcesDirty(renderable));
+
+        const DrawPacketUniform* uniforms = scene.getDrawPacketUniforms(scene.getDrawPacket(renderable));
+        EXPECT_EQ(EDataType::Float, uniforms[0].dataType);
+        EXPECT_EQ(floatRef, uniforms[0].dataInstance);
+        EXPECT_EQ(DataFieldHandle{ 0u }, uniforms[0].dataInstanceField);
+        EXPECT_EQ(DataFieldHandle{ 0u }, uniforms[0].uniformInputField);
+
+        scene.setDataReference(uniformData, DataFieldHandle{ 0u }, vec2Ref);
+        updateRenderableResources();
+        ASSERT_FALSE(scene.renderableResourcesDirty(renderable));
+
+        uniforms = scene.getDrawPacketUniforms(scene.getDrawPacket(renderable));
+        EXPECT_EQ(EDataType::Vector2F, uniforms[0].dataType);
+        EXPECT_EQ(vec2Ref, uniforms[0].dataInstance);
+    }
 }
@@ -21,6 +21,7 @@ namespace ramses::internal
         MOCK_METHOD(std::optional<DeviceResourceHandle> , uploadResource, (IRenderBackend&, const ResourceDescriptor&, uint32_t&), (override));
         MOCK_METHOD(void, unloadResource, (IRenderBackend&, EResourceType, ResourceContentHash, DeviceResourceHandle), (override));
         MOCK_METHOD(void, storeShaderInBinaryShaderCache, (IRenderBackend&, DeviceResourceHandle, const ResourceContentHash&, SceneId), (override));
+        MOCK_METHOD(bool, hasShaderInBinaryShaderCache, (IRenderBackend&, const ResourceContentHash&), (override));
 
         static const DeviceResourceHandle FakeResourceDeviceHandle;
     };
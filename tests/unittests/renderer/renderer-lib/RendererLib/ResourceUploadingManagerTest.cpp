@@ -69,7 +69,7 @@ namespace ramses::internal
 
         ~AResourceUploadingManager() override
         {
-            EXPECT_CALL(platformMock, destroyResourceUploadRenderBackend());
+            EXPECT_CALL(platformMock, destroyResourceUploadRenderBackend(_));
             asyncEffectUploader.destroyResourceUploadRenderBackendAndStopThread();
         }
 
@@ -318,6 +318,48 @@ namespace ramses::internal
         makeResourceUnused(resHash);
     }
 
+    TEST_F(AResourceUploadingManager, prewarmsOnlyEffectsNotInBinaryShaderCacheAndUsesPrewarmedEffectWhenUploading)
+    {
+        const EffectResource effectToPrewarm("prewarm", "", "", {}, EffectInputInformationVector(), EffectInputInformationVector(), "");
+        const EffectResource effectInCache("cached", "", "", {}, EffectInputInformationVector(), EffectInputInformationVector(), "");
+        const ResourceContentHash hash = effectToPrewarm.getHash();
+
+        EXPECT_CALL(*uploader, hasShaderInBinaryShaderCache(Ref(platformMock.renderBackendMock), hash)).WillOnce(Return(false));
+        EXPECT_CALL(*uploader, hasShaderInBinaryShaderCache(Ref(platformMock.renderBackendMock), effectInCache.getHash())).WillOnce(Return(true));
+        std::promise<void> barrierEffectPrewarmed;
+        EXPECT_CALL(platformMock.resourceUploadRenderBackendMock.deviceMock, uploadShader(Ref(effectToPrewarm))).WillOnce(Invoke([&](const auto& /*unused*/) {
+            barrierEffectPrewarmed.set_value();
+            return std::make_unique<const GPUResource>(1u, 2u);
+            }));
+        expectDeviceFlushOnWindows();
+        rendererResourceUploader.prewarmEffects({
+            ManagedResource{ &dummyResource, dummyManagedResourceCallback },
+            ManagedResource{ &effectToPrewarm, dummyManagedResourceCallback },
+            ManagedResource{ &effectInCache, dummyManagedResourceCallback } });
+        barrierEffectPrewarmed.get_future().get();
+
+        // effect is not uploaded again when scene gets mapped and requests it
+        registerAndProvideResource(hash, true, &effectToPrewarm);
+        const std::optional<DeviceResourceHandle> unsetDeviceHandle;
+        EXPECT_CALL(*uploader, uploadResource(_, _, _)).WillOnce(Return(unsetDeviceHandle));
+        EXPECT_CALL(platformMock.renderBackendMock.deviceMock, registerShader(_));
+        EXPECT_CALL(*uploader, storeShaderInBinaryShaderCache(Ref(platformMock.renderBackendMock), DeviceMock::FakeShaderDeviceHandle, hash, sceneId));
+
+        constexpr std::chrono::seconds timeoutTime{ 2u };
+        const auto startTime = std::chrono::steady_clock::now();
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+        while (resourceRegistry.getResourceStatus(hash) == EResourceStatus::ScheduledForUpload
+            && std::chrono::steady_clock::now() - startTime < timeoutTime)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{ 5u });
+            rendererResourceUploader.uploadAndUnloadPendingResources();
+        }
+        expectResourceUploaded(hash, DeviceMock::FakeShaderDeviceHandle);
+
+        EXPECT_CALL(*uploader, unloadResource(_, _, _, _));
+        makeResourceUnused(hash);
+    }
+
     TEST_F(AResourceUploadingManager, uploadsAllProvidedResourcesInOneUpdate_defaultUploadStrategy)
     {
         const ResourceContentHash res1(1234u, 0u);
@@ -0,0 +1,84 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/SharedResourcePool.h"
+#include "internal/SceneGraph/Resource/ArrayResource.h"
+#include "gtest/gtest.h"
+#include <array>
+
+namespace ramses::internal
+{
+    class ASharedResourcePool : public ::testing::Test
+    {
+    public:
+        static ManagedResource CreateResource(float value)
+        {
+            const std::array<float, 3> data{ value, value, value };
+            return std::make_shared<const ArrayResource>(EResourceType::VertexArray, 1u, EDataType::Vector3F, data.data(), "res");
+        }
+
+        SharedResourcePool pool;
+    };
+
+    TEST_F(ASharedResourcePool, returnsSameResourceIfNotSharedBefore)
+    {
+        const auto res = CreateResource(1.f);
+        EXPECT_EQ(res, pool.share(res));
+        EXPECT_EQ(1u, pool.getNumberOfSharedResources());
+        EXPECT_EQ(0u, pool.getNumberOfDeduplicatedResources());
+    }
+
+    TEST_F(ASharedResourcePool, returnsAlreadySharedInstanceForResourceWithSameContent)
+    {
+        const auto res1 = CreateResource(1.f);
+        const auto res2 = CreateResource(1.f);
+        ASSERT_NE(res1, res2);
+        ASSERT_EQ(res1->getHash(), res2->getHash());
+
+        EXPECT_EQ(res1, pool.share(res1));
+        EXPECT_EQ(res1, pool.share(res2));
+        EXPECT_EQ(res1, pool.share(res1));
+        EXPECT_EQ(1u, pool.getNumberOfSharedResources());
+        EXPECT_EQ(1u, pool.getNumberOfDeduplicatedResources());
+    }
+
+    TEST_F(ASharedResourcePool, keepsResourcesWithDifferentContentSeparate)
+    {
+        const auto res1 = CreateResource(1.f);
+        const auto res2 = CreateResource(2.f);
+        EXPECT_EQ(res1, pool.share(res1));
+        EXPECT_EQ(res2, pool.share(res2));
+        EXPECT_EQ(2u, pool.getNumberOfSharedResources());
+    }
+
+    TEST_F(ASharedResourcePool, replacesResourcesInVector)
+    {
+        const auto res1 = CreateResource(1.f);
+        ManagedResourceVector resources{ CreateResource(1.f), CreateResource(2.f), ManagedResource{} };
+        pool.share(res1);
+        pool.share(resources);
+        EXPECT_EQ(res1, resources[0]);
+        EXPECT_NE(nullptr, resources[1]);
+        EXPECT_EQ(nullptr, resources[2]);
+        EXPECT_EQ(2u, pool.getNumberOfSharedResources());
+    }
+
+    TEST_F(ASharedResourcePool, doesNotKeepResourcesAlive)
+    {
+        auto res = CreateResource(1.f);
+        const std::weak_ptr<const IResource> weakRes = res;
+        pool.share(res);
+        res.reset();
+        EXPECT_TRUE(weakRes.expired());
+        EXPECT_EQ(0u, pool.getNumberOfSharedResources());
+
+        // new instance with same content is not replaced by released one
+        const auto newRes = CreateResource(1.f);
+        EXPECT_EQ(newRes, pool.share(newRes));
+    }
+}
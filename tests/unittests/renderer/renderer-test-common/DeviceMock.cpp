@@ -43,6 +43,7 @@ namespace ramses::internal
 
         EXPECT_CALL(*this, getFramebufferRenderTarget()).Times(AnyNumber());
         EXPECT_CALL(*this, getTextureAddress(_)).Times(AnyNumber());
+        EXPECT_CALL(*this, invalidateStateCache()).Times(AnyNumber());
 
         // fake uploads
         ON_CALL(*this, allocateVertexBuffer(_)).WillByDefault(Return(FakeVertexBufferDeviceHandle));
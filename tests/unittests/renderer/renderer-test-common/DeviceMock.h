@@ -59,12 +59,14 @@ namespace ramses::internal
 
         MOCK_METHOD(DeviceResourceHandle, allocateVertexBuffer, (uint32_t), (override));
         MOCK_METHOD(void, uploadVertexBufferData, (DeviceResourceHandle, const std::byte*, uint32_t), (override));
+        MOCK_METHOD(void, updateVertexBufferData, (DeviceResourceHandle, uint32_t, const std::byte*, uint32_t), (override));
         MOCK_METHOD(void, deleteVertexBuffer, (DeviceResourceHandle), (override));
         MOCK_METHOD(DeviceResourceHandle, allocateVertexArray, (const VertexArrayInfo&), (override));
         MOCK_METHOD(void, activateVertexArray, (DeviceResourceHandle handle), (override));
         MOCK_METHOD(void, deleteVertexArray, (DeviceResourceHandle handle), (override));
         MOCK_METHOD(DeviceResourceHandle, allocateIndexBuffer, (EDataType, uint32_t), (override));
         MOCK_METHOD(void, uploadIndexBufferData, (DeviceResourceHandle, const std::byte*, uint32_t), (override));
+        MOCK_METHOD(void, updateIndexBufferData, (DeviceResourceHandle, uint32_t, const std::byte*, uint32_t), (override));
         MOCK_METHOD(void, deleteIndexBuffer, (DeviceResourceHandle), (override));
 
         MOCK_METHOD(std::unique_ptr<const GPUResource>, uploadShader, (const EffectResource&), (override));
@@ -83,6 +85,7 @@ namespace ramses::internal
         MOCK_METHOD(void, generateMipmaps, (DeviceResourceHandle handle), (override));
         MOCK_METHOD(void, uploadTextureData, (DeviceResourceHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t z, uint32_t width, uint32_t height, uint32_t depth, const std::byte* data, uint32_t dataSize, uint32_t stride), (override));
         MOCK_METHOD(DeviceResourceHandle, uploadStreamTexture2D, (DeviceResourceHandle handle, uint32_t width, uint32_t height, EPixelStorageFormat format, const std::byte* data, const TextureSwizzleArray& swizzle), (override));
+        MOCK_METHOD(void, updateStreamTexture2D, (DeviceResourceHandle handle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t stride, EPixelStorageFormat format, const std::byte* data), (override));
         MOCK_METHOD(void, deleteTexture, (DeviceResourceHandle), (override));
         MOCK_METHOD(void, activateTexture, (DeviceResourceHandle, DataFieldHandle), (override));
         MOCK_METHOD(DeviceResourceHandle, uploadRenderBuffer, (uint32_t, uint32_t, EPixelStorageFormat, ERenderBufferAccessMode, uint32_t), (override));
@@ -107,6 +110,8 @@ namespace ramses::internal
 
         MOCK_METHOD(uint32_t, getTotalGpuMemoryUsageInKB, (), (const, override));
         MOCK_METHOD(uint32_t, getAndResetDrawCallCount, (), (override));
+        MOCK_METHOD(DeviceStateChangeCounts, getAndResetStateChangeCounts, (), (override));
+        MOCK_METHOD(void, invalidateStateCache, (), (override));
 
         MOCK_METHOD(void, validateDeviceStatusHealthy, (), (const, override));
         MOCK_METHOD(bool, isDeviceStatusHealthy, (), (const, override));
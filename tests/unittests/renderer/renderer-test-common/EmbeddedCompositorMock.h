@@ -26,7 +26,7 @@ namespace ramses::internal
         MOCK_METHOD(WaylandIviSurfaceIdSet, dispatchNewStreamTextureSourceIds, (), (override));
         MOCK_METHOD(WaylandIviSurfaceIdSet, dispatchObsoleteStreamTextureSourceIds, (), (override));
         MOCK_METHOD(void, endFrame, (bool), (override));
-        MOCK_METHOD(uint32_t, uploadCompositingContentForStreamTexture, (WaylandIviSurfaceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter&), (override));
+        MOCK_METHOD(StreamTextureUploadResult, uploadCompositingContentForStreamTexture, (WaylandIviSurfaceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter&, bool fullUpload), (override));
         MOCK_METHOD(bool , isContentAvailableForStreamTexture, (WaylandIviSurfaceId), (const, override));
         MOCK_METHOD(uint64_t, getNumberOfCommitedFramesForWaylandIviSurfaceSinceBeginningOfTime, (WaylandIviSurfaceId), (const, override));
         MOCK_METHOD(bool, isBufferAttachedToWaylandIviSurface, (WaylandIviSurfaceId), (const, override));
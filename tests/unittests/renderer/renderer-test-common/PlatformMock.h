@@ -27,7 +27,7 @@ namespace ramses::internal
         MOCK_METHOD(IRenderBackend*, createRenderBackend, (const DisplayConfig& displayConfig, IWindowEventHandler& windowEventHandler), (override));
         MOCK_METHOD(void, destroyRenderBackend, (), (override));
         MOCK_METHOD(IResourceUploadRenderBackend*, createResourceUploadRenderBackend, (), (override));
-        MOCK_METHOD(void, destroyResourceUploadRenderBackend, (), (override));
+        MOCK_METHOD(void, destroyResourceUploadRenderBackend, (IResourceUploadRenderBackend&), (override));
         MOCK_METHOD(ISystemCompositorController*, getSystemCompositorController, (), (override));
 
         MOCK_TYPE<RenderBackendMock<MOCK_TYPE>>     renderBackendMock;
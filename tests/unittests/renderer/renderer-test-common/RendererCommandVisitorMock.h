@@ -209,7 +209,7 @@ namespace ramses::internal
 
         void operator()(const RendererCommand::SetLimits_FrameBudgets& cmd)
         {
-            setLimitsFrameBudgets(cmd.limitForSceneResourcesUploadMicrosec, cmd.limitForResourcesUploadMicrosec, cmd.limitForOffscreenBufferRenderMicrosec);
+            setLimitsFrameBudgets(cmd.limitForSceneResourcesUploadMicrosec, cmd.limitForResourcesUploadMicrosec, cmd.limitForOffscreenBufferRenderMicrosec, cmd.limitForSceneActionsApplyMicrosec);
         }
 
         void operator()(const RendererCommand::SetSkippingOfUnmodifiedBuffers& cmd)
@@ -264,7 +264,7 @@ namespace ramses::internal
         MOCK_METHOD(void, systemCompositorSetIviSurfaceDestRectangle, (WaylandIviSurfaceId, int32_t, int32_t, int32_t, int32_t));
         MOCK_METHOD(void, systemCompositorScreenshot, (std::string_view, int32_t));
         MOCK_METHOD(void, logInfo, (ERendererLogTopic, bool, NodeHandle));
-        MOCK_METHOD(void, setLimitsFrameBudgets, (uint64_t, uint64_t, uint64_t));
+        MOCK_METHOD(void, setLimitsFrameBudgets, (uint64_t, uint64_t, uint64_t, uint64_t));
         MOCK_METHOD(void, setSkippingOfUnmodifiedBuffers, (bool));
         MOCK_METHOD(void, handleConfirmationEcho, (DisplayHandle, std::string_view));
     };